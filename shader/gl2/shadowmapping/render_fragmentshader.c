@@ -18,12 +18,18 @@ uniform float diffuseTextureMaskedTransparencyThreshold;
 
 uniform vec3 lightDirection;
 
+uniform vec2 cascadeViewDepthRange;
+
 // passed from vertex shader
 varying vec2 vsFragTextureUV;
 varying vec4 vsShadowCoord;
 varying float vsShadowIntensity;
+varying float vsViewDepth;
 
 void main() {
+	// discard fragments not belonging to current shadow map cascade
+	if (vsViewDepth < cascadeViewDepthRange.x || vsViewDepth >= cascadeViewDepthRange.y) discard;
+
 	// retrieve diffuse texture color value
 	if (diffuseTextureAvailable == 1) {
 		// fetch from texture
@@ -11,6 +11,7 @@ attribute vec3 inOrigin;
 
 uniform mat4 depthBiasMVPMatrix;
 uniform mat4 mvpMatrix;
+uniform mat4 mvMatrix;
 uniform mat4 normalMatrix;
 uniform vec3 modelTranslation;
 uniform mat3 textureMatrix;
@@ -23,6 +24,7 @@ varying vec2 vsFragTextureUV;
 varying vec4 vsShadowCoord;
 varying float vsShadowIntensity;
 varying vec3 vsPosition;
+varying float vsViewDepth;
 
 {$DEFINITIONS}
 
@@ -48,6 +50,9 @@ void main() {
 	vec3 normal = normalize(vec3(normalMatrix * shaderTransformMatrix * vec4(inNormal, 0.0)));
 	vsShadowIntensity = clamp(abs(dot(normalize(lightDirection.xyz), normal)), 0.0, 1.0);
 
+	// view depth, used to clip fragments to current shadow map cascade
+	vsViewDepth = -(mvMatrix * shaderTransformMatrix * vec4(inVertex, 1.0)).z;
+
 	// compute gl position
 	gl_Position = mvpMatrix * shaderTransformMatrix * vec4(inVertex, 1.0);
 }
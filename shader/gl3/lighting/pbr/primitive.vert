@@ -43,7 +43,12 @@ out vec4 v_Color;
 #endif
 
 uniform mat4 u_ViewProjectionMatrix;
+#if defined(HAVE_INSTANCE_INDICES)
+uniform samplerBuffer instanceDataTextureUnit;
+uniform isamplerBuffer instanceIndicesTextureUnit;
+#else
 layout (location = 6) in mat4 u_ModelMatrix;
+#endif
 
 vec4 getPosition()
 {
@@ -69,6 +74,17 @@ vec4 getTangent()
 
 void main()
 {
+    #if defined(HAVE_INSTANCE_INDICES)
+    // fetch model matrix by instance index
+    int instanceDataIdx = texelFetch(instanceIndicesTextureUnit, gl_InstanceID).r * 6;
+    mat4 u_ModelMatrix = mat4(
+        texelFetch(instanceDataTextureUnit, instanceDataIdx + 0),
+        texelFetch(instanceDataTextureUnit, instanceDataIdx + 1),
+        texelFetch(instanceDataTextureUnit, instanceDataIdx + 2),
+        texelFetch(instanceDataTextureUnit, instanceDataIdx + 3)
+    );
+    #endif
+
     vec4 pos = u_ModelMatrix * getPosition();
     v_Position = vec3(pos.xyz) / pos.w;
 
@@ -212,6 +212,77 @@ vec4 fragColor;
 			computeLight(i, normal, position);
 		}
 	}
+
+	#if defined(HAVE_CLUSTERED_LIGHTING)
+		#define CLUSTERS_X	16
+		#define CLUSTERS_Y	8
+		#define CLUSTERS_Z	24
+
+		uniform int clusteredLightsEnabled;
+		uniform samplerBuffer clusteredLightsLightsTextureUnit;
+		uniform isamplerBuffer clusteredLightsClustersTextureUnit;
+		uniform isamplerBuffer clusteredLightsLightIndicesTextureUnit;
+		uniform mat4 clusteredLightsProjectionMatrixInverted;
+		uniform vec2 clusteredLightsClusterZ;
+		uniform vec2 clusteredLightsViewPortSizeInverted;
+
+		void computeClusteredLight(in int i, in vec3 normal, in vec3 position) {
+			// light data: position and range, diffuse, specular, spot direction and spot cos cut off, attenuations and spot exponent
+			vec4 lightPositionRange = texelFetch(clusteredLightsLightsTextureUnit, i * 5 + 0);
+			vec3 lightDirection = lightPositionRange.xyz - position.xyz;
+			float lightDistance = length(lightDirection);
+			if (lightPositionRange.w >= 0.0 && lightDistance > lightPositionRange.w) return;
+			vec4 lightDiffuse = texelFetch(clusteredLightsLightsTextureUnit, i * 5 + 1);
+			vec4 lightSpecular = texelFetch(clusteredLightsLightsTextureUnit, i * 5 + 2);
+			vec4 lightSpotDirectionCosCutoff = texelFetch(clusteredLightsLightsTextureUnit, i * 5 + 3);
+			vec4 lightAttenuations = texelFetch(clusteredLightsLightsTextureUnit, i * 5 + 4);
+			lightDirection = normalize(lightDirection);
+			vec3 reflectionDirection = normalize(reflect(-lightDirection, normal));
+
+			// compute attenuation
+			float lightAttenuation =
+				1.0 /
+				(
+					lightAttenuations.x +
+					lightAttenuations.y * lightDistance +
+					lightAttenuations.z * lightDistance * lightDistance
+				);
+
+			// see if point on surface is inside cone of illumination
+			float lightSpotDot = dot(-lightDirection, normalize(lightSpotDirectionCosCutoff.xyz));
+			float lightSpotAttenuation = 0.0;
+			if (lightSpotDot >= lightSpotDirectionCosCutoff.w) {
+				lightSpotAttenuation = pow(lightSpotDot, lightAttenuations.w);
+			}
+
+			// Combine the spotlight and distance attenuation.
+			lightAttenuation *= lightSpotAttenuation;
+
+			// add color components to fragment color, clustered lights do not have ambient color
+			fragColor+=
+				clamp(lightDiffuse * material.diffuse * max(dot(normal, lightDirection), 0.0) * lightAttenuation, 0.0, 1.0) +
+				clamp(lightSpecular * material.specular * pow(max(dot(reflectionDirection, vsEyeDirection), 0.0), 0.3 * materialShininess) * lightAttenuation, 0.0, 1.0);
+		}
+
+		void computeClusteredLights(in vec3 normal, in vec3 position) {
+			// determine view space depth of fragment
+			vec4 viewPosition = clusteredLightsProjectionMatrixInverted * vec4(gl_FragCoord.xy * clusteredLightsViewPortSizeInverted * 2.0 - 1.0, gl_FragCoord.z * 2.0 - 1.0, 1.0);
+			float viewDepth = -viewPosition.z / viewPosition.w;
+
+			// determine cluster
+			ivec3 cluster = ivec3(
+				clamp(int(gl_FragCoord.x * clusteredLightsViewPortSizeInverted.x * float(CLUSTERS_X)), 0, CLUSTERS_X - 1),
+				clamp(int(gl_FragCoord.y * clusteredLightsViewPortSizeInverted.y * float(CLUSTERS_Y)), 0, CLUSTERS_Y - 1),
+				clamp(int(log(max(viewDepth, 0.0001)) * clusteredLightsClusterZ.x + clusteredLightsClusterZ.y), 0, CLUSTERS_Z - 1)
+			);
+			ivec2 clusterLights = texelFetch(clusteredLightsClustersTextureUnit, (cluster.z * CLUSTERS_Y + cluster.y) * CLUSTERS_X + cluster.x).xy;
+
+			// process each light of cluster
+			for (int i = 0; i < clusterLights.y; i++) {
+				computeClusteredLight(texelFetch(clusteredLightsLightIndicesTextureUnit, clusterLights.x + i).x, normal, position);
+			}
+		}
+	#endif
 #endif
 
 void main(void) {
@@ -269,6 +340,9 @@ void main(void) {
 
 		// compute lights
 		computeLights(normal, vsPosition);
+		#if defined(HAVE_CLUSTERED_LIGHTING)
+			if (clusteredLightsEnabled == 1) computeClusteredLights(normal, vsPosition);
+		#endif
 	#endif
 
 		// take effect colors into account
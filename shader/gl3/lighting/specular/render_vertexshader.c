@@ -6,14 +6,10 @@ layout (location = 1) in vec3 inNormal;
 layout (location = 2) in vec2 inTextureUV;
 
 // normal mapping
-layout (location = 4) in vec3 inTangent;
+// 	packed vertices provide bitangent sign in tangent w component and no bitangent
+layout (location = 4) in vec4 inTangent;
 layout (location = 5) in vec3 inBitangent;
 
-// instanced rendering
-layout (location = 6) in mat4 inModelMatrix;
-layout (location = 10) in vec4 inEffectColorMul;
-layout (location = 11) in vec4 inEffectColorAdd;
-
 // render groups
 layout (location = 12) in vec3 inOrigin;
 
@@ -24,6 +20,16 @@ uniform float time;
 
 {$DEFINITIONS}
 
+// instanced rendering
+#if defined(HAVE_INSTANCE_INDICES)
+	uniform samplerBuffer instanceDataTextureUnit;
+	uniform isamplerBuffer instanceIndicesTextureUnit;
+#else
+	layout (location = 6) in mat4 inModelMatrix;
+	layout (location = 10) in vec4 inEffectColorMul;
+	layout (location = 11) in vec4 inEffectColorAdd;
+#endif
+
 uniform mat4 projectionMatrix;
 uniform mat4 cameraMatrix;
 
@@ -60,6 +66,19 @@ out vec3 vsEyeDirection;
 {$FUNCTIONS}
 
 void main(void) {
+	#if defined(HAVE_INSTANCE_INDICES)
+		// fetch instance data by instance index
+		int instanceDataIdx = texelFetch(instanceIndicesTextureUnit, gl_InstanceID).r * 6;
+		mat4 inModelMatrix = mat4(
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 0),
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 1),
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 2),
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 3)
+		);
+		vec4 inEffectColorMul = texelFetch(instanceDataTextureUnit, instanceDataIdx + 4);
+		vec4 inEffectColorAdd = texelFetch(instanceDataTextureUnit, instanceDataIdx + 5);
+	#endif
+
 	#if defined(HAVE_TREE)
 		mat4 shaderTransformMatrix = createTreeTransformMatrix(inOrigin, inVertex, vec3(inModelMatrix[3][0], inModelMatrix[3][1], inModelMatrix[3][2]));
 	#elif defined(HAVE_FOLIAGE)
@@ -106,8 +125,8 @@ void main(void) {
 
 	// normal texture
 	if (normalTextureAvailable == 1) {
-		vsTangent = normalize(vec3(normalMatrix * vec4(inTangent, 0.0)));
-		vsBitangent = normalize(vec3(normalMatrix * vec4(inBitangent, 0.0)));
+		vsTangent = normalize(vec3(normalMatrix * vec4(inTangent.xyz, 0.0)));
+		vsBitangent = normalize(vec3(normalMatrix * vec4(dot(inBitangent, inBitangent) > 0.0?inBitangent:cross(inNormal, inTangent.xyz) * inTangent.w, 0.0)));
 	} else {
 		vsTangent = vec3(0.0, 0.0, 0.0);
 		vsBitangent = vec3(0.0, 0.0, 0.0);
@@ -4,9 +4,6 @@
 layout (location = 0) in vec3 inVertex;
 layout (location = 2) in vec2 inTextureUV;
 
-// indexed rendering
-layout (location = 6) in mat4 inModelMatrix;
-
 // render groups
 layout (location = 12) in vec3 inOrigin;
 
@@ -18,12 +15,31 @@ uniform float time;
 
 {$DEFINITIONS}
 
+// indexed rendering
+#if defined(HAVE_INSTANCE_INDICES)
+	uniform samplerBuffer instanceDataTextureUnit;
+	uniform isamplerBuffer instanceIndicesTextureUnit;
+#else
+	layout (location = 6) in mat4 inModelMatrix;
+#endif
+
 // will be passed to fragment shader
 out vec2 vsFragTextureUV;
 
 {$FUNCTIONS}
 
 void main() {
+	#if defined(HAVE_INSTANCE_INDICES)
+		// fetch instance data by instance index
+		int instanceDataIdx = texelFetch(instanceIndicesTextureUnit, gl_InstanceID).r * 6;
+		mat4 inModelMatrix = mat4(
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 0),
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 1),
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 2),
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 3)
+		);
+	#endif
+
 	#if defined(HAVE_TREE)
 		mat4 shaderTransformMatrix = createTreeTransformMatrix(inOrigin, inVertex, vec3(inModelMatrix[3][0], inModelMatrix[3][1], inModelMatrix[3][2]));
 	#elif defined(HAVE_FOLIAGE)
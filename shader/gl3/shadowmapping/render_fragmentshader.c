@@ -21,16 +21,22 @@ uniform float lightConstantAttenuation;
 uniform float lightLinearAttenuation;
 uniform float lightQuadraticAttenuation;
 
+uniform vec2 cascadeViewDepthRange;
+
 // passed from geometry shader
 in vec2 vsFragTextureUV;
 in vec4 vsShadowCoord;
 in float vsShadowIntensity;
 in vec3 vsPosition;
+in float vsViewDepth;
 
 // fragment color
 out vec4 outColor;
 
 void main() {
+	// discard fragments not belonging to current shadow map cascade
+	if (vsViewDepth < cascadeViewDepthRange.x || vsViewDepth >= cascadeViewDepthRange.y) discard;
+
 	// retrieve diffuse texture color value
 	if (diffuseTextureAvailable == 1) {
 		// fetch from texture
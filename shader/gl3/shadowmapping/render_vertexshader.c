@@ -7,9 +7,6 @@ layout (location = 0) in vec3 inVertex;
 layout (location = 1) in vec3 inNormal;
 layout (location = 2) in vec2 inTextureUV;
 
-// indexed rendering
-layout (location = 6) in mat4 inModelMatrix;
-
 // render groups
 layout (location = 12) in vec3 inOrigin;
 
@@ -24,15 +21,35 @@ uniform float time;
 
 {$DEFINITIONS}
 
+// indexed rendering
+#if defined(HAVE_INSTANCE_INDICES)
+	uniform samplerBuffer instanceDataTextureUnit;
+	uniform isamplerBuffer instanceIndicesTextureUnit;
+#else
+	layout (location = 6) in mat4 inModelMatrix;
+#endif
+
 // will be passed to fragment shader
 out vec2 vsFragTextureUV;
 out vec4 vsShadowCoord;
 out float vsShadowIntensity;
 out vec3 vsPosition;
+out float vsViewDepth;
 
 {$FUNCTIONS}
 
 void main() {
+	#if defined(HAVE_INSTANCE_INDICES)
+		// fetch instance data by instance index
+		int instanceDataIdx = texelFetch(instanceIndicesTextureUnit, gl_InstanceID).r * 6;
+		mat4 inModelMatrix = mat4(
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 0),
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 1),
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 2),
+			texelFetch(instanceDataTextureUnit, instanceDataIdx + 3)
+		);
+	#endif
+
 	#if defined(HAVE_TREE)
 		mat4 shaderTransformMatrix = createTreeTransformMatrix(inOrigin, inVertex, vec3(inModelMatrix[3][0], inModelMatrix[3][1], inModelMatrix[3][2]));
 	#elif defined(HAVE_FOLIAGE)
@@ -60,6 +77,9 @@ void main() {
 	vec4 vsPosition4 = inModelMatrix * shaderTransformMatrix * vec4(inVertex, 1.0);
 	vsPosition = vsPosition4.xyz / vsPosition4.w;
 
+	// view depth, used to clip fragments to current shadow map cascade
+	vsViewDepth = -(cameraMatrix * vsPosition4).z;
+
 	// compute gl position
 	gl_Position = mvpMatrix * vec4(inVertex, 1.0);
 	gl_Position.z-= 0.0001;
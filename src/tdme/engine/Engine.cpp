@@ -22,6 +22,7 @@
 	#include <tdme/engine/EngineGL3Renderer.h>
 	#include <tdme/engine/EngineGLES2Renderer.h>
 #endif
+#include <tdme/engine/EngineSoftwareRenderer.h>
 #include <tdme/engine/Entity.h>
 #include <tdme/engine/EntityHierarchy.h>
 #include <tdme/engine/EntityPickingFilter.h>
@@ -39,6 +40,8 @@
 #include <tdme/engine/PartitionOctTree.h>
 #include <tdme/engine/PointsParticleSystem.h>
 #include <tdme/engine/Timing.h>
+#include <tdme/engine/VisibilityCache.h>
+#include <tdme/engine/VisibilityCacheStatistics.h>
 #include <tdme/engine/model/Color4.h>
 #include <tdme/engine/model/Group.h>
 #include <tdme/engine/physics/CollisionDetection.h>
@@ -46,16 +49,23 @@
 #include <tdme/engine/primitives/LineSegment.h>
 #include <tdme/engine/subsystems/earlyzrejection/EZRShaderPre.h>
 #include <tdme/engine/subsystems/framebuffer/FrameBufferRenderShader.h>
+#include <tdme/engine/subsystems/lighting/LightClusters.h>
+#include <tdme/engine/subsystems/lighting/LightClustersStatistics.h>
 #include <tdme/engine/subsystems/lighting/LightingShader.h>
 #include <tdme/engine/subsystems/lines/LinesShader.h>
 #include <tdme/engine/subsystems/manager/MeshManager.h>
+#include <tdme/engine/subsystems/manager/StreamingManager.h>
 #include <tdme/engine/subsystems/manager/TextureManager.h>
 #include <tdme/engine/subsystems/manager/VBOManager.h>
+#include <tdme/engine/subsystems/occlusionculling/OcclusionCulling.h>
+#include <tdme/engine/subsystems/occlusionculling/OcclusionCullingStatistics.h>
+#include <tdme/engine/subsystems/rendering/ModelMemoryStatistics.h>
 #include <tdme/engine/subsystems/rendering/ObjectBuffer.h>
 #include <tdme/engine/subsystems/rendering/Object3DBase_TransformedFacesIterator.h>
 #include <tdme/engine/subsystems/rendering/Object3DGroupMesh.h>
 #include <tdme/engine/subsystems/rendering/Object3DRenderer.h>
 #include <tdme/engine/subsystems/rendering/Object3DRenderer_InstancedRenderFunctionParameters.h>
+#include <tdme/engine/subsystems/rendering/RenderingStatistics.h>
 #include <tdme/engine/subsystems/rendering/TransparentRenderFacesPool.h>
 #include <tdme/engine/subsystems/particlesystem/ParticlesShader.h>
 #include <tdme/engine/subsystems/postprocessing/PostProcessing.h>
@@ -66,6 +76,7 @@
 #include <tdme/engine/subsystems/shadowmapping/ShadowMapping.h>
 #include <tdme/engine/subsystems/shadowmapping/ShadowMappingShaderPre.h>
 #include <tdme/engine/subsystems/shadowmapping/ShadowMappingShaderRender.h>
+#include <tdme/engine/subsystems/shadowmapping/ShadowMappingStatistics.h>
 #include <tdme/engine/subsystems/skinning/SkinningShader.h>
 #include <tdme/gui/GUI.h>
 #include <tdme/gui/GUIParser.h>
@@ -96,6 +107,7 @@ using tdme::engine::EngineGL3Renderer;
 using tdme::engine::EngineGL2Renderer;
 using tdme::engine::EngineGLES2Renderer;
 using tdme::engine::EngineVKRenderer;
+using tdme::engine::EngineSoftwareRenderer;
 using tdme::engine::Entity;
 using tdme::engine::EntityHierarchy;
 using tdme::engine::EntityPickingFilter;
@@ -113,21 +125,30 @@ using tdme::engine::Partition;
 using tdme::engine::PartitionOctTree;
 using tdme::engine::PointsParticleSystem;
 using tdme::engine::Timing;
+using tdme::engine::VisibilityCache;
+using tdme::engine::VisibilityCacheStatistics;
 using tdme::engine::model::Color4;
 using tdme::engine::model::Group;
 using tdme::engine::physics::CollisionDetection;
 using tdme::engine::primitives::BoundingBox;
 using tdme::engine::primitives::LineSegment;
 using tdme::engine::subsystems::earlyzrejection::EZRShaderPre;
+using tdme::engine::subsystems::lighting::LightClusters;
+using tdme::engine::subsystems::lighting::LightClustersStatistics;
 using tdme::engine::subsystems::lighting::LightingShader;
 using tdme::engine::subsystems::lines::LinesShader;
 using tdme::engine::subsystems::manager::MeshManager;
+using tdme::engine::subsystems::manager::StreamingManager;
 using tdme::engine::subsystems::manager::TextureManager;
 using tdme::engine::subsystems::manager::VBOManager;
+using tdme::engine::subsystems::occlusionculling::OcclusionCulling;
+using tdme::engine::subsystems::occlusionculling::OcclusionCullingStatistics;
+using tdme::engine::subsystems::rendering::ModelMemoryStatistics;
 using tdme::engine::subsystems::rendering::Object3DBase_TransformedFacesIterator;
 using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::engine::subsystems::rendering::Object3DRenderer_InstancedRenderFunctionParameters;
 using tdme::engine::subsystems::rendering::ObjectBuffer;
+using tdme::engine::subsystems::rendering::RenderingStatistics;
 using tdme::engine::subsystems::rendering::TransparentRenderFacesPool;
 using tdme::engine::subsystems::particlesystem::ParticlesShader;
 using tdme::engine::subsystems::postprocessing::PostProcessing;
@@ -138,6 +159,7 @@ using tdme::engine::subsystems::shadowmapping::ShadowMap;
 using tdme::engine::subsystems::shadowmapping::ShadowMapping;
 using tdme::engine::subsystems::shadowmapping::ShadowMappingShaderPre;
 using tdme::engine::subsystems::shadowmapping::ShadowMappingShaderRender;
+using tdme::engine::subsystems::shadowmapping::ShadowMappingStatistics;
 using tdme::engine::subsystems::skinning::SkinningShader;
 using tdme::gui::GUI;
 using tdme::gui::GUIParser;
@@ -159,6 +181,7 @@ Renderer* Engine::renderer = nullptr;
 TextureManager* Engine::textureManager = nullptr;
 VBOManager* Engine::vboManager = nullptr;
 MeshManager* Engine::meshManager = nullptr;
+StreamingManager* Engine::streamingManager = nullptr;
 GUIRenderer* Engine::guiRenderer = nullptr;
 FrameBufferRenderShader* Engine::frameBufferRenderShader = nullptr;
 PostProcessing* Engine::postProcessing = nullptr;
@@ -177,10 +200,15 @@ bool Engine::skinningShaderEnabled = false;
 int Engine::threadCount = 0;
 bool Engine::have4K = false;
 float Engine::animationBlendingTime = 250.0f;
+bool Engine::packedVertices = false;
+bool Engine::softwareRendering = false;
+Engine::TransparencySorting Engine::transparencySorting = Engine::TRANSPARENCYSORTING_FACES;
 int32_t Engine::shadowMapWidth = 0;
 int32_t Engine::shadowMapHeight = 0;
 int32_t Engine::shadowMapRenderLookUps = 0;
 float Engine::shadowMaplightEyeDistanceScale = 1.0f;
+int32_t Engine::shadowMapCascades = 1;
+float Engine::shadowMapCascadeSplitLambda = 0.75f;
 float Engine::transformationsComputingReduction1Distance = 25.0f;
 float Engine::transformationsComputingReduction2Distance = 50.0f;
 
@@ -202,14 +230,25 @@ void Engine::EngineThread::run() {
 			case STATE_WAITING:
 				while (state == STATE_WAITING) Thread::nanoSleep(10000LL);
 				break;
+			case STATE_PARTICLES:
+				engine->updateParticlesFunction(threadCount, idx);
+				state = STATE_SPINNING;
+				break;
 			case STATE_TRANSFORMATIONS:
 				engine->computeTransformationsFunction(threadCount, idx);
 				state = STATE_SPINNING;
 				break;
+			case STATE_SHADOWCASTERS:
+				engine->shadowMapping->determineShadowCastersFunction(threadCount, idx);
+				state = STATE_SPINNING;
+				break;
+			case STATE_SHADOWCASTERSPRERENDER:
+				engine->shadowMapping->preRenderShadowCastersFunction(threadCount, idx);
+				state = STATE_SPINNING;
+				break;
 			case STATE_RENDERING:
 				rendering.transparentRenderFacesPool->reset();
-				engine->object3DRenderer->renderFunction(threadCount, idx, rendering.parameters.objects, rendering.objectsByShadersAndModels, rendering.parameters.collectTransparentFaces, rendering.parameters.renderTypes, rendering.transparentRenderFacesPool);
-				rendering.objectsByShadersAndModels.clear();
+				engine->object3DRenderer->renderFunction(threadCount, idx, rendering.parameters.objects, rendering.parameters.collectTransparentFaces, rendering.parameters.renderTypes, rendering.transparentRenderFacesPool);
 				state = STATE_SPINNING;
 				break;
 			case STATE_SPINNING:
@@ -223,6 +262,7 @@ void Engine::EngineThread::run() {
 Engine::Engine() {
 	timing = new Timing();
 	camera = nullptr;
+	visibilityCache = new VisibilityCache();
 	sceneColor.set(0.0f, 0.0f, 0.0f, 1.0f);
 	frameBuffer = nullptr;
 	// shadow mapping
@@ -251,11 +291,15 @@ Engine::~Engine() {
 	if (postProcessingFrameBuffer2 != nullptr) delete postProcessingFrameBuffer2;
 	if (postProcessingTemporaryFrameBuffer != nullptr) delete postProcessingTemporaryFrameBuffer;
 	if (shadowMapping != nullptr) delete shadowMapping;
+	if (occlusionCulling != nullptr) delete occlusionCulling;
+	if (lightClusters != nullptr) delete lightClusters;
+	delete visibilityCache;
 	delete object3DRenderer;
 	if (instance == this) {
 		delete renderer;
 		delete textureManager;
 		delete vboManager;
+		delete streamingManager;
 		delete meshManager;
 		delete guiRenderer;
 		delete lightingShader;
@@ -317,6 +361,7 @@ void Engine::setPartition(Partition* partition)
 {
 	if (this->partition != nullptr) delete this->partition;
 	this->partition = partition;
+	visibilityCache->invalidate();
 }
 
 void Engine::addEntity(Entity* entity)
@@ -435,71 +480,80 @@ void Engine::initialize()
 	if (initialized == true)
 		return;
 
-	#if defined(VULKAN)
-		renderer = new EngineVKRenderer(this);
-		Console::println(string("TDME::Using Vulkan"));
-		// Console::println(string("TDME::Extensions: ") + gl->glGetString(GL::GL_EXTENSIONS));
-		shadowMappingEnabled = true;
-		if (getShadowMapWidth() == 0 || getShadowMapHeight() == 0) setShadowMapSize(2048, 2048);
-		if (getShadowMapRenderLookUps() == 0) setShadowMapRenderLookUps(8);
-		skinningShaderEnabled = true;
-		animationProcessingTarget = Engine::AnimationProcessingTarget::GPU;
-	#else
-		// MacOSX, currently GL3 only
-		#if defined(__APPLE__)
-		{
-			renderer = new EngineGL3Renderer(this);
-			Console::println(string("TDME::Using GL3+/CORE"));
-			// Console::println(string("TDME::Extensions: ") + gl->glGetString(GL::GL_EXTENSIONS));
-			shadowMappingEnabled = true;
-			if (getShadowMapWidth() == 0 || getShadowMapHeight() == 0) setShadowMapSize(2048, 2048);
-			if (getShadowMapRenderLookUps() == 0) setShadowMapRenderLookUps(4);
-			skinningShaderEnabled = false;
-			animationProcessingTarget = Engine::AnimationProcessingTarget::CPU;
-		}
-		// Linux/FreeBSD/NetBSD/Win32, GL2 or GL3 via GLEW
-		#elif defined(_WIN32) || ((defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__linux__)) && !defined(GLES2)) || defined(__HAIKU__)
-		{
-			int glMajorVersion;
-			int glMinorVersion;
-			glGetIntegerv(GL_MAJOR_VERSION, &glMajorVersion);
-			glGetIntegerv(GL_MINOR_VERSION, &glMinorVersion);
-			if ((glMajorVersion == 3 && glMinorVersion >= 2) || glMajorVersion > 3) {
-				Console::println(string("TDME::Using GL3+/CORE(" + to_string(glMajorVersion) + "." + to_string(glMinorVersion) + ")"));
-				renderer = new EngineGL3Renderer(this);
-			} else {
-				Console::println(string("TDME::Using GL2(" + to_string(glMajorVersion) + "." + to_string(glMinorVersion) + ")"));
-				renderer = new EngineGL2Renderer(this);
-			}
-			skinningShaderEnabled = (glMajorVersion == 4 && glMinorVersion >= 3) || glMajorVersion > 4; // TODO: Move me into renderer backend
+	// software renderer, which does not require a GL or Vulkan context
+	if (softwareRendering == true) {
+		renderer = new EngineSoftwareRenderer(this);
+		Console::println(string("TDME::Using software renderer"));
+		shadowMappingEnabled = false;
+		skinningShaderEnabled = false;
+		animationProcessingTarget = Engine::AnimationProcessingTarget::CPU;
+	} else {
+		#if defined(VULKAN)
+			renderer = new EngineVKRenderer(this);
+			Console::println(string("TDME::Using Vulkan"));
 			// Console::println(string("TDME::Extensions: ") + gl->glGetString(GL::GL_EXTENSIONS));
 			shadowMappingEnabled = true;
 			if (getShadowMapWidth() == 0 || getShadowMapHeight() == 0) setShadowMapSize(2048, 2048);
 			if (getShadowMapRenderLookUps() == 0) setShadowMapRenderLookUps(8);
-			animationProcessingTarget = skinningShaderEnabled == true?Engine::AnimationProcessingTarget::GPU:Engine::AnimationProcessingTarget::CPU;
-		}
-		// GLES2 on Linux
-		#elif (defined(__linux__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)) && defined(GLES2)
-		{
-			renderer = new EngineGLES2Renderer(this);
-			Console::println(string("TDME::Using GLES2"));
-			// Console::println(string("TDME::Extensions: ") + gl->glGetString(GL::GL_EXTENSIONS));
-			if (renderer->isBufferObjectsAvailable() == true && renderer->isDepthTextureAvailable() == true) {
+			skinningShaderEnabled = true;
+			animationProcessingTarget = Engine::AnimationProcessingTarget::GPU;
+		#else
+			// MacOSX, currently GL3 only
+			#if defined(__APPLE__)
+			{
+				renderer = new EngineGL3Renderer(this);
+				Console::println(string("TDME::Using GL3+/CORE"));
+				// Console::println(string("TDME::Extensions: ") + gl->glGetString(GL::GL_EXTENSIONS));
 				shadowMappingEnabled = true;
-				animationProcessingTarget = Engine::AnimationProcessingTarget::CPU;
-				if (getShadowMapWidth() == 0 || getShadowMapHeight() == 0) setShadowMapSize(1024, 1024);
+				if (getShadowMapWidth() == 0 || getShadowMapHeight() == 0) setShadowMapSize(2048, 2048);
 				if (getShadowMapRenderLookUps() == 0) setShadowMapRenderLookUps(4);
-			} else {
-				shadowMappingEnabled = false;
+				skinningShaderEnabled = false;
 				animationProcessingTarget = Engine::AnimationProcessingTarget::CPU;
 			}
-			skinningShaderEnabled = false;
-		}
-		#else
-			Console::println("Engine::initialize(): unsupported GL!");
-			return;
+			// Linux/FreeBSD/NetBSD/Win32, GL2 or GL3 via GLEW
+			#elif defined(_WIN32) || ((defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__) || defined(__linux__)) && !defined(GLES2)) || defined(__HAIKU__)
+			{
+				int glMajorVersion;
+				int glMinorVersion;
+				glGetIntegerv(GL_MAJOR_VERSION, &glMajorVersion);
+				glGetIntegerv(GL_MINOR_VERSION, &glMinorVersion);
+				if ((glMajorVersion == 3 && glMinorVersion >= 2) || glMajorVersion > 3) {
+					Console::println(string("TDME::Using GL3+/CORE(" + to_string(glMajorVersion) + "." + to_string(glMinorVersion) + ")"));
+					renderer = new EngineGL3Renderer(this);
+				} else {
+					Console::println(string("TDME::Using GL2(" + to_string(glMajorVersion) + "." + to_string(glMinorVersion) + ")"));
+					renderer = new EngineGL2Renderer(this);
+				}
+				skinningShaderEnabled = (glMajorVersion == 4 && glMinorVersion >= 3) || glMajorVersion > 4; // TODO: Move me into renderer backend
+				// Console::println(string("TDME::Extensions: ") + gl->glGetString(GL::GL_EXTENSIONS));
+				shadowMappingEnabled = true;
+				if (getShadowMapWidth() == 0 || getShadowMapHeight() == 0) setShadowMapSize(2048, 2048);
+				if (getShadowMapRenderLookUps() == 0) setShadowMapRenderLookUps(8);
+				animationProcessingTarget = skinningShaderEnabled == true?Engine::AnimationProcessingTarget::GPU:Engine::AnimationProcessingTarget::CPU;
+			}
+			// GLES2 on Linux
+			#elif (defined(__linux__) || defined(__FreeBSD__) || defined(__NetBSD__) || defined(__OpenBSD__)) && defined(GLES2)
+			{
+				renderer = new EngineGLES2Renderer(this);
+				Console::println(string("TDME::Using GLES2"));
+				// Console::println(string("TDME::Extensions: ") + gl->glGetString(GL::GL_EXTENSIONS));
+				if (renderer->isBufferObjectsAvailable() == true && renderer->isDepthTextureAvailable() == true) {
+					shadowMappingEnabled = true;
+					animationProcessingTarget = Engine::AnimationProcessingTarget::CPU;
+					if (getShadowMapWidth() == 0 || getShadowMapHeight() == 0) setShadowMapSize(1024, 1024);
+					if (getShadowMapRenderLookUps() == 0) setShadowMapRenderLookUps(4);
+				} else {
+					shadowMappingEnabled = false;
+					animationProcessingTarget = Engine::AnimationProcessingTarget::CPU;
+				}
+				skinningShaderEnabled = false;
+			}
+			#else
+				Console::println("Engine::initialize(): unsupported GL!");
+				return;
+			#endif
 		#endif
-	#endif
+	}
 
 	// engine thread count
 	if (renderer->isSupportingMultithreadedRendering() == true) {
@@ -516,6 +570,8 @@ void Engine::initialize()
 	textureManager = new TextureManager(renderer);
 	vboManager = new VBOManager(renderer);
 	meshManager = new MeshManager();
+	streamingManager = new StreamingManager();
+	streamingManager->start();
 
 	// init
 	initialized = true;
@@ -842,14 +898,28 @@ void Engine::determineEntityTypes(
 	}
 }
 
-void Engine::computeTransformations()
-{
-	// init rendering if not yet done
-	if (renderingInitiated == false) initRendering();
+void Engine::updateParticlesFunction(int threadCount, int threadIdx) {
+	// update particles only, partition is updated afterwards single threaded
+	auto ppsIdx = 0;
+	for (auto pps: autoEmitPpses) {
+		if (ppsIdx % threadCount == threadIdx) pps->PointsParticleSystemInternal::updateParticles();
+		ppsIdx++;
+	}
+	auto fpsIdx = 0;
+	for (auto fps: autoEmitFpses) {
+		if (fpsIdx % threadCount == threadIdx) fps->FogParticleSystemInternal::updateParticles();
+		fpsIdx++;
+	}
+}
 
+void Engine::updateParticles() {
 	ParticleSystemEntity* pse = nullptr;
+	PointsParticleSystem* pps = nullptr;
+	FogParticleSystem* fps = nullptr;
 
-	// do particle systems auto emit
+	// emit particles single threaded as emitters share the random number generator
+	autoEmitPpses.clear();
+	autoEmitFpses.clear();
 	for (auto it: autoEmitParticleSystemEntities) {
 		auto entity = it.second;
 
@@ -859,13 +929,60 @@ void Engine::computeTransformations()
 		// do auto emit
 		if ((pse = dynamic_cast<ParticleSystemEntity*>(entity)) != nullptr) {
 			pse->emitParticles();
-			pse->updateParticles();
+			// points and fog particle systems are independent of each other and get updated in parallel below
+			if ((pps = dynamic_cast<PointsParticleSystem*>(entity)) != nullptr) {
+				autoEmitPpses.push_back(pps);
+			} else
+			if ((fps = dynamic_cast<FogParticleSystem*>(entity)) != nullptr) {
+				autoEmitFpses.push_back(fps);
+			} else {
+				pse->updateParticles();
+			}
 		}
 	}
 
+	// update points and fog particle systems
+	if (autoEmitPpses.size() + autoEmitFpses.size() == 0) return;
+	if (renderer->isSupportingMultithreadedRendering() == false) {
+		updateParticlesFunction(1, 0);
+	} else {
+		for (auto engineThread: engineThreads) engineThread->engine = this;
+		for (auto engineThread: engineThreads) engineThread->state = EngineThread::STATE_PARTICLES;
+		updateParticlesFunction(threadCount, 0);
+		for (auto engineThread: engineThreads) while (engineThread->state == EngineThread::STATE_PARTICLES);
+		for (auto engineThread: engineThreads) engineThread->state = EngineThread::STATE_SPINNING;
+	}
+
+	// update partition
+	for (auto pps: autoEmitPpses) {
+		if (pps->getParentEntity() == nullptr && pps->isFrustumCulling() == true) partition->updateEntity(pps);
+	}
+	for (auto fps: autoEmitFpses) {
+		if (fps->getParentEntity() == nullptr && fps->isFrustumCulling() == true) partition->updateEntity(fps);
+	}
+}
+
+void Engine::computeTransformations()
+{
+	// init rendering if not yet done
+	if (renderingInitiated == false) initRendering();
+
+	// deliver finished streaming requests, which might replace placeholder entities
+	if (this == Engine::instance) {
+		streamingManager->setCameraPosition(camera->getLookFrom());
+		streamingManager->processCompletions();
+	}
+
+	// do particle systems auto emit
+	updateParticles();
+
+	// determine visible entities, reuse or patch them if camera frustum did not change, optionally reject entities that are occluded
+	visibilityCache->resetStatistics();
+	auto& visibleEntities = visibilityCache->getVisibleEntities(partition, camera->getFrustum());
+
 	// determine entity types and store them
 	determineEntityTypes(
-		partition->getVisibleEntities(camera->getFrustum()),
+		occlusionCulling != nullptr?occlusionCulling->cull(camera, visibleEntities):visibleEntities,
 		visibleObjects,
 		visibleObjectsPostPostProcessing,
 		visibleObjectsNoDepthTest,
@@ -923,6 +1040,44 @@ void Engine::computeTransformations()
 	renderingComputedTransformations = true;
 }
 
+void Engine::prepareShadowMaps()
+{
+	// set up light cameras and determine shadow caster entities
+	shadowMapping->updateShadowMaps();
+
+	// determine shadow casters per shadow map, collect them and do their transformations and pre render steps
+	if (renderer->isSupportingMultithreadedRendering() == false) {
+		shadowMapping->determineShadowCastersFunction(1, 0);
+		shadowMapping->collectShadowCasters();
+		if (skinningShaderEnabled == true) skinningShader->useProgram();
+		shadowMapping->preRenderShadowCastersFunction(1, 0);
+		if (skinningShaderEnabled == true) skinningShader->unUseProgram();
+	} else {
+		for (auto engineThread: engineThreads) engineThread->engine = this;
+		for (auto engineThread: engineThreads) engineThread->state = EngineThread::STATE_SHADOWCASTERS;
+		shadowMapping->determineShadowCastersFunction(threadCount, 0);
+		for (auto engineThread: engineThreads) while (engineThread->state == EngineThread::STATE_SHADOWCASTERS);
+		shadowMapping->collectShadowCasters();
+		if (skinningShaderEnabled == true) skinningShader->useProgram();
+		for (auto engineThread: engineThreads) engineThread->state = EngineThread::STATE_SHADOWCASTERSPRERENDER;
+		shadowMapping->preRenderShadowCastersFunction(threadCount, 0);
+		for (auto engineThread: engineThreads) while (engineThread->state == EngineThread::STATE_SHADOWCASTERSPRERENDER);
+		for (auto engineThread: engineThreads) engineThread->state = EngineThread::STATE_SPINNING;
+		if (skinningShaderEnabled == true) skinningShader->unUseProgram();
+	}
+}
+
+void Engine::updateLightClusters(void* context)
+{
+	// bin clustered lights into clusters
+	lightClusters->update(camera->getProjectionMatrix(), camera->getModelViewMatrix(), camera->getZNear(), camera->getZFar(), clusteredLights);
+	lightClusters->binLights();
+	lightClusters->collectLights();
+
+	// upload them
+	lightClusters->upload(context);
+}
+
 void Engine::display()
 {
 	// finish last frame
@@ -938,11 +1093,20 @@ void Engine::display()
 	// init frame
 	if (this == Engine::instance) Engine::renderer->initializeFrame();
 
+	// reset rendering statistics
+	object3DRenderer->resetStatistics();
+
+	// prepare persistent instance data buffers
+	object3DRenderer->prepareInstanceDataBuffers();
+
 	// default context
 	auto context = Engine::renderer->getDefaultContext();
 
 	// create shadow maps
-	if (shadowMapping != nullptr) shadowMapping->createShadowMaps();
+	if (shadowMapping != nullptr) {
+		prepareShadowMaps();
+		shadowMapping->createShadowMaps();
+	}
 
 	// create post processing frame buffers if having post processing
 	if (postProcessingPrograms.size() > 0) {
@@ -983,6 +1147,19 @@ void Engine::display()
 	// restore camera from shadow map rendering
 	camera->update(context, width, height);
 
+	// update light clusters if having clustered lights
+	if (clusteredLights.empty() == false && renderer->isTextureBufferObjectsAvailable() == true) {
+		if (lightClusters == nullptr) {
+			// light clusters use own bin lights threads, as texture buffer objects are only available with renderers that have no engine threads
+			lightClusters = new LightClusters(
+				renderer,
+				renderer->isSupportingMultithreadedRendering() == true?threadCount:Math::clamp(Thread::getHardwareThreadCount() == 0?2:Thread::getHardwareThreadCount() / 2, 2, 4)
+			);
+			lightClusters->initialize();
+		}
+		updateLightClusters(context);
+	}
+
 	// render lines objects
 	if (visibleLinesObjects.size() > 0) {
 		// use particle shader
@@ -1699,6 +1876,9 @@ void Engine::dispose()
 	// dispose shadow mapping
 	if (shadowMapping != nullptr) shadowMapping->dispose();
 
+	// dispose light clusters
+	if (lightClusters != nullptr) lightClusters->dispose();
+
 	// dispose frame buffers
 	if (frameBuffer != nullptr) frameBuffer->dispose();
 	if (postProcessingFrameBuffer1 != nullptr) postProcessingFrameBuffer1->dispose();
@@ -1820,6 +2000,104 @@ bool Engine::makeScreenshot(const string& pathName, const string& fileName)
 	return true;
 }
 
+void Engine::computeModelMemoryStatistics(Entity* entity, map<string, ModelMemoryStatistics>& modelMemoryStatistics) {
+	Object3D* object = nullptr;
+	LODObject3D* lodObject = nullptr;
+	Object3DRenderGroup* org = nullptr;
+	EntityHierarchy* eh = nullptr;
+	if ((object = dynamic_cast<Object3D*>(entity)) != nullptr) {
+		auto& statistics = modelMemoryStatistics[object->getModel()->getId()];
+		statistics.objectCount++;
+		statistics.instanceMemoryUsage+= object->computeInstanceMemoryUsage();
+	} else
+	if ((lodObject = dynamic_cast<LODObject3D*>(entity)) != nullptr) {
+		if (lodObject->objectLOD1 != nullptr) computeModelMemoryStatistics(lodObject->objectLOD1, modelMemoryStatistics);
+		if (lodObject->objectLOD2 != nullptr) computeModelMemoryStatistics(lodObject->objectLOD2, modelMemoryStatistics);
+		if (lodObject->objectLOD3 != nullptr) computeModelMemoryStatistics(lodObject->objectLOD3, modelMemoryStatistics);
+	} else
+	if ((org = dynamic_cast<Object3DRenderGroup*>(entity)) != nullptr) {
+		if (org->getEntity() != nullptr) computeModelMemoryStatistics(org->getEntity(), modelMemoryStatistics);
+	} else
+	if ((eh = dynamic_cast<EntityHierarchy*>(entity)) != nullptr) {
+		for (auto subEntity: eh->getEntities()) computeModelMemoryStatistics(subEntity, modelMemoryStatistics);
+	}
+}
+
+void Engine::computeModelMemoryStatistics(map<string, ModelMemoryStatistics>& modelMemoryStatistics) {
+	// shared meshes
+	meshManager->computeMemoryStatistics(modelMemoryStatistics);
+	// instance state of objects
+	for (auto it: entitiesById) computeModelMemoryStatistics(it.second, modelMemoryStatistics);
+}
+
+void Engine::printModelMemoryStatistics() {
+	map<string, ModelMemoryStatistics> modelMemoryStatistics;
+	computeModelMemoryStatistics(modelMemoryStatistics);
+	int64_t totalMemoryUsage = 0LL;
+	int64_t totalMemoryUsageUnshared = 0LL;
+	Console::println("Engine::printModelMemoryStatistics(): model: objects: meshes / references: mesh memory usage (unshared): instance memory usage");
+	for (auto it: modelMemoryStatistics) {
+		auto& statistics = it.second;
+		Console::println(
+			"\t" +
+			it.first + ": " +
+			to_string(statistics.objectCount) + ": " +
+			to_string(statistics.meshCount) + " / " + to_string(statistics.meshReferenceCount) + ": " +
+			to_string(statistics.meshMemoryUsage / 1024) + "KB (" + to_string(statistics.meshMemoryUsageUnshared / 1024) + "KB): " +
+			to_string(statistics.instanceMemoryUsage / 1024) + "KB"
+		);
+		totalMemoryUsage+= statistics.meshMemoryUsage + statistics.instanceMemoryUsage;
+		totalMemoryUsageUnshared+= statistics.meshMemoryUsageUnshared + statistics.instanceMemoryUsage;
+	}
+	Console::println("Engine::printModelMemoryStatistics(): total: " + to_string(totalMemoryUsage / 1024) + "KB, without mesh sharing: " + to_string(totalMemoryUsageUnshared / 1024) + "KB");
+}
+
+void Engine::getRenderingStatistics(RenderingStatistics& renderingStatistics) {
+	object3DRenderer->getStatistics(renderingStatistics);
+}
+
+void Engine::getShadowMappingStatistics(int32_t lightIdx, ShadowMappingStatistics& shadowMappingStatistics) {
+	if (shadowMapping == nullptr) {
+		shadowMappingStatistics = ShadowMappingStatistics();
+		return;
+	}
+	shadowMapping->getStatistics(lightIdx, shadowMappingStatistics);
+}
+
+void Engine::setOcclusionCulling(bool occlusionCulling) {
+	if (occlusionCulling == true && this->occlusionCulling == nullptr) {
+		this->occlusionCulling = new OcclusionCulling();
+	} else
+	if (occlusionCulling == false && this->occlusionCulling != nullptr) {
+		delete this->occlusionCulling;
+		this->occlusionCulling = nullptr;
+	}
+}
+
+void Engine::getOcclusionCullingStatistics(OcclusionCullingStatistics& occlusionCullingStatistics) {
+	if (occlusionCulling == nullptr) {
+		occlusionCullingStatistics = OcclusionCullingStatistics();
+		return;
+	}
+	occlusionCulling->getStatistics(occlusionCullingStatistics);
+}
+
+void Engine::getVisibilityCacheStatistics(VisibilityCacheStatistics& visibilityCacheStatistics) {
+	visibilityCache->getStatistics(visibilityCacheStatistics);
+}
+
+void Engine::getLightClustersStatistics(LightClustersStatistics& lightClustersStatistics) {
+	if (lightClusters == nullptr || clusteredLights.empty() == true) {
+		lightClustersStatistics = LightClustersStatistics();
+		return;
+	}
+	lightClusters->getStatistics(lightClustersStatistics);
+}
+
+void Engine::setClusteredLightCount(int32_t clusteredLightCount) {
+	clusteredLights.resize(Math::clamp(clusteredLightCount, 0, LightClusters::LIGHTS_MAX));
+}
+
 void Engine::resetPostProcessingPrograms() {
 	postProcessingPrograms.clear();
 }
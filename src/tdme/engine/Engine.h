@@ -18,6 +18,7 @@
 #include <tdme/engine/subsystems/lighting/fwd-tdme.h>
 #include <tdme/engine/subsystems/lines/fwd-tdme.h>
 #include <tdme/engine/subsystems/manager/fwd-tdme.h>
+#include <tdme/engine/subsystems/occlusionculling/fwd-tdme.h>
 #include <tdme/engine/subsystems/rendering/fwd-tdme.h>
 #include <tdme/engine/subsystems/rendering/Object3DRenderer_InstancedRenderFunctionParameters.h>
 #include <tdme/engine/subsystems/particlesystem/fwd-tdme.h>
@@ -58,18 +59,27 @@ using tdme::engine::ParticleSystemGroup;
 using tdme::engine::Partition;
 using tdme::engine::PointsParticleSystem;
 using tdme::engine::Timing;
+using tdme::engine::VisibilityCache;
+using tdme::engine::VisibilityCacheStatistics;
 using tdme::engine::model::Color4;
 using tdme::engine::model::Group;
 using tdme::engine::model::Material;
 using tdme::engine::subsystems::earlyzrejection::EZRShaderPre;
 using tdme::engine::subsystems::framebuffer::FrameBufferRenderShader;
+using tdme::engine::subsystems::lighting::LightClusters;
+using tdme::engine::subsystems::lighting::LightClustersStatistics;
 using tdme::engine::subsystems::lighting::LightingShader;
 using tdme::engine::subsystems::lines::LinesShader;
 using tdme::engine::subsystems::manager::MeshManager;
+using tdme::engine::subsystems::manager::StreamingManager;
 using tdme::engine::subsystems::manager::TextureManager;
 using tdme::engine::subsystems::manager::VBOManager;
+using tdme::engine::subsystems::occlusionculling::OcclusionCulling;
+using tdme::engine::subsystems::occlusionculling::OcclusionCullingStatistics;
+using tdme::engine::subsystems::rendering::ModelMemoryStatistics;
 using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::engine::subsystems::rendering::Object3DRenderer_InstancedRenderFunctionParameters;
+using tdme::engine::subsystems::rendering::RenderingStatistics;
 using tdme::engine::subsystems::rendering::TransparentRenderFacesPool;
 using tdme::engine::subsystems::particlesystem::ParticlesShader;
 using tdme::engine::subsystems::postprocessing::PostProcessing;
@@ -79,6 +89,7 @@ using tdme::engine::subsystems::renderer::Renderer;
 using tdme::engine::subsystems::shadowmapping::ShadowMapping;
 using tdme::engine::subsystems::shadowmapping::ShadowMappingShaderPre;
 using tdme::engine::subsystems::shadowmapping::ShadowMappingShaderRender;
+using tdme::engine::subsystems::shadowmapping::ShadowMappingStatistics;
 using tdme::engine::subsystems::skinning::SkinningShader;
 using tdme::gui::GUI;
 using tdme::gui::renderer::GUIRenderer;
@@ -100,6 +111,7 @@ class tdme::engine::Engine final
 	friend class EngineGL2Renderer;
 	friend class EngineGLES2Renderer;
 	friend class EngineVKRenderer;
+	friend class EngineSoftwareRenderer;
 	friend class EntityHierarchy;
 	friend class FogParticleSystem;
 	friend class FrameBuffer;
@@ -112,6 +124,7 @@ class tdme::engine::Engine final
 	friend class PointsParticleSystem;
 	friend class SkinnedObject3DRenderGroup;
 	friend class tdme::engine::subsystems::framebuffer::FrameBufferRenderShader;
+	friend class tdme::engine::subsystems::lighting::LightingShaderBaseImplementation;
 	friend class tdme::engine::subsystems::lines::LinesObject3DInternal;
 	friend class tdme::engine::subsystems::rendering::BatchRendererPoints;
 	friend class tdme::engine::subsystems::rendering::BatchRendererTriangles;
@@ -137,6 +150,7 @@ class tdme::engine::Engine final
 
 public:
 	enum AnimationProcessingTarget {NONE, CPU, CPU_NORENDERING, GPU};
+	enum TransparencySorting {TRANSPARENCYSORTING_FACES, TRANSPARENCYSORTING_OBJECTS};
 	static constexpr int LIGHTS_MAX { 8 };
 
 protected:
@@ -149,6 +163,7 @@ private:
 	static TextureManager* textureManager;
 	static VBOManager* vboManager;
 	static MeshManager* meshManager;
+	static StreamingManager* streamingManager;
 	static GUIRenderer* guiRenderer;
 
 	static AnimationProcessingTarget animationProcessingTarget;
@@ -167,10 +182,15 @@ private:
 	static int threadCount;
 	static bool have4K;
 	static float animationBlendingTime;
+	static bool packedVertices;
+	static bool softwareRendering;
+	static TransparencySorting transparencySorting;
 	static int32_t shadowMapWidth;
 	static int32_t shadowMapHeight;
 	static int32_t shadowMapRenderLookUps;
 	static float shadowMaplightEyeDistanceScale;
+	static int32_t shadowMapCascades;
+	static float shadowMapCascadeSplitLambda;
 	static float transformationsComputingReduction1Distance;
 	static float transformationsComputingReduction2Distance;
 
@@ -184,15 +204,21 @@ private:
 	Partition* partition { nullptr };
 
 	array<Light, LIGHTS_MAX> lights;
+	vector<Light> clusteredLights;
+	LightClusters* lightClusters { nullptr };
 	Color4 sceneColor;
 	FrameBuffer* frameBuffer { nullptr };
 	FrameBuffer* postProcessingFrameBuffer1 { nullptr };
 	FrameBuffer* postProcessingFrameBuffer2{ nullptr };
 	FrameBuffer* postProcessingTemporaryFrameBuffer { nullptr };
 	ShadowMapping* shadowMapping { nullptr };
+	OcclusionCulling* occlusionCulling { nullptr };
+	VisibilityCache* visibilityCache { nullptr };
 
 	map<string, Entity*> entitiesById;
 	map<string, ParticleSystemEntity*> autoEmitParticleSystemEntities;
+	vector<PointsParticleSystem*> autoEmitPpses;
+	vector<FogParticleSystem*> autoEmitFpses;
 	map<string, Entity*> noFrustumCullingEntitiesById;
 
 	vector<Object3D*> visibleObjects;
@@ -228,13 +254,12 @@ private:
 		int idx;
 		void* context;
 	public:
-		enum State { STATE_WAITING, STATE_TRANSFORMATIONS, STATE_RENDERING, STATE_SPINNING };
+		enum State { STATE_WAITING, STATE_PARTICLES, STATE_TRANSFORMATIONS, STATE_SHADOWCASTERS, STATE_SHADOWCASTERSPRERENDER, STATE_RENDERING, STATE_SPINNING };
 
 		Engine* engine;
 
 		struct {
 			Object3DRenderer_InstancedRenderFunctionParameters parameters;
-			unordered_map<string, unordered_map<string, vector<Object3D*>>> objectsByShadersAndModels;
 			TransparentRenderFacesPool* transparentRenderFacesPool;
 		} rendering;
 
@@ -375,6 +400,18 @@ private:
 		vector<EntityHierarchy*>& entityHierarchies
 	);
 
+	/**
+	 * Updates particles of auto emit points and fog particle systems
+	 * @param threadCount thread count
+	 * @param threadIdx thread idx
+	 */
+	void updateParticlesFunction(int threadCount, int threadIdx);
+
+	/**
+	 * Emits and updates particles of auto emit particle systems, independent points and fog particle systems are updated using engine threads
+	 */
+	void updateParticles();
+
 	/**
 	 * Computes visibility and transformations
 	 * @param threadCount thread count
@@ -387,6 +424,24 @@ private:
 	 */
 	void computeTransformations();
 
+	/**
+	 * Prepare shadow maps, which determines shadow casters and does their transformations and pre render steps using engine threads
+	 */
+	void prepareShadowMaps();
+
+	/**
+	 * Update light clusters of clustered lights, which bins clustered lights into camera view frustum clusters using engine threads and uploads them
+	 * @param context context
+	 */
+	void updateLightClusters(void* context);
+
+	/**
+	 * Add instance memory usage of given entity and its sub entities to model memory statistics
+	 * @param entity entity
+	 * @param modelMemoryStatistics model memory statistics by model id
+	 */
+	void computeModelMemoryStatistics(Entity* entity, map<string, ModelMemoryStatistics>& modelMemoryStatistics);
+
 	/**
 	 * Set up GUI mode rendering
 	 */
@@ -415,6 +470,13 @@ public:
 		return Engine::textureManager;
 	}
 
+	/**
+	 * @return streaming manager, which loads models, textures and file content asynchronously
+	 */
+	inline static StreamingManager* getStreamingManager() {
+		return Engine::streamingManager;
+	}
+
 	/**
 	 * @return engine thread count
 	 */
@@ -460,6 +522,54 @@ public:
 		Engine::animationBlendingTime = animationBlendingTime;
 	}
 
+	/**
+	 * @return if using packed vertices for static meshes if supported by renderer, see VertexPacking
+	 */
+	inline static bool isPackedVertices() {
+		return Engine::packedVertices;
+	}
+
+	/**
+	 * Set if using packed vertices for static meshes if supported by renderer, needs to be set before creating objects
+	 * @param packedVertices packed vertices
+	 */
+	inline static void setPackedVertices(bool packedVertices) {
+		Engine::packedVertices = packedVertices;
+	}
+
+	/**
+	 * @return if using software renderer, which does not require a GL or Vulkan context, e.g. for headless tests and benchmarks
+	 */
+	inline static bool isSoftwareRendering() {
+		return Engine::softwareRendering;
+	}
+
+	/**
+	 * Set if using software renderer, needs to be set before initializing the engine
+	 * @param softwareRendering software rendering
+	 */
+	inline static void setSoftwareRendering(bool softwareRendering) {
+		Engine::softwareRendering = softwareRendering;
+	}
+
+	/**
+	 * @return transparency sorting, which is sorting transparent faces by face distance or by object distance
+	 */
+	inline static TransparencySorting getTransparencySorting() {
+		return Engine::transparencySorting;
+	}
+
+	/**
+	 * Set transparency sorting
+	 * 	TRANSPARENCYSORTING_FACES sorts each transparent face by its own distance from camera
+	 * 	TRANSPARENCYSORTING_OBJECTS sorts transparent faces of an object group as a whole by object distance from camera,
+	 * 	which is a lot faster with many transparent faces, but faces within an object are not ordered
+	 * @param transparencySorting transparency sorting
+	 */
+	inline static void setTransparencySorting(TransparencySorting transparencySorting) {
+		Engine::transparencySorting = transparencySorting;
+	}
+
 	/** 
 	 * @return shadow map light eye distance scale
 	 */
@@ -514,6 +624,31 @@ public:
 		Engine::shadowMapRenderLookUps = shadowMapRenderLookUps;
 	}
 
+	/**
+	 * @return shadow map cascades for directional lights
+	 */
+	inline static int32_t getShadowMapCascades() {
+		return Engine::shadowMapCascades;
+	}
+
+	/**
+	 * @return shadow map cascade split lambda, which blends between uniform(0.0) and logarithmic(1.0) splits
+	 */
+	inline static float getShadowMapCascadeSplitLambda() {
+		return Engine::shadowMapCascadeSplitLambda;
+	}
+
+	/**
+	 * Set shadow map cascades for directional lights, which are lights with position w component being 0.0
+	 * 	Each cascade is rendered into its own shadow map and covers a view depth range of the camera
+	 * @param cascades cascades, 1 disables cascaded shadow mapping
+	 * @param splitLambda split lambda, which blends between uniform(0.0) and logarithmic(1.0) splits
+	 */
+	inline static void setShadowMapCascades(int32_t cascades, float splitLambda = 0.75f) {
+		Engine::shadowMapCascades = cascades < 1?1:cascades;
+		Engine::shadowMapCascadeSplitLambda = splitLambda;
+	}
+
 	/**
 	 * @return distance of animated object including skinned objects from which animation computation will be computed only every second frame
 	 */
@@ -640,6 +775,29 @@ public:
 		return &lights[idx];
 	}
 
+	/**
+	 * @return count of clustered lights
+	 */
+	inline int32_t getClusteredLightCount() {
+		return clusteredLights.size();
+	}
+
+	/**
+	 * Set count of clustered lights, which are point and spot lights additionally to the fixed lights that are binned into view frustum clusters
+	 * 	Clustered lights require texture buffer object support by renderer, otherwise they are ignored
+	 * @param clusteredLightCount clustered light count, which will be clamped to LightClusters::LIGHTS_MAX
+	 */
+	void setClusteredLightCount(int32_t clusteredLightCount);
+
+	/**
+	 * Returns clustered light at idx (0 <= idx < clustered light count)
+	 * @param idx idx
+	 * @return Light
+	 */
+	inline Light* getClusteredLightAt(int32_t idx) {
+		return &clusteredLights[idx];
+	}
+
 	/** 
 	 * @return scene / background color
 	 */
@@ -692,6 +850,62 @@ public:
 	 */
 	void reset();
 
+	/**
+	 * Compute memory statistics per model, which are shared mesh memory usage and instance memory usage of objects in engine
+	 * @param modelMemoryStatistics model memory statistics by model id
+	 */
+	void computeModelMemoryStatistics(map<string, ModelMemoryStatistics>& modelMemoryStatistics);
+
+	/**
+	 * Print memory statistics per model to console
+	 */
+	void printModelMemoryStatistics();
+
+	/**
+	 * Get rendering statistics of last frame, which are render queue entries, batches, state changes, draw calls, instances and uploaded instance data and instance indices bytes
+	 * @param renderingStatistics rendering statistics
+	 */
+	void getRenderingStatistics(RenderingStatistics& renderingStatistics);
+
+	/**
+	 * Get shadow mapping statistics of given light of last frame, which are cascades, shadow caster entities, shadow casters and times
+	 * @param lightIdx light index
+	 * @param shadowMappingStatistics shadow mapping statistics
+	 */
+	void getShadowMappingStatistics(int32_t lightIdx, ShadowMappingStatistics& shadowMappingStatistics);
+
+	/**
+	 * @return if occlusion culling is enabled
+	 */
+	inline bool isOcclusionCulling() {
+		return occlusionCulling != nullptr;
+	}
+
+	/**
+	 * Enable/disable occlusion culling
+	 * 	Entities in camera frustum get tested against a CPU depth buffer of objects that are marked as occluder, see Object3D::setOccluder()
+	 * @param occlusionCulling occlusion culling
+	 */
+	void setOcclusionCulling(bool occlusionCulling);
+
+	/**
+	 * Get occlusion culling statistics of last frame, which are occluders, occluder triangles, tested and culled entities
+	 * @param occlusionCullingStatistics occlusion culling statistics
+	 */
+	void getOcclusionCullingStatistics(OcclusionCullingStatistics& occlusionCullingStatistics);
+
+	/**
+	 * Get visibility cache statistics of last frame, which tell if camera frustum visible entities have been reused, patched or fully looked up
+	 * @param visibilityCacheStatistics visibility cache statistics
+	 */
+	void getVisibilityCacheStatistics(VisibilityCacheStatistics& visibilityCacheStatistics);
+
+	/**
+	 * Get light clusters statistics of last frame, which are visible clustered lights, cluster light references, dropped cluster light references and binning time
+	 * @param lightClustersStatistics light clusters statistics
+	 */
+	void getLightClustersStatistics(LightClustersStatistics& lightClustersStatistics);
+
 	/** 
 	 * Initialize render engine
 	 */
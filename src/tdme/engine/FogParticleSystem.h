@@ -39,6 +39,7 @@ class tdme::engine::FogParticleSystem final
 	: public FogParticleSystemInternal
 	, public ParticleSystemEntity
 {
+	friend class tdme::engine::Engine;
 	friend class tdme::engine::ParticleSystemGroup;
 
 private:
@@ -39,6 +39,7 @@ void Frustum::updateFrustum()
 	projectionMatrixTransposed.set(renderer->getProjectionMatrix()).transpose();
 	modelViewMatrixTransposed.set(renderer->getModelViewMatrix()).transpose();
 	frustumMatrix.set(projectionMatrixTransposed).multiply(modelViewMatrixTransposed);
+	version++;
 	auto& data = frustumMatrix.getArray();
 	float x, y, z, d, t;
 
@@ -45,12 +45,22 @@ private:
 
 	array<Plane, 6> planes;
 
+	int64_t version { 0LL };
+
 public:
 	/** 
 	 * Setups frustum, should be called if frustum did change 
 	 */
 	void updateFrustum();
 
+	/**
+	 * Get version, which is increased every time the frustum has been set up, can be used to cache look ups
+	 * @return version
+	 */
+	inline int64_t getVersion() {
+		return version;
+	}
+
 	/** 
 	 * Checks if given vector is in frustum
 	 * @param vector vecto
@@ -47,6 +47,7 @@ public:
 	enum LODLevelType { LODLEVELTYPE_NONE, LODLEVELTYPE_MODEL, LODLEVELTYPE_IGNORE };
 
 private:
+	friend class Engine;
 	friend class Object3DRenderGroup;
 
 	Engine* engine { nullptr };
@@ -148,19 +149,17 @@ public:
 		if (objectLOD != nullptr) {
 			// set effect colors
 			if (objectLOD != nullptr) {
+				// compute effect colors first, as setting them on LOD object marks its instance data as changed
+				Color4 effectColorAdd(0.0f, 0.0f, 0.0f, 0.0f);
+				Color4 effectColorMul(1.0f, 1.0f, 1.0f, 1.0f);
 				if (levelLOD == 3) {
-					objectLOD->setEffectColorAdd(effectColorAddLOD3);
-					objectLOD->setEffectColorMul(effectColorMulLOD3);
+					effectColorAdd = effectColorAddLOD3;
+					effectColorMul = effectColorMulLOD3;
 				} else
 				if (levelLOD == 2) {
-					objectLOD->setEffectColorAdd(effectColorAddLOD2);
-					objectLOD->setEffectColorMul(effectColorMulLOD2);
-				} else {
-					objectLOD->setEffectColorAdd(Color4(0.0f, 0.0f, 0.0f, 0.0f));
-					objectLOD->setEffectColorMul(Color4(1.0f, 1.0f, 1.0f, 1.0f));
+					effectColorAdd = effectColorAddLOD2;
+					effectColorMul = effectColorMulLOD2;
 				}
-				auto effectColorAdd = objectLOD->getEffectColorAdd();
-				auto effectColorMul = objectLOD->getEffectColorMul();
 				effectColorAdd.add(this->effectColorAdd);
 				effectColorMul.scale(this->effectColorMul);
 				objectLOD->setEffectColorAdd(effectColorAdd);
@@ -172,6 +171,14 @@ public:
 		return objectLOD;
 	}
 
+	/**
+	 * Get current LOD object without applying LOD effect colors, which is safe to be called from several threads
+	 * @return LOD object
+	 */
+	inline Object3D* getCurrentLODObject() {
+		return objectLOD;
+	}
+
 	/**
 	 * Get current lod object
 	 * @param camera camera
@@ -202,19 +209,17 @@ public:
 
 		// set effect colors
 		if (objectLOD != nullptr) {
+			// compute effect colors first, as setting them on LOD object marks its instance data as changed
+			Color4 effectColorAdd(0.0f, 0.0f, 0.0f, 0.0f);
+			Color4 effectColorMul(1.0f, 1.0f, 1.0f, 1.0f);
 			if (levelLOD == 3) {
-				objectLOD->setEffectColorAdd(effectColorAddLOD3);
-				objectLOD->setEffectColorMul(effectColorMulLOD3);
+				effectColorAdd = effectColorAddLOD3;
+				effectColorMul = effectColorMulLOD3;
 			} else
 			if (levelLOD == 2) {
-				objectLOD->setEffectColorAdd(effectColorAddLOD2);
-				objectLOD->setEffectColorMul(effectColorMulLOD2);
-			} else {
-				objectLOD->setEffectColorAdd(Color4(0.0f, 0.0f, 0.0f, 0.0f));
-				objectLOD->setEffectColorMul(Color4(1.0f, 1.0f, 1.0f, 1.0f));
+				effectColorAdd = effectColorAddLOD2;
+				effectColorMul = effectColorMulLOD2;
 			}
-			auto effectColorAdd = objectLOD->getEffectColorAdd();
-			auto effectColorMul = objectLOD->getEffectColorMul();
 			effectColorAdd.add(this->effectColorAdd);
 			effectColorMul.scale(this->effectColorMul);
 			objectLOD->setEffectColorAdd(effectColorAdd);
@@ -7,6 +7,7 @@
 #include <tdme/engine/Transformations.h>
 #include <tdme/engine/model/fwd-tdme.h>
 #include <tdme/engine/subsystems/renderer/fwd-tdme.h>
+#include <tdme/engine/subsystems/rendering/Object3DRenderer.h>
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/math/Vector3.h>
 #include <tdme/math/Quaternion.h>
@@ -17,6 +18,7 @@ using tdme::engine::Object3D;
 using tdme::engine::Engine;
 using tdme::engine::Partition;
 using tdme::engine::Transformations;
+using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
 using tdme::math::Quaternion;
@@ -39,6 +41,16 @@ void Object3D::setRenderer(Renderer* renderer)
 {
 }
 
+void Object3D::setShader(const string& id) {
+	shaderId = id;
+	shaderIdx = Object3DRenderer::getShaderIdx(id);
+}
+
+void Object3D::setDistanceShader(const string& id) {
+	distanceShaderId = id;
+	distanceShaderIdx = id.empty() == true?-1:Object3DRenderer::getShaderIdx(id);
+}
+
 void Object3D::fromTransformations(const Transformations& transformations)
 {
 	Object3DInternal::fromTransformations(transformations);
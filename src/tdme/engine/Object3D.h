@@ -62,17 +62,24 @@ private:
 	friend class Object3DRenderGroup;
 	friend class ObjectParticleSystem;
 	friend class SkinnedObject3DRenderGroup;
+	friend class tdme::engine::subsystems::rendering::Object3DRenderer;
 	friend class tdme::engine::subsystems::shadowmapping::ShadowMap;
+	friend class tdme::engine::subsystems::shadowmapping::ShadowMapping;
 
 	Engine* engine { nullptr };
 	Entity* parentEntity { nullptr };
 	bool frustumCulling { true };
 	string shaderId { "default" };
 	string distanceShaderId { "" };
+	int32_t shaderIdx { 0 };
+	int32_t distanceShaderIdx { -1 };
 	float distanceShaderDistance { 50.0f };
 	RenderPass renderPass { RENDERPASS_OBJECTS };
 	bool enableEarlyZRejection { false };
 	bool disableDepthTest { false };
+	bool occluder { false };
+	bool occluderUsingBoundingBox { false };
+	BoundingBox occluderBoundingBox;
 	int64_t frameTransformationsLast { -1LL };
 	int64_t timeTransformationsLast { -1LL };
 
@@ -297,9 +304,7 @@ public:
 	 * Set shader
 	 * @param id shader id
 	 */
-	inline void setShader(const string& id) {
-		shaderId = id;
-	}
+	void setShader(const string& id);
 
 	/**
 	 * @return distance shader id
@@ -312,9 +317,7 @@ public:
 	 * Set distance shader
 	 * @param id shader id
 	 */
-	inline void setDistanceShader(const string& id) {
-		distanceShaderId = id;
-	}
+	void setDistanceShader(const string& id);
 
 	/**
 	 * @return distance shader distance
@@ -376,4 +379,30 @@ public:
 		this->disableDepthTest = disableDepthTest;
 	}
 
+	/**
+	 * @return if object is a occluder for occlusion culling
+	 */
+	inline bool isOccluder() const {
+		return occluder;
+	}
+
+	/**
+	 * @return occluder bounding box in object space or nullptr if model triangles are used as occluder geometry
+	 */
+	inline BoundingBox* getOccluderBoundingBox() {
+		return occluderUsingBoundingBox == true?&occluderBoundingBox:nullptr;
+	}
+
+	/**
+	 * Set if object is a occluder for occlusion culling
+	 * 	Occluder geometry must not exceed the rendered geometry, so a occluder bounding box should be fully contained in the model
+	 * @param occluder occluder
+	 * @param occluderBoundingBox simplified occluder geometry as bounding box in object space or nullptr to use model triangles
+	 */
+	inline void setOccluder(bool occluder, BoundingBox* occluderBoundingBox = nullptr) {
+		this->occluder = occluder;
+		this->occluderUsingBoundingBox = occluderBoundingBox != nullptr;
+		if (occluderBoundingBox != nullptr) this->occluderBoundingBox.fromBoundingVolume(occluderBoundingBox);
+	}
+
 };
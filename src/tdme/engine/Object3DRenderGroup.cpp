@@ -1,5 +1,6 @@
 #include <tdme/engine/Object3DRenderGroup.h>
 
+#include <map>
 #include <string>
 #include <vector>
 
@@ -16,12 +17,15 @@
 #include <tdme/engine/model/ModelHelper.h>
 #include <tdme/engine/model/RotationOrder.h>
 #include <tdme/engine/model/UpVector.h>
+#include <tdme/engine/model/TextureAtlasBaker.h>
+#include <tdme/engine/model/TextureAtlasStatistics.h>
 #include <tdme/engine/model/TextureCoordinate.h>
 #include <tdme/engine/primitives/BoundingBox.h>
 #include <tdme/math/Math.h>
 #include <tdme/math/Vector3.h>
 #include <tdme/math/Matrix4x4.h>
 
+using std::map;
 using std::string;
 using std::to_string;
 using std::vector;
@@ -39,6 +43,8 @@ using tdme::engine::model::Model;
 using tdme::engine::model::ModelHelper;
 using tdme::engine::model::RotationOrder;
 using tdme::engine::model::UpVector;
+using tdme::engine::model::TextureAtlasBaker;
+using tdme::engine::model::TextureAtlasStatistics;
 using tdme::engine::model::TextureCoordinate;
 using tdme::engine::Transformations;
 using tdme::engine::primitives::BoundingBox;
@@ -98,17 +104,18 @@ void Object3DRenderGroup::setModel(Model* model) {
 	this->model = model;
 }
 
-void Object3DRenderGroup::combineGroup(Group* sourceGroup, const vector<Vector3>& origins, const vector<Matrix4x4>& objectParentTransformationsMatrices, Model* combinedModel) {
-	// create group in combined model
-	auto combinedModelGroup = combinedModel->getGroupById(sourceGroup->getId());
+void Object3DRenderGroup::combineGroup(Group* sourceGroup, const vector<Vector3>& origins, const vector<Matrix4x4>& objectParentTransformationsMatrices, Model* combinedModel, const string& idPrefix, TextureAtlasBaker* textureAtlasBaker) {
+	// create group in combined model, with texture atlas all geometry goes into a single group to be able to share faces entities
+	auto combinedModelGroupId = textureAtlasBaker != nullptr?string("atlas"):idPrefix + sourceGroup->getId();
+	auto combinedModelGroup = combinedModel->getGroupById(combinedModelGroupId);
 	if (combinedModelGroup == nullptr) {
 		combinedModelGroup = new Group(
 			combinedModel,
-			sourceGroup->getParentGroup() == nullptr?nullptr:combinedModel->getGroupById(sourceGroup->getParentGroup()->getId()),
-			sourceGroup->getId(),
-			sourceGroup->getName()
+			textureAtlasBaker != nullptr || sourceGroup->getParentGroup() == nullptr?nullptr:combinedModel->getGroupById(idPrefix + sourceGroup->getParentGroup()->getId()),
+			combinedModelGroupId,
+			textureAtlasBaker != nullptr?combinedModelGroupId:idPrefix + sourceGroup->getName()
 		);
-		if (sourceGroup->getParentGroup() == nullptr) {
+		if (combinedModelGroup->getParentGroup() == nullptr) {
 			combinedModel->getSubGroups()[combinedModelGroup->getId()] = combinedModelGroup;
 		} else {
 			combinedModelGroup->getParentGroup()->getSubGroups()[combinedModelGroup->getId()] = combinedModelGroup;
@@ -139,6 +146,22 @@ void Object3DRenderGroup::combineGroup(Group* sourceGroup, const vector<Vector3>
 		auto combinedModelGroupTangentsIdxStart = combinedModelGroupTangents.size();
 		auto combinedModelGroupBitangentsIdxStart = combinedModelGroupBitangents.size();
 
+		// remap texture coordinates of texture atlas materials once
+		auto sourceGroupTextureCoordinates = sourceGroup->getTextureCoordinates();
+		if (textureAtlasBaker != nullptr) {
+			vector<bool> sourceGroupTextureCoordinatesRemapped(sourceGroupTextureCoordinatesSize, false);
+			for (auto& facesEntity: sourceGroup->getFacesEntities()) {
+				if (textureAtlasBaker->getAtlasMaterial(facesEntity.getMaterial()) == nullptr) continue;
+				for (auto& face: facesEntity.getFaces()) {
+					for (auto textureCoordinateIdx: face.getTextureCoordinateIndices()) {
+						if (sourceGroupTextureCoordinatesRemapped[textureCoordinateIdx] == true) continue;
+						sourceGroupTextureCoordinates[textureCoordinateIdx] = textureAtlasBaker->remapTextureCoordinate(facesEntity.getMaterial(), sourceGroup->getTextureCoordinates()[textureCoordinateIdx]);
+						sourceGroupTextureCoordinatesRemapped[textureCoordinateIdx] = true;
+					}
+				}
+			}
+		}
+
 		// add vertices and such from source group to new group
 		{
 			auto i = 0;
@@ -156,7 +179,7 @@ void Object3DRenderGroup::combineGroup(Group* sourceGroup, const vector<Vector3>
 				for (auto& normal: sourceGroup->getNormals()) {
 					combinedModelGroupNormals.push_back(transformationsMatrix.multiplyNoTranslation(normal, tmpVector3));
 				}
-				for (auto& textureCoordinate: sourceGroup->getTextureCoordinates()) {
+				for (auto& textureCoordinate: sourceGroupTextureCoordinates) {
 					combinedModelGroupTextureCoordinates.push_back(textureCoordinate);
 				}
 				for (auto& tangent: sourceGroup->getTangents()) {
@@ -175,10 +198,17 @@ void Object3DRenderGroup::combineGroup(Group* sourceGroup, const vector<Vector3>
 			bool haveTextureCoordinates = facesEntity.isTextureCoordinatesAvailable();
 			bool haveTangentsBitangents = facesEntity.isTangentBitangentAvailable();
 
+			// determine faces entity id and material, faces entities are combined by material with texture atlas
+			auto material = facesEntity.getMaterial();
+			auto atlasMaterial = textureAtlasBaker != nullptr?textureAtlasBaker->getAtlasMaterial(material):nullptr;
+			if (atlasMaterial != nullptr) material = atlasMaterial;
+			auto combinedModelGroupMaterialId = atlasMaterial != nullptr?material->getId():idPrefix + material->getId();
+			auto combinedModelGroupFacesEntityId = textureAtlasBaker != nullptr?combinedModelGroupMaterialId:idPrefix + facesEntity.getId();
+
 			// get faces entity
 			FacesEntity* combinedModelGroupFacesEntity = nullptr;
 			for (auto& combinedModelGroupFacesEntityExisting: combinedModelGroupFacesEntities) {
-				if (combinedModelGroupFacesEntityExisting.getId() == facesEntity.getId()) {
+				if (combinedModelGroupFacesEntityExisting.getId() == combinedModelGroupFacesEntityId) {
 					combinedModelGroupFacesEntity = &combinedModelGroupFacesEntityExisting;
 					break;
 				}
@@ -187,13 +217,13 @@ void Object3DRenderGroup::combineGroup(Group* sourceGroup, const vector<Vector3>
 			if (combinedModelGroupFacesEntity == nullptr) {
 				auto newFacesEntity = FacesEntity(
 					combinedModelGroup,
-					facesEntity.getId()
+					combinedModelGroupFacesEntityId
 				);
 				combinedModelGroupFacesEntities.push_back(newFacesEntity);
 				combinedModelGroupFacesEntity = &combinedModelGroupFacesEntities[combinedModelGroupFacesEntities.size() - 1];
-				auto combinedModelGroupFacesEntityMaterial = combinedModel->getMaterials()[facesEntity.getMaterial()->getId()];
+				auto combinedModelGroupFacesEntityMaterial = combinedModel->getMaterials()[combinedModelGroupMaterialId];
 				if (combinedModelGroupFacesEntityMaterial == nullptr) {
-					combinedModelGroupFacesEntityMaterial = ModelHelper::cloneMaterial(facesEntity.getMaterial());
+					combinedModelGroupFacesEntityMaterial = ModelHelper::cloneMaterial(material, combinedModelGroupMaterialId);
 					combinedModel->getMaterials()[combinedModelGroupFacesEntityMaterial->getId()] = combinedModelGroupFacesEntityMaterial;
 				}
 				combinedModelGroupFacesEntity->setMaterial(combinedModelGroupFacesEntityMaterial);
@@ -273,11 +303,11 @@ void Object3DRenderGroup::combineGroup(Group* sourceGroup, const vector<Vector3>
 
 	// do child groups
 	for (auto groupIt: sourceGroup->getSubGroups()) {
-		combineGroup(groupIt.second, origins, objectParentTransformationsMatrices, combinedModel);
+		combineGroup(groupIt.second, origins, objectParentTransformationsMatrices, combinedModel, idPrefix, textureAtlasBaker);
 	}
 }
 
-void Object3DRenderGroup::combineObjects(Model* model, const vector<Transformations>& objectsTransformations, Model* combinedModel) {
+void Object3DRenderGroup::combineObjects(Model* model, const vector<Transformations>& objectsTransformations, Model* combinedModel, const string& idPrefix, TextureAtlasBaker* textureAtlasBaker) {
 	vector<Matrix4x4> objectTransformationMatrices;
 	vector<Vector3> origins;
 	for (auto& objectTransformations: objectsTransformations) {
@@ -288,8 +318,19 @@ void Object3DRenderGroup::combineObjects(Model* model, const vector<Transformati
 		origins.push_back(objectTransformations.getTranslation());
 	}
 	for (auto groupIt: model->getSubGroups()) {
-		combineGroup(groupIt.second, origins, objectTransformationMatrices, combinedModel);
+		combineGroup(groupIt.second, origins, objectTransformationMatrices, combinedModel, idPrefix, textureAtlasBaker);
+	}
+}
+
+int32_t Object3DRenderGroup::computeFacesEntityCount(const map<string, Group*>& groups) {
+	auto facesEntityCount = 0;
+	for (auto groupIt: groups) {
+		for (auto& facesEntity: groupIt.second->getFacesEntities()) {
+			if (facesEntity.getFaces().size() > 0) facesEntityCount++;
+		}
+		facesEntityCount+= computeFacesEntityCount(groupIt.second->getSubGroups());
 	}
+	return facesEntityCount;
 }
 
 void Object3DRenderGroup::updateRenderGroup() {
@@ -311,23 +352,61 @@ void Object3DRenderGroup::updateRenderGroup() {
 		);
 	}
 
+	// group objects by model in order of first occurrence
+	vector<Model*> models;
+	vector<vector<Transformations>> modelsObjectsTransformations;
+	textureAtlasStatistics = TextureAtlasStatistics();
+	for (auto i = 0; i < objectsTransformations.size(); i++) {
+		auto objectModel = objectsModels[i] == nullptr?model:objectsModels[i];
+		if (objectModel == nullptr) continue;
+		auto modelIdx = 0;
+		for (; modelIdx < models.size(); modelIdx++) {
+			if (models[modelIdx] == objectModel) break;
+		}
+		if (modelIdx == models.size()) {
+			models.push_back(objectModel);
+			modelsObjectsTransformations.push_back(vector<Transformations>());
+		}
+		modelsObjectsTransformations[modelIdx].push_back(objectsTransformations[i]);
+		textureAtlasStatistics.drawCount+= computeFacesEntityCount(objectModel->getSubGroups());
+	}
+
+	// bake texture atlas of materials of all models
+	TextureAtlasBaker* textureAtlasBaker = nullptr;
+	if (textureAtlasEnabled == true) {
+		textureAtlasBaker = new TextureAtlasBaker(id);
+		for (auto atlasModel: models) textureAtlasBaker->addModel(atlasModel);
+		textureAtlasBaker->bake(&textureAtlasStatistics);
+	}
+
 	auto lodLevel = 0;
 	for (auto combinedModel: combinedModels) {
 		auto reduceByFactor = lodReduceBy[lodLevel];
 		lodLevel++;
-		auto objectCount = 0;
-		vector<Transformations> reducedObjectsTransformations;
-		for (auto& objectTransformations: objectsTransformations) {
-			if (objectCount % reduceByFactor != 0) {
+		for (auto modelIdx = 0; modelIdx < models.size(); modelIdx++) {
+			auto objectCount = 0;
+			vector<Transformations> reducedObjectsTransformations;
+			for (auto& objectTransformations: modelsObjectsTransformations[modelIdx]) {
+				if (objectCount % reduceByFactor != 0) {
+					objectCount++;
+					continue;
+				}
+				reducedObjectsTransformations.push_back(objectTransformations);
 				objectCount++;
-				continue;
 			}
-			reducedObjectsTransformations.push_back(objectTransformations);
-			objectCount++;
+			combineObjects(
+				models[modelIdx],
+				reducedObjectsTransformations,
+				combinedModel,
+				models[modelIdx] == model?string():models[modelIdx]->getId() + ".",
+				textureAtlasBaker
+			);
 		}
-		combineObjects(model, reducedObjectsTransformations, combinedModel);
 	}
 
+	// atlas materials have been cloned into combined models
+	if (textureAtlasBaker != nullptr) delete textureAtlasBaker;
+
 	// create new combined object
 	for (auto combinedModel: combinedModels) {
 		if (combinedModel != nullptr) {
@@ -338,6 +417,7 @@ void Object3DRenderGroup::updateRenderGroup() {
 			ModelHelper::fixAnimationLength(combinedModel);
 		}
 	}
+	textureAtlasStatistics.combinedDrawCount = computeFacesEntityCount(combinedModels[0]->getSubGroups());
 
 	if (combinedModels.size() == 1) {
 		auto combinedObject3D = new Object3D(id, combinedModels[0]);
@@ -381,6 +461,12 @@ void Object3DRenderGroup::updateRenderGroup() {
 
 void Object3DRenderGroup::addObject(const Transformations& transformations) {
 	objectsTransformations.push_back(transformations);
+	objectsModels.push_back(nullptr);
+}
+
+void Object3DRenderGroup::addObject(Model* model, const Transformations& transformations) {
+	objectsTransformations.push_back(transformations);
+	objectsModels.push_back(model == this->model?nullptr:model);
 }
 
 void Object3DRenderGroup::setEngine(Engine* engine)
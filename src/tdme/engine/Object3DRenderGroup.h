@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <map>
 #include <string>
 #include <vector>
 
@@ -17,12 +18,14 @@
 #include <tdme/engine/model/Color4.h>
 #include <tdme/engine/model/Group.h>
 #include <tdme/engine/model/Model.h>
+#include <tdme/engine/model/TextureAtlasStatistics.h>
 #include <tdme/engine/primitives/fwd-tdme.h>
 #include <tdme/engine/subsystems/renderer/fwd-tdme.h>
 #include <tdme/math/fwd-tdme.h>
 #include <tdme/engine/Entity.h>
 
 using std::array;
+using std::map;
 using std::string;
 using std::to_string;
 using std::vector;
@@ -36,6 +39,8 @@ using tdme::engine::Transformations;
 using tdme::engine::model::Color4;
 using tdme::engine::model::Group;
 using tdme::engine::model::Model;
+using tdme::engine::model::TextureAtlasBaker;
+using tdme::engine::model::TextureAtlasStatistics;
 using tdme::engine::primitives::BoundingBox;
 using tdme::engine::subsystems::renderer::Renderer;
 using tdme::math::Matrix4x4;
@@ -68,6 +73,7 @@ private:
 	float modelLOD3MinDistance;
 	Entity* combinedEntity;
 	vector<Transformations> objectsTransformations;
+	vector<Model*> objectsModels;
 	Model* model;
 	vector<Model*> combinedModels;
 	string shaderId { "default" };
@@ -75,6 +81,8 @@ private:
 	float distanceShaderDistance { 50.0f };
 	array<int, 3> lodReduceBy;
 	bool enableEarlyZRejection { false };
+	bool textureAtlasEnabled { false };
+	TextureAtlasStatistics textureAtlasStatistics;
 
 	/**
 	 * Compute bounding box
@@ -91,19 +99,27 @@ private:
 	 * @param origins origins
 	 * @param objectParentTransformationsMatrices object parent transformations matrix
 	 * @param combinedModel combined model
-	 * @param reduceFactorBy reduce factor by
+	 * @param idPrefix id prefix for groups, faces entities and materials of source model
+	 * @param textureAtlasBaker texture atlas baker or null, if given geometry is combined into a single group and faces entities are combined by atlas material
 	 */
-	static void combineGroup(Group* sourceGroup, const vector<Vector3>& origins, const vector<Matrix4x4>& objectParentTransformationsMatrices, Model* combinedModel);
+	static void combineGroup(Group* sourceGroup, const vector<Vector3>& origins, const vector<Matrix4x4>& objectParentTransformationsMatrices, Model* combinedModel, const string& idPrefix, TextureAtlasBaker* textureAtlasBaker);
 
 	/**
 	 * Combine model with transformations into current model
 	 * @param model model
 	 * @param transformations transformations
 	 * @param combinedModel combined model
-	 * @param reduceFactorBy reduce factor by
-	 * @return model
+	 * @param idPrefix id prefix for groups, faces entities and materials of model
+	 * @param textureAtlasBaker texture atlas baker or null
 	 */
-	static void combineObjects(Model* model, const vector<Transformations>& objectsTransformations, Model* combinedModel);
+	static void combineObjects(Model* model, const vector<Transformations>& objectsTransformations, Model* combinedModel, const string& idPrefix, TextureAtlasBaker* textureAtlasBaker);
+
+	/**
+	 * Compute count of faces entities with faces of given groups and its sub groups, which equals the draw calls required to render them
+	 * @param groups groups
+	 * @return faces entity count
+	 */
+	static int32_t computeFacesEntityCount(const map<string, Group*>& groups);
 
 	// overridden methods
 	inline void setParentEntity(Entity* entity) override {
@@ -185,6 +201,36 @@ public:
 	 */
 	void addObject(const Transformations& transformations);
 
+	/**
+	 * Adds a instance of a different model to this render group
+	 * 	Models other than render group model can only share draw calls with other models if texture atlas is enabled
+	 * @param model model
+	 * @param transformations transformations
+	 */
+	void addObject(Model* model, const Transformations& transformations);
+
+	/**
+	 * @return if texture atlas is enabled
+	 */
+	inline bool isTextureAtlasEnabled() const {
+		return textureAtlasEnabled;
+	}
+
+	/**
+	 * Enable/disable texture atlas, which bakes textures of compatible materials into texture atlases when updating render group
+	 * @param textureAtlasEnabled texture atlas enabled
+	 */
+	inline void setTextureAtlasEnabled(bool textureAtlasEnabled) {
+		this->textureAtlasEnabled = textureAtlasEnabled;
+	}
+
+	/**
+	 * @return texture atlas statistics of last render group update, draw counts are available without texture atlas enabled too
+	 */
+	inline const TextureAtlasStatistics& getTextureAtlasStatistics() const {
+		return textureAtlasStatistics;
+	}
+
 	// overriden methods
 	void dispose() override;
 
@@ -66,6 +66,26 @@ struct tdme::engine::Partition
 	 */
 	virtual VectorIteratorMultiple<Entity*>* getObjectsNearTo(const Vector3& center, const Vector3& halfExtension = Vector3(0.1f, 0.1f, 0.1f)) = 0;
 
+	/**
+	 * Get change count, which is increased when entities are added, updated or removed, can be used to cache look ups
+	 * @return change count or -1 if not supported
+	 */
+	virtual int64_t getChangeCount() {
+		return -1LL;
+	}
+
+	/**
+	 * Get entities that have been added, updated or removed since given change count, can be used to patch cached look ups
+	 * 	Removed entities must not be dereferenced as they could have been disposed already
+	 * @param changeCount change count
+	 * @param updatedEntities entities that have been added or updated and are still in partition
+	 * @param removedEntities entities that have been removed and are not in partition anymore
+	 * @return if changes since given change count are available, if not a full look up is required
+	 */
+	virtual bool getChangedEntities(int64_t changeCount, vector<Entity*>& updatedEntities, vector<Entity*>& removedEntities) {
+		return false;
+	}
+
 	/**
 	 * Destructor
 	 */
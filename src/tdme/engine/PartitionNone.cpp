@@ -19,6 +19,7 @@ PartitionNone::PartitionNone()
 void PartitionNone::reset()
 {
 	entities.clear();
+	changeCount++;
 }
 
 void PartitionNone::addEntity(Entity* entity)
@@ -28,10 +29,12 @@ void PartitionNone::addEntity(Entity* entity)
 	}
 
 	entities.push_back(entity);
+	changeCount++;
 }
 
 void PartitionNone::updateEntity(Entity* entity)
 {
+	changeCount++;
 }
 
 void PartitionNone::removeEntity(Entity* entity)
@@ -39,6 +42,7 @@ void PartitionNone::removeEntity(Entity* entity)
 	for (int i = 0; i < entities.size(); i++) {
 		if (entities[i] == entity) {
 			entities.erase(entities.begin() + i);
+			changeCount++;
 			return;
 		}
 	}
@@ -58,3 +62,8 @@ VectorIteratorMultiple<Entity*>* PartitionNone::getObjectsNearTo(const Vector3&
 {
 	return &arrayListIteratorMultiple;
 }
+
+int64_t PartitionNone::getChangeCount()
+{
+	return changeCount;
+}
@@ -31,6 +31,7 @@ class tdme::engine::PartitionNone final
 private:
 	vector<Entity*> entities;
 	VectorIteratorMultiple<Entity*> arrayListIteratorMultiple;
+	int64_t changeCount { 0LL };
 
 private:
 	void reset() override;
@@ -42,6 +43,7 @@ public:
 	const vector<Entity*>& getVisibleEntities(Frustum* frustum) override;
 	VectorIteratorMultiple<Entity*>* getObjectsNearTo(BoundingVolume* cbv) override;
 	VectorIteratorMultiple<Entity*>* getObjectsNearTo(const Vector3& center, const Vector3& halfExtension = Vector3(0.1f, 0.1f, 0.1f)) override;
+	int64_t getChangeCount() override;
 
 	/**
 	 * Public constructor
@@ -40,6 +40,8 @@ constexpr float PartitionOctTree::PARTITION_SIZE_MIN;
 
 constexpr float PartitionOctTree::PARTITION_SIZE_MAX;
 
+constexpr int32_t PartitionOctTree::CHANGELOG_SIZE_MAX;
+
 PartitionOctTree::PartitionOctTree() 
 {
 	reset();
@@ -54,10 +56,14 @@ void PartitionOctTree::reset()
 	this->treeRoot.y = -1;
 	this->treeRoot.z = -1;
 	this->treeRoot.parent = nullptr;
+	changeCount++;
+	changeLog.clear();
+	changeLogChangeCount = changeCount;
 }
 
 void PartitionOctTree::addEntity(Entity* entity)
 {
+	changeCount++;
 	// update if already exists
 	vector<PartitionOctTree_PartitionTreeNode*>* thisEntityPartitions = nullptr;
 	auto thisEntityPartitionsIt = entityPartitionNodes.find(entity->getId());
@@ -81,10 +87,12 @@ void PartitionOctTree::addEntity(Entity* entity)
 	for (auto zPartition = minZPartition; zPartition <= maxZPartition; zPartition++) {
 		updatePartitionTree(&treeRoot, xPartition, yPartition, zPartition, PARTITION_SIZE_MAX, entity);
 	}
+	logChange(entity, false);
 }
 
 void PartitionOctTree::removeEntity(Entity* entity)
 {
+	changeCount++;
 	// check if we have entity in oct tree
 	vector<PartitionOctTree_PartitionTreeNode*>* objectPartitionsVector = nullptr;
 	auto objectPartitionsVectorIt = entityPartitionNodes.find(entity->getId());
@@ -125,6 +133,7 @@ void PartitionOctTree::removeEntity(Entity* entity)
 		}
 	}
 	entityPartitionNodes.erase(objectPartitionsVectorIt);
+	logChange(entity, true);
 }
 
 const vector<Entity*>& PartitionOctTree::getVisibleEntities(Frustum* frustum)
@@ -138,6 +147,28 @@ const vector<Entity*>& PartitionOctTree::getVisibleEntities(Frustum* frustum)
 	return visibleEntities;
 }
 
+bool PartitionOctTree::getChangedEntities(int64_t changeCount, vector<Entity*>& updatedEntities, vector<Entity*>& removedEntities)
+{
+	updatedEntities.clear();
+	removedEntities.clear();
+	// changes before change log start are not available
+	if (changeCount < changeLogChangeCount) return false;
+	// iterate change log backwards, so the last change of a entity wins
+	changedEntities.clear();
+	for (auto i = static_cast<int32_t>(changeLog.size()) - 1; i >= 0; i--) {
+		auto& changeLogEntry = changeLog[i];
+		if (changeLogEntry.changeCount <= changeCount) break;
+		if (changedEntities.count(changeLogEntry.entity) == 1) continue;
+		changedEntities.insert(changeLogEntry.entity);
+		if (changeLogEntry.removed == true) {
+			removedEntities.push_back(changeLogEntry.entity);
+		} else {
+			updatedEntities.push_back(changeLogEntry.entity);
+		}
+	}
+	return true;
+}
+
 VectorIteratorMultiple<Entity*>* PartitionOctTree::getObjectsNearTo(BoundingVolume* cbv)
 {
 	entityIterator.clear();
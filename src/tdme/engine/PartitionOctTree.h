@@ -50,12 +50,23 @@ class tdme::engine::PartitionOctTree final
 private:
 	static constexpr float PARTITION_SIZE_MIN { 64.0f };
 	static constexpr float PARTITION_SIZE_MAX { 512.0f };
+	static constexpr int32_t CHANGELOG_SIZE_MAX { 8192 };
+
+	struct ChangeLogEntry {
+		int64_t changeCount;
+		Entity* entity;
+		bool removed;
+	};
 
 	VectorIteratorMultiple<Entity*> entityIterator;
 	map<string, vector<PartitionOctTree_PartitionTreeNode*>> entityPartitionNodes;
 	vector<Entity*> visibleEntities;
 	unordered_set<string> visibleEntitiesById;
 	PartitionOctTree_PartitionTreeNode treeRoot;
+	int64_t changeCount { 0LL };
+	vector<ChangeLogEntry> changeLog;
+	int64_t changeLogChangeCount { 0LL };
+	unordered_set<Entity*> changedEntities;
 
 	// overriden methods
 	void reset() override;
@@ -65,6 +76,20 @@ private:
 	}
 	void removeEntity(Entity* entity) override;
 
+	/**
+	 * Log change of given entity with current change count
+	 * @param entity entity
+	 * @param removed removed
+	 */
+	inline void logChange(Entity* entity, bool removed) {
+		// change log is bounded, consumers that are older than the change log do a full look up
+		if (changeLog.size() == CHANGELOG_SIZE_MAX) {
+			changeLog.clear();
+			changeLogChangeCount = changeCount - 1;
+		}
+		changeLog.push_back({changeCount, entity, removed});
+	}
+
 	/** 
 	 * Update partition tree
 	 * @param parent parent
@@ -251,6 +276,10 @@ public:
 	const vector<Entity*>& getVisibleEntities(Frustum* frustum) override;
 	VectorIteratorMultiple<Entity*>* getObjectsNearTo(BoundingVolume* cbv) override;
 	VectorIteratorMultiple<Entity*>* getObjectsNearTo(const Vector3& center, const Vector3& halfExtension = Vector3(0.1f, 0.1f, 0.1f)) override;
+	inline int64_t getChangeCount() override {
+		return changeCount;
+	}
+	bool getChangedEntities(int64_t changeCount, vector<Entity*>& updatedEntities, vector<Entity*>& removedEntities) override;
 
 	/**
 	 * Public constructor
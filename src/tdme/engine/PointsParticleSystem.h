@@ -39,6 +39,7 @@ class tdme::engine::PointsParticleSystem final
 	: public PointsParticleSystemInternal
 	, public ParticleSystemEntity
 {
+	friend class tdme::engine::Engine;
 	friend class tdme::engine::ParticleSystemGroup;
 
 private:
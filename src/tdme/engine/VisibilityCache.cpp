@@ -0,0 +1,106 @@
+#include <tdme/engine/VisibilityCache.h>
+
+#include <unordered_set>
+#include <vector>
+
+#include <tdme/engine/Entity.h>
+#include <tdme/engine/Frustum.h>
+#include <tdme/engine/Partition.h>
+#include <tdme/engine/VisibilityCacheStatistics.h>
+
+using std::unordered_set;
+using std::vector;
+
+using tdme::engine::Entity;
+using tdme::engine::Frustum;
+using tdme::engine::Partition;
+using tdme::engine::VisibilityCache;
+using tdme::engine::VisibilityCacheStatistics;
+
+VisibilityCache::VisibilityCache()
+{
+}
+
+void VisibilityCache::rebuild()
+{
+	visibleEntities.clear();
+	for (auto entity: partition->getVisibleEntities(frustum)) {
+		visibleEntities.push_back(entity);
+	}
+	statistics.rebuilds++;
+}
+
+void VisibilityCache::patch()
+{
+	// remove changed entities from visible entities
+	changedEntities.clear();
+	for (auto entity: updatedEntities) changedEntities.insert(entity);
+	for (auto entity: removedEntities) changedEntities.insert(entity);
+	auto visibleEntityIdx = 0;
+	for (auto i = 0; i < visibleEntities.size(); i++) {
+		auto entity = visibleEntities[i];
+		if (changedEntities.count(entity) == 1) continue;
+		visibleEntities[visibleEntityIdx++] = entity;
+	}
+	visibleEntities.resize(visibleEntityIdx);
+
+	// add added or updated entities that are visible
+	for (auto entity: updatedEntities) {
+		if (frustum->isVisible(entity->getBoundingBoxTransformed()) == false) continue;
+		visibleEntities.push_back(entity);
+	}
+
+	//
+	statistics.partials++;
+	statistics.updatedEntities+= updatedEntities.size();
+	statistics.removedEntities+= removedEntities.size();
+}
+
+const vector<Entity*>& VisibilityCache::getVisibleEntities(Partition* partition, Frustum* frustum)
+{
+	auto partitionChangeCount = partition->getChangeCount();
+	auto frustumVersion = frustum->getVersion();
+	if (partitionChangeCount == -1LL ||
+		partition != this->partition ||
+		frustum != this->frustum ||
+		frustumVersion != this->frustumVersion) {
+		// partition does not support change count, or partition or frustum changed
+		this->partition = partition;
+		this->frustum = frustum;
+		rebuild();
+	} else
+	if (partitionChangeCount == this->partitionChangeCount) {
+		// nothing changed
+		statistics.hits++;
+	} else
+	if (partition->getChangedEntities(this->partitionChangeCount, updatedEntities, removedEntities) == true) {
+		// only some entities changed
+		patch();
+	} else {
+		// partition changes are not available
+		rebuild();
+	}
+	this->frustumVersion = frustumVersion;
+	this->partitionChangeCount = partitionChangeCount;
+	statistics.visibleEntities = visibleEntities.size();
+	return visibleEntities;
+}
+
+void VisibilityCache::invalidate()
+{
+	partition = nullptr;
+	frustum = nullptr;
+	frustumVersion = -1LL;
+	partitionChangeCount = -1LL;
+	visibleEntities.clear();
+}
+
+void VisibilityCache::getStatistics(VisibilityCacheStatistics& statistics)
+{
+	statistics = this->statistics;
+}
+
+void VisibilityCache::resetStatistics()
+{
+	statistics = VisibilityCacheStatistics();
+}
@@ -0,0 +1,77 @@
+#pragma once
+
+#include <unordered_set>
+#include <vector>
+
+#include <tdme/tdme.h>
+#include <tdme/engine/fwd-tdme.h>
+#include <tdme/engine/VisibilityCacheStatistics.h>
+
+using std::unordered_set;
+using std::vector;
+
+using tdme::engine::Entity;
+using tdme::engine::Frustum;
+using tdme::engine::Partition;
+using tdme::engine::VisibilityCacheStatistics;
+
+/**
+ * Visibility cache, which reuses the visible entities of a partition look up as long as frustum and partition did not change
+ * 	and patches them with entities that have been added, updated or removed if only the partition did change
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::engine::VisibilityCache final
+{
+private:
+	Partition* partition { nullptr };
+	Frustum* frustum { nullptr };
+	int64_t frustumVersion { -1LL };
+	int64_t partitionChangeCount { -1LL };
+	vector<Entity*> visibleEntities;
+	vector<Entity*> updatedEntities;
+	vector<Entity*> removedEntities;
+	unordered_set<Entity*> changedEntities;
+	VisibilityCacheStatistics statistics;
+
+	/**
+	 * Do full partition look up
+	 */
+	void rebuild();
+
+	/**
+	 * Patch visible entities with updated and removed entities
+	 */
+	void patch();
+
+public:
+	/**
+	 * Public constructor
+	 */
+	VisibilityCache();
+
+	/**
+	 * Get visible entities
+	 * @param partition partition
+	 * @param frustum frustum
+	 * @return visible entities
+	 */
+	const vector<Entity*>& getVisibleEntities(Partition* partition, Frustum* frustum);
+
+	/**
+	 * Invalidate cache, next look up will be a full partition look up
+	 */
+	void invalidate();
+
+	/**
+	 * Get statistics, hits, partials and rebuilds are accumulated until statistics get reset
+	 * @param statistics statistics
+	 */
+	void getStatistics(VisibilityCacheStatistics& statistics);
+
+	/**
+	 * Reset statistics
+	 */
+	void resetStatistics();
+
+};
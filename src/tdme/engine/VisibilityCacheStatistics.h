@@ -0,0 +1,19 @@
+#pragma once
+
+#include <tdme/tdme.h>
+#include <tdme/engine/fwd-tdme.h>
+
+/**
+ * Visibility cache statistics entity
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+struct tdme::engine::VisibilityCacheStatistics
+{
+	int64_t hits {  };
+	int64_t partials {  };
+	int64_t rebuilds {  };
+	int64_t updatedEntities {  };
+	int64_t removedEntities {  };
+	int64_t visibleEntities {  };
+};
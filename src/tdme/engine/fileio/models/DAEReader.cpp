@@ -9,6 +9,7 @@
 #include <tdme/engine/ModelUtilities.h>
 #include <tdme/engine/Transformations.h>
 #include <tdme/engine/fileio/models/ModelFileIOException.h>
+#include <tdme/engine/fileio/models/ModelImportStatistics.h>
 #include <tdme/engine/fileio/models/TMWriter.h>
 #include <tdme/engine/model/Animation.h>
 #include <tdme/engine/model/Color4.h>
@@ -32,6 +33,8 @@
 #include <tdme/os/filesystem/FileSystem.h>
 #include <tdme/os/filesystem/FileSystemException.h>
 #include <tdme/os/filesystem/FileSystemInterface.h>
+#include <tdme/os/threading/AtomicOperations.h>
+#include <tdme/os/threading/Thread.h>
 #include <tdme/tools/shared/files/LevelFileExport.h>
 #include <tdme/utils/Float.h>
 #include <tdme/utils/Integer.h>
@@ -39,6 +42,9 @@
 #include <tdme/utils/StringUtils.h>
 #include <tdme/utils/Console.h>
 #include <tdme/utils/Exception.h>
+#include <tdme/utils/ExceptionBase.h>
+#include <tdme/utils/Time.h>
+#include <tdme/utils/XMLPullParser.h>
 
 #include <ext/tinyxml/tinyxml.h>
 
@@ -49,6 +55,7 @@ using std::vector;
 using std::map;
 using std::unordered_set;
 using std::to_string;
+using std::stoull;
 using std::string;
 
 using tdme::engine::fileio::models::DAEReader;
@@ -56,6 +63,7 @@ using tdme::math::Math;
 using tdme::engine::ModelUtilities;
 using tdme::engine::Transformations;
 using tdme::engine::fileio::models::ModelFileIOException;
+using tdme::engine::fileio::models::ModelImportStatistics;
 using tdme::engine::fileio::models::TMWriter;
 using tdme::engine::model::Animation;
 using tdme::engine::model::Color4;
@@ -79,31 +87,62 @@ using tdme::math::Vector3;
 using tdme::os::filesystem::FileSystem;
 using tdme::os::filesystem::FileSystemException;
 using tdme::os::filesystem::FileSystemInterface;
+using tdme::os::threading::AtomicOperations;
+using tdme::os::threading::Thread;
 using tdme::utils::Float;
 using tdme::utils::Integer;
 using tdme::utils::StringTokenizer;
 using tdme::utils::StringUtils;
 using tdme::utils::Console;
 using tdme::utils::Exception;
+using tdme::utils::ExceptionBase;
+using tdme::utils::Time;
+using tdme::utils::XMLPullParser;
 
 using tinyxml::TiXmlDocument;
 using tinyxml::TiXmlElement;
 using tinyxml::TiXmlAttribute;
+using tinyxml::TiXmlNode;
+using tinyxml::TiXmlText;
 
 const Color4 DAEReader::BLENDER_AMBIENT_NONE(0.0f, 0.0f, 0.0f, 1.0f);
 
-Model* DAEReader::read(const string& pathName, const string& fileName)
+DAEReader::ReadGeometryThread::ReadGeometryThread(Model* model, TiXmlElement* xmlRoot, const vector<GroupGeometries>* groupGeometries, volatile uint64_t* groupGeometriesIdx, vector<string>* errors):
+	Thread("daereader-readgeometry-thread"),
+	model(model),
+	xmlRoot(xmlRoot),
+	groupGeometries(groupGeometries),
+	groupGeometriesIdx(groupGeometriesIdx),
+	errors(errors) {
+}
+
+void DAEReader::ReadGeometryThread::run() {
+	uint64_t i;
+	while ((i = AtomicOperations::add(*groupGeometriesIdx) - 1) < groupGeometries->size()) {
+		auto& _groupGeometries = (*groupGeometries)[i];
+		try {
+			for (auto j = 0; j < _groupGeometries.xmlGeometryIds.size(); j++) {
+				readGeometry(model, _groupGeometries.group, xmlRoot, _groupGeometries.xmlGeometryIds[j], &_groupGeometries.materialSymbols[j]);
+			}
+		} catch (Exception& exception) {
+			(*errors)[i] = exception.what();
+		}
+	}
+}
+
+Model* DAEReader::read(const string& pathName, const string& fileName, ModelImportStatistics* statistics)
 {
+	auto timeStart = Time::getCurrentMillis();
+	auto timeLast = timeStart;
+	auto timeNow = timeStart;
+
 	// load dae xml document
-	auto xmlContent = FileSystem::getInstance()->getContentAsString(pathName, fileName);
 	TiXmlDocument xmlDocument;
-	xmlDocument.Parse(xmlContent.c_str());
-	if (xmlDocument.Error() == true) {
-		throw ModelFileIOException(
-			string("Could not parse XML. Error='") + string(xmlDocument.ErrorDesc()) + string("'")
-		);
-	}
+	readDocument(pathName, fileName, xmlDocument);
 	TiXmlElement* xmlRoot = xmlDocument.RootElement();
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->parseTime = timeNow - timeLast;
+	timeLast = timeNow;
 
 	// authoring tool
 	auto authoringTool = getAuthoringTool(xmlRoot);
@@ -142,7 +181,8 @@ Model* DAEReader::read(const string& pathName, const string& fileName)
 		xmlSceneId = StringUtils::substring(string(AVOID_NULLPTR_STRING(xmlInstanceVisualscene->Attribute("url"))), 1);
 	}
 
-	// parse visual scenes
+	// parse visual scenes aka scene graph, group geometries are read later
+	vector<GroupGeometries> groupGeometries;
 	auto xmlLibraryVisualScenes = getChildrenByTagName(xmlRoot, "library_visual_scenes").at(0);
 	for (auto xmlLibraryVisualScene: getChildrenByTagName(xmlLibraryVisualScenes, "visual_scene")) {
 		auto xmlVisualSceneId = string(AVOID_NULLPTR_STRING(xmlLibraryVisualScene->Attribute("id")));
@@ -165,7 +205,7 @@ Model* DAEReader::read(const string& pathName, const string& fileName)
 			model->setFPS(fps);
 			// visual scene root nodes
 			for (auto xmlNode: getChildrenByTagName(xmlLibraryVisualScene, "node")) {
-				auto group = readVisualSceneNode(pathName, model, nullptr, xmlRoot, xmlNode, fps);
+				auto group = readVisualSceneNode(pathName, model, nullptr, xmlRoot, xmlNode, fps, groupGeometries);
 				if (group != nullptr) {
 					model->getSubGroups()[group->getId()] = group;
 					model->getGroups()[group->getId()] = group;
@@ -173,17 +213,174 @@ Model* DAEReader::read(const string& pathName, const string& fileName)
 			}
 		}
 	}
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->sceneGraphTime = timeNow - timeLast;
+	timeLast = timeNow;
+
+	// materials and their textures
+	readMaterials(pathName, model, xmlRoot, groupGeometries);
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->texturesTime = timeNow - timeLast;
+	timeLast = timeNow;
+
+	// group geometries, groups are independent, so read them in parallel if worth it
+	{
+		auto threadCount = Math::min(static_cast<int>(groupGeometries.size()), Thread::getHardwareThreadCount());
+		if (statistics != nullptr) statistics->threadCount = Thread::getHardwareThreadCount();
+		vector<string> errors;
+		errors.resize(groupGeometries.size());
+		if (threadCount < 2) {
+			for (auto& _groupGeometries: groupGeometries) {
+				for (auto i = 0; i < _groupGeometries.xmlGeometryIds.size(); i++) {
+					readGeometry(model, _groupGeometries.group, xmlRoot, _groupGeometries.xmlGeometryIds[i], &_groupGeometries.materialSymbols[i]);
+				}
+			}
+		} else {
+			volatile uint64_t groupGeometriesIdx = 0LL;
+			vector<ReadGeometryThread*> threads;
+			for (auto i = 0; i < threadCount; i++) {
+				auto thread = new ReadGeometryThread(model, xmlRoot, &groupGeometries, &groupGeometriesIdx, &errors);
+				thread->start();
+				threads.push_back(thread);
+			}
+			for (auto thread: threads) {
+				thread->join();
+				delete thread;
+			}
+		}
+		// report first error in scene graph order
+		for (auto& error: errors) {
+			if (error.empty() == false) throw ModelFileIOException(error);
+		}
+	}
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->groupsTime = timeNow - timeLast;
+	timeLast = timeNow;
+
 	if (ModelHelper::hasDefaultAnimation(model) == false) ModelHelper::createDefaultAnimation(model, 0);
 	// set up joints
 	ModelHelper::setupJoints(model);
 	// fix animation length
 	ModelHelper::fixAnimationLength(model);
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->animationsTime = timeNow - timeLast;
+	timeLast = timeNow;
+
 	// prepare for indexed rendering
 	ModelHelper::prepareForIndexedRendering(model);
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) {
+		statistics->postProcessTime = timeNow - timeLast;
+		statistics->totalTime = timeNow - timeStart;
+	}
 	//
 	return model;
 }
 
+void DAEReader::readDocument(const string& pathName, const string& fileName, TiXmlDocument& xmlDocument)
+{
+	// document name is used to parse large arrays from file later
+	xmlDocument.SetValue(FileSystem::getInstance()->getFileName(pathName, fileName));
+	try {
+		XMLPullParser xmlParser(pathName, fileName);
+		TiXmlNode* xmlParent = &xmlDocument;
+		auto xmlArray = false;
+		string text;
+		while (true == true) {
+			auto event = xmlParser.next();
+			if (event == XMLPullParser::EVENTTYPE_END_DOCUMENT) break;
+			switch (event) {
+				case XMLPullParser::EVENTTYPE_START_ELEMENT:
+					{
+						auto xmlElement = new TiXmlElement(xmlParser.getName().c_str());
+						for (auto& attribute: xmlParser.getAttributes()) {
+							xmlElement->SetAttribute(attribute.first.c_str(), attribute.second.c_str());
+						}
+						xmlParent->LinkEndChild(xmlElement);
+						xmlParent = xmlElement;
+						auto& name = xmlParser.getName();
+						xmlArray = name == "float_array" || name == "int_array" || name == "p" || name == "v" || name == "vcount";
+						break;
+					}
+				case XMLPullParser::EVENTTYPE_END_ELEMENT:
+					{
+						xmlParent = xmlParent->Parent();
+						xmlArray = false;
+						break;
+					}
+				case XMLPullParser::EVENTTYPE_TEXT:
+					{
+						if (xmlParser.readText(text, xmlArray == true?ARRAY_TEXT_LENGTH_MAX:UINT64_MAX) == true) {
+							xmlParent->LinkEndChild(new TiXmlText(text.c_str()));
+						} else {
+							// large arrays are parsed from file when reading them
+							xmlParent->ToElement()->SetAttribute("tdme:offset", to_string(xmlParser.getTextOffset()).c_str());
+							xmlParent->ToElement()->SetAttribute("tdme:bytes", to_string(xmlParser.getTextBytes()).c_str());
+						}
+						break;
+					}
+				default:
+					break;
+			}
+		}
+	} catch (FileSystemException& exception) {
+		throw;
+	} catch (ExceptionBase& exception) {
+		throw ModelFileIOException(
+			string("Could not parse XML. Error='") + string(exception.what()) + string("'")
+		);
+	}
+	if (xmlDocument.RootElement() == nullptr) {
+		throw ModelFileIOException("Could not parse XML. Error='No root element'");
+	}
+}
+
+void DAEReader::readFloatArray(TiXmlElement* xmlArray, vector<float>& values)
+{
+	try {
+		auto xmlOffset = xmlArray->Attribute("tdme:offset");
+		if (xmlOffset == nullptr) {
+			XMLPullParser::parseFloats(string(AVOID_NULLPTR_STRING(xmlArray->GetText())), values);
+		} else {
+			auto documentFileName = string(xmlArray->GetDocument()->Value());
+			XMLPullParser xmlParser(
+				FileSystem::getInstance()->getPathName(documentFileName),
+				FileSystem::getInstance()->getFileName(documentFileName),
+				stoull(xmlOffset),
+				stoull(AVOID_NULLPTR_STRING(xmlArray->Attribute("tdme:bytes")))
+			);
+			xmlParser.readFloats(values);
+		}
+	} catch (ExceptionBase& exception) {
+		throw ModelFileIOException(
+			"Could not parse float array '" + string(AVOID_NULLPTR_STRING(xmlArray->Attribute("id"))) + "': " + string(exception.what())
+		);
+	}
+}
+
+void DAEReader::readIntArray(TiXmlElement* xmlArray, vector<int32_t>& values)
+{
+	try {
+		auto xmlOffset = xmlArray->Attribute("tdme:offset");
+		if (xmlOffset == nullptr) {
+			XMLPullParser::parseInts(string(AVOID_NULLPTR_STRING(xmlArray->GetText())), values);
+		} else {
+			auto documentFileName = string(xmlArray->GetDocument()->Value());
+			XMLPullParser xmlParser(
+				FileSystem::getInstance()->getPathName(documentFileName),
+				FileSystem::getInstance()->getFileName(documentFileName),
+				stoull(xmlOffset),
+				stoull(AVOID_NULLPTR_STRING(xmlArray->Attribute("tdme:bytes")))
+			);
+			xmlParser.readInts(values);
+		}
+	} catch (ExceptionBase& exception) {
+		throw ModelFileIOException(
+			"Could not parse integer array '" + string(AVOID_NULLPTR_STRING(xmlArray->Value())) + "': " + string(exception.what())
+		);
+	}
+}
+
 Model::AuthoringTool DAEReader::getAuthoringTool(TiXmlElement* xmlRoot)
 {
 	for (auto xmlAsset: getChildrenByTagName(xmlRoot, "asset")) {
@@ -254,17 +451,17 @@ void DAEReader::setupModelImportScaleMatrix(TiXmlElement* xmlRoot, Model* model)
 	}
 }
 
-Group* DAEReader::readVisualSceneNode(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode, float fps)
+Group* DAEReader::readVisualSceneNode(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode, float fps, vector<GroupGeometries>& groupGeometries)
 {
 	auto xmlInstanceControllers = getChildrenByTagName(xmlNode, "instance_controller");
 	if (xmlInstanceControllers.empty() == false) {
-		return readVisualSceneInstanceController(pathName, model, parentGroup, xmlRoot, xmlNode);
+		return readVisualSceneInstanceController(pathName, model, parentGroup, xmlRoot, xmlNode, groupGeometries);
 	} else {
-		return readNode(pathName, model, parentGroup, xmlRoot, xmlNode, fps);
+		return readNode(pathName, model, parentGroup, xmlRoot, xmlNode, fps, groupGeometries);
 	}
 }
 
-Group* DAEReader::readNode(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode, float fps)
+Group* DAEReader::readNode(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode, float fps, vector<GroupGeometries>& groupGeometries)
 {
 	auto xmlNodeId = string(AVOID_NULLPTR_STRING(xmlNode->Attribute("id")));
 	auto xmlNodeName = string(AVOID_NULLPTR_STRING(xmlNode->Attribute("name")));
@@ -334,14 +531,9 @@ Group* DAEReader::readNode(const string& pathName, Model* model, Group* parentGr
 				if (string(AVOID_NULLPTR_STRING(xmlAnimationSource->Attribute("id"))) == xmlSamplerInputSource) {
 					auto xmlFloatArray = getChildrenByTagName(xmlAnimationSource, "float_array").at(0);
 					auto frames = Integer::parseInt(string(AVOID_NULLPTR_STRING(xmlFloatArray->Attribute("count"))));
-					auto valueString = string(AVOID_NULLPTR_STRING(xmlFloatArray->GetText()));
-					auto keyFrameIdx = 0;
+					keyFrameTimes.clear();
+					readFloatArray(xmlFloatArray, keyFrameTimes);
 					keyFrameTimes.resize(frames);
-					StringTokenizer t;
-					t.tokenize(valueString, " \n\r");
-					while (t.hasMoreTokens()) {
-						keyFrameTimes[keyFrameIdx++] = Float::parseFloat(t.nextToken());
-					}
 				}
 			}
 			// load animation output matrices
@@ -353,22 +545,19 @@ Group* DAEReader::readNode(const string& pathName, Model* model, Group* parentGr
 						auto keyFrames = Integer::parseInt(string(AVOID_NULLPTR_STRING(xmlFloatArray->Attribute("count")))) / 16;
 						// some models have animations without frames
 						if (keyFrames > 0) {
-							auto valueString = string(AVOID_NULLPTR_STRING(xmlFloatArray->GetText()));
-							StringTokenizer t;
-							t.tokenize(valueString, " \n\r");
+							vector<float> values;
+							readFloatArray(xmlFloatArray, values);
 							// parse key frame
-							int32_t keyFrameIdx = 0;
 							vector<Matrix4x4> keyFrameMatrices;
 							keyFrameMatrices.resize(keyFrames);
-							while (t.hasMoreTokens()) {
+							for (auto keyFrameIdx = 0; keyFrameIdx < keyFrames && (keyFrameIdx + 1) * 16 <= values.size(); keyFrameIdx++) {
 								// set animation transformation matrix at frame
 								array<float, 16> keyFrameMatricesArray;
 								for (auto i = 0; i < keyFrameMatricesArray.size() ;i++) {
-									keyFrameMatricesArray[i] = Float::parseFloat(t.nextToken());
+									keyFrameMatricesArray[i] = values[keyFrameIdx * 16 + i];
 								}
 								keyFrameMatrices[keyFrameIdx].set(keyFrameMatricesArray);
 								keyFrameMatrices[keyFrameIdx].transpose();
-								keyFrameIdx++;
 							}
 
 							auto frames = static_cast< int32_t >(Math::ceil(keyFrameTimes[keyFrameTimes.size() - 1] * fps));
@@ -378,7 +567,7 @@ Group* DAEReader::readNode(const string& pathName, Model* model, Group* parentGr
 								vector<Matrix4x4> transformationsMatrices;
 								transformationsMatrices.resize(frames);
 								auto tansformationsMatrixLast = &keyFrameMatrices[0];
-								keyFrameIdx = 0;
+								auto keyFrameIdx = 0;
 								auto frameIdx = 0;
 								auto timeStampLast = 0.0f;
 								for (auto keyFrameTime : keyFrameTimes) {
@@ -410,7 +599,7 @@ Group* DAEReader::readNode(const string& pathName, Model* model, Group* parentGr
 
 	// parse sub groups
 	for (auto _xmlNode: getChildrenByTagName(xmlNode, "node")) {
-		auto _group = readVisualSceneNode(pathName, model, group, xmlRoot, _xmlNode, fps);
+		auto _group = readVisualSceneNode(pathName, model, group, xmlRoot, _xmlNode, fps, groupGeometries);
 		if (_group != nullptr) {
 			group->getSubGroups()[_group->getId()] = _group;
 			model->getGroups()[_group->getId()] = _group;
@@ -432,8 +621,8 @@ Group* DAEReader::readNode(const string& pathName, Model* model, Group* parentGr
 			materialSymbols[string(AVOID_NULLPTR_STRING(xmlInstanceMaterial->Attribute("symbol")))] =
 				string(AVOID_NULLPTR_STRING(xmlInstanceMaterial->Attribute("target")));
 		}
-		// parse geometry
-		readGeometry(pathName, model, group, xmlRoot, xmlInstanceGeometryId, &materialSymbols);
+		// parse geometry later
+		addGroupGeometry(groupGeometries, group, xmlInstanceGeometryId, materialSymbols);
 		return group;
 	}
 
@@ -449,7 +638,7 @@ Group* DAEReader::readNode(const string& pathName, Model* model, Group* parentGr
 		if (string(AVOID_NULLPTR_STRING(xmlLibraryNode->Attribute("id"))) == xmlInstanceNodeId) {
 			// parse sub groups
 			for (auto _xmlNode: getChildrenByTagName(xmlLibraryNode, "node")) {
-				auto _group = readVisualSceneNode(pathName, model, parentGroup, xmlRoot, _xmlNode, fps);
+				auto _group = readVisualSceneNode(pathName, model, parentGroup, xmlRoot, _xmlNode, fps, groupGeometries);
 				if (_group != nullptr) {
 					group->getSubGroups()[_group->getId()] = _group;
 					model->getGroups()[_group->getId()] = _group;
@@ -466,15 +655,15 @@ Group* DAEReader::readNode(const string& pathName, Model* model, Group* parentGr
 					materialSymbols[string(AVOID_NULLPTR_STRING(xmlInstanceMaterial->Attribute("symbol")))] =
 						string(AVOID_NULLPTR_STRING(xmlInstanceMaterial->Attribute("target")));
 				}
-				// parse geometry
-				readGeometry(pathName, model, group, xmlRoot, xmlGeometryId, &materialSymbols);
+				// parse geometry later
+				addGroupGeometry(groupGeometries, group, xmlGeometryId, materialSymbols);
 			}
 		}
 	}
 	return group;
 }
 
-Group* DAEReader::readVisualSceneInstanceController(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode)
+Group* DAEReader::readVisualSceneInstanceController(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode, vector<GroupGeometries>& groupGeometries)
 {
 	auto xmlNodeId = string(AVOID_NULLPTR_STRING(xmlNode->Attribute("id")));
 	auto xmlNodeName = string(AVOID_NULLPTR_STRING(xmlNode->Attribute("name")));
@@ -536,8 +725,8 @@ Group* DAEReader::readVisualSceneInstanceController(const string& pathName, Mode
 	// create skinning
 	auto skinning = new Skinning();
 
-	// parse geometry
-	readGeometry(pathName, model, group, xmlRoot, xmlGeometryId, &materialSymbols);
+	// parse geometry later
+	addGroupGeometry(groupGeometries, group, xmlGeometryId, materialSymbols);
 
 	// parse joints
 	string xmlJointsSource;
@@ -584,14 +773,22 @@ Group* DAEReader::readVisualSceneInstanceController(const string& pathName, Mode
 	// Create joints bind matrices
 	for (auto xmlSkinSource: getChildrenByTagName(xmlSkin, "source")) {
 		if (string(AVOID_NULLPTR_STRING(xmlSkinSource->Attribute("id"))) == xmlJointsInverseBindMatricesSource) {
-			t.tokenize(string(AVOID_NULLPTR_STRING(getChildrenByTagName(xmlSkinSource, "float_array").at(0)->GetText())), " \n\r");
+			vector<float> values;
+			readFloatArray(getChildrenByTagName(xmlSkinSource, "float_array").at(0), values);
+			if (values.size() < joints.size() * 16) {
+				throw ModelFileIOException(
+					"inverse bind matrices missing for instance controller '" +
+					(xmlNodeId) +
+					"'"
+				);
+			}
 			auto& _joints = skinning->getJoints();
 			for (auto i = 0; i < joints.size(); i++) {
 				// The vertices are defined in model space
 				// The transformation to the local space of the joint is called the inverse bind matrix
 				array<float, 16> bindMatrixArray;
-				for (auto i = 0; i < bindMatrixArray.size(); i++) {
-					bindMatrixArray[i] = Float::parseFloat(t.nextToken());
+				for (auto j = 0; j < bindMatrixArray.size(); j++) {
+					bindMatrixArray[j] = values[i * 16 + j];
 				}
 				Matrix4x4 bindMatrix;
 				bindMatrix.set(bindShapeMatrix);
@@ -649,32 +846,34 @@ Group* DAEReader::readVisualSceneInstanceController(const string& pathName, Mode
 	// parse weights
 	for (auto xmlSkinSource: getChildrenByTagName(xmlSkin, "source")) {
 		if (string(AVOID_NULLPTR_STRING(xmlSkinSource->Attribute("id"))) == xmlWeightsSource) {
-			t.tokenize(string(AVOID_NULLPTR_STRING(getChildrenByTagName(xmlSkinSource, "float_array").at(0)->GetText())), " \n\r");
-			while (t.hasMoreTokens()) {
-				weights.push_back(Float::parseFloat(t.nextToken()));
-			}
+			readFloatArray(getChildrenByTagName(xmlSkinSource, "float_array").at(0), weights);
 		}
 	}
 	skinning->setWeights(weights);
 
 	// actually do parse joint influences of each vertex
 	auto xmlVertexWeightInputCount = xmlVertexWeightInputs.size();
-	auto vertexJointsInfluenceCountString = string(AVOID_NULLPTR_STRING(getChildrenByTagName(xmlVertexWeights, "vcount").at(0)->GetText()));
-	auto vertexJointsInfluencesString = string(AVOID_NULLPTR_STRING(getChildrenByTagName(xmlVertexWeights, "v").at(0)->GetText()));
-	t.tokenize(vertexJointsInfluenceCountString, " \n\r");
-	StringTokenizer t2;
-	t2.tokenize(vertexJointsInfluencesString, " \n\r");
+	vector<int32_t> vertexJointsInfluenceCounts;
+	vector<int32_t> vertexJointsInfluences;
+	readIntArray(getChildrenByTagName(xmlVertexWeights, "vcount").at(0), vertexJointsInfluenceCounts);
+	readIntArray(getChildrenByTagName(xmlVertexWeights, "v").at(0), vertexJointsInfluences);
 	auto offset = 0;
 	vector<vector<JointWeight>> verticesJointsWeights;
-	while (t.hasMoreTokens()) {
+	for (auto vertexJointsInfluencesCount: vertexJointsInfluenceCounts) {
 		// read joint influences for current vertex
-		auto vertexJointsInfluencesCount = Integer::parseInt(t.nextToken());
 		vector<JointWeight>vertexJointsWeights;
 		for (auto i = 0; i < vertexJointsInfluencesCount; i++) {
 			auto vertexJoint = -1;
 			auto vertexWeight = -1;
 			while (vertexJoint == -1 || vertexWeight == -1) {
-				auto value = Integer::parseInt(t2.nextToken());
+				if (offset >= vertexJointsInfluences.size()) {
+					throw ModelFileIOException(
+						"xml vertex weight joint influences missing for node '" +
+						(xmlNodeId) +
+						"'"
+					);
+				}
+				auto value = vertexJointsInfluences[offset];
 				if (offset % xmlVertexWeightInputCount == xmlJointOffset) {
 					vertexJoint = value;
 				} else if (offset % xmlVertexWeightInputCount == xmlWeightOffset) {
@@ -693,7 +892,58 @@ Group* DAEReader::readVisualSceneInstanceController(const string& pathName, Mode
 	return group;
 }
 
-void DAEReader::readGeometry(const string& pathName, Model* model, Group* group, TiXmlElement* xmlRoot, const string& xmlNodeId, const map<string, string>* materialSymbols)
+void DAEReader::addGroupGeometry(vector<GroupGeometries>& groupGeometries, Group* group, const string& xmlGeometryId, const map<string, string>& materialSymbols)
+{
+	// geometries of a group are read in order by the same task
+	GroupGeometries* _groupGeometries = nullptr;
+	for (auto& groupGeometriesCandidate: groupGeometries) {
+		if (groupGeometriesCandidate.group == group) {
+			_groupGeometries = &groupGeometriesCandidate;
+			break;
+		}
+	}
+	if (_groupGeometries == nullptr) {
+		groupGeometries.push_back(GroupGeometries());
+		_groupGeometries = &groupGeometries[groupGeometries.size() - 1];
+		_groupGeometries->group = group;
+	}
+	_groupGeometries->xmlGeometryIds.push_back(xmlGeometryId);
+	_groupGeometries->materialSymbols.push_back(materialSymbols);
+}
+
+void DAEReader::readMaterials(const string& pathName, Model* model, TiXmlElement* xmlRoot, const vector<GroupGeometries>& groupGeometries)
+{
+	for (auto& _groupGeometries: groupGeometries)
+	for (auto i = 0; i < _groupGeometries.xmlGeometryIds.size(); i++) {
+		auto xmlLibraryGeometries = getChildrenByTagName(xmlRoot, "library_geometries").at(0);
+		for (auto xmlGeometry: getChildrenByTagName(xmlLibraryGeometries, "geometry")) {
+			if (string(AVOID_NULLPTR_STRING(xmlGeometry->Attribute("id"))) != _groupGeometries.xmlGeometryIds[i]) continue;
+			auto xmlMesh = getChildrenByTagName(xmlGeometry, "mesh").at(0);
+			for (auto xmlPolygons: getChildren(xmlMesh)) {
+				auto xmlPolygonsTagName = StringUtils::toLowerCase(xmlPolygons->Value());
+				if (xmlPolygonsTagName != "triangles" && xmlPolygonsTagName != "polylist" && xmlPolygonsTagName != "polygons") continue;
+				auto xmlMaterialId = getMaterialId(xmlPolygons, &_groupGeometries.materialSymbols[i]);
+				// parse material if we do not have it yet
+				if (xmlMaterialId.length() > 0 && model->getMaterials().find(xmlMaterialId) == model->getMaterials().end()) {
+					readMaterial(pathName, model, xmlRoot, xmlMaterialId);
+				}
+			}
+		}
+	}
+}
+
+const string DAEReader::getMaterialId(TiXmlElement* xmlPolygons, const map<string, string>* materialSymbols)
+{
+	auto xmlMaterialId = string(AVOID_NULLPTR_STRING(xmlPolygons->Attribute("material")));
+	auto materialSymbolIt = materialSymbols->find(xmlMaterialId);
+	if (materialSymbolIt != materialSymbols->end()) {
+		xmlMaterialId = materialSymbolIt->second;
+		xmlMaterialId = StringUtils::substring(xmlMaterialId, 1);
+	}
+	return xmlMaterialId;
+}
+
+void DAEReader::readGeometry(Model* model, Group* group, TiXmlElement* xmlRoot, const string& xmlNodeId, const map<string, string>* materialSymbols)
 {
 	vector<FacesEntity> facesEntities = group->getFacesEntities();
 	auto verticesOffset = group->getVertices().size();
@@ -724,10 +974,9 @@ void DAEReader::readGeometry(const string& pathName, Model* model, Group* group,
 				vector<Face> faces;
 				FacesEntity facesEntity(group, xmlNodeId);
 				if (StringUtils::toLowerCase((xmlPolygons->Value())) == "polylist") {
-					StringTokenizer t;
-					t.tokenize(string(AVOID_NULLPTR_STRING(getChildrenByTagName(xmlPolygons, "vcount").at(0)->GetText())), " \t\n\r\f");
-					while (t.hasMoreTokens()) {
-						auto vertexCount = Integer::parseInt(t.nextToken());
+					vector<int32_t> vertexCounts;
+					readIntArray(getChildrenByTagName(xmlPolygons, "vcount").at(0), vertexCounts);
+					for (auto vertexCount: vertexCounts) {
 						if (vertexCount != 3) {
 							throw ModelFileIOException(
 								 "we only support triangles in '" +
@@ -746,24 +995,14 @@ void DAEReader::readGeometry(const string& pathName, Model* model, Group* group,
 				string xmlTexCoordSource;
 				auto xmlColorOffset = -1;
 				string xmlColorSource;
-				auto xmlMaterialId = string(AVOID_NULLPTR_STRING(xmlPolygons->Attribute("material")));
-				auto materialSymbolIt = materialSymbols->find(xmlMaterialId);
-				if (materialSymbolIt != materialSymbols->end()) {
-					xmlMaterialId = materialSymbolIt->second;
-					xmlMaterialId = StringUtils::substring(xmlMaterialId, 1);
-				}
-
+				auto xmlMaterialId = getMaterialId(xmlPolygons, materialSymbols);
 				if (xmlMaterialId.length() > 0) {
-					Material* material = nullptr;
+					// materials have been read already, see readMaterials()
 					auto materialIt = model->getMaterials().find(xmlMaterialId);
 					if (materialIt != model->getMaterials().end()) {
-						material = materialIt->second;
-					} else {
-						// parse material as we do not have it yet
-						material = readMaterial(pathName, model, xmlRoot, xmlMaterialId);
+						// set it up
+						facesEntity.setMaterial(materialIt->second);
 					}
-					// set it up
-					facesEntity.setMaterial(material);
 				}
 				unordered_set<int32_t> xmlInputSet;
 				for (auto xmlTrianglesInput: getChildrenByTagName(xmlPolygons, "input")) {
@@ -826,50 +1065,35 @@ void DAEReader::readGeometry(const string& pathName, Model* model, Group* group,
 				for (auto xmlMeshSource: getChildrenByTagName(xmlMesh, "source")) {
 					// vertices
 					if (string(AVOID_NULLPTR_STRING(xmlMeshSource->Attribute("id"))) == xmlVerticesSource) {
-						auto xmlFloatArray = getChildrenByTagName(xmlMeshSource, "float_array").at(0);
-						auto valueString = string(AVOID_NULLPTR_STRING(xmlFloatArray->GetText()));
-						StringTokenizer t;
-						t.tokenize(valueString, " \n\r");
-						while (t.hasMoreTokens()) {
-							float x = Float::parseFloat(t.nextToken());
-							float y = Float::parseFloat(t.nextToken());
-							float z = Float::parseFloat(t.nextToken());
-							vertices.push_back(Vector3(x, y, z));
+						vector<float> values;
+						readFloatArray(getChildrenByTagName(xmlMeshSource, "float_array").at(0), values);
+						for (auto i = 0; i + 2 < values.size(); i+= 3) {
+							vertices.push_back(Vector3(values[i + 0], values[i + 1], values[i + 2]));
 						}
 					} else
 					// normals
 					if (string(AVOID_NULLPTR_STRING(xmlMeshSource->Attribute("id"))) == xmlNormalsSource) {
-						auto xmlFloatArray = getChildrenByTagName(xmlMeshSource, "float_array").at(0);
-						auto valueString = string(AVOID_NULLPTR_STRING(xmlFloatArray->GetText()));
-						StringTokenizer t;
-						t.tokenize(valueString, " \n\r");
-						while (t.hasMoreTokens()) {
-							float x = Float::parseFloat(t.nextToken());
-							float y = Float::parseFloat(t.nextToken());
-							float z = Float::parseFloat(t.nextToken());
-							normals.push_back(Vector3(x, y, z));
+						vector<float> values;
+						readFloatArray(getChildrenByTagName(xmlMeshSource, "float_array").at(0), values);
+						for (auto i = 0; i + 2 < values.size(); i+= 3) {
+							normals.push_back(Vector3(values[i + 0], values[i + 1], values[i + 2]));
 						}
 					} else
 					// texture coordinates
 					if (xmlTexCoordSource.length() > 0) {
 						if (string(AVOID_NULLPTR_STRING(xmlMeshSource->Attribute("id"))) == xmlTexCoordSource) {
-							auto xmlFloatArray = getChildrenByTagName(xmlMeshSource, "float_array").at(0);
-							auto valueString = string(AVOID_NULLPTR_STRING(xmlFloatArray->GetText()));
-							StringTokenizer t;
-							t.tokenize(valueString, " \n\r");
-							while (t.hasMoreTokens()) {
-								float u = Float::parseFloat(t.nextToken());
-								float v = Float::parseFloat(t.nextToken());
-								textureCoordinates.push_back(TextureCoordinate(u, v));
+							vector<float> values;
+							readFloatArray(getChildrenByTagName(xmlMeshSource, "float_array").at(0), values);
+							for (auto i = 0; i + 1 < values.size(); i+= 2) {
+								textureCoordinates.push_back(TextureCoordinate(values[i + 0], values[i + 1]));
 							}
 						}
 					}
 				}
 				// load faces
 				for (auto xmlPolygon: getChildrenByTagName(xmlPolygons, "p")) {
-					auto valueString = string(AVOID_NULLPTR_STRING(xmlPolygon->GetText()));
-					StringTokenizer t;
-					t.tokenize(valueString, " \n\r");
+					vector<int32_t> values;
+					readIntArray(xmlPolygon, values);
 					array<int32_t, 3> vi;
 					auto viIdx = 0;
 					array<int32_t, 3> ni;
@@ -878,8 +1102,7 @@ void DAEReader::readGeometry(const string& pathName, Model* model, Group* group,
 					auto tiIdx = 0;
 					auto valueIdx = 0;
 					auto valid = true;
-					while (t.hasMoreTokens()) {
-						auto value = Integer::parseInt(t.nextToken());
+					for (auto value: values) {
 						if (valueIdx % xmlInputs == xmlVerticesOffset) {
 							vi[viIdx++] = value;
 							// validate
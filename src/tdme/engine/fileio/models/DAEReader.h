@@ -9,6 +9,7 @@
 #include <tdme/engine/model/fwd-tdme.h>
 #include <tdme/engine/model/Model.h>
 #include <tdme/os/filesystem/fwd-tdme.h>
+#include <tdme/os/threading/Thread.h>
 #include <tdme/tools/shared/model/fwd-tdme.h>
 #include <tdme/utils/fwd-tdme.h>
 
@@ -28,12 +29,16 @@ using tdme::engine::model::Material;
 using tdme::engine::model::UpVector;
 using tdme::engine::model::Model;
 using tdme::os::filesystem::FileSystemException;
+using tdme::os::threading::Thread;
 using tdme::tools::shared::model::LevelEditorLevel;
 
+using tinyxml::TiXmlDocument;
 using tinyxml::TiXmlElement;
 
 /** 
  * Collada DAE model reader
+ * 	The scene graph is read first, then materials and after that group geometries in parallel
+ * 	The document is streamed by a pull parser, large numeric arrays are not kept in the document but are parsed from file when needed
  * @author Andreas Drewke
  * @version $Id$
  */
@@ -44,6 +49,7 @@ private:
 	static const Color4 BLENDER_AMBIENT_NONE;
 	static constexpr float BLENDER_AMBIENT_FROM_DIFFUSE_SCALE { 0.7f };
 	static constexpr float BLENDER_DIFFUSE_SCALE { 0.8f };
+	static constexpr int32_t ARRAY_TEXT_LENGTH_MAX { 4096 };
 
 public:
 
@@ -51,14 +57,80 @@ public:
 	 * Reads Collada DAE file
 	 * @param pathName path name
 	 * @param fileName file name
+	 * @param statistics import statistics or null
 	 * @throws tdme::engine::fileio::models::ModelFileIOException
 	 * @throws tdme::os::filesystem::FileSystemException
 	 * @return model instance
 	 */
-	static Model* read(const string& pathName, const string& fileName);
+	static Model* read(const string& pathName, const string& fileName, ModelImportStatistics* statistics = nullptr);
 
 private:
 
+	/**
+	 * Group geometries, which are read after the scene graph has been set up
+	 */
+	struct GroupGeometries {
+		Group* group;
+		vector<string> xmlGeometryIds;
+		vector<map<string, string>> materialSymbols;
+	};
+
+	/**
+	 * Read geometry thread, reads geometries of groups
+	 */
+	class ReadGeometryThread: public Thread {
+	public:
+		/**
+		 * Constructor
+		 * @param model model
+		 * @param xmlRoot xml root
+		 * @param groupGeometries group geometries
+		 * @param groupGeometriesIdx shared index of next group geometries to process
+		 * @param errors errors by group geometries
+		 */
+		ReadGeometryThread(Model* model, TiXmlElement* xmlRoot, const vector<GroupGeometries>* groupGeometries, volatile uint64_t* groupGeometriesIdx, vector<string>* errors);
+
+		/**
+		 * Run
+		 */
+		virtual void run();
+
+	private:
+		Model* model;
+		TiXmlElement* xmlRoot;
+		const vector<GroupGeometries>* groupGeometries;
+		volatile uint64_t* groupGeometriesIdx;
+		vector<string>* errors;
+	};
+
+	/**
+	 * Read document, large numeric array elements only get their file offset and bytes of their text assigned as attributes
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param xmlDocument xml document
+	 * @throws tdme::engine::fileio::models::ModelFileIOException
+	 * @throws tdme::os::filesystem::FileSystemException
+	 */
+	static void readDocument(const string& pathName, const string& fileName, TiXmlDocument& xmlDocument);
+
+	/**
+	 * Read float array element values
+	 * @param xmlArray xml array element
+	 * @param values values to append floats to
+	 * @throws tdme::engine::fileio::models::ModelFileIOException
+	 * @throws tdme::os::filesystem::FileSystemException
+	 */
+	static void readFloatArray(TiXmlElement* xmlArray, vector<float>& values);
+
+	/**
+	 * Read integer array element values
+	 * @param xmlArray xml array element
+	 * @param values values to append integers to
+	 * @throws tdme::engine::fileio::models::ModelFileIOException
+	 * @throws tdme::os::filesystem::FileSystemException
+	 */
+	static void readIntArray(TiXmlElement* xmlArray, vector<int32_t>& values);
+
 	/** 
 	 * Get authoring tool
 	 * @param xmlRoot xml root
@@ -96,9 +168,10 @@ private:
 	 * @param xmlRoot xml node
 	 * @param xmlNode xml root
 	 * @param fps frames per second
+	 * @param groupGeometries group geometries to be read later
 	 * @return group
 	 */
-	static Group* readVisualSceneNode(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode, float fps);
+	static Group* readVisualSceneNode(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode, float fps, vector<GroupGeometries>& groupGeometries);
 
 	/** 
 	 * Reads a DAE visual scene group node
@@ -108,10 +181,11 @@ private:
 	 * @param xmlRoot xml node
 	 * @param xmlNode xml root
 	 * @param fps frames per seconds
+	 * @param groupGeometries group geometries to be read later
 	 * @throws tdme::engine::fileio::models::ModelFileIOException
 	 * @return group
 	 */
-	static Group* readNode(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode, float fps);
+	static Group* readNode(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode, float fps, vector<GroupGeometries>& groupGeometries);
 
 	/** 
 	 * Reads a instance controller
@@ -120,23 +194,49 @@ private:
 	 * @param parentGroup parent group
 	 * @param xmlRoot xml root
 	 * @param xmlNode xml node
+	 * @param groupGeometries group geometries to be read later
 	 * @throws tdme::engine::fileio::models::ModelFileIOException
 	 * @return Group
 	 * @throws tdme::utils::Exception
 	 */
-	static Group* readVisualSceneInstanceController(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode);
+	static Group* readVisualSceneInstanceController(const string& pathName, Model* model, Group* parentGroup, TiXmlElement* xmlRoot, TiXmlElement* xmlNode, vector<GroupGeometries>& groupGeometries);
 
-	/** 
-	 * Reads a geometry
+	/**
+	 * Add geometry to be read later for given group
+	 * @param groupGeometries group geometries
+	 * @param group group
+	 * @param xmlGeometryId xml geometry id
+	 * @param materialSymbols material symbols
+	 */
+	static void addGroupGeometry(vector<GroupGeometries>& groupGeometries, Group* group, const string& xmlGeometryId, const map<string, string>& materialSymbols);
+
+	/**
+	 * Reads materials used by given group geometries
 	 * @param pathName path name
 	 * @param model model
+	 * @param xmlRoot xml root
+	 * @param groupGeometries group geometries
+	 */
+	static void readMaterials(const string& pathName, Model* model, TiXmlElement* xmlRoot, const vector<GroupGeometries>& groupGeometries);
+
+	/**
+	 * Reads a geometry, materials need to be read already, only touches given group and thus can run in parallel
+	 * @param model model
 	 * @param group group
 	 * @param xmlRoot xml root
 	 * @param xmlNodeId xml node id
 	 * @param materialSymbols material symbols
 	 * @throws tdme::engine::fileio::models::ModelFileIOException
 	 */
-	static void readGeometry(const string& pathName, Model* model, Group* group, TiXmlElement* xmlRoot, const string& xmlNodeId, const map<string, string>* materialSymbols); // TODO: std container: maybe use call by reference
+	static void readGeometry(Model* model, Group* group, TiXmlElement* xmlRoot, const string& xmlNodeId, const map<string, string>* materialSymbols); // TODO: std container: maybe use call by reference
+
+	/**
+	 * Get material id of xml polygons element
+	 * @param xmlPolygons xml triangles, polylist or polygons element
+	 * @param materialSymbols material symbols
+	 * @return material id
+	 */
+	static const string getMaterialId(TiXmlElement* xmlPolygons, const map<string, string>* materialSymbols);
 
 	/** 
 	 * Reads a material
@@ -8,6 +8,7 @@
 #include <string>
 #include <vector>
 
+#include <tdme/engine/fileio/models/ModelImportStatistics.h>
 #include <tdme/engine/model/Animation.h>
 #include <tdme/engine/model/AnimationSetup.h>
 #include <tdme/engine/model/Group.h>
@@ -31,6 +32,7 @@
 #include <tdme/os/filesystem/FileSystemException.h>
 #include <tdme/os/filesystem/FileSystemInterface.h>
 #include <tdme/utils/Console.h>
+#include <tdme/utils/Time.h>
 
 using std::map;
 using std::string;
@@ -38,6 +40,7 @@ using std::to_string;
 using std::vector;
 
 using tdme::engine::fileio::models::FBXReader;
+using tdme::engine::fileio::models::ModelImportStatistics;
 using tdme::engine::model::Animation;
 using tdme::engine::model::AnimationSetup;
 using tdme::engine::model::Group;
@@ -59,10 +62,15 @@ using tdme::os::filesystem::FileSystem;
 using tdme::os::filesystem::FileSystemException;
 using tdme::os::filesystem::FileSystemInterface;
 using tdme::utils::Console;
+using tdme::utils::Time;
 
 const Color4 FBXReader::BLENDER_AMBIENT_NONE(0.0f, 0.0f, 0.0f, 1.0f);
 
-Model* FBXReader::read(const string& pathName, const string& fileName) throw (ModelFileIOException, FileSystemException) {
+Model* FBXReader::read(const string& pathName, const string& fileName, ModelImportStatistics* statistics) throw (ModelFileIOException, FileSystemException) {
+	auto timeStart = Time::getCurrentMillis();
+	auto timeLast = timeStart;
+	auto timeNow = timeStart;
+
 	// init fbx sdk
 	FbxManager* fbxManager = NULL;
 	FbxScene* fbxScene = NULL;
@@ -103,6 +111,12 @@ Model* FBXReader::read(const string& pathName, const string& fileName) throw (Mo
 	// triangulate
 	FbxGeometryConverter fbxGeometryConverter(fbxManager);
 	fbxGeometryConverter.Triangulate(fbxScene, true);
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) {
+		statistics->threadCount = 1;
+		statistics->parseTime = timeNow - timeLast;
+	}
+	timeLast = timeNow;
 
 	Console::println("FBXReader::read(): importing FBX");
 
@@ -124,6 +138,9 @@ Model* FBXReader::read(const string& pathName, const string& fileName) throw (Mo
 
 	// process nodes
 	processScene(fbxScene, model, pathName);
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->sceneGraphTime = timeNow - timeLast;
+	timeLast = timeNow;
 
 	//
 	Console::println("FBXReader::read(): setting up animations");
@@ -186,6 +203,9 @@ Model* FBXReader::read(const string& pathName, const string& fileName) throw (Mo
         frameOffset+= endFrame - startFrame + 1;
 	}
 	FbxArrayDelete(fbxAnimStackNameArray);
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->animationsTime = timeNow - timeLast;
+	timeLast = timeNow;
 
 	//
 	Console::println("FBXReader::read(): destroying FBX SDK");
@@ -202,6 +222,11 @@ Model* FBXReader::read(const string& pathName, const string& fileName) throw (Mo
 	ModelHelper::setupJoints(model);
 	ModelHelper::fixAnimationLength(model);
 	ModelHelper::prepareForIndexedRendering(model);
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) {
+		statistics->postProcessTime = timeNow - timeLast;
+		statistics->totalTime = timeNow - timeStart;
+	}
 
 	Console::println("FBXReader::read(): done");
 
@@ -33,11 +33,12 @@ public:
 	 * Reads FBX file
 	 * @param pathName path name
 	 * @param fileName file name
+	 * @param statistics import statistics or null, groups are read as part of scene graph as FBX SDK is not thread safe
 	 * @throws model file IO exception
 	 * @throws file system exception
 	 * @return model instance
 	 */
-	static Model* read(const string& pathName, const string& fileName) throw (ModelFileIOException, FileSystemException);
+	static Model* read(const string& pathName, const string& fileName, ModelImportStatistics* statistics = nullptr) throw (ModelFileIOException, FileSystemException);
 
 private:
 	static const Color4 BLENDER_AMBIENT_NONE;
@@ -12,6 +12,7 @@
 #include <ext/libpng/png.h>
 #include <ext/tinygltf/tiny_gltf.h>
 
+#include <tdme/engine/fileio/models/ModelImportStatistics.h>
 #include <tdme/engine/model/Animation.h>
 #include <tdme/engine/model/Color4.h>
 #include <tdme/engine/model/Color4Base.h>
@@ -29,14 +30,18 @@
 #include <tdme/engine/model/SpecularMaterialProperties.h>
 #include <tdme/engine/model/TextureCoordinate.h>
 #include <tdme/engine/model/UpVector.h>
+#include <tdme/math/Math.h>
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/math/Quaternion.h>
 #include <tdme/math/Vector3.h>
 #include <tdme/os/filesystem/FileSystem.h>
 #include <tdme/os/filesystem/FileSystemException.h>
 #include <tdme/os/filesystem/FileSystemInterface.h>
+#include <tdme/os/threading/AtomicOperations.h>
+#include <tdme/os/threading/Thread.h>
 #include <tdme/utils/Console.h>
 #include <tdme/utils/Exception.h>
+#include <tdme/utils/Time.h>
 
 using std::map;
 using std::to_string;
@@ -45,6 +50,7 @@ using std::string;
 using std::vector;
 
 using tdme::engine::fileio::models::GLTFReader;
+using tdme::engine::fileio::models::ModelImportStatistics;
 using tdme::engine::model::Animation;
 using tdme::engine::model::Color4;
 using tdme::engine::model::Color4Base;
@@ -62,17 +68,66 @@ using tdme::engine::model::Skinning;
 using tdme::engine::model::SpecularMaterialProperties;
 using tdme::engine::model::TextureCoordinate;
 using tdme::engine::model::UpVector;
+using tdme::math::Math;
 using tdme::math::Matrix4x4;
 using tdme::math::Quaternion;
 using tdme::math::Vector3;
 using tdme::os::filesystem::FileSystem;
 using tdme::os::filesystem::FileSystemException;
 using tdme::os::filesystem::FileSystemInterface;
+using tdme::os::threading::AtomicOperations;
+using tdme::os::threading::Thread;
 using tdme::utils::Console;
 using tdme::utils::Exception;
+using tdme::utils::Time;
+
+GLTFReader::WritePNGThread::WritePNGThread(const string* pathName, const tinygltf::Model* gltfModel, const vector<int>* gltfImageIndices, volatile uint64_t* gltfImageIdx):
+	Thread("gltfreader-writepng-thread"),
+	pathName(pathName),
+	gltfModel(gltfModel),
+	gltfImageIndices(gltfImageIndices),
+	gltfImageIdx(gltfImageIdx) {
+}
+
+void GLTFReader::WritePNGThread::run() {
+	uint64_t i;
+	while ((i = AtomicOperations::add(*gltfImageIdx) - 1) < gltfImageIndices->size()) {
+		auto& image = gltfModel->images[(*gltfImageIndices)[i]];
+		auto fileName = getImageFileName(*gltfModel, (*gltfImageIndices)[i]);
+		if (writePNG(*pathName, fileName, image.component == 3?24:32, image.width, image.height, (const uint8_t*)image.image.data()) == false) {
+			Console::println("GLTFReader::WritePNGThread::run(): An error occurred: Could not write PNG: " + fileName);
+		}
+	}
+}
 
-Model* GLTFReader::read(const string& pathName, const string& fileName)
+GLTFReader::ParseNodeMeshThread::ParseNodeMeshThread(const tinygltf::Model* gltfModel, const vector<int>* gltfNodeIndices, const vector<Group*>* groups, const map<int, Material*>* materials, volatile uint64_t* groupIdx, vector<Skinning*>* skinnings, vector<string>* errors):
+	Thread("gltfreader-parsenodemesh-thread"),
+	gltfModel(gltfModel),
+	gltfNodeIndices(gltfNodeIndices),
+	groups(groups),
+	materials(materials),
+	groupIdx(groupIdx),
+	skinnings(skinnings),
+	errors(errors) {
+}
+
+void GLTFReader::ParseNodeMeshThread::run() {
+	uint64_t i;
+	while ((i = AtomicOperations::add(*groupIdx) - 1) < groups->size()) {
+		try {
+			(*skinnings)[i] = parseNodeMesh(*gltfModel, (*gltfNodeIndices)[i], *materials, (*groups)[i]);
+		} catch (Exception& exception) {
+			(*errors)[i] = exception.what();
+		}
+	}
+}
+
+Model* GLTFReader::read(const string& pathName, const string& fileName, ModelImportStatistics* statistics)
 {
+	auto timeStart = Time::getCurrentMillis();
+	auto timeLast = timeStart;
+	auto timeNow = timeStart;
+
 	// load model
 	vector<uint8_t> glftBinaryData;
 	FileSystem::getInstance()->getContent(pathName, fileName, glftBinaryData);
@@ -88,6 +143,9 @@ Model* GLTFReader::read(const string& pathName, const string& fileName)
 		Console::println("GLTFReader::read(): Failed to load model: " + pathName + "/" + fileName);
 		return nullptr;
 	}
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->parseTime = timeNow - timeLast;
+	timeLast = timeNow;
 
 	// 	create model
 	auto model = new Model(
@@ -99,16 +157,116 @@ Model* GLTFReader::read(const string& pathName, const string& fileName)
 		model::Model::AUTHORINGTOOL_UNKNOWN
 	);
 
-	// parse nodes aka scene
+	// parse nodes aka scene graph, group meshes are set up later
+	vector<Group*> groups;
+	vector<int> gltfNodeIndices;
 	for (auto& gltfScene: gltfModel.scenes) {
 		for (auto gltfNodeIdx: gltfScene.nodes) { 
 			auto& node = gltfModel.nodes[gltfNodeIdx]; 
-			auto group = parseNode(pathName, gltfModel, gltfNodeIdx, model, nullptr);
+			auto group = parseNode(gltfModel, gltfNodeIdx, model, nullptr, groups, gltfNodeIndices);
 			model->getGroups()[group->getId()] = group;
 			model->getSubGroups()[group->getId()] = group;
-			if (node.children.empty() == false) parseNodeChildren(pathName, gltfModel, node.children, group);
+			if (node.children.empty() == false) parseNodeChildren(gltfModel, node.children, group, groups, gltfNodeIndices);
 		}	
 	} 
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->sceneGraphTime = timeNow - timeLast;
+	timeLast = timeNow;
+
+	// we use one thread per hardware thread at most
+	auto threadCount = Thread::getHardwareThreadCount();
+	if (statistics != nullptr) statistics->threadCount = threadCount;
+
+	// materials and their textures
+	map<int, Material*> materials;
+	{
+		// collect materials used by groups and their images in deterministic order
+		vector<int> gltfMaterialIndices;
+		vector<int> gltfImageIndices;
+		set<string> imageFileNames;
+		for (auto gltfNodeIdx: gltfNodeIndices) {
+			for (auto& gltfPrimitive: gltfModel.meshes[gltfModel.nodes[gltfNodeIdx].mesh].primitives) {
+				if (gltfPrimitive.material == -1 || materials.find(gltfPrimitive.material) != materials.end()) continue;
+				materials[gltfPrimitive.material] = nullptr;
+				gltfMaterialIndices.push_back(gltfPrimitive.material);
+				auto& gltfMaterial = gltfModel.materials[gltfPrimitive.material];
+				vector<int> gltfMaterialImageIndices = {
+					getMaterialTextureImageIdx(gltfModel, gltfMaterial.values, "baseColorTexture"),
+					getMaterialTextureImageIdx(gltfModel, gltfMaterial.values, "metallicRoughnessTexture"),
+					getMaterialTextureImageIdx(gltfModel, gltfMaterial.additionalValues, "normalTexture")
+				};
+				for (auto gltfImageIdx: gltfMaterialImageIndices) {
+					if (gltfImageIdx == -1) continue;
+					auto imageFileName = getImageFileName(gltfModel, gltfImageIdx);
+					if (imageFileNames.find(imageFileName) != imageFileNames.end()) continue;
+					imageFileNames.insert(imageFileName);
+					gltfImageIndices.push_back(gltfImageIdx);
+				}
+			}
+		}
+		// write images, each into its own file, as PNG in parallel
+		volatile uint64_t gltfImageIdx = 0LL;
+		vector<WritePNGThread*> threads;
+		for (auto i = 0; i < Math::min(static_cast<int>(gltfImageIndices.size()), threadCount); i++) {
+			auto thread = new WritePNGThread(&pathName, &gltfModel, &gltfImageIndices, &gltfImageIdx);
+			thread->start();
+			threads.push_back(thread);
+		}
+		for (auto thread: threads) {
+			thread->join();
+			delete thread;
+		}
+		// create materials, materials with the same name are shared
+		for (auto gltfMaterialIdx: gltfMaterialIndices) {
+			auto materialIt = model->getMaterials().find(gltfModel.materials[gltfMaterialIdx].name);
+			if (materialIt != model->getMaterials().end()) {
+				materials[gltfMaterialIdx] = materialIt->second;
+			} else {
+				auto material = parseMaterial(pathName, gltfModel, gltfMaterialIdx);
+				model->getMaterials()[material->getId()] = material;
+				materials[gltfMaterialIdx] = material;
+			}
+		}
+	}
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->texturesTime = timeNow - timeLast;
+	timeLast = timeNow;
+
+	// group meshes, groups are independent, so parse them in parallel if worth it
+	{
+		vector<Skinning*> skinnings;
+		vector<string> errors;
+		skinnings.resize(groups.size());
+		errors.resize(groups.size());
+		volatile uint64_t groupIdx = 0LL;
+		if (threadCount < 2 || groups.size() < 2) {
+			for (auto i = 0; i < groups.size(); i++) skinnings[i] = parseNodeMesh(gltfModel, gltfNodeIndices[i], materials, groups[i]);
+		} else {
+			vector<ParseNodeMeshThread*> threads;
+			for (auto i = 0; i < Math::min(static_cast<int>(groups.size()), threadCount); i++) {
+				auto thread = new ParseNodeMeshThread(&gltfModel, &gltfNodeIndices, &groups, &materials, &groupIdx, &skinnings, &errors);
+				thread->start();
+				threads.push_back(thread);
+			}
+			for (auto thread: threads) {
+				thread->join();
+				delete thread;
+			}
+		}
+		// report first error in scene graph order
+		for (auto i = 0; i < groups.size(); i++) {
+			if (errors[i].empty() == true) continue;
+			for (auto skinning: skinnings) delete skinning;
+			throw ModelFileIOException(errors[i]);
+		}
+		// set up skinning here as it also touches the model
+		for (auto i = 0; i < groups.size(); i++) {
+			if (skinnings[i] != nullptr) groups[i]->setSkinning(skinnings[i]);
+		}
+	}
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->groupsTime = timeNow - timeLast;
+	timeLast = timeNow;
 
 	// animations
 	auto maxFrames = 0;
@@ -199,10 +357,19 @@ Model* GLTFReader::read(const string& pathName, const string& fileName)
 
 	// create default animations
 	ModelHelper::createDefaultAnimation(model, maxFrames);
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) statistics->animationsTime = timeNow - timeLast;
+	timeLast = timeNow;
+
 	// set up joints
 	ModelHelper::setupJoints(model);
 	// fix animation length
 	ModelHelper::fixAnimationLength(model);
+	timeNow = Time::getCurrentMillis();
+	if (statistics != nullptr) {
+		statistics->postProcessTime = timeNow - timeLast;
+		statistics->totalTime = timeNow - timeStart;
+	}
 
 	//
 	return model;
@@ -253,7 +420,7 @@ void GLTFReader::interpolateKeyFrames(int frameTimeCount, const float* frameTime
 	}
 }
 
-Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltfModel, int gltfNodeIdx, Model* model, Group* parentGroup) {
+Group* GLTFReader::parseNode(const tinygltf::Model& gltfModel, int gltfNodeIdx, Model* model, Group* parentGroup, vector<Group*>& groups, vector<int>& gltfNodeIndices) {
 	auto& gltfNode = gltfModel.nodes[gltfNodeIdx];
 	auto group = new Group(model, parentGroup, gltfNode.name, gltfNode.name);
 	if (gltfNode.matrix.size() == 16) {
@@ -300,7 +467,15 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 		groupTransformationsMatrix.multiply(groupTranslationMatrices);
 		group->setTransformationsMatrix(groupTransformationsMatrix);
 	}
-	if (gltfNode.mesh == -1) return group;
+	if (gltfNode.mesh != -1) {
+		groups.push_back(group);
+		gltfNodeIndices.push_back(gltfNodeIdx);
+	}
+	return group;
+}
+
+Skinning* GLTFReader::parseNodeMesh(const tinygltf::Model& gltfModel, int gltfNodeIdx, const map<int, Material*>& materials, Group* group) {
+	auto& gltfNode = gltfModel.nodes[gltfNodeIdx];
 	vector<int> joints;
 	vector<float> weights;
 	vector<Vector3> vertices;
@@ -312,69 +487,11 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 	for (auto& gltfPrimitive: mesh.primitives) {
 		Material* material = nullptr;
 		if (gltfPrimitive.material != -1) {
-			auto& gltfMaterial = gltfModel.materials[gltfPrimitive.material];
-			auto& gltfMaterialName = gltfMaterial.name;
-			auto materialIt = model->getMaterials().find(gltfMaterialName);
-			if (materialIt != model->getMaterials().end()) {
-				material = materialIt->second;
-			} else {
-				material = new Material(gltfMaterial.name);
-				auto pbrMaterialProperties = new PBRMaterialProperties();
-				auto specularMaterialProperties = new SpecularMaterialProperties();
-				// we ignore for now Factor, ColorFactor, TextureScale, TextureStrength, TextureTexCoord as I do not see them feasible in Blender exported GLTF files
-				if (gltfMaterial.values.find("baseColorTexture") != gltfMaterial.values.end() &&
-					gltfMaterial.values.find("baseColorTexture")->second.TextureIndex() != -1) {
-					auto& gltfMaterialBaseColorTexture = gltfMaterial.values.find("baseColorTexture")->second;
-					auto& gltfTexture = gltfModel.textures[gltfMaterialBaseColorTexture.TextureIndex()];
-					auto& image = gltfModel.images[gltfTexture.source];
-					try {
-						auto fileName = image.name + ".png";
-						if (writePNG(pathName, fileName, image.component == 3?24:32, image.width, image.height, (const uint8_t*)image.image.data()) == false) {
-							Console::println("GLTFReader::parseNode(): " + group->getId() + ": An error occurred: Could not write PNG: " + fileName);
-						}
-						pbrMaterialProperties->setBaseColorTexture(pathName, fileName);
-						specularMaterialProperties->setDiffuseTexture(pathName, fileName);
-					} catch (Exception& exception) {
-						Console::println("GLTFReader::parseNode(): " + group->getId() + ": An error occurred: " + exception.what());
-					}
-				}
-				if (gltfMaterial.values.find("metallicRoughnessTexture") != gltfMaterial.values.end() &&
-					gltfMaterial.values.find("metallicRoughnessTexture")->second.TextureIndex() != -1) {
-					auto& gltfMetallicRoughnessTexture = gltfMaterial.values.find("metallicRoughnessTexture")->second;
-					auto& gltfTexture = gltfModel.textures[gltfMetallicRoughnessTexture.TextureIndex()];
-					auto& image = gltfModel.images[gltfTexture.source];
-					try {
-						auto fileName = image.name + ".png";
-						if (writePNG(pathName, fileName, image.component == 3?24:32, image.width, image.height, (const uint8_t*)image.image.data()) == false) {
-							Console::println("GLTFReader::parseNode(): " + group->getId() + ": An error occurred: Could not write PNG: " + fileName);
-						}
-						pbrMaterialProperties->setMetallicRoughnessTexture(pathName, fileName);
-					} catch (Exception& exception) {
-						Console::println("GLTFReader::parseNode(): " + group->getId() + ": An error occurred: " + exception.what());
-					}
-				}
-				if (gltfMaterial.additionalValues.find("normalTexture") != gltfMaterial.values.end() &&
-					gltfMaterial.additionalValues.find("normalTexture")->second.TextureIndex() != -1) {
-					auto& gltfNormalTexture = gltfMaterial.additionalValues.find("normalTexture")->second;
-					auto& gltfTexture = gltfModel.textures[gltfNormalTexture.TextureIndex()];
-					auto& image = gltfModel.images[gltfTexture.source];
-					try {
-						auto fileName = image.name + ".png";
-						if (writePNG(pathName, fileName, image.component == 3?24:32, image.width, image.height, (const uint8_t*)image.image.data()) == false) {
-							Console::println("GLTFReader::parseNode(): " + group->getId() + ": An error occurred: Could not write PNG: " + fileName);
-						}
-						pbrMaterialProperties->setNormalTexture(pathName, fileName);
-					} catch (Exception& exception) {
-						Console::println("GLTFReader::parseNode(): " + group->getId() + ": An error occurred: " + exception.what());
-					}
-				}
-				material->setPBRMaterialProperties(pbrMaterialProperties);
-				material->setSpecularMaterialProperties(specularMaterialProperties);
-				model->getMaterials()[material->getId()] = material;
-			}
+			auto materialIt = materials.find(gltfPrimitive.material);
+			if (materialIt != materials.end()) material = materialIt->second;
 		}
 		if (gltfPrimitive.mode != 4) {
-			Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid primitive mode: " + to_string(gltfPrimitive.mode));
+			Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid primitive mode: " + to_string(gltfPrimitive.mode));
 			continue;
 		} 
 		vector<int> indices;
@@ -383,7 +500,7 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 			auto& indicesBufferView = gltfModel.bufferViews[indicesAccessor.bufferView];
 			auto& indicesBuffer = gltfModel.buffers[indicesBufferView.buffer];
 			if (indicesBufferView.byteStride != 0) {
-				Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid stride: " + to_string(indicesBufferView.byteStride));
+				Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid stride: " + to_string(indicesBufferView.byteStride));
 			} else
 			switch (indicesAccessor.componentType) {
 				case TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT:
@@ -405,7 +522,7 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 						break;
 					} 
 				default:
-					Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid indices component: " + to_string(indicesAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(indicesAccessor.componentType)));
+					Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid indices component: " + to_string(indicesAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(indicesAccessor.componentType)));
 			}
 		}
 		auto start = 0;
@@ -418,11 +535,11 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 			auto& attributeBufferView = gltfModel.bufferViews[attributeAccessor.bufferView];
 			auto& attributeBuffer = gltfModel.buffers[attributeBufferView.buffer];
 			if (attributeBufferView.byteStride != 0) {
-				Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid attributes stride: " + to_string(attributeBufferView.byteStride));
+				Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid attributes stride: " + to_string(attributeBufferView.byteStride));
 			} else {
 				if (gltfBufferType == "POSITION") {
 					if (attributeAccessor.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT) {
-						Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid attributes component: " + to_string(attributeAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(attributeAccessor.componentType)));
+						Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid attributes component: " + to_string(attributeAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(attributeAccessor.componentType)));
 						continue;
 					}
 					haveVertices = true;
@@ -435,7 +552,7 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 				} else
 				if (gltfBufferType == "NORMAL") {
 					if (attributeAccessor.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT) {
-						Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid attributes component: " + to_string(attributeAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(attributeAccessor.componentType)));
+						Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid attributes component: " + to_string(attributeAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(attributeAccessor.componentType)));
 						continue;
 					}
 					haveNormals = true;
@@ -448,7 +565,7 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 				} else
 				if (gltfBufferType == "TEXCOORD_0") {
 					if (attributeAccessor.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT) {
-						Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid attributes component: " + to_string(attributeAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(attributeAccessor.componentType)));
+						Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid attributes component: " + to_string(attributeAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(attributeAccessor.componentType)));
 						continue;
 					}
 					haveTextureCoordinates = true;
@@ -464,7 +581,7 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 				} else
 				if (gltfBufferType == "WEIGHTS_0") {
 					if (attributeAccessor.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT) {
-						Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid attributes component: " + to_string(attributeAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(attributeAccessor.componentType)));
+						Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid attributes component: " + to_string(attributeAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(attributeAccessor.componentType)));
 						continue;
 					}
 					auto start = weights.size();
@@ -476,7 +593,7 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 				} else
 				if (gltfBufferType == "JOINTS_0") {
 					if (attributeAccessor.componentType != TINYGLTF_COMPONENT_TYPE_UNSIGNED_SHORT) {
-						Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid attributes component: " + to_string(attributeAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(attributeAccessor.componentType)));
+						Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid attributes component: " + to_string(attributeAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(attributeAccessor.componentType)));
 						continue;
 					}
 					auto start = joints.size();
@@ -486,7 +603,7 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 						joints[start + i] = bufferData[i];
 					}
 				} else {
-					Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid buffer type: " + gltfBufferType);
+					Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid buffer type: " + gltfBufferType);
 				}
 			}
 		}
@@ -522,6 +639,7 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 	}
 
 	// skinning
+	Skinning* skinning = nullptr;
 	if (gltfNode.skin != -1) {
 		auto& gltfSkin = gltfModel.skins[gltfNode.skin];
 		auto& inverseBindMatricesAccessor = gltfModel.accessors[gltfSkin.inverseBindMatrices];
@@ -529,15 +647,15 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 		auto& inverseBindMatricesBuffer = gltfModel.buffers[inverseBindMatricesBufferView.buffer];
 		const float* inverseBindMatricesBufferData = nullptr;
 		if (inverseBindMatricesBufferView.byteStride != 0) {
-			Console::println("GLTFReader::parseNode(): " + group->getId() + ": Invalid attributes stride: " + to_string(inverseBindMatricesBufferView.byteStride));
+			Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Invalid attributes stride: " + to_string(inverseBindMatricesBufferView.byteStride));
 		} else
 		if (inverseBindMatricesAccessor.componentType != TINYGLTF_COMPONENT_TYPE_FLOAT) {
-			Console::println("GLTFReader::parseNode(): " + group->getId() + ": Inverse bind matrices: Invalid attributes component: " + to_string(inverseBindMatricesAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(inverseBindMatricesAccessor.componentType)));
+			Console::println("GLTFReader::parseNodeMesh(): " + group->getId() + ": Inverse bind matrices: Invalid attributes component: " + to_string(inverseBindMatricesAccessor.componentType) + ", with size: " + to_string(getComponentTypeByteSize(inverseBindMatricesAccessor.componentType)));
 		} else {
 			inverseBindMatricesBufferData = (const float*)(inverseBindMatricesBuffer.data.data() + inverseBindMatricesAccessor.byteOffset + inverseBindMatricesBufferView.byteOffset);
 		}
 		if (inverseBindMatricesBufferData != nullptr) {
-			auto skinning = new Skinning();
+			skinning = new Skinning();
 			{
 				vector<Joint> skinningJoints;
 				for (auto gltfJointNodeIdx: gltfSkin.joints) {
@@ -582,7 +700,6 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 				skinning->setWeights(skinningWeights);
 				skinning->setVerticesJointsWeights(skinningJointWeights);
 			}
-			group->setSkinning(skinning);
 		}
 	}
 
@@ -593,19 +710,66 @@ Group* GLTFReader::parseNode(const string& pathName, const tinygltf::Model& gltf
 	group->setFacesEntities(facesEntities);
 
 	//
-	return group;
+	return skinning;
 } 
 
-void GLTFReader::parseNodeChildren(const string& pathName, const tinygltf::Model& gltfModel, const vector<int>& gltfNodeChildrenIdx, Group* parentGroup) {
+void GLTFReader::parseNodeChildren(const tinygltf::Model& gltfModel, const vector<int>& gltfNodeChildrenIdx, Group* parentGroup, vector<Group*>& groups, vector<int>& gltfNodeIndices) {
 	for (auto gltfNodeIdx: gltfNodeChildrenIdx) { 
 		auto& node = gltfModel.nodes[gltfNodeIdx];
-		auto group = parseNode(pathName, gltfModel, gltfNodeIdx, parentGroup->getModel(), parentGroup);
+		auto group = parseNode(gltfModel, gltfNodeIdx, parentGroup->getModel(), parentGroup, groups, gltfNodeIndices);
 		parentGroup->getModel()->getGroups()[group->getId()] = group;
 		parentGroup->getSubGroups()[group->getId()] = group;
-		if (node.children.empty() == false) parseNodeChildren(pathName, gltfModel, node.children, group);
+		if (node.children.empty() == false) parseNodeChildren(gltfModel, node.children, group, groups, gltfNodeIndices);
 	}	
 } 
 
+Material* GLTFReader::parseMaterial(const string& pathName, const tinygltf::Model& gltfModel, int gltfMaterialIdx) {
+	auto& gltfMaterial = gltfModel.materials[gltfMaterialIdx];
+	auto material = new Material(gltfMaterial.name);
+	auto pbrMaterialProperties = new PBRMaterialProperties();
+	auto specularMaterialProperties = new SpecularMaterialProperties();
+	// we ignore for now Factor, ColorFactor, TextureScale, TextureStrength, TextureTexCoord as I do not see them feasible in Blender exported GLTF files
+	auto baseColorImageIdx = getMaterialTextureImageIdx(gltfModel, gltfMaterial.values, "baseColorTexture");
+	if (baseColorImageIdx != -1) {
+		try {
+			auto fileName = getImageFileName(gltfModel, baseColorImageIdx);
+			pbrMaterialProperties->setBaseColorTexture(pathName, fileName);
+			specularMaterialProperties->setDiffuseTexture(pathName, fileName);
+		} catch (Exception& exception) {
+			Console::println("GLTFReader::parseMaterial(): " + material->getId() + ": An error occurred: " + exception.what());
+		}
+	}
+	auto metallicRoughnessImageIdx = getMaterialTextureImageIdx(gltfModel, gltfMaterial.values, "metallicRoughnessTexture");
+	if (metallicRoughnessImageIdx != -1) {
+		try {
+			pbrMaterialProperties->setMetallicRoughnessTexture(pathName, getImageFileName(gltfModel, metallicRoughnessImageIdx));
+		} catch (Exception& exception) {
+			Console::println("GLTFReader::parseMaterial(): " + material->getId() + ": An error occurred: " + exception.what());
+		}
+	}
+	auto normalImageIdx = getMaterialTextureImageIdx(gltfModel, gltfMaterial.additionalValues, "normalTexture");
+	if (normalImageIdx != -1) {
+		try {
+			pbrMaterialProperties->setNormalTexture(pathName, getImageFileName(gltfModel, normalImageIdx));
+		} catch (Exception& exception) {
+			Console::println("GLTFReader::parseMaterial(): " + material->getId() + ": An error occurred: " + exception.what());
+		}
+	}
+	material->setPBRMaterialProperties(pbrMaterialProperties);
+	material->setSpecularMaterialProperties(specularMaterialProperties);
+	return material;
+}
+
+int GLTFReader::getMaterialTextureImageIdx(const tinygltf::Model& gltfModel, const tinygltf::ParameterMap& gltfParameters, const string& name) {
+	auto gltfParameterIt = gltfParameters.find(name);
+	if (gltfParameterIt == gltfParameters.end() || gltfParameterIt->second.TextureIndex() == -1) return -1;
+	return gltfModel.textures[gltfParameterIt->second.TextureIndex()].source;
+}
+
+const string GLTFReader::getImageFileName(const tinygltf::Model& gltfModel, int gltfImageIdx) {
+	return gltfModel.images[gltfImageIdx].name + ".png";
+}
+
 bool GLTFReader::writePNG(const string& pathName, const string& fileName, int bitsPerPixel, int width, int height, const uint8_t* pixels) {
 	// see: https://gist.github.com/niw/5963798
 	FILE *fp = fopen((pathName + "/" + fileName).c_str(), "wb");
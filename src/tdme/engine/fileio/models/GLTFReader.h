@@ -1,6 +1,8 @@
 #pragma once
 
+#include <map>
 #include <string>
+#include <vector>
 
 #include <ext/tinygltf/tiny_gltf.h>
 
@@ -9,6 +11,7 @@
 #include <tdme/engine/model/fwd-tdme.h>
 #include <tdme/engine/model/Model.h>
 #include <tdme/os/filesystem/fwd-tdme.h>
+#include <tdme/os/threading/Thread.h>
 
 #include <tdme/engine/fileio/models/ModelFileIOException.h>
 #include <tdme/os/filesystem/FileSystemException.h>
@@ -20,10 +23,14 @@ using std::vector;
 using tdme::engine::fileio::models::ModelFileIOException;
 using tdme::engine::model::Model;
 using tdme::engine::model::Group;
+using tdme::engine::model::Material;
+using tdme::engine::model::Skinning;
 using tdme::os::filesystem::FileSystemException;
+using tdme::os::threading::Thread;
 
 /**
  * GLTF model reader
+ * 	The scene graph is parsed first, then images are written as PNG and group meshes are set up in parallel
  * @author Andreas Drewke
  * @version $Id$
  */
@@ -35,14 +42,73 @@ public:
 	 * Reads GLTF file
 	 * @param pathName path name
 	 * @param fileName file name
+	 * @param statistics import statistics or null
 	 * @throws tdme::engine::fileio::models::ModelFileIOException
 	 * @throws tdme::os::filesystem::FileSystemException
 	 * @return model instance
 	 */
-	static Model* read(const string& pathName, const string& fileName);
+	static Model* read(const string& pathName, const string& fileName, ModelImportStatistics* statistics = nullptr);
 
 private:
 
+	/**
+	 * Write PNG thread, writes images used by materials
+	 */
+	class WritePNGThread: public Thread {
+	public:
+		/**
+		 * Constructor
+		 * @param pathName path name
+		 * @param gltfModel GLTF model
+		 * @param gltfImageIndices GLTF image indices
+		 * @param gltfImageIdx shared index of next image to process
+		 */
+		WritePNGThread(const string* pathName, const tinygltf::Model* gltfModel, const vector<int>* gltfImageIndices, volatile uint64_t* gltfImageIdx);
+
+		/**
+		 * Run
+		 */
+		virtual void run();
+
+	private:
+		const string* pathName;
+		const tinygltf::Model* gltfModel;
+		const vector<int>* gltfImageIndices;
+		volatile uint64_t* gltfImageIdx;
+	};
+
+	/**
+	 * Parse node mesh thread, sets up group meshes and skinning
+	 */
+	class ParseNodeMeshThread: public Thread {
+	public:
+		/**
+		 * Constructor
+		 * @param gltfModel GLTF model
+		 * @param gltfNodeIndices GLTF node indices
+		 * @param groups TDME groups
+		 * @param materials TDME materials by GLTF material index
+		 * @param groupIdx shared index of next group to process
+		 * @param skinnings created skinnings by group
+		 * @param errors errors by group
+		 */
+		ParseNodeMeshThread(const tinygltf::Model* gltfModel, const vector<int>* gltfNodeIndices, const vector<Group*>* groups, const map<int, Material*>* materials, volatile uint64_t* groupIdx, vector<Skinning*>* skinnings, vector<string>* errors);
+
+		/**
+		 * Run
+		 */
+		virtual void run();
+
+	private:
+		const tinygltf::Model* gltfModel;
+		const vector<int>* gltfNodeIndices;
+		const vector<Group*>* groups;
+		const map<int, Material*>* materials;
+		volatile uint64_t* groupIdx;
+		vector<Skinning*>* skinnings;
+		vector<string>* errors;
+	};
+
 	/**
 	 * @return component byte size
 	 */
@@ -60,23 +126,62 @@ private:
 	static void interpolateKeyFrames(int frameTimeCount, const float* frameTimes, const vector<Matrix4x4>& keyFrameMatrices, int interpolatedMatrixCount, vector<Matrix4x4>& interpolatedMatrices, int frameStartIdx);
 
 	/**
-	 * Parse GLTF node
-	 * @param pathName path name
+	 * Parse GLTF node, without mesh
 	 * @param gltfModel GLTF mode
 	 * @param gltfNodeIdx GLTF node index
 	 * @param model TDME model 
 	 * @param parentGroup TDME parent group
+	 * @param groups TDME groups with meshes
+	 * @param gltfNodeIndices GLTF node indices of TDME groups with meshes
 	 */
-	static Group* parseNode(const string& pathName, const tinygltf::Model& gltfModel, int gltfNodeIdx, Model* model, Group* parentGroup);
+	static Group* parseNode(const tinygltf::Model& gltfModel, int gltfNodeIdx, Model* model, Group* parentGroup, vector<Group*>& groups, vector<int>& gltfNodeIndices);
 
 	/**
 	 * Parse GLTF node children into TDME group
-	 * @param pathName path name
 	 * @param gltfModel GLTF model
 	 * @param gltfNodeChildrenIdx GLTF node children indices
 	 * @param parentGroup TDME parent group
+	 * @param groups TDME groups with meshes
+	 * @param gltfNodeIndices GLTF node indices of TDME groups with meshes
+	 */
+	static void parseNodeChildren(const tinygltf::Model& gltfModel, const vector<int>& gltfNodeChildrenIdx, Group* parentGroup, vector<Group*>& groups, vector<int>& gltfNodeIndices);
+
+	/**
+	 * Parse GLTF node mesh into TDME group, only touches given group and thus can run in parallel
+	 * @param gltfModel GLTF model
+	 * @param gltfNodeIdx GLTF node index
+	 * @param materials TDME materials by GLTF material index
+	 * @param group TDME group
+	 * @throws tdme::engine::fileio::models::ModelFileIOException
+	 * @return skinning to be set up with group or null
+	 */
+	static Skinning* parseNodeMesh(const tinygltf::Model& gltfModel, int gltfNodeIdx, const map<int, Material*>& materials, Group* group);
+
+	/**
+	 * Parse GLTF material, its images need to be written already
+	 * @param pathName path name
+	 * @param gltfModel GLTF model
+	 * @param gltfMaterialIdx GLTF material index
+	 * @return material
+	 */
+	static Material* parseMaterial(const string& pathName, const tinygltf::Model& gltfModel, int gltfMaterialIdx);
+
+	/**
+	 * Get image index of GLTF material texture
+	 * @param gltfModel GLTF model
+	 * @param gltfParameters GLTF material parameters
+	 * @param name texture parameter name
+	 * @return image index or -1
+	 */
+	static int getMaterialTextureImageIdx(const tinygltf::Model& gltfModel, const tinygltf::ParameterMap& gltfParameters, const string& name);
+
+	/**
+	 * Get file name of GLTF image
+	 * @param gltfModel GLTF model
+	 * @param gltfImageIdx GLTF image index
+	 * @return file name
 	 */
-	static void parseNodeChildren(const string& pathName, const tinygltf::Model& gltfModel, const vector<int>& gltfNodeChildrenIdx, Group* parentGroup);
+	static const string getImageFileName(const tinygltf::Model& gltfModel, int gltfImageIdx);
 
 	/**
 	 * Write PNG from memory
@@ -0,0 +1,20 @@
+#pragma once
+
+#include <tdme/tdme.h>
+#include <tdme/engine/fileio/models/fwd-tdme.h>
+
+/**
+ * Model import statistics entity, times are given in milliseconds
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+struct tdme::engine::fileio::models::ModelImportStatistics
+{	int32_t threadCount {  };
+	int64_t parseTime {  };
+	int64_t sceneGraphTime {  };
+	int64_t texturesTime {  };
+	int64_t groupsTime {  };
+	int64_t animationsTime {  };
+	int64_t postProcessTime {  };
+	int64_t totalTime {  };
+};
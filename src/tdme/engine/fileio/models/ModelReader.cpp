@@ -7,6 +7,7 @@
 #include <tdme/engine/fileio/models/GLTFReader.h>
 #include <tdme/engine/fileio/models/TMReader.h>
 #include <tdme/engine/fileio/models/ModelFileIOException.h>
+#include <tdme/engine/fileio/models/ModelImportStatistics.h>
 #include <tdme/engine/model/Model.h>
 #include <tdme/os/filesystem/FileSystem.h>
 #include <tdme/os/filesystem/FileSystemInterface.h>
@@ -21,6 +22,7 @@ using tdme::engine::fileio::models::DAEReader;
 using tdme::engine::fileio::models::GLTFReader;
 using tdme::engine::fileio::models::TMReader;
 using tdme::engine::fileio::models::ModelFileIOException;
+using tdme::engine::fileio::models::ModelImportStatistics;
 using tdme::engine::fileio::models::ModelReader;
 using tdme::engine::model::Model;
 using tdme::os::filesystem::FileSystem;
@@ -35,14 +37,14 @@ const vector<string>& ModelReader::getModelExtensions() {
 	return extensions;
 }
 
-Model* ModelReader::read(const string& pathName, const string& fileName)
+Model* ModelReader::read(const string& pathName, const string& fileName, ModelImportStatistics* statistics)
 {
 	try {
 		if (StringUtils::endsWith(StringUtils::toLowerCase(fileName), ".dae") == true) {
-			return DAEReader::read(pathName, fileName);
+			return DAEReader::read(pathName, fileName, statistics);
 		} else
 		if (StringUtils::endsWith(StringUtils::toLowerCase(fileName), ".glb") == true) {
-			return GLTFReader::read(pathName, fileName);
+			return GLTFReader::read(pathName, fileName, statistics);
 		} else
 		if (StringUtils::endsWith(StringUtils::toLowerCase(fileName), ".tm") == true) {
 			return TMReader::read(pathName, fileName);
@@ -36,9 +36,10 @@ public:
 	 * Reads a model
 	 * @param pathName path name
 	 * @param fileName file name
+	 * @param statistics import statistics or null, which are only provided by DAE, FBX and GLTF readers
 	 * @throws tdme::engine::fileio::models::ModelFileIOException
 	 * @throws tdme::os::filesystem::FileSystemException
 	 * @return texture data instance or null
 	 */
-	static Model* read(const string& pathName, const string& fileName);
+	static Model* read(const string& pathName, const string& fileName, ModelImportStatistics* statistics = nullptr);
 };
@@ -25,6 +25,7 @@
 #include <tdme/math/Matrix2D3x3.h>
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/math/Vector3.h>
+#include <tdme/os/filesystem/ArchiveFileSystem.h>
 #include <tdme/os/filesystem/FileSystem.h>
 #include <tdme/os/filesystem/FileSystemInterface.h>
 
@@ -56,14 +57,32 @@ using tdme::engine::model::UpVector;
 using tdme::engine::primitives::BoundingBox;
 using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
+using tdme::os::filesystem::ArchiveFileSystem;
 using tdme::os::filesystem::FileSystem;
 using tdme::os::filesystem::FileSystemInterface;
 
 Model* TMReader::read(const string& pathName, const string& fileName)
 {
+	// read directly from memory mapped archive if file is stored uncompressed
+	auto archiveFileSystem = dynamic_cast<ArchiveFileSystem*>(FileSystem::getInstance());
+	if (archiveFileSystem != nullptr) {
+		uint64_t bytes = 0LL;
+		auto data = archiveFileSystem->getContentView(pathName, fileName, bytes);
+		if (data != nullptr) return read(data, bytes, pathName, fileName);
+	}
 	vector<uint8_t> content;
 	FileSystem::getInstance()->getContent(pathName, fileName, content);
-	TMReaderInputStream is(&content);
+	return read(content, pathName, fileName);
+}
+
+Model* TMReader::read(const vector<uint8_t>& content, const string& pathName, const string& fileName)
+{
+	return read(content.data(), content.size(), pathName, fileName);
+}
+
+Model* TMReader::read(const uint8_t* data, uint64_t bytes, const string& pathName, const string& fileName)
+{
+	TMReaderInputStream is(data, bytes);
 	auto fileId = is.readString();
 	if (fileId.length() == 0 || fileId != "TDME Model") {
 		throw ModelFileIOException(
@@ -225,12 +244,10 @@ void TMReader::readAnimationSetup(TMReaderInputStream* is, Model* model, const a
 const vector<Vector3> TMReader::readVertices(TMReaderInputStream* is)
 {
 	vector<Vector3> v;
-	array<float, 3> vXYZ;
 	if (is->readBoolean() == true) {
 		v.resize(is->readInt());
 		for (auto i = 0; i < v.size(); i++) {
-			is->readFloatArray(vXYZ);
-			v[i].set(vXYZ);
+			is->readFloatArray(v[i].getArray());
 		}
 	}
 	return v;
@@ -238,13 +255,11 @@ const vector<Vector3> TMReader::readVertices(TMReaderInputStream* is)
 
 const vector<TextureCoordinate> TMReader::readTextureCoordinates(TMReaderInputStream* is)
 {
-	array<float, 2> tcUV;
 	vector<TextureCoordinate> tc;
 	if (is->readBoolean() == true) {
 		tc.resize(is->readInt());
 		for (auto i = 0; i < tc.size(); i++) {
-			is->readFloatArray(tcUV);
-			tc[i] = TextureCoordinate(tcUV);
+			is->readFloatArray(tc[i].getArray());
 		}
 	}
 	return tc;
@@ -259,9 +274,7 @@ bool TMReader::readIndices(TMReaderInputStream* is, array<int32_t, 3>* indices)
 		if (length != indices->size()) {
 			throw ModelFileIOException("Wrong indices array size");
 		}
-		for (auto i = 0; i < indices->size(); i++) {
-			(*indices)[i] = is->readInt();
-		}
+		is->readInts(indices->data(), indices->size());
 		return true;
 	}
 }
@@ -271,14 +284,12 @@ Animation* TMReader::readAnimation(TMReaderInputStream* is, Group* g)
 	if (is->readBoolean() == false) {
 		return nullptr;
 	} else {
-		array<float, 16> matrixArray;
 		auto frames = is->readInt();
 		auto animation = new Animation();
 		vector<Matrix4x4> transformationsMatrices;
 		transformationsMatrices.resize(frames);
 		for (auto i = 0; i < transformationsMatrices.size(); i++) {
-			is->readFloatArray(matrixArray);
-			transformationsMatrices[i].set(matrixArray);
+			is->readFloatArray(transformationsMatrices[i].getArray());
 		}
 		animation->setTransformationsMatrices(transformationsMatrices);
 		g->setAnimation(animation);
@@ -1,6 +1,8 @@
 #pragma once
 
 #include <array>
+#include <cstdlib>
+#include <cstring>
 #include <map>
 #include <string>
 #include <vector>
@@ -17,6 +19,7 @@
 
 using std::array;
 using std::map;
+using std::memcpy;
 using std::string;
 using std::vector;
 
@@ -37,21 +40,63 @@ namespace fileio {
 namespace models {
 
 /**
- * TM reader input stream
+ * TM reader input stream, which reads from a borrowed buffer
  * @author Andreas Drewke
  * @version $Id$
  */
 class TMReaderInputStream {
 private:
-	vector<uint8_t>* data;
-	int32_t position;
+	const uint8_t* data;
+	int64_t size;
+	int64_t position;
+
+	/**
+	 * Check if given number of bytes can be read
+	 * @param bytes bytes
+	 * @throws tdme::engine::fileio::models::ModelFileIOException
+	 */
+	inline void checkBytes(int64_t bytes) {
+		if (bytes < 0 || position + bytes > size) {
+			throw ModelFileIOException("Unexpected end of stream");
+		}
+	}
+
+	/**
+	 * Decode a big endian 32 bit unsigned integer
+	 * @param bytes bytes
+	 * @return unsigned integer
+	 */
+	inline static uint32_t decodeUInt32(const uint8_t* bytes) {
+		uint32_t value;
+		memcpy(&value, bytes, sizeof(value));
+		#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+			return value;
+		#elif defined(_MSC_VER)
+			return _byteswap_ulong(value);
+		#else
+			return __builtin_bswap32(value);
+		#endif
+	}
+
 public:
 	/**
 	 * Constructor
 	 * @param data input data array
 	 */
-	inline TMReaderInputStream(vector<uint8_t>* data) {
+	inline TMReaderInputStream(const vector<uint8_t>* data) {
+		this->data = data->data();
+		this->size = data->size();
+		this->position = 0;
+	}
+
+	/**
+	 * Constructor
+	 * @param data input data, which needs to stay valid while reading
+	 * @param size input data size
+	 */
+	inline TMReaderInputStream(const uint8_t* data, int64_t size) {
 		this->data = data;
+		this->size = size;
 		this->position = 0;
 	}
 
@@ -71,10 +116,10 @@ public:
 	 * @return byte
 	 */
 	inline int8_t readByte() {
-		if (position == data->size()) {
+		if (position == size) {
 			throw ModelFileIOException("Unexpected end of stream");
 		}
-		return (*data)[position++];
+		return data[position++];
 	}
 
 	/**
@@ -83,11 +128,9 @@ public:
 	 * @return int
 	 */
 	inline  int32_t readInt() {
-		int32_t value =
-			((static_cast< int32_t >(readByte()) & 0xFF) << 24) +
-			((static_cast< int32_t >(readByte()) & 0xFF) << 16) +
-			((static_cast< int32_t >(readByte()) & 0xFF) << 8) +
-			((static_cast< int32_t >(readByte()) & 0xFF) << 0);
+		checkBytes(4);
+		int32_t value = static_cast<int32_t>(decodeUInt32(&data[position]));
+		position+= 4;
 		return value;
 	}
 
@@ -97,90 +140,59 @@ public:
 	 * @return float
 	 */
 	inline float readFloat() {
-		int32_t value =
-			((static_cast< int32_t >(readByte()) & 0xFF) << 24) +
-			((static_cast< int32_t >(readByte()) & 0xFF) << 16) +
-			((static_cast< int32_t >(readByte()) & 0xFF) << 8) +
-			((static_cast< int32_t >(readByte()) & 0xFF) << 0);
-		float* floatValue = (float*)&value;
-		return *floatValue;
-	}
-
-	/**
-	 * Reads a string from input stream
-	 * @throws tdme::engine::fileio::models::ModelFileIOException
-	 * @return string
-	 */
-	inline const string readString() {
-		if (readBoolean() == false) {
-			return "";
-		} else {
-			auto l = readInt();
-			string s;
-			for (auto i = 0; i < l; i++) {
-				s+= static_cast< char >(readByte());
-			}
-			return s;
-		}
+		checkBytes(4);
+		auto value = decodeUInt32(&data[position]);
+		position+= 4;
+		float floatValue;
+		memcpy(&floatValue, &value, sizeof(floatValue));
+		return floatValue;
 	}
 
 	/**
-	 * Reads a float array from input stream
+	 * Reads integers from input stream in one go
+	 * @param values values
+	 * @param count integer count
 	 * @throws tdme::engine::fileio::models::ModelFileIOException
-	 * @return float array
 	 */
-	inline void readFloatArray(array<float, 16>& data) {
-		auto length = readInt();
-		if (length != data.size()) {
-			throw ModelFileIOException("Wrong float array size");
-		}
-		for (auto i = 0; i < data.size(); i++) {
-			(data)[i] = readFloat();
+	inline void readInts(int32_t* values, int32_t count) {
+		checkBytes(static_cast<int64_t>(count) * 4);
+		auto bytes = &data[position];
+		for (auto i = 0; i < count; i++) {
+			values[i] = static_cast<int32_t>(decodeUInt32(&bytes[i * 4]));
 		}
+		position+= static_cast<int64_t>(count) * 4;
 	}
 
 	/**
-	 * Reads a float array from input stream
+	 * Reads floats from input stream in one go
+	 * @param values values
+	 * @param count float count
 	 * @throws tdme::engine::fileio::models::ModelFileIOException
-	 * @return float array
 	 */
-	inline void readFloatArray(array<float, 9>& data) {
-		auto length = readInt();
-		if (length != data.size()) {
-			throw ModelFileIOException("Wrong float array size");
-		}
-		for (auto i = 0; i < data.size(); i++) {
-			(data)[i] = readFloat();
+	inline void readFloats(float* values, int32_t count) {
+		checkBytes(static_cast<int64_t>(count) * 4);
+		auto bytes = &data[position];
+		for (auto i = 0; i < count; i++) {
+			auto value = decodeUInt32(&bytes[i * 4]);
+			memcpy(&values[i], &value, sizeof(float));
 		}
+		position+= static_cast<int64_t>(count) * 4;
 	}
 
 	/**
-	 * Reads a float array from input stream
-	 * @throws tdme::engine::fileio::models::ModelFileIOException
-	 * @return float array
-	 */
-	inline void readFloatArray(array<float, 4>& data) {
-		auto length = readInt();
-		if (length != data.size()) {
-			throw ModelFileIOException("Wrong float array size");
-		}
-		for (auto i = 0; i < data.size(); i++) {
-			(data)[i] = readFloat();
-		}
-	}
-
-	/**
-	 * Reads a float array from input stream
+	 * Reads a string from input stream
 	 * @throws tdme::engine::fileio::models::ModelFileIOException
-	 * @return float array
+	 * @return string
 	 */
-	inline void readFloatArray(array<float, 3>& data) {
-		auto length = readInt();
-		if (length != data.size()) {
-			throw ModelFileIOException("Wrong float array size");
-		}
-		for (auto i = 0; i < data.size(); i++) {
-			data[i] = readFloat();
+	inline const string readString() {
+		if (readBoolean() == false) {
+			return "";
+		} else {
+			auto l = readInt();
+			checkBytes(l);
+			string s(reinterpret_cast<const char*>(&data[position]), l);
+			position+= l;
+			return s;
 		}
 	}
 
@@ -189,14 +201,13 @@ public:
 	 * @throws tdme::engine::fileio::models::ModelFileIOException
 	 * @return float array
 	 */
-	inline void readFloatArray(array<float, 2>& data) {
+	template<size_t SIZE>
+	inline void readFloatArray(array<float, SIZE>& data) {
 		auto length = readInt();
 		if (length != data.size()) {
 			throw ModelFileIOException("Wrong float array size");
 		}
-		for (auto i = 0; i < data.size(); i++) {
-			data[i] = readFloat();
-		}
+		readFloats(data.data(), SIZE);
 	}
 
 	/**
@@ -206,10 +217,10 @@ public:
 	 */
 	inline const vector<float> readFloatVector() {
 		vector<float> f;
-		f.resize(readInt());
-		for (auto i = 0; i < f.size(); i++) {
-			f[i] = readFloat();
-		}
+		auto length = readInt();
+		checkBytes(static_cast<int64_t>(length) * 4);
+		f.resize(length);
+		readFloats(f.data(), length);
 		return f;
 	}
 
@@ -239,6 +250,29 @@ public:
 	 */
 	static Model* read(const string& pathName, const string& fileName);
 
+	/**
+	 * TDME model format reader, which decodes a model from given already loaded file content
+	 * @param content file content
+	 * @param pathName path name, used to resolve textures
+	 * @param fileName file name
+	 * @throws tdme::os::filesystem::FileSystemException
+	 * @throws tdme::engine::fileio::models::ModelFileIOException
+	 * @return model
+	 */
+	static Model* read(const vector<uint8_t>& content, const string& pathName, const string& fileName);
+
+	/**
+	 * TDME model format reader, which decodes a model from a borrowed buffer like a memory mapped archive
+	 * @param data file content, which needs to stay valid while reading
+	 * @param bytes file content bytes
+	 * @param pathName path name, used to resolve textures
+	 * @param fileName file name
+	 * @throws tdme::os::filesystem::FileSystemException
+	 * @throws tdme::engine::fileio::models::ModelFileIOException
+	 * @return model
+	 */
+	static Model* read(const uint8_t* data, uint64_t bytes, const string& pathName, const string& fileName);
+
 private:
 	/**
 	 * Get texture path
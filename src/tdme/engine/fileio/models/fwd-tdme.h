@@ -8,6 +8,7 @@ namespace fileio {
 namespace models {
 	class DAEReader;
 	class ModelFileIOException;
+	class ModelImportStatistics;
 	class ModelReader;
 	class FBXReader;
 	class GLTFReader;
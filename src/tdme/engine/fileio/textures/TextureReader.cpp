@@ -41,6 +41,16 @@ const vector<string>& TextureReader::getTextureExtensions() {
 }
 
 Texture* TextureReader::read(const string& pathName, const string& fileName, bool useCache, bool powerOfTwo)
+{
+	return loadTexture(nullptr, pathName, fileName, useCache, powerOfTwo);
+}
+
+Texture* TextureReader::read(const vector<uint8_t>& content, const string& pathName, const string& fileName, bool useCache, bool powerOfTwo)
+{
+	return loadTexture(&content, pathName, fileName, useCache, powerOfTwo);
+}
+
+Texture* TextureReader::loadTexture(const vector<uint8_t>* content, const string& pathName, const string& fileName, bool useCache, bool powerOfTwo)
 {
 	Texture* texture = nullptr;
 
@@ -63,7 +73,9 @@ Texture* TextureReader::read(const string& pathName, const string& fileName, boo
 		// nope try to load
 		try {
 			if (StringUtils::endsWith(StringUtils::toLowerCase(canonicalFileName), ".png") == true) {
-				texture = TextureReader::loadPNG(canonicalPathName, canonicalFileName, powerOfTwo);
+				texture = content != nullptr?
+					TextureReader::loadPNG(*content, canonicalPathName, canonicalFileName, powerOfTwo):
+					TextureReader::loadPNG(canonicalPathName, canonicalFileName, powerOfTwo);
 				if (texture != nullptr && useCache == true) {
 					(*textureCache)[texture->getId()] = texture;
 				}
@@ -173,14 +185,18 @@ void TextureReader::readPNGDataFromMemory(png_structp png_ptr, png_bytep outByte
 }
 
 Texture* TextureReader::loadPNG(const string& pathName, const string& fileName, bool powerOfTwo) {
+	vector<uint8_t> content;
+	FileSystem::getInstance()->getContent(pathName, fileName, content);
+	return loadPNG(content, pathName, fileName, powerOfTwo);
+}
+
+Texture* TextureReader::loadPNG(const vector<uint8_t>& content, const string& pathName, const string& fileName, bool powerOfTwo) {
 	// see: http://devcry.heiho.net/html/2015/20150517-libpng.html
 
 	// canonical file name for id
 	auto canonicalFileName = FileSystem::getInstance()->getCanonicalPath(pathName, fileName);
 
 	// create PNG input stream
-	vector<uint8_t> content;
-	FileSystem::getInstance()->getContent(pathName, fileName, content);
 	PNGInputStream* pngInputStream = new PNGInputStream(&content);
 
 	// check that the PNG signature is in the file header
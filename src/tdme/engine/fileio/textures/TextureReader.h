@@ -59,6 +59,17 @@ public:
 	 */
 	static Texture* read(const string& texturePathName, const string& textureFileName, const string& transparencyTexturePathName, const string& transparencyTextureFileName, bool useCache = true, bool powerOfTwo = true);
 
+	/**
+	 * Decodes a texture from given already loaded file content
+	 * @param content file content
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param useCache use cache
+	 * @param powerOfTwo scale image to fit power of two dimensions
+	 * @return texture data instance or null
+	 */
+	static Texture* read(const vector<uint8_t>& content, const string& pathName, const string& fileName, bool useCache = true, bool powerOfTwo = true);
+
 private:
 	/**
 	 * PNG input stream
@@ -71,7 +82,7 @@ private:
 		 * @author Andreas Drewke
 		 * @version $Id$
 		 */
-		PNGInputStream(vector<uint8_t>* data) {
+		PNGInputStream(const vector<uint8_t>* data) {
 			this->offset = 0;
 			this->data = data;
 		}
@@ -95,7 +106,7 @@ private:
 
 	private:
 		int32_t offset;
-		vector<uint8_t>* data;
+		const vector<uint8_t>* data;
 
 	};
 
@@ -121,6 +132,26 @@ private:
 	 */
 	static Texture* loadPNG(const string& path, const string& fileName, bool powerOfTwo = true);
 
+	/**
+	 * Load PNG from given file content
+	 * @param content file content
+	 * @param path path name
+	 * @param fileName file name
+	 * @param powerOfTwo scale image to fit power of two dimensions
+	 */
+	static Texture* loadPNG(const vector<uint8_t>& content, const string& path, const string& fileName, bool powerOfTwo = true);
+
+	/**
+	 * Load texture, either from given file content or from file system if content is null
+	 * @param content file content or null
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param useCache use cache
+	 * @param powerOfTwo scale image to fit power of two dimensions
+	 * @return texture data instance or null
+	 */
+	static Texture* loadTexture(const vector<uint8_t>* content, const string& pathName, const string& fileName, bool useCache, bool powerOfTwo);
+
 	/**
 	 * Scales a texture line
 	 * @param pixelByteBuffer pixel byte buffer aka original texture
@@ -9,6 +9,7 @@ namespace engine {
 		class EngineGL3Renderer;
 		class EngineGL2Renderer;
 		class EngineGLES2Renderer;
+		class EngineSoftwareRenderer;
 		class EngineVKRenderer;
 		class Entity;
 		class EntityHierarchy;
@@ -34,6 +35,8 @@ namespace engine {
 		class Rotation;
 		class Timing;
 		class Transformations;
+		class VisibilityCache;
+		struct VisibilityCacheStatistics;
 		class WindowManager;
 }  // namespace engine
 }  // namespace tdme
@@ -2,6 +2,7 @@
 
 #include <tdme/engine/model/PBRMaterialProperties.h>
 #include <tdme/engine/model/SpecularMaterialProperties.h>
+#include <tdme/os/threading/AtomicOperations.h>
 
 #include <string>
 
@@ -10,9 +11,11 @@ using std::string;
 using tdme::engine::model::Material;
 using tdme::engine::model::PBRMaterialProperties;
 using tdme::engine::model::SpecularMaterialProperties;
+using tdme::os::threading::AtomicOperations;
 
 Material::Material(const string& id)
 {
+	this->uniqueIdx = AtomicOperations::add(uniqueIdxCounter);
 	this->id = id;
 	this->textureMatrix.identity();
 	this->specularMaterialProperties = new SpecularMaterialProperties();
@@ -36,5 +39,6 @@ Material::~Material() {
 	if (this->specularMaterialProperties != nullptr) delete this->specularMaterialProperties;
 }
 
+volatile uint64_t Material::uniqueIdxCounter = 0LL;
 string Material::defaultMaterialId = "tdme.default_material";
 Material* Material::defaultMaterial = new Material(Material::defaultMaterialId);
@@ -22,6 +22,7 @@ class tdme::engine::model::Material final
 private:
 	static string defaultMaterialId;
 	static Material* defaultMaterial;
+	static volatile uint64_t uniqueIdxCounter;
 
 public:
 
@@ -33,6 +34,7 @@ public:
 	}
 
 private:
+	uint32_t uniqueIdx;
 	string id;
 	SpecularMaterialProperties* specularMaterialProperties { nullptr };
 	PBRMaterialProperties* pbrMaterialProperties { nullptr };
@@ -47,6 +49,13 @@ public:
 		return id;
 	}
 
+	/**
+	 * @return unique material index, which can be used for sorting and state change detection instead of material id
+	 */
+	inline uint32_t getUniqueIdx() const {
+		return uniqueIdx;
+	}
+
 	/**
 	 * @return specular material properties
 	 */
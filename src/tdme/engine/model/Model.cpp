@@ -14,6 +14,7 @@
 #include <tdme/engine/primitives/BoundingBox.h>
 #include <tdme/engine/subsystems/rendering/Object3DModelInternal.h>
 #include <tdme/math/Matrix4x4.h>
+#include <tdme/os/threading/AtomicOperations.h>
 
 using std::map;
 using std::string;
@@ -30,13 +31,17 @@ using tdme::engine::model::RotationOrder;
 using tdme::engine::primitives::BoundingBox;
 using tdme::engine::subsystems::rendering::Object3DModelInternal;
 using tdme::math::Matrix4x4;
+using tdme::os::threading::AtomicOperations;
 
 string Model::ANIMATIONSETUP_DEFAULT = "tdme.default";
 
 constexpr float Model::FPS_DEFAULT;
 
+volatile uint64_t Model::uniqueIdxCounter = 0LL;
+
 Model::Model(const string& id, const string& name, UpVector* upVector, RotationOrder* rotationOrder, BoundingBox* boundingBox, AuthoringTool authoringTool)
 {
+	this->uniqueIdx = AtomicOperations::add(uniqueIdxCounter);
 	this->id = id;
 	this->name = name;
 	this->upVector = upVector;
@@ -38,7 +38,10 @@ public:
 	static constexpr float FPS_DEFAULT { 30.0f };
 
 private:
+	static volatile uint64_t uniqueIdxCounter;
+
 	AuthoringTool authoringTool;
+	uint32_t uniqueIdx;
 	string id;
 	string name;
 	UpVector* upVector;
@@ -93,6 +96,13 @@ public:
 		return id;
 	}
 
+	/**
+	 * @return unique model index, which can be used for sorting instead of model id
+	 */
+	inline uint32_t getUniqueIdx() {
+		return uniqueIdx;
+	}
+
 	/** 
 	 * @return model name
 	 */
@@ -1,8 +1,12 @@
 #include <tdme/engine/model/ModelHelper.h>
 
+#include <algorithm>
 #include <array>
+#include <cmath>
 #include <map>
 #include <string>
+#include <unordered_map>
+#include <utility>
 #include <vector>
 
 #include <tdme/engine/Transformations.h>
@@ -16,22 +20,32 @@
 #include <tdme/engine/model/Material.h>
 #include <tdme/engine/model/Model.h>
 #include <tdme/engine/model/ModelHelper_VertexOrder.h>
+#include <tdme/engine/model/ModelSimplificationStatistics.h>
 #include <tdme/engine/model/Skinning.h>
 #include <tdme/engine/model/SpecularMaterialProperties.h>
 #include <tdme/engine/model/TextureCoordinate.h>
 #include <tdme/engine/model/UpVector.h>
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/math/Vector2.h>
+#include <tdme/math/Math.h>
 #include <tdme/math/Vector3.h>
+#include <tdme/os/threading/AtomicOperations.h>
+#include <tdme/os/threading/Thread.h>
 #include <tdme/tools/shared/files/ProgressCallback.h>
 #include <tdme/tools/shared/model/LevelEditorObject.h>
 #include <tdme/utils/Console.h>
 #include <tdme/utils/StringUtils.h>
 
 using std::array;
+using std::binary_search;
+using std::find;
+using std::make_pair;
 using std::map;
+using std::pair;
+using std::sort;
 using std::string;
 using std::to_string;
+using std::unordered_map;
 using std::vector;
 
 using tdme::engine::Transformations;
@@ -52,7 +66,10 @@ using tdme::engine::model::TextureCoordinate;
 using tdme::engine::model::UpVector;
 using tdme::math::Matrix4x4;
 using tdme::math::Vector2;
+using tdme::math::Math;
 using tdme::math::Vector3;
+using tdme::os::threading::AtomicOperations;
+using tdme::os::threading::Thread;
 using tdme::tools::shared::files::ProgressCallback;
 using tdme::tools::shared::model::LevelEditorObject;
 using tdme::utils::Console;
@@ -74,91 +91,155 @@ ModelHelper_VertexOrder* ModelHelper::determineVertexOrder(const vector<Vector3>
 	}
 }
 
-void ModelHelper::prepareForIndexedRendering(Model* model)
+ModelHelper::PrepareForIndexedRenderingThread::PrepareForIndexedRenderingThread(const vector<Group*>* groups, volatile uint64_t* groupIdx, float epsilon):
+	Thread("modelhelper-prepareforindexedrendering-thread"),
+	groups(groups),
+	groupIdx(groupIdx),
+	epsilon(epsilon) {
+}
+
+void ModelHelper::PrepareForIndexedRenderingThread::run() {
+	uint64_t i;
+	while ((i = AtomicOperations::add(*groupIdx) - 1) < groups->size()) {
+		ModelHelper::prepareForIndexedRendering((*groups)[i], epsilon);
+	}
+}
+
+void ModelHelper::prepareForIndexedRendering(Model* model, float epsilon)
 {
-	prepareForIndexedRendering(model->getSubGroups());
+	vector<Group*> groups;
+	collectGroups(model->getSubGroups(), groups);
+
+	// groups are independent, so prepare them in parallel if worth it
+	auto faceCount = 0;
+	for (auto group: groups) faceCount+= group->getFaceCount();
+	auto threadCount = Math::min(static_cast<int>(groups.size()), Thread::getHardwareThreadCount());
+	if (threadCount < 2 || faceCount < 10000) {
+		for (auto group: groups) prepareForIndexedRendering(group, epsilon);
+		return;
+	}
+	volatile uint64_t groupIdx = 0LL;
+	vector<PrepareForIndexedRenderingThread*> threads;
+	for (auto i = 0; i < threadCount; i++) {
+		auto thread = new PrepareForIndexedRenderingThread(&groups, &groupIdx, epsilon);
+		thread->start();
+		threads.push_back(thread);
+	}
+	for (auto thread: threads) {
+		thread->join();
+		delete thread;
+	}
 }
 
-void ModelHelper::prepareForIndexedRendering(const map<string, Group*>& groups)
+void ModelHelper::collectGroups(const map<string, Group*>& groups, vector<Group*>& collectedGroups)
 {
-	// we need to prepare the group for indexed rendering
 	for (auto it: groups) {
-		Group* group = it.second;
-		auto& groupVertices = group->getVertices();
-		auto& groupNormals = group->getNormals();
-		auto& groupTextureCoordinates = group->getTextureCoordinates();
-		auto& groupTangents = group->getTangents();
-		auto& groupBitangents = group->getBitangents();
-		vector<int32_t> vertexMapping;
-		vector<Vector3> indexedVertices;
-		vector<Vector3> indexedNormals;
-		vector<TextureCoordinate> indexedTextureCoordinates;
-		vector<Vector3> indexedTangents;
-		vector<Vector3> indexedBitangents;
-		// construct indexed vertex data suitable for GL
-		auto preparedIndices = 0;
-		auto newFacesEntities = group->getFacesEntities();
-		for (auto& newFacesEntity: newFacesEntities) {
-			auto newFaces = newFacesEntity.getFaces();
-			for (auto& face: newFaces) {
-				auto faceVertexIndices = face.getVertexIndices();
-				auto faceNormalIndices = face.getNormalIndices();
-				auto faceTextureIndices = face.getTextureCoordinateIndices();
-				auto faceTangentIndices = face.getTangentIndices();
-				auto faceBitangentIndices = face.getBitangentIndices();
-				array<int32_t, 3> indexedFaceVertexIndices;
-				for (int16_t idx = 0; idx < 3; idx++) {
-					auto groupVertexIndex = faceVertexIndices[idx];
-					auto groupNormalIndex = faceNormalIndices[idx];
-					auto groupTextureCoordinateIndex = faceTextureIndices[idx];
-					auto groupTangentIndex = faceTangentIndices[idx];
-					auto groupBitangentIndex = faceBitangentIndices[idx];
-					auto vertex = &groupVertices[groupVertexIndex];
-					auto normal = &groupNormals[groupNormalIndex];
-					auto textureCoordinate = groupTextureCoordinates.size() > 0 ? &groupTextureCoordinates[groupTextureCoordinateIndex] : static_cast< TextureCoordinate* >(nullptr);
-					auto tangent = groupTangents.size() > 0 ? &groupTangents[groupTangentIndex] : static_cast< Vector3* >(nullptr);
-					auto bitangent = groupBitangents.size() > 0 ? &groupBitangents[groupBitangentIndex] : static_cast< Vector3* >(nullptr);
-					auto newIndex = preparedIndices;
-					for (auto i = 0; i < preparedIndices; i++)
-					if (indexedVertices[i].equals(*vertex) &&
-						indexedNormals[i].equals(*normal) &&
-					    (textureCoordinate == nullptr || indexedTextureCoordinates[i].equals(*textureCoordinate)) &&
-					    (tangent == nullptr || indexedTangents[i].equals(*tangent)) &&
-						(bitangent == nullptr || indexedBitangents[i].equals(*bitangent))) {
-						newIndex = i;
-						break;
-					}
-					if (newIndex == preparedIndices) {
-						vertexMapping.push_back(groupVertexIndex);
-						indexedVertices.push_back(*vertex);;
-						indexedNormals.push_back(*normal);;
-						if (textureCoordinate != nullptr) indexedTextureCoordinates.push_back(*textureCoordinate);
-						if (tangent != nullptr) indexedTangents.push_back(*tangent);
-						if (bitangent != nullptr) indexedBitangents.push_back(*bitangent);
-						preparedIndices++;
+		collectedGroups.push_back(it.second);
+		collectGroups(it.second->getSubGroups(), collectedGroups);
+	}
+}
+
+void ModelHelper::prepareForIndexedRendering(Group* group, float epsilon)
+{
+	auto& groupVertices = group->getVertices();
+	auto& groupNormals = group->getNormals();
+	auto& groupTextureCoordinates = group->getTextureCoordinates();
+	auto& groupTangents = group->getTangents();
+	auto& groupBitangents = group->getBitangents();
+	vector<int32_t> vertexMapping;
+	vector<Vector3> indexedVertices;
+	vector<Vector3> indexedNormals;
+	vector<TextureCoordinate> indexedTextureCoordinates;
+	vector<Vector3> indexedTangents;
+	vector<Vector3> indexedBitangents;
+	// indexed vertices are hashed by grid cell of their position, so we only need to compare with vertices of the same or adjacent cells,
+	// cells store indices in ascending order, so we find the same first matching vertex as a linear search would do
+	// epsilon needs to be positive as it gives the cell size, so it is clamped to Math::EPSILON
+	epsilon = Math::max(epsilon, Math::EPSILON);
+	auto cellSize = static_cast<double>(epsilon) * 256.0;
+	unordered_map<uint64_t, vector<int32_t>> vertexCells;
+	array<int64_t, 3> cell;
+	array<int64_t, 3> cellMin;
+	array<int64_t, 3> cellMax;
+	// construct indexed vertex data suitable for GL
+	auto preparedIndices = 0;
+	auto newFacesEntities = group->getFacesEntities();
+	for (auto& newFacesEntity: newFacesEntities) {
+		auto newFaces = newFacesEntity.getFaces();
+		for (auto& face: newFaces) {
+			auto& faceVertexIndices = face.getVertexIndices();
+			auto& faceNormalIndices = face.getNormalIndices();
+			auto& faceTextureIndices = face.getTextureCoordinateIndices();
+			auto& faceTangentIndices = face.getTangentIndices();
+			auto& faceBitangentIndices = face.getBitangentIndices();
+			array<int32_t, 3> indexedFaceVertexIndices;
+			for (int16_t idx = 0; idx < 3; idx++) {
+				auto groupVertexIndex = faceVertexIndices[idx];
+				auto groupNormalIndex = faceNormalIndices[idx];
+				auto groupTextureCoordinateIndex = faceTextureIndices[idx];
+				auto groupTangentIndex = faceTangentIndices[idx];
+				auto groupBitangentIndex = faceBitangentIndices[idx];
+				auto vertex = &groupVertices[groupVertexIndex];
+				auto normal = &groupNormals[groupNormalIndex];
+				auto textureCoordinate = groupTextureCoordinates.size() > 0 ? &groupTextureCoordinates[groupTextureCoordinateIndex] : static_cast< TextureCoordinate* >(nullptr);
+				auto tangent = groupTangents.size() > 0 ? &groupTangents[groupTangentIndex] : static_cast< Vector3* >(nullptr);
+				auto bitangent = groupBitangents.size() > 0 ? &groupBitangents[groupBitangentIndex] : static_cast< Vector3* >(nullptr);
+				// determine cell and adjacent cells within epsilon
+				auto& vertexXYZ = vertex->getArray();
+				for (auto i = 0; i < 3; i++) {
+					auto cellPosition = static_cast<double>(vertexXYZ[i]) / cellSize;
+					cell[i] = static_cast<int64_t>(floor(cellPosition));
+					cellMin[i] = (cellPosition - static_cast<double>(cell[i])) * cellSize < epsilon?cell[i] - 1:cell[i];
+					cellMax[i] = (static_cast<double>(cell[i] + 1) - cellPosition) * cellSize < epsilon?cell[i] + 1:cell[i];
+				}
+				// find first matching indexed vertex
+				auto newIndex = preparedIndices;
+				for (auto x = cellMin[0]; x <= cellMax[0]; x++)
+				for (auto y = cellMin[1]; y <= cellMax[1]; y++)
+				for (auto z = cellMin[2]; z <= cellMax[2]; z++) {
+					auto vertexCellIt = vertexCells.find(computeVertexCellHash(x, y, z));
+					if (vertexCellIt == vertexCells.end()) continue;
+					for (auto i: vertexCellIt->second) {
+						if (i >= newIndex) break;
+						if (indexedVertices[i].equals(*vertex, epsilon) &&
+							indexedNormals[i].equals(*normal, epsilon) &&
+							(textureCoordinate == nullptr || indexedTextureCoordinates[i].equals(*textureCoordinate, epsilon)) &&
+							(tangent == nullptr || indexedTangents[i].equals(*tangent, epsilon)) &&
+							(bitangent == nullptr || indexedBitangents[i].equals(*bitangent, epsilon))) {
+							newIndex = i;
+							break;
+						}
 					}
-					indexedFaceVertexIndices[idx] = newIndex;
 				}
-				face.setIndexedRenderingIndices(indexedFaceVertexIndices);
+				if (newIndex == preparedIndices) {
+					vertexMapping.push_back(groupVertexIndex);
+					indexedVertices.push_back(*vertex);
+					indexedNormals.push_back(*normal);
+					if (textureCoordinate != nullptr) indexedTextureCoordinates.push_back(*textureCoordinate);
+					if (tangent != nullptr) indexedTangents.push_back(*tangent);
+					if (bitangent != nullptr) indexedBitangents.push_back(*bitangent);
+					vertexCells[computeVertexCellHash(cell[0], cell[1], cell[2])].push_back(newIndex);
+					preparedIndices++;
+				}
+				indexedFaceVertexIndices[idx] = newIndex;
 			}
-			newFacesEntity.setFaces(newFaces);
-		}
-		group->setFacesEntities(newFacesEntities);
-		// remap skinning
-		auto skinning = group->getSkinning();
-		if (skinning != nullptr) {
-			prepareForIndexedRendering(skinning, vertexMapping, preparedIndices);
-		}
-		group->setVertices(indexedVertices);
-		group->setNormals(indexedNormals);
-		if (groupTextureCoordinates.size() > 0) {
-			group->setTextureCoordinates(indexedTextureCoordinates);
+			face.setIndexedRenderingIndices(indexedFaceVertexIndices);
 		}
-		group->setTangents(indexedTangents);
-		group->setBitangents(indexedBitangents);
-		// process sub groups
-		prepareForIndexedRendering(group->getSubGroups());
+		newFacesEntity.setFaces(newFaces);
 	}
+	group->setFacesEntities(newFacesEntities);
+	// remap skinning
+	auto skinning = group->getSkinning();
+	if (skinning != nullptr) {
+		prepareForIndexedRendering(skinning, vertexMapping, preparedIndices);
+	}
+	group->setVertices(indexedVertices);
+	group->setNormals(indexedNormals);
+	if (groupTextureCoordinates.size() > 0) {
+		group->setTextureCoordinates(indexedTextureCoordinates);
+	}
+	group->setTangents(indexedTangents);
+	group->setBitangents(indexedBitangents);
 }
 
 void ModelHelper::prepareForIndexedRendering(Skinning* skinning, const vector<int32_t>& vertexMapping, int32_t vertices)
@@ -274,8 +355,8 @@ void ModelHelper::createDefaultAnimation(Model* model, int32_t frames)
 	}
 }
 
-Material* ModelHelper::cloneMaterial(const Material* material) {
-	auto clonedMaterial = new Material(material->getId());
+Material* ModelHelper::cloneMaterial(const Material* material, const string& id) {
+	auto clonedMaterial = new Material(id.empty() == true?material->getId():id);
 	auto specularMaterialProperties = material->getSpecularMaterialProperties();
 	if (specularMaterialProperties != nullptr) {
 		auto clonedSpecularMaterialProperties = new SpecularMaterialProperties();
@@ -293,18 +374,28 @@ Material* ModelHelper::cloneMaterial(const Material* material) {
 				specularMaterialProperties->getDiffuseTransparencyTexturePathName(),
 				specularMaterialProperties->getDiffuseTransparencyTextureFileName()
 			);
+		} else
+		if (specularMaterialProperties->getDiffuseTexture() != nullptr) {
+			// textures created in memory have no file
+			clonedSpecularMaterialProperties->setDiffuseTexture(specularMaterialProperties->getDiffuseTexture());
 		}
 		if (specularMaterialProperties->getNormalTextureFileName().length() != 0) {
 			clonedSpecularMaterialProperties->setNormalTexture(
 				specularMaterialProperties->getNormalTexturePathName(),
 				specularMaterialProperties->getNormalTextureFileName()
 			);
+		} else
+		if (specularMaterialProperties->getNormalTexture() != nullptr) {
+			clonedSpecularMaterialProperties->setNormalTexture(specularMaterialProperties->getNormalTexture());
 		}
 		if (specularMaterialProperties->getSpecularTextureFileName().length() != 0) {
 			clonedSpecularMaterialProperties->setSpecularTexture(
 				specularMaterialProperties->getSpecularTexturePathName(),
 				specularMaterialProperties->getSpecularTextureFileName()
 			);
+		} else
+		if (specularMaterialProperties->getSpecularTexture() != nullptr) {
+			clonedSpecularMaterialProperties->setSpecularTexture(specularMaterialProperties->getSpecularTexture());
 		}
 		clonedMaterial->setSpecularMaterialProperties(clonedSpecularMaterialProperties);
 	}
@@ -623,70 +714,813 @@ void ModelHelper::shrinkToFit(Model* model) {
 	}
 }
 
-float ModelHelper::computeNormals(Group* group, ProgressCallback* progressCallback, float incrementPerFace, float progress) {
-	group->setNormals(vector<Vector3>());
+ModelHelper::ComputeNormalsThread::ComputeNormalsThread(const vector<Group*>* groups, volatile uint64_t* groupIdx, volatile uint64_t* facesProcessed, bool angleWeighted, float creaseAngle):
+	Thread("modelhelper-computenormals-thread"),
+	groups(groups),
+	groupIdx(groupIdx),
+	facesProcessed(facesProcessed),
+	angleWeighted(angleWeighted),
+	creaseAngle(creaseAngle) {
+}
+
+void ModelHelper::ComputeNormalsThread::run() {
+	uint64_t i;
+	while ((i = AtomicOperations::add(*groupIdx) - 1) < groups->size()) {
+		auto group = (*groups)[i];
+		ModelHelper::computeNormals(group, angleWeighted, creaseAngle);
+		AtomicOperations::add(*facesProcessed, group->getFaceCount());
+	}
+}
+
+int32_t ModelHelper::computeVertexPositionIndices(const vector<Vector3>& vertices, vector<int32_t>& vertexPositionIndices) {
+	// sort vertices by position quantized to epsilon grid, so vertices at the same position become neighbours
+	//	comparing quantized positions is transitive, unlike comparing positions with a tolerance
+	vector<pair<array<int64_t, 3>, int32_t>> sortedVertices;
+	sortedVertices.resize(vertices.size());
+	for (auto i = 0; i < vertices.size(); i++) {
+		auto& vertexXYZ = vertices[i].getArray();
+		auto& sortedVertex = sortedVertices[i];
+		for (auto j = 0; j < 3; j++) sortedVertex.first[j] = static_cast<int64_t>(floor(static_cast<double>(vertexXYZ[j]) / static_cast<double>(Math::EPSILON) + 0.5));
+		sortedVertex.second = i;
+	}
+	sort(sortedVertices.begin(), sortedVertices.end());
+	vertexPositionIndices.resize(vertices.size());
+	auto positionCount = 0;
+	for (auto i = 0; i < sortedVertices.size(); i++) {
+		if (i > 0 && sortedVertices[i].first != sortedVertices[i - 1].first) positionCount++;
+		vertexPositionIndices[sortedVertices[i].second] = positionCount;
+	}
+	if (sortedVertices.empty() == false) positionCount++;
+	return positionCount;
+}
+
+void ModelHelper::computeNormals(Group* group, bool angleWeighted, float creaseAngle) {
+	auto& groupVertices = group->getVertices();
+
+	// vertices at the same position share a position index
+	vector<int32_t> vertexPositionIndices;
+	auto positionCount = computeVertexPositionIndices(groupVertices, vertexPositionIndices);
+
+	// compute face normals and face corner weights
+	auto faceCount = group->getFaceCount();
+	vector<Vector3> faceNormals;
+	vector<float> faceCornerWeights;
+	vector<int32_t> faceCornerPositionIndices;
+	faceNormals.resize(faceCount);
+	faceCornerWeights.resize(faceCount * 3);
+	faceCornerPositionIndices.resize(faceCount * 3);
 	array<Vector3, 3> vertices;
-	Vector3 normal;
-	auto facesEntityProcessed = 0;
+	Vector3 edge1;
+	Vector3 edge2;
+	auto faceIdx = 0;
+	for (auto& facesEntity: group->getFacesEntities()) {
+		for (auto& face: facesEntity.getFaces()) {
+			for (auto i = 0; i < vertices.size(); i++) {
+				vertices[i] = groupVertices[face.getVertexIndices()[i]];
+				faceCornerPositionIndices[faceIdx * 3 + i] = vertexPositionIndices[face.getVertexIndices()[i]];
+			}
+			computeNormal(vertices, faceNormals[faceIdx]);
+			for (auto i = 0; i < vertices.size(); i++) {
+				if (angleWeighted == true) {
+					edge1.set(vertices[(i + 1) % 3]).sub(vertices[i]);
+					edge2.set(vertices[(i + 2) % 3]).sub(vertices[i]);
+					faceCornerWeights[faceIdx * 3 + i] =
+						edge1.computeLengthSquared() < Math::EPSILON * Math::EPSILON || edge2.computeLengthSquared() < Math::EPSILON * Math::EPSILON?
+							0.0f:
+							Vector3::computeAngle(edge1.normalize(), edge2.normalize());
+				} else {
+					faceCornerWeights[faceIdx * 3 + i] = 1.0f;
+				}
+			}
+			faceIdx++;
+		}
+	}
+
+	// collect face corners by position
+	vector<int32_t> positionFaceCornersOffsets;
+	vector<int32_t> positionFaceCorners;
+	positionFaceCornersOffsets.resize(positionCount + 1, 0);
+	for (auto positionIdx: faceCornerPositionIndices) positionFaceCornersOffsets[positionIdx + 1]++;
+	for (auto i = 0; i < positionCount; i++) positionFaceCornersOffsets[i + 1]+= positionFaceCornersOffsets[i];
+	positionFaceCorners.resize(faceCornerPositionIndices.size());
+	{
+		auto positionFaceCornersIdx = positionFaceCornersOffsets;
+		for (auto i = 0; i < faceCornerPositionIndices.size(); i++) {
+			positionFaceCorners[positionFaceCornersIdx[faceCornerPositionIndices[i]]++] = i;
+		}
+	}
+
+	// compute smooth normals per face corner, faces exceeding crease angle to the current face are not taken into account
+	auto creaseAngleCos = Math::cos(Math::clamp(creaseAngle, 0.0f, 180.0f) * Math::DEG2RAD) - Math::EPSILON;
 	vector<Vector3> normals;
+	normals.resize(faceCount * 3);
+	Vector3 normal;
+	faceIdx = 0;
 	auto facesEntities = group->getFacesEntities();
 	for (auto& facesEntity: facesEntities) {
 		auto faces = facesEntity.getFaces();
 		for (auto& face: faces) {
-			for (auto i = 0; i < vertices.size(); i++) {
-				vertices[i] = group->getVertices()[face.getVertexIndices()[i]];
-			}
-			computeNormal(vertices, normal);
-			face.setNormalIndices(normals.size(), normals.size() + 1, normals.size() + 2);
-			normals.push_back(normal);
-			normals.push_back(normal);
-			normals.push_back(normal);
-			if (progressCallback != nullptr) {
-				progress+= incrementPerFace / 2.0f;
-				if (facesEntityProcessed == 0 || facesEntityProcessed % 1000 == 0) progressCallback->progress(progress);
-				facesEntityProcessed++;
+			auto& faceNormal = faceNormals[faceIdx];
+			for (auto i = 0; i < 3; i++) {
+				auto positionIdx = faceCornerPositionIndices[faceIdx * 3 + i];
+				normal.set(0.0f, 0.0f, 0.0f);
+				for (auto j = positionFaceCornersOffsets[positionIdx]; j < positionFaceCornersOffsets[positionIdx + 1]; j++) {
+					auto faceCornerIdx = positionFaceCorners[j];
+					auto& otherFaceNormal = faceNormals[faceCornerIdx / 3];
+					if (Vector3::computeDotProduct(faceNormal, otherFaceNormal) < creaseAngleCos) continue;
+					normal.add(otherFaceNormal.clone().scale(faceCornerWeights[faceCornerIdx]));
+				}
+				if (normal.computeLengthSquared() < Math::EPSILON * Math::EPSILON) {
+					normals[faceIdx * 3 + i].set(faceNormal);
+				} else {
+					normals[faceIdx * 3 + i].set(normal.normalize());
+				}
 			}
+			face.setNormalIndices(faceIdx * 3 + 0, faceIdx * 3 + 1, faceIdx * 3 + 2);
+			faceIdx++;
 		}
 		facesEntity.setFaces(faces);
 	}
 	group->setFacesEntities(facesEntities);
-	facesEntityProcessed = 0;
-	for (auto& facesEntity: group->getFacesEntities()) {
-		for (auto& face: facesEntity.getFaces()) {
-			for (auto i = 0; i < vertices.size(); i++) {
-				if (interpolateNormal(group, group->getVertices()[face.getVertexIndices()[i]], normals, normal) == true) {
-					normals[face.getNormalIndices()[i]].set(normal);
+	group->setNormals(normals);
+}
+
+void ModelHelper::computeNormals(Model* model, ProgressCallback* progressCallback, bool angleWeighted, float creaseAngle) {
+	vector<Group*> groups;
+	collectGroups(model->getSubGroups(), groups);
+	auto faceCount = 0;
+	for (auto groupIt: model->getSubGroups()) {
+		faceCount+= determineFaceCount(groupIt.second);
+	}
+
+	// groups are independent, so compute them in parallel if worth it
+	auto threadCount = Math::min(static_cast<int>(groups.size()), Thread::getHardwareThreadCount());
+	if (threadCount < 2 || faceCount < 10000) {
+		auto facesProcessed = 0;
+		for (auto group: groups) {
+			computeNormals(group, angleWeighted, creaseAngle);
+			facesProcessed+= group->getFaceCount();
+			if (progressCallback != nullptr) progressCallback->progress(static_cast<float>(facesProcessed) / static_cast<float>(faceCount) * 0.5f);
+		}
+	} else {
+		volatile uint64_t groupIdx = 0LL;
+		volatile uint64_t facesProcessed = 0LL;
+		vector<ComputeNormalsThread*> threads;
+		for (auto i = 0; i < threadCount; i++) {
+			auto thread = new ComputeNormalsThread(&groups, &groupIdx, &facesProcessed, angleWeighted, creaseAngle);
+			thread->start();
+			threads.push_back(thread);
+		}
+		// report progress from this thread, as progress callbacks are not thread safe
+		while (AtomicOperations::load(facesProcessed) < faceCount) {
+			if (progressCallback != nullptr) progressCallback->progress(static_cast<float>(AtomicOperations::load(facesProcessed)) / static_cast<float>(faceCount) * 0.5f);
+			Thread::sleep(50);
+		}
+		for (auto thread: threads) {
+			thread->join();
+			delete thread;
+		}
+	}
+	if (progressCallback != nullptr) progressCallback->progress(0.5f);
+	prepareForIndexedRendering(model);
+	if (progressCallback != nullptr) {
+		progressCallback->progress(1.0f);
+		delete progressCallback;
+	}
+}
+
+void ModelHelper::optimizeVertexCache(vector<Face>& faces) {
+	auto faceCount = static_cast<int32_t>(faces.size());
+	if (faceCount == 0) return;
+	auto vertexCount = 0;
+	for (auto& face: faces) {
+		for (auto vertexIdx: face.getVertexIndices()) vertexCount = Math::max(vertexCount, vertexIdx + 1);
+	}
+
+	// faces that use a vertex and are not emitted yet
+	vector<int32_t> vertexActiveFaceCounts;
+	vector<int32_t> vertexFacesOffsets;
+	vector<int32_t> vertexFaces;
+	vertexActiveFaceCounts.resize(vertexCount, 0);
+	vertexFacesOffsets.resize(vertexCount + 1, 0);
+	vertexFaces.resize(faceCount * 3);
+	for (auto& face: faces) {
+		for (auto vertexIdx: face.getVertexIndices()) vertexActiveFaceCounts[vertexIdx]++;
+	}
+	for (auto i = 0; i < vertexCount; i++) vertexFacesOffsets[i + 1] = vertexFacesOffsets[i] + vertexActiveFaceCounts[i];
+	{
+		auto vertexFacesIdx = vertexFacesOffsets;
+		for (auto i = 0; i < faceCount; i++) {
+			for (auto vertexIdx: faces[i].getVertexIndices()) vertexFaces[vertexFacesIdx[vertexIdx]++] = i;
+		}
+	}
+
+	// initial scores
+	vector<int32_t> vertexCachePositions;
+	vector<float> vertexScores;
+	vector<float> faceScores;
+	vector<bool> facesEmitted;
+	vertexCachePositions.resize(vertexCount, -1);
+	vertexScores.resize(vertexCount);
+	faceScores.resize(faceCount);
+	facesEmitted.resize(faceCount, false);
+	for (auto i = 0; i < vertexCount; i++) vertexScores[i] = computeVertexCacheScore(-1, vertexActiveFaceCounts[i]);
+	for (auto i = 0; i < faceCount; i++) {
+		auto& faceVertexIndices = faces[i].getVertexIndices();
+		faceScores[i] = vertexScores[faceVertexIndices[0]] + vertexScores[faceVertexIndices[1]] + vertexScores[faceVertexIndices[2]];
+	}
+
+	// emit faces with best score, only faces using vertices in cache get rescored
+	vector<Face> optimizedFaces;
+	vector<int32_t> cache;
+	vector<int32_t> newCache;
+	optimizedFaces.reserve(faceCount);
+	cache.reserve(VERTEXCACHE_LRU_SIZE + 3);
+	newCache.reserve(VERTEXCACHE_LRU_SIZE + 3);
+	auto bestFaceIdx = -1;
+	auto nextFaceIdx = 0;
+	while (optimizedFaces.size() < faceCount) {
+		if (bestFaceIdx == -1) {
+			// dead end, continue with next remaining face in input order
+			while (facesEmitted[nextFaceIdx] == true) nextFaceIdx++;
+			bestFaceIdx = nextFaceIdx;
+		}
+		auto& face = faces[bestFaceIdx];
+		auto& faceVertexIndices = face.getVertexIndices();
+		optimizedFaces.push_back(face);
+		facesEmitted[bestFaceIdx] = true;
+		for (auto vertexIdx: faceVertexIndices) {
+			auto vertexFacesBegin = vertexFacesOffsets[vertexIdx];
+			auto vertexFacesEnd = vertexFacesBegin + vertexActiveFaceCounts[vertexIdx];
+			for (auto i = vertexFacesBegin; i < vertexFacesEnd; i++) {
+				if (vertexFaces[i] != bestFaceIdx) continue;
+				vertexFaces[i] = vertexFaces[vertexFacesEnd - 1];
+				vertexActiveFaceCounts[vertexIdx]--;
+				break;
+			}
+		}
+
+		// face vertices move to front of LRU cache
+		newCache.clear();
+		for (auto vertexIdx: faceVertexIndices) {
+			if (find(newCache.begin(), newCache.end(), vertexIdx) == newCache.end()) newCache.push_back(vertexIdx);
+		}
+		for (auto vertexIdx: cache) {
+			if (vertexIdx != faceVertexIndices[0] && vertexIdx != faceVertexIndices[1] && vertexIdx != faceVertexIndices[2]) newCache.push_back(vertexIdx);
+		}
+		cache.swap(newCache);
+		for (auto i = 0; i < cache.size(); i++) {
+			auto vertexIdx = cache[i];
+			vertexCachePositions[vertexIdx] = i < VERTEXCACHE_LRU_SIZE?i:-1;
+			vertexScores[vertexIdx] = computeVertexCacheScore(vertexCachePositions[vertexIdx], vertexActiveFaceCounts[vertexIdx]);
+		}
+
+		// rescore faces of affected vertices and pick best one
+		bestFaceIdx = -1;
+		auto bestFaceScore = -1.0f;
+		for (auto vertexIdx: cache) {
+			auto vertexFacesBegin = vertexFacesOffsets[vertexIdx];
+			auto vertexFacesEnd = vertexFacesBegin + vertexActiveFaceCounts[vertexIdx];
+			for (auto i = vertexFacesBegin; i < vertexFacesEnd; i++) {
+				auto faceIdx = vertexFaces[i];
+				auto& otherFaceVertexIndices = faces[faceIdx].getVertexIndices();
+				auto faceScore = vertexScores[otherFaceVertexIndices[0]] + vertexScores[otherFaceVertexIndices[1]] + vertexScores[otherFaceVertexIndices[2]];
+				faceScores[faceIdx] = faceScore;
+				if (faceScore > bestFaceScore) {
+					bestFaceIdx = faceIdx;
+					bestFaceScore = faceScore;
 				}
 			}
-			if (progressCallback != nullptr) {
-				progress+= incrementPerFace / 2.0f;
-				if (facesEntityProcessed == 0 || facesEntityProcessed % 1000 == 0) progressCallback->progress(progress);
-				facesEntityProcessed++;
+		}
+		if (cache.size() > VERTEXCACHE_LRU_SIZE) cache.resize(VERTEXCACHE_LRU_SIZE);
+	}
+	faces = optimizedFaces;
+}
+
+void ModelHelper::optimizeOverdraw(const vector<Vector3>& vertices, vector<Face>& faces, float threshold) {
+	auto faceCount = static_cast<int32_t>(faces.size());
+	if (faceCount < 2) return;
+	vector<int64_t> vertexTimestamps;
+	vertexTimestamps.resize(vertices.size(), 0LL);
+	int64_t timestamp = VERTEXCACHE_FIFO_SIZE + 1;
+
+	// hard cluster boundaries are faces that miss the cache completely
+	vector<int32_t> hardBoundaries;
+	for (auto i = 0; i < faceCount; i++) {
+		if (updateVertexCache(faces[i], vertexTimestamps, timestamp, VERTEXCACHE_FIFO_SIZE) == 3) hardBoundaries.push_back(i);
+	}
+	hardBoundaries.push_back(faceCount);
+
+	// split hard clusters further as soon as cache miss ratio of a new cluster gets near to the one of its hard cluster
+	vector<int32_t> clusters;
+	for (auto i = 0; i < hardBoundaries.size() - 1; i++) {
+		auto hardClusterBegin = hardBoundaries[i];
+		auto hardClusterEnd = hardBoundaries[i + 1];
+		auto cacheMisses = 0;
+		timestamp+= VERTEXCACHE_FIFO_SIZE + 1;
+		for (auto j = hardClusterBegin; j < hardClusterEnd; j++) cacheMisses+= updateVertexCache(faces[j], vertexTimestamps, timestamp, VERTEXCACHE_FIFO_SIZE);
+		auto clusterThreshold = threshold * static_cast<float>(cacheMisses) / static_cast<float>(hardClusterEnd - hardClusterBegin);
+		auto clusterBegin = hardClusterBegin;
+		cacheMisses = 0;
+		timestamp+= VERTEXCACHE_FIFO_SIZE + 1;
+		clusters.push_back(clusterBegin);
+		for (auto j = hardClusterBegin; j < hardClusterEnd - 1; j++) {
+			cacheMisses+= updateVertexCache(faces[j], vertexTimestamps, timestamp, VERTEXCACHE_FIFO_SIZE);
+			if (static_cast<float>(cacheMisses) / static_cast<float>(j - clusterBegin + 1) <= clusterThreshold) {
+				clusterBegin = j + 1;
+				cacheMisses = 0;
+				timestamp+= VERTEXCACHE_FIFO_SIZE + 1;
+				clusters.push_back(clusterBegin);
 			}
 		}
 	}
+	clusters.push_back(faceCount);
+	if (clusters.size() < 3) return;
+
+	// compute area weighted cluster centroids and normals
+	Vector3 meshCentroid;
+	vector<Vector3> clusterCentroids;
+	vector<Vector3> clusterNormals;
+	clusterCentroids.resize(clusters.size() - 1);
+	clusterNormals.resize(clusters.size() - 1);
+	Vector3 edge1;
+	Vector3 edge2;
+	Vector3 faceNormal;
+	Vector3 faceCentroid;
+	auto meshArea = 0.0f;
+	for (auto i = 0; i < clusters.size() - 1; i++) {
+		auto clusterArea = 0.0f;
+		for (auto j = clusters[i]; j < clusters[i + 1]; j++) {
+			auto& faceVertexIndices = faces[j].getVertexIndices();
+			auto& vertex0 = vertices[faceVertexIndices[0]];
+			auto& vertex1 = vertices[faceVertexIndices[1]];
+			auto& vertex2 = vertices[faceVertexIndices[2]];
+			Vector3::computeCrossProduct(edge1.set(vertex1).sub(vertex0), edge2.set(vertex2).sub(vertex0), faceNormal);
+			auto faceArea = faceNormal.computeLength();
+			faceCentroid.set(vertex0).add(vertex1).add(vertex2).scale(faceArea / 3.0f);
+			clusterCentroids[i].add(faceCentroid);
+			clusterNormals[i].add(faceNormal);
+			meshCentroid.add(faceCentroid);
+			clusterArea+= faceArea;
+		}
+		if (clusterArea > Math::EPSILON) clusterCentroids[i].scale(1.0f / clusterArea);
+		if (clusterNormals[i].computeLengthSquared() > Math::EPSILON * Math::EPSILON) clusterNormals[i].normalize();
+		meshArea+= clusterArea;
+	}
+	if (meshArea > Math::EPSILON) meshCentroid.scale(1.0f / meshArea);
+
+	// render clusters that face away from mesh centroid first, as they are likely to occlude other clusters
+	vector<pair<float, int32_t>> clusterSortKeys;
+	clusterSortKeys.resize(clusters.size() - 1);
+	for (auto i = 0; i < clusters.size() - 1; i++) {
+		clusterSortKeys[i] = make_pair(-Vector3::computeDotProduct(clusterCentroids[i].sub(meshCentroid), clusterNormals[i]), i);
+	}
+	sort(clusterSortKeys.begin(), clusterSortKeys.end());
+	vector<Face> optimizedFaces;
+	optimizedFaces.reserve(faceCount);
+	for (auto& clusterSortKey: clusterSortKeys) {
+		auto clusterIdx = clusterSortKey.second;
+		optimizedFaces.insert(optimizedFaces.end(), faces.begin() + clusters[clusterIdx], faces.begin() + clusters[clusterIdx + 1]);
+	}
+	faces = optimizedFaces;
+}
+
+void ModelHelper::optimizeVertexFetch(Group* group) {
+	auto& groupVertices = group->getVertices();
+	auto& groupNormals = group->getNormals();
+	auto& groupTextureCoordinates = group->getTextureCoordinates();
+	auto& groupTangents = group->getTangents();
+	auto& groupBitangents = group->getBitangents();
+	auto& groupOrigins = group->getOrigins();
+	auto vertexCount = static_cast<int32_t>(groupVertices.size());
+
+	// remapping requires a indexed group, which has been prepared for indexed rendering
+	if (isIndexed(group) == false) return;
+
+	// new vertex indices in order of first use
+	vector<int32_t> vertexMapping;
+	vector<int32_t> newVertexIndices;
+	vertexMapping.reserve(vertexCount);
+	newVertexIndices.resize(vertexCount, -1);
+	auto newFacesEntities = group->getFacesEntities();
+	for (auto& newFacesEntity: newFacesEntities) {
+		auto newFaces = newFacesEntity.getFaces();
+		for (auto& face: newFaces) {
+			array<int32_t, 3> indexedFaceVertexIndices;
+			for (auto i = 0; i < 3; i++) {
+				auto vertexIdx = face.getVertexIndices()[i];
+				if (newVertexIndices[vertexIdx] == -1) {
+					newVertexIndices[vertexIdx] = vertexMapping.size();
+					vertexMapping.push_back(vertexIdx);
+				}
+				indexedFaceVertexIndices[i] = newVertexIndices[vertexIdx];
+			}
+			face.setIndexedRenderingIndices(indexedFaceVertexIndices);
+		}
+		newFacesEntity.setFaces(newFaces);
+	}
+
+	// remap vertex data
+	vector<Vector3> vertices;
+	vector<Vector3> normals;
+	vector<TextureCoordinate> textureCoordinates;
+	vector<Vector3> tangents;
+	vector<Vector3> bitangents;
+	vector<Vector3> origins;
+	for (auto vertexIdx: vertexMapping) {
+		vertices.push_back(groupVertices[vertexIdx]);
+		normals.push_back(groupNormals[vertexIdx]);
+		if (groupTextureCoordinates.size() > 0) textureCoordinates.push_back(groupTextureCoordinates[vertexIdx]);
+		if (groupTangents.size() > 0) tangents.push_back(groupTangents[vertexIdx]);
+		if (groupBitangents.size() > 0) bitangents.push_back(groupBitangents[vertexIdx]);
+		if (groupOrigins.size() == vertexCount) origins.push_back(groupOrigins[vertexIdx]);
+	}
+	group->setFacesEntities(newFacesEntities);
+	auto skinning = group->getSkinning();
+	if (skinning != nullptr) {
+		prepareForIndexedRendering(skinning, vertexMapping, vertexMapping.size());
+	}
+	group->setVertices(vertices);
 	group->setNormals(normals);
-	for (auto subGroupIt: group->getSubGroups()) {
-		progress = computeNormals(subGroupIt.second, progressCallback, incrementPerFace, progress);
+	if (groupTextureCoordinates.size() > 0) group->setTextureCoordinates(textureCoordinates);
+	if (groupTangents.size() > 0) group->setTangents(tangents);
+	if (groupBitangents.size() > 0) group->setBitangents(bitangents);
+	if (groupOrigins.size() == vertexCount) group->setOrigins(origins);
+}
+
+bool ModelHelper::isIndexed(Group* group) {
+	auto vertexCount = group->getVertices().size();
+	auto textureCoordinateCount = group->getTextureCoordinates().size();
+	auto tangentCount = group->getTangents().size();
+	auto bitangentCount = group->getBitangents().size();
+	if (group->getNormals().size() != vertexCount ||
+		(textureCoordinateCount > 0 && textureCoordinateCount != vertexCount) ||
+		(tangentCount > 0 && tangentCount != vertexCount) ||
+		(bitangentCount > 0 && bitangentCount != vertexCount)) return false;
+	for (auto& facesEntity: group->getFacesEntities()) {
+		for (auto& face: facesEntity.getFaces()) {
+			auto& faceVertexIndices = face.getVertexIndices();
+			if (face.getNormalIndices() != faceVertexIndices ||
+				(textureCoordinateCount > 0 && face.getTextureCoordinateIndices() != faceVertexIndices) ||
+				(tangentCount > 0 && face.getTangentIndices() != faceVertexIndices) ||
+				(bitangentCount > 0 && face.getBitangentIndices() != faceVertexIndices)) return false;
+		}
 	}
-	return progress;
+	return true;
 }
 
-void ModelHelper::computeNormals(Model* model, ProgressCallback* progressCallback) {
+void ModelHelper::optimizeForRendering(Model* model, ProgressCallback* progressCallback) {
+	vector<Group*> groups;
+	collectGroups(model->getSubGroups(), groups);
 	auto faceCount = 0;
-	for (auto groupIt: model->getSubGroups()) {
-		faceCount+= determineFaceCount(groupIt.second);
-	}
-	for (auto groupIt: model->getSubGroups()) {
-		computeNormals(groupIt.second, progressCallback, 1.0f / static_cast<float>(faceCount), 0.0f);
+	for (auto group: groups) faceCount+= group->getFaceCount();
+	auto facesProcessed = 0;
+	for (auto group: groups) {
+		// faces entities are rendered with separate draw calls, so faces can only be reordered within them
+		auto facesEntities = group->getFacesEntities();
+		for (auto& facesEntity: facesEntities) {
+			auto faces = facesEntity.getFaces();
+			optimizeVertexCache(faces);
+			optimizeOverdraw(group->getVertices(), faces, 1.05f);
+			facesEntity.setFaces(faces);
+			facesProcessed+= faces.size();
+			if (progressCallback != nullptr && faceCount > 0) progressCallback->progress(static_cast<float>(facesProcessed) / static_cast<float>(faceCount));
+		}
+		group->setFacesEntities(facesEntities);
+		optimizeVertexFetch(group);
 	}
-	prepareForIndexedRendering(model);
 	if (progressCallback != nullptr) {
 		progressCallback->progress(1.0f);
 		delete progressCallback;
 	}
 }
 
+float ModelHelper::computeJointWeightsDistance(Skinning* skinning, int32_t vertexIdx0, int32_t vertexIdx1) {
+	auto& weights = skinning->getWeights();
+	auto& jointsWeights0 = skinning->getVerticesJointsWeights()[vertexIdx0];
+	auto& jointsWeights1 = skinning->getVerticesJointsWeights()[vertexIdx1];
+	auto distance = 0.0f;
+	for (auto& jointWeight0: jointsWeights0) {
+		auto weight1 = 0.0f;
+		for (auto& jointWeight1: jointsWeights1) {
+			if (jointWeight1.getJointIndex() == jointWeight0.getJointIndex()) weight1+= weights[jointWeight1.getWeightIndex()];
+		}
+		distance+= Math::abs(weights[jointWeight0.getWeightIndex()] - weight1);
+	}
+	for (auto& jointWeight1: jointsWeights1) {
+		auto jointFound = false;
+		for (auto& jointWeight0: jointsWeights0) {
+			if (jointWeight0.getJointIndex() == jointWeight1.getJointIndex()) {
+				jointFound = true;
+				break;
+			}
+		}
+		if (jointFound == false) distance+= weights[jointWeight1.getWeightIndex()];
+	}
+	return distance;
+}
+
+bool ModelHelper::hasFaceFlips(const vector<Vector3>& vertices, const vector<array<int32_t, 3>>& faces, const vector<int32_t>& vertexFaces, const vector<int32_t>& vertexFacesOffsets, const vector<int32_t>& vertexRemapping, const vector<int32_t>& vertexPositionIndices, int32_t vertexIdx0, int32_t vertexIdx1) {
+	Vector3 edge1;
+	Vector3 edge2;
+	Vector3 normal;
+	Vector3 collapsedNormal;
+	for (auto i = vertexFacesOffsets[vertexIdx0]; i < vertexFacesOffsets[vertexIdx0 + 1]; i++) {
+		auto& face = faces[vertexFaces[i]];
+		array<int32_t, 3> faceVertexIndices = {{ vertexRemapping[face[0]], vertexRemapping[face[1]], vertexRemapping[face[2]] }};
+		// faces that contain both vertices get removed by collapse
+		auto collapsingCorner = -1;
+		auto removed = false;
+		for (auto j = 0; j < 3; j++) {
+			if (faceVertexIndices[j] == vertexIdx0) collapsingCorner = j;
+			if (vertexPositionIndices[faceVertexIndices[j]] == vertexPositionIndices[vertexIdx1]) removed = true;
+		}
+		if (removed == true || collapsingCorner == -1) continue;
+		auto& vertex0 = vertices[faceVertexIndices[(collapsingCorner + 1) % 3]];
+		auto& vertex1 = vertices[faceVertexIndices[(collapsingCorner + 2) % 3]];
+		Vector3::computeCrossProduct(edge1.set(vertex0).sub(vertices[vertexIdx0]), edge2.set(vertex1).sub(vertices[vertexIdx0]), normal);
+		Vector3::computeCrossProduct(edge1.set(vertex0).sub(vertices[vertexIdx1]), edge2.set(vertex1).sub(vertices[vertexIdx1]), collapsedNormal);
+		if (Vector3::computeDotProduct(normal, collapsedNormal) <= 0.0f) return true;
+	}
+	return false;
+}
+
+void ModelHelper::simplify(Group* group, float targetRatio, float maxError, ModelSimplificationStatistics* statistics) {
+	// simplification works on vertex indices, so make sure vertex attributes share them
+	if (isIndexed(group) == false) prepareForIndexedRendering(group, Math::EPSILON);
+	auto& vertices = group->getVertices();
+	auto vertexCount = static_cast<int32_t>(vertices.size());
+	auto skinning = group->getSkinning();
+
+	// collect faces
+	vector<array<int32_t, 3>> faces;
+	vector<int32_t> facesEntityIndices;
+	auto facesEntityIdx = 0;
+	for (auto& facesEntity: group->getFacesEntities()) {
+		for (auto& face: facesEntity.getFaces()) {
+			faces.push_back(face.getVertexIndices());
+			facesEntityIndices.push_back(facesEntityIdx);
+		}
+		facesEntityIdx++;
+	}
+	auto faceCount = static_cast<int32_t>(faces.size());
+	auto targetFaceCount = static_cast<int32_t>(static_cast<float>(faceCount) * Math::clamp(targetRatio, 0.0f, 1.0f));
+	if (statistics != nullptr) statistics->faceCount+= faceCount;
+	if (faceCount <= targetFaceCount) {
+		if (statistics != nullptr) statistics->simplifiedFaceCount+= faceCount;
+		return;
+	}
+
+	// vertices at the same position but with different attributes, like on UV seams, are linked as wedges
+	vector<int32_t> vertexPositionIndices;
+	auto positionCount = computeVertexPositionIndices(vertices, vertexPositionIndices);
+	vector<int32_t> vertexWedges;
+	vector<int32_t> positionVertices;
+	vector<int32_t> positionWedgeCounts;
+	vertexWedges.resize(vertexCount);
+	positionVertices.resize(positionCount, -1);
+	positionWedgeCounts.resize(positionCount, 0);
+	for (auto i = 0; i < vertexCount; i++) {
+		auto positionIdx = vertexPositionIndices[i];
+		if (positionVertices[positionIdx] == -1) {
+			positionVertices[positionIdx] = i;
+			vertexWedges[i] = i;
+		} else {
+			vertexWedges[i] = vertexWedges[positionVertices[positionIdx]];
+			vertexWedges[positionVertices[positionIdx]] = i;
+		}
+		positionWedgeCounts[positionIdx]++;
+	}
+
+	// find open edges, which have no opposite edge in same faces entity, so mesh borders, UV seams and material borders are open
+	vector<array<int32_t, 3>> halfEdges;
+	halfEdges.reserve(faceCount * 3);
+	for (auto i = 0; i < faceCount; i++) {
+		for (auto j = 0; j < 3; j++) halfEdges.push_back({{ faces[i][j], faces[i][(j + 1) % 3], facesEntityIndices[i] }});
+	}
+	sort(halfEdges.begin(), halfEdges.end());
+	vector<int32_t> vertexOpenEdgesOut;
+	vector<int32_t> vertexOpenEdgesIn;
+	vertexOpenEdgesOut.resize(vertexCount, -1);
+	vertexOpenEdgesIn.resize(vertexCount, -1);
+	for (auto& halfEdge: halfEdges) {
+		array<int32_t, 3> oppositeHalfEdge = {{ halfEdge[1], halfEdge[0], halfEdge[2] }};
+		if (binary_search(halfEdges.begin(), halfEdges.end(), oppositeHalfEdge) == true) continue;
+		// -2 marks vertices with more than one open edge
+		vertexOpenEdgesOut[halfEdge[0]] = vertexOpenEdgesOut[halfEdge[0]] == -1?halfEdge[1]:-2;
+		vertexOpenEdgesIn[halfEdge[1]] = vertexOpenEdgesIn[halfEdge[1]] == -1?halfEdge[0]:-2;
+	}
+
+	// classify vertices
+	vector<SimplificationVertexKind> vertexKinds;
+	vertexKinds.resize(vertexCount, SIMPLIFICATIONVERTEXKIND_LOCKED);
+	for (auto i = 0; i < vertexCount; i++) {
+		auto wedgeCount = positionWedgeCounts[vertexPositionIndices[i]];
+		auto openEdgeOut = vertexOpenEdgesOut[i];
+		auto openEdgeIn = vertexOpenEdgesIn[i];
+		if (wedgeCount == 1) {
+			if (openEdgeOut == -1 && openEdgeIn == -1) {
+				vertexKinds[i] = SIMPLIFICATIONVERTEXKIND_MANIFOLD;
+			} else
+			if (openEdgeOut >= 0 && openEdgeIn >= 0) {
+				vertexKinds[i] = SIMPLIFICATIONVERTEXKIND_BORDER;
+			}
+		} else
+		if (wedgeCount == 2) {
+			// a seam vertex has one open edge on each side which mirror each other
+			auto wedgeOpenEdgeOut = vertexOpenEdgesOut[vertexWedges[i]];
+			auto wedgeOpenEdgeIn = vertexOpenEdgesIn[vertexWedges[i]];
+			if (openEdgeOut >= 0 && openEdgeIn >= 0 && wedgeOpenEdgeOut >= 0 && wedgeOpenEdgeIn >= 0 &&
+				vertexPositionIndices[openEdgeOut] == vertexPositionIndices[wedgeOpenEdgeIn] &&
+				vertexPositionIndices[openEdgeIn] == vertexPositionIndices[wedgeOpenEdgeOut]) {
+				vertexKinds[i] = SIMPLIFICATIONVERTEXKIND_SEAM;
+			}
+		}
+	}
+
+	// error quadrics by position, from face planes and from planes perpendicular to open edges to preserve borders
+	//	distance quadrics by position only contain face planes, they measure the distance a collapse introduces in model space
+	vector<Quadric> positionQuadrics;
+	vector<Quadric> positionDistanceQuadrics;
+	positionQuadrics.resize(positionCount);
+	positionDistanceQuadrics.resize(positionCount);
+	Vector3 edge1;
+	Vector3 edge2;
+	Vector3 faceNormal;
+	Vector3 edgeNormal;
+	for (auto i = 0; i < faceCount; i++) {
+		auto& face = faces[i];
+		Vector3::computeCrossProduct(edge1.set(vertices[face[1]]).sub(vertices[face[0]]), edge2.set(vertices[face[2]]).sub(vertices[face[0]]), faceNormal);
+		auto faceArea = faceNormal.computeLength() * 0.5f;
+		if (faceArea < Math::EPSILON) continue;
+		faceNormal.normalize();
+		auto faceDistance = -Vector3::computeDotProduct(faceNormal, vertices[face[0]]);
+		for (auto j = 0; j < 3; j++) addPlaneToQuadric(positionQuadrics[vertexPositionIndices[face[j]]], faceNormal, faceDistance, faceArea);
+		for (auto j = 0; j < 3; j++) addPlaneToQuadric(positionDistanceQuadrics[vertexPositionIndices[face[j]]], faceNormal, faceDistance, faceArea);
+		for (auto j = 0; j < 3; j++) {
+			auto vertexIdx0 = face[j];
+			auto vertexIdx1 = face[(j + 1) % 3];
+			if (vertexOpenEdgesOut[vertexIdx0] != vertexIdx1 && vertexOpenEdgesOut[vertexIdx0] != -2) continue;
+			array<int32_t, 3> oppositeHalfEdge = {{ vertexIdx1, vertexIdx0, facesEntityIndices[i] }};
+			if (binary_search(halfEdges.begin(), halfEdges.end(), oppositeHalfEdge) == true) continue;
+			edge1.set(vertices[vertexIdx1]).sub(vertices[vertexIdx0]);
+			auto edgeLengthSquared = edge1.computeLengthSquared();
+			if (edgeLengthSquared < Math::EPSILON * Math::EPSILON) continue;
+			Vector3::computeCrossProduct(edge1, faceNormal, edgeNormal);
+			edgeNormal.normalize();
+			auto edgeDistance = -Vector3::computeDotProduct(edgeNormal, vertices[vertexIdx0]);
+			addPlaneToQuadric(positionQuadrics[vertexPositionIndices[vertexIdx0]], edgeNormal, edgeDistance, edgeLengthSquared * 10.0f);
+			addPlaneToQuadric(positionQuadrics[vertexPositionIndices[vertexIdx1]], edgeNormal, edgeDistance, edgeLengthSquared * 10.0f);
+		}
+	}
+
+	// collapse edges in passes, each vertex takes part in at most one collapse per pass
+	vector<int32_t> vertexRemapping;
+	vector<bool> verticesCollapseLocked;
+	vector<int32_t> vertexFaces;
+	vector<int32_t> vertexFacesOffsets;
+	vector<pair<float, pair<int32_t, int32_t>>> collapses;
+	vertexRemapping.resize(vertexCount);
+	auto maxCollapseDistanceSquared = 0.0f;
+	auto maxErrorSquared = maxError * maxError;
+	while (faces.size() > targetFaceCount) {
+		for (auto i = 0; i < vertexCount; i++) vertexRemapping[i] = i;
+		verticesCollapseLocked.assign(vertexCount, false);
+
+		// faces by vertex
+		vertexFacesOffsets.assign(vertexCount + 1, 0);
+		for (auto& face: faces) {
+			for (auto vertexIdx: face) vertexFacesOffsets[vertexIdx + 1]++;
+		}
+		for (auto i = 0; i < vertexCount; i++) vertexFacesOffsets[i + 1]+= vertexFacesOffsets[i];
+		vertexFaces.resize(faces.size() * 3);
+		{
+			auto vertexFacesIdx = vertexFacesOffsets;
+			for (auto i = 0; i < faces.size(); i++) {
+				for (auto vertexIdx: faces[i]) vertexFaces[vertexFacesIdx[vertexIdx]++] = i;
+			}
+		}
+
+		// determine collapse candidates, border and seam vertices only collapse along their open edges
+		collapses.clear();
+		for (auto& face: faces) {
+			for (auto j = 0; j < 6; j++) {
+				auto vertexIdx0 = face[j % 3];
+				auto vertexIdx1 = face[(j / 3 + j + 1) % 3];
+				if (vertexPositionIndices[vertexIdx0] == vertexPositionIndices[vertexIdx1]) continue;
+				auto vertexKind0 = vertexKinds[vertexIdx0];
+				auto vertexKind1 = vertexKinds[vertexIdx1];
+				auto onOpenEdge = vertexOpenEdgesOut[vertexIdx0] == vertexIdx1 || vertexOpenEdgesIn[vertexIdx0] == vertexIdx1;
+				if (vertexKind0 == SIMPLIFICATIONVERTEXKIND_LOCKED) continue;
+				if (vertexKind0 == SIMPLIFICATIONVERTEXKIND_BORDER &&
+					(onOpenEdge == false || (vertexKind1 != SIMPLIFICATIONVERTEXKIND_BORDER && vertexKind1 != SIMPLIFICATIONVERTEXKIND_LOCKED))) continue;
+				if (vertexKind0 == SIMPLIFICATIONVERTEXKIND_SEAM &&
+					(onOpenEdge == false || vertexKind1 != SIMPLIFICATIONVERTEXKIND_SEAM)) continue;
+				if (skinning != nullptr && computeJointWeightsDistance(skinning, vertexIdx0, vertexIdx1) > 0.5f) continue;
+				collapses.push_back(make_pair(computeQuadricError(positionQuadrics[vertexPositionIndices[vertexIdx0]], vertices[vertexIdx1]), make_pair(vertexIdx0, vertexIdx1)));
+			}
+		}
+		sort(collapses.begin(), collapses.end());
+
+		// collapse edges with least error first
+		auto facesToRemove = static_cast<int32_t>(faces.size()) - targetFaceCount;
+		auto facesRemoved = 0;
+		for (auto& collapse: collapses) {
+			if (facesRemoved >= facesToRemove) break;
+			auto vertexIdx0 = collapse.second.first;
+			auto vertexIdx1 = collapse.second.second;
+			if (verticesCollapseLocked[vertexIdx0] == true || verticesCollapseLocked[vertexIdx1] == true) continue;
+			// mean squared distance of target position to the original face planes of collapsing vertex
+			auto collapseDistanceSquared = computeQuadricError(positionDistanceQuadrics[vertexPositionIndices[vertexIdx0]], vertices[vertexIdx1]);
+			if (collapseDistanceSquared > maxErrorSquared) continue;
+			// seam vertices collapse together with their wedge along the mirrored open edge
+			auto wedgeVertexIdx0 = -1;
+			auto wedgeVertexIdx1 = -1;
+			if (vertexKinds[vertexIdx0] == SIMPLIFICATIONVERTEXKIND_SEAM) {
+				wedgeVertexIdx0 = vertexWedges[vertexIdx0];
+				auto wedgeOpenEdgeOut = vertexOpenEdgesOut[wedgeVertexIdx0];
+				auto wedgeOpenEdgeIn = vertexOpenEdgesIn[wedgeVertexIdx0];
+				wedgeVertexIdx1 =
+					vertexPositionIndices[wedgeOpenEdgeOut] == vertexPositionIndices[vertexIdx1]?
+						wedgeOpenEdgeOut:
+						(vertexPositionIndices[wedgeOpenEdgeIn] == vertexPositionIndices[vertexIdx1]?wedgeOpenEdgeIn:-1);
+				if (wedgeVertexIdx1 == -1 || wedgeVertexIdx1 == vertexIdx1) continue;
+				if (verticesCollapseLocked[wedgeVertexIdx0] == true || verticesCollapseLocked[wedgeVertexIdx1] == true) continue;
+				if (skinning != nullptr && computeJointWeightsDistance(skinning, wedgeVertexIdx0, wedgeVertexIdx1) > 0.5f) continue;
+			}
+			if (hasFaceFlips(vertices, faces, vertexFaces, vertexFacesOffsets, vertexRemapping, vertexPositionIndices, vertexIdx0, vertexIdx1) == true) continue;
+			if (wedgeVertexIdx0 != -1 &&
+				hasFaceFlips(vertices, faces, vertexFaces, vertexFacesOffsets, vertexRemapping, vertexPositionIndices, wedgeVertexIdx0, wedgeVertexIdx1) == true) continue;
+			// collapse
+			vertexRemapping[vertexIdx0] = vertexIdx1;
+			verticesCollapseLocked[vertexIdx0] = true;
+			verticesCollapseLocked[vertexIdx1] = true;
+			if (wedgeVertexIdx0 != -1) {
+				vertexRemapping[wedgeVertexIdx0] = wedgeVertexIdx1;
+				verticesCollapseLocked[wedgeVertexIdx0] = true;
+				verticesCollapseLocked[wedgeVertexIdx1] = true;
+			}
+			addQuadric(positionQuadrics[vertexPositionIndices[vertexIdx1]], positionQuadrics[vertexPositionIndices[vertexIdx0]]);
+			addQuadric(positionDistanceQuadrics[vertexPositionIndices[vertexIdx1]], positionDistanceQuadrics[vertexPositionIndices[vertexIdx0]]);
+			maxCollapseDistanceSquared = Math::max(maxCollapseDistanceSquared, collapseDistanceSquared);
+			facesRemoved+= vertexKinds[vertexIdx0] == SIMPLIFICATIONVERTEXKIND_BORDER?1:2;
+		}
+		if (facesRemoved == 0) break;
+
+		// remap faces and remove degenerated ones
+		auto remainingFaceCount = 0;
+		for (auto i = 0; i < faces.size(); i++) {
+			auto& face = faces[i];
+			for (auto j = 0; j < 3; j++) face[j] = vertexRemapping[face[j]];
+			if (vertexPositionIndices[face[0]] == vertexPositionIndices[face[1]] ||
+				vertexPositionIndices[face[1]] == vertexPositionIndices[face[2]] ||
+				vertexPositionIndices[face[2]] == vertexPositionIndices[face[0]]) continue;
+			faces[remainingFaceCount] = face;
+			facesEntityIndices[remainingFaceCount] = facesEntityIndices[i];
+			remainingFaceCount++;
+		}
+		faces.resize(remainingFaceCount);
+		facesEntityIndices.resize(remainingFaceCount);
+	}
+
+	// store simplified faces and remove unused vertices
+	auto facesEntities = group->getFacesEntities();
+	vector<vector<Face>> facesEntitiesFaces;
+	facesEntitiesFaces.resize(facesEntities.size());
+	for (auto i = 0; i < faces.size(); i++) {
+		auto& face = faces[i];
+		Face simplifiedFace(group, face[0], face[1], face[2], face[0], face[1], face[2]);
+		simplifiedFace.setIndexedRenderingIndices(face);
+		facesEntitiesFaces[facesEntityIndices[i]].push_back(simplifiedFace);
+	}
+	for (auto i = 0; i < facesEntities.size(); i++) facesEntities[i].setFaces(facesEntitiesFaces[i]);
+	group->setFacesEntities(facesEntities);
+	optimizeVertexFetch(group);
+	if (statistics != nullptr) {
+		statistics->simplifiedFaceCount+= faces.size();
+		statistics->maxError = Math::max(statistics->maxError, Math::sqrt(maxCollapseDistanceSquared));
+	}
+}
+
+void ModelHelper::simplify(Model* model, float targetRatio, float maxError, ModelSimplificationStatistics* statistics) {
+	vector<Group*> groups;
+	collectGroups(model->getSubGroups(), groups);
+	for (auto group: groups) simplify(group, targetRatio, maxError, statistics);
+}
+
+int64_t ModelHelper::computeTransformedVertexCount(const vector<Face>& faces, int cacheSize) {
+	auto vertexCount = 0;
+	for (auto& face: faces) {
+		for (auto vertexIdx: face.getVertexIndices()) vertexCount = Math::max(vertexCount, vertexIdx + 1);
+	}
+	vector<int64_t> vertexTimestamps;
+	vertexTimestamps.resize(vertexCount, 0LL);
+	int64_t timestamp = cacheSize + 1;
+	int64_t transformedVertexCount = 0LL;
+	for (auto& face: faces) transformedVertexCount+= updateVertexCache(face, vertexTimestamps, timestamp, cacheSize);
+	return transformedVertexCount;
+}
+
 int ModelHelper::determineFaceCount(Group* group) {
 	auto faceCount = 0;
 	faceCount+= group->getFaceCount();
@@ -12,9 +12,12 @@
 #include <tdme/engine/model/FacesEntity.h>
 #include <tdme/engine/model/Group.h>
 #include <tdme/math/fwd-tdme.h>
+#include <tdme/math/Math.h>
 #include <tdme/math/Vector3.h>
+#include <tdme/os/threading/Thread.h>
 #include <tdme/tools/shared/files/fwd-tdme.h>
 #include <tdme/utils/fwd-tdme.h>
+#include <tdme/utils/Float.h>
 
 using std::array;
 using std::map;
@@ -25,9 +28,13 @@ using tdme::engine::Transformations;
 using tdme::engine::model::Group;
 using tdme::engine::model::Model;
 using tdme::engine::model::ModelHelper_VertexOrder;
+using tdme::engine::model::ModelSimplificationStatistics;
 using tdme::engine::model::Skinning;
+using tdme::math::Math;
 using tdme::math::Vector3;
+using tdme::os::threading::Thread;
 using tdme::tools::shared::files::ProgressCallback;
+using tdme::utils::Float;
 
 /** 
  * Model helper functions class
@@ -37,6 +44,9 @@ class tdme::engine::model::ModelHelper final
 {
 
 public:
+	static constexpr int VERTEXCACHE_FIFO_SIZE { 16 };
+	static constexpr int VERTEXCACHE_LRU_SIZE { 32 };
+
 	/** 
 	 * Determines vertex order of face
 	 * @param vertices vertices
@@ -85,10 +95,11 @@ public:
 	}
 
 	/** 
-	 * Prepare for indexed rendering
+	 * Prepare for indexed rendering, which welds equal face vertices into indexed vertices
 	 * @param model model
+	 * @param epsilon tolerance used to compare vertices, normals, texture coordinates, tangents and bitangents, at least Math::EPSILON
 	 */
-	static void prepareForIndexedRendering(Model* model);
+	static void prepareForIndexedRendering(Model* model, float epsilon = Math::EPSILON);
 
 	/**
 	 * Set diffuse masked transparency for given model
@@ -98,11 +109,57 @@ public:
 	static void setDiffuseMaskedTransparency(Model* model, bool maskedTransparency);
 private:
 
-	/** 
-	 * Prepares this group for indexed rendering
+	/**
+	 * Prepares groups for indexed rendering in parallel
+	 */
+	class PrepareForIndexedRenderingThread: public Thread {
+	public:
+		/**
+		 * Constructor
+		 * @param groups groups
+		 * @param groupIdx shared index of next group to process
+		 * @param epsilon epsilon
+		 */
+		PrepareForIndexedRenderingThread(const vector<Group*>* groups, volatile uint64_t* groupIdx, float epsilon);
+
+		/**
+		 * Run
+		 */
+		virtual void run();
+
+	private:
+		const vector<Group*>* groups;
+		volatile uint64_t* groupIdx;
+		float epsilon;
+	};
+
+	/**
+	 * Compute vertex welding grid cell hash
+	 * @param x x cell
+	 * @param y y cell
+	 * @param z z cell
+	 * @return hash
+	 */
+	inline static uint64_t computeVertexCellHash(int64_t x, int64_t y, int64_t z) {
+		return
+			(static_cast<uint64_t>(x) * 73856093ULL) ^
+			(static_cast<uint64_t>(y) * 19349663ULL) ^
+			(static_cast<uint64_t>(z) * 83492791ULL);
+	}
+
+	/**
+	 * Collect given groups and its sub groups
 	 * @param groups groups
+	 * @param collectedGroups collected groups
 	 */
-	static void prepareForIndexedRendering(const map<string, Group*>& groups);
+	static void collectGroups(const map<string, Group*>& groups, vector<Group*>& collectedGroups);
+
+	/** 
+	 * Prepares group for indexed rendering
+	 * @param group group
+	 * @param epsilon tolerance used to compare vertices, normals, texture coordinates, tangents and bitangents, at least Math::EPSILON
+	 */
+	static void prepareForIndexedRendering(Group* group, float epsilon);
 
 	/** 
 	 * Maps original vertices to new vertice mapping
@@ -164,9 +221,10 @@ public:
 	/**
 	 * Clone material
 	 * @param material material
+	 * @param id id of cloned material or empty string to use id of given material
 	 * @return material
 	 */
-	static Material* cloneMaterial(const Material* material);
+	static Material* cloneMaterial(const Material* material, const string& id = string());
 
 	/**
 	 * Create model from source sub groups into target sub groups
@@ -194,48 +252,232 @@ private:
 	static void shrinkToFit(Group* group);
 
 	/**
-	 * Find all faces that include vertex and compute the avarage normal
+	 * Computes normals of groups in parallel
+	 */
+	class ComputeNormalsThread: public Thread {
+	public:
+		/**
+		 * Constructor
+		 * @param groups groups
+		 * @param groupIdx shared index of next group to process
+		 * @param facesProcessed shared count of processed faces
+		 * @param angleWeighted angle weighted
+		 * @param creaseAngle crease angle
+		 */
+		ComputeNormalsThread(const vector<Group*>* groups, volatile uint64_t* groupIdx, volatile uint64_t* facesProcessed, bool angleWeighted, float creaseAngle);
+
+		/**
+		 * Run
+		 */
+		virtual void run();
+
+	private:
+		const vector<Group*>* groups;
+		volatile uint64_t* groupIdx;
+		volatile uint64_t* facesProcessed;
+		bool angleWeighted;
+		float creaseAngle;
+	};
+
+	/**
+	 * Compute smooth normals of group, vertices sharing the same position are found by sorting them by position
 	 * @param group group
-	 * @param vertex vertex
-	 * @param normals normals
-	 * @param normal normal
-	 */
-	inline static bool interpolateNormal(Group* group, const Vector3& vertex, const vector<Vector3>& normals, Vector3& normal) {
-		array<Vector3, 3> vertices;
-		auto normalCount = 0;
-		normal.set(0.0f, 0.0f, 0.0f);
-		for (auto& facesEntity: group->getFacesEntities()) {
-			for (auto& face: facesEntity.getFaces()) {
-				for (auto i = 0; i < vertices.size(); i++) {
-					if (vertex.equals(group->getVertices()[face.getVertexIndices()[i]]) == true) {
-						normal.add(normals[face.getNormalIndices()[0]]);
-						normalCount++;
-						break;
-					}
-				}
-				if (normalCount == 6) break;
-			}
-			if (normalCount == 6) break;
-		}
-		if (normalCount > 1) {
-			normal.normalize();
-			return true;
+	 * @param angleWeighted weight face normals by face corner angle
+	 * @param creaseAngle faces whose normals deviate more than crease angle in degrees do not get smoothed together
+	 */
+	static void computeNormals(Group* group, bool angleWeighted, float creaseAngle);
+
+	/**
+	 * Compute face count
+	 * @param group group
+	 */
+	static int determineFaceCount(Group* group);
+
+	/**
+	 * Compute vertex score used by vertex cache optimization
+	 * @param cachePosition LRU cache position or -1 if not in cache
+	 * @param activeFaceCount count of faces not yet emitted that use the vertex
+	 * @return score
+	 */
+	inline static float computeVertexCacheScore(int cachePosition, int activeFaceCount) {
+		if (activeFaceCount == 0) return -1.0f;
+		auto score = 0.0f;
+		if (cachePosition < 0) {
+			// not in cache
+		} else
+		if (cachePosition < 3) {
+			// vertices of last face get a fixed score, so its hard to generate strips
+			score = 0.75f;
 		} else {
-			return false;
+			score = static_cast<float>(Math::pow(1.0f - static_cast<float>(cachePosition - 3) / static_cast<float>(VERTEXCACHE_LRU_SIZE - 3), 1.5f));
+		}
+		// boost vertices with few faces left, so they do not remain as lone faces
+		return score + 2.0f * static_cast<float>(Math::pow(static_cast<float>(activeFaceCount), -0.5f));
+	}
+
+	/**
+	 * Simulate rendering a face with a FIFO post transform vertex cache
+	 * 	A vertex is in cache if it was inserted less than cache size insertions ago
+	 * @param face face
+	 * @param vertexTimestamps vertex insertion timestamps
+	 * @param timestamp current timestamp
+	 * @param cacheSize cache size
+	 * @return cache misses
+	 */
+	inline static int updateVertexCache(const Face& face, vector<int64_t>& vertexTimestamps, int64_t& timestamp, int cacheSize) {
+		auto cacheMisses = 0;
+		for (auto vertexIdx: face.getVertexIndices()) {
+			if (timestamp - vertexTimestamps[vertexIdx] <= cacheSize) continue;
+			vertexTimestamps[vertexIdx] = timestamp++;
+			cacheMisses++;
 		}
+		return cacheMisses;
 	}
 
 	/**
-	 * Compute normals
+	 * Reorder faces for post transform vertex cache efficiency using Tom Forsyth's linear-speed vertex cache optimization
+	 * @param faces faces
+	 */
+	static void optimizeVertexCache(vector<Face>& faces);
+
+	/**
+	 * Reorder clusters of faces, that were ordered for vertex cache efficiency, so that outward facing clusters get rendered first to reduce overdraw
+	 * @param vertices vertices
+	 * @param faces faces
+	 * @param threshold max allowed average cache miss ratio increase when splitting faces into clusters
+	 */
+	static void optimizeOverdraw(const vector<Vector3>& vertices, vector<Face>& faces, float threshold);
+
+	/**
+	 * Remap vertices of indexed group in order of first use, so vertex fetch from GPU memory becomes sequential, unused vertices get removed
 	 * @param group group
 	 */
-	static float computeNormals(Group* group, ProgressCallback* progressCallback = nullptr, float incrementPerFace = 0.0f, float progress = 0.0f);
+	static void optimizeVertexFetch(Group* group);
 
 	/**
-	 * Compute face count
+	 * Determine if group is indexed, means all face vertex attribute indices equal the face vertex indices
 	 * @param group group
+	 * @return if group is indexed
 	 */
-	static int determineFaceCount(Group* group);
+	static bool isIndexed(Group* group);
+
+	/**
+	 * Compute indices of distinct vertex positions
+	 * @param vertices vertices
+	 * @param vertexPositionIndices vertex position indices
+	 * @return distinct position count
+	 */
+	static int32_t computeVertexPositionIndices(const vector<Vector3>& vertices, vector<int32_t>& vertexPositionIndices);
+
+	/**
+	 * Simplification vertex kind
+	 */
+	enum SimplificationVertexKind { SIMPLIFICATIONVERTEXKIND_MANIFOLD, SIMPLIFICATIONVERTEXKIND_BORDER, SIMPLIFICATIONVERTEXKIND_SEAM, SIMPLIFICATIONVERTEXKIND_LOCKED };
+
+	/**
+	 * Error quadric, which is a symmetric 4x4 matrix accumulating squared distances to planes
+	 */
+	struct Quadric {
+		float a00 {  };
+		float a11 {  };
+		float a22 {  };
+		float a10 {  };
+		float a20 {  };
+		float a21 {  };
+		float b0 {  };
+		float b1 {  };
+		float b2 {  };
+		float c {  };
+		float w {  };
+	};
+
+	/**
+	 * Add plane to quadric
+	 * @param quadric quadric
+	 * @param normal plane normal
+	 * @param distance plane distance
+	 * @param weight weight
+	 */
+	inline static void addPlaneToQuadric(Quadric& quadric, const Vector3& normal, float distance, float weight) {
+		auto& n = normal.getArray();
+		quadric.a00+= weight * n[0] * n[0];
+		quadric.a11+= weight * n[1] * n[1];
+		quadric.a22+= weight * n[2] * n[2];
+		quadric.a10+= weight * n[1] * n[0];
+		quadric.a20+= weight * n[2] * n[0];
+		quadric.a21+= weight * n[2] * n[1];
+		quadric.b0+= weight * n[0] * distance;
+		quadric.b1+= weight * n[1] * distance;
+		quadric.b2+= weight * n[2] * distance;
+		quadric.c+= weight * distance * distance;
+		quadric.w+= weight;
+	}
+
+	/**
+	 * Add quadric to quadric
+	 * @param quadric quadric
+	 * @param other other quadric
+	 */
+	inline static void addQuadric(Quadric& quadric, const Quadric& other) {
+		quadric.a00+= other.a00;
+		quadric.a11+= other.a11;
+		quadric.a22+= other.a22;
+		quadric.a10+= other.a10;
+		quadric.a20+= other.a20;
+		quadric.a21+= other.a21;
+		quadric.b0+= other.b0;
+		quadric.b1+= other.b1;
+		quadric.b2+= other.b2;
+		quadric.c+= other.c;
+		quadric.w+= other.w;
+	}
+
+	/**
+	 * Compute quadric error, which is the weighted mean squared distance of given position to quadric planes
+	 * @param quadric quadric
+	 * @param position position
+	 * @return error
+	 */
+	inline static float computeQuadricError(const Quadric& quadric, const Vector3& position) {
+		auto& p = position.getArray();
+		auto rx = quadric.a00 * p[0] + quadric.a10 * p[1] + quadric.a20 * p[2];
+		auto ry = quadric.a10 * p[0] + quadric.a11 * p[1] + quadric.a21 * p[2];
+		auto rz = quadric.a20 * p[0] + quadric.a21 * p[1] + quadric.a22 * p[2];
+		auto r = rx * p[0] + ry * p[1] + rz * p[2] + 2.0f * (quadric.b0 * p[0] + quadric.b1 * p[1] + quadric.b2 * p[2]) + quadric.c;
+		return quadric.w < Math::EPSILON?0.0f:Math::abs(r) / quadric.w;
+	}
+
+	/**
+	 * Compute distance of joint weights of two vertices
+	 * @param skinning skinning
+	 * @param vertexIdx0 vertex index 0
+	 * @param vertexIdx1 vertex index 1
+	 * @return sum of absolute joint weight differences
+	 */
+	static float computeJointWeightsDistance(Skinning* skinning, int32_t vertexIdx0, int32_t vertexIdx1);
+
+	/**
+	 * Check if collapsing a vertex into another vertex would flip any of the remaining faces of the vertex
+	 * @param vertices vertices
+	 * @param faces faces
+	 * @param vertexFaces faces by vertex
+	 * @param vertexFacesOffsets vertex faces offsets
+	 * @param vertexRemapping vertex remapping of this simplification pass
+	 * @param vertexPositionIndices vertex position indices
+	 * @param vertexIdx0 collapsing vertex index
+	 * @param vertexIdx1 target vertex index
+	 * @return if faces would flip
+	 */
+	static bool hasFaceFlips(const vector<Vector3>& vertices, const vector<array<int32_t, 3>>& faces, const vector<int32_t>& vertexFaces, const vector<int32_t>& vertexFacesOffsets, const vector<int32_t>& vertexRemapping, const vector<int32_t>& vertexPositionIndices, int32_t vertexIdx0, int32_t vertexIdx1);
+
+	/**
+	 * Simplify group
+	 * @param group group
+	 * @param targetRatio target face count ratio
+	 * @param maxError max error as root mean square distance in model space
+	 * @param statistics simplification statistics or null
+	 */
+	static void simplify(Group* group, float targetRatio, float maxError, ModelSimplificationStatistics* statistics);
 
 public:
 	/**
@@ -254,10 +496,40 @@ public:
 	static void shrinkToFit(Model* model);
 
 	/**
-	 * Compute normals
-	 * @param group group
+	 * Compute smooth normals
+	 * @param model model
+	 * @param progressCallback progress callback
+	 * @param angleWeighted weight face normals by face corner angle
+	 * @param creaseAngle faces whose normals deviate more than crease angle in degrees do not get smoothed together
+	 */
+	static void computeNormals(Model* model, ProgressCallback* progressCallback = nullptr, bool angleWeighted = false, float creaseAngle = 180.0f);
+
+	/**
+	 * Optimize model for rendering, which reorders faces for post transform vertex cache efficiency and less overdraw,
+	 * 	and remaps vertices in order of first use for vertex fetch efficiency
+	 * @param model model
+	 * @param progressCallback progress callback
+	 */
+	static void optimizeForRendering(Model* model, ProgressCallback* progressCallback = nullptr);
+
+	/**
+	 * Simplify model by collapsing edges with the least quadric error until target face ratio has been reached for each group
+	 * 	Vertices on UV seams, material borders and mesh borders only collapse along these borders,
+	 * 	and skinned vertices only collapse into vertices with similar joint weights
+	 * @param model model
+	 * @param targetRatio target face count ratio
+	 * @param maxError max error as root mean square distance in model space of a collapsed vertex to the planes of the original faces it represents
+	 * @param statistics simplification statistics or null
+	 */
+	static void simplify(Model* model, float targetRatio, float maxError = Float::MAX_VALUE, ModelSimplificationStatistics* statistics = nullptr);
+
+	/**
+	 * Simulate a FIFO post transform vertex cache to determine how many vertices need to be transformed to render given faces
+	 * @param faces faces
+	 * @param cacheSize cache size
+	 * @return transformed vertex count
 	 */
-	static void computeNormals(Model* model, ProgressCallback* progressCallback = nullptr);
+	static int64_t computeTransformedVertexCount(const vector<Face>& faces, int cacheSize = VERTEXCACHE_FIFO_SIZE);
 
 	/**
 	 * Prepare model for foliage shader
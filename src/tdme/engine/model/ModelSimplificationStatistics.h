@@ -0,0 +1,16 @@
+#pragma once
+
+#include <tdme/tdme.h>
+#include <tdme/engine/model/fwd-tdme.h>
+
+/**
+ * Model simplification statistics entity
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+struct tdme::engine::model::ModelSimplificationStatistics
+{
+	int32_t faceCount {  };
+	int32_t simplifiedFaceCount {  };
+	float maxError {  };
+};
@@ -61,6 +61,18 @@ void SpecularMaterialProperties::setDiffuseTexture(const string& pathName, const
 	checkDiffuseTextureTransparency();
 }
 
+void SpecularMaterialProperties::setDiffuseTexture(Texture* texture)
+{
+	diffuseTexturePathName.clear();
+	diffuseTextureFileName.clear();
+	diffuseTransparencyTexturePathName.clear();
+	diffuseTransparencyTextureFileName.clear();
+	if (texture != nullptr) texture->acquireReference();
+	if (diffuseTexture != nullptr) diffuseTexture->releaseReference();
+	diffuseTexture = texture;
+	checkDiffuseTextureTransparency();
+}
+
 void SpecularMaterialProperties::checkDiffuseTextureTransparency()
 {
 	diffuseTextureTransparency = false;
@@ -83,9 +95,27 @@ void SpecularMaterialProperties::setSpecularTexture(const string& pathName, cons
 	specularTexture = TextureReader::read(pathName, fileName);
 }
 
+void SpecularMaterialProperties::setSpecularTexture(Texture* texture)
+{
+	specularTexturePathName.clear();
+	specularTextureFileName.clear();
+	if (texture != nullptr) texture->acquireReference();
+	if (specularTexture != nullptr) specularTexture->releaseReference();
+	specularTexture = texture;
+}
+
 void SpecularMaterialProperties::setNormalTexture(const string& pathName, const string& fileName)
 {
 	normalTexturePathName = pathName;
 	normalTextureFileName = fileName;
 	normalTexture = TextureReader::read(pathName, fileName);
 }
+
+void SpecularMaterialProperties::setNormalTexture(Texture* texture)
+{
+	normalTexturePathName.clear();
+	normalTextureFileName.clear();
+	if (texture != nullptr) texture->acquireReference();
+	if (normalTexture != nullptr) normalTexture->releaseReference();
+	normalTexture = texture;
+}
@@ -163,6 +163,12 @@ public:
 	 */
 	void setDiffuseTexture(const string& pathName, const string& fileName, const string& transparencyPathName = string(), const string& transparencyFileName = string());
 
+	/**
+	 * Set up a diffuse texture that has been created in memory, e.g. a texture atlas
+	 * @param texture texture
+	 */
+	void setDiffuseTexture(Texture* texture);
+
 	/**
 	 * @return if material has a diffuse texture
 	 */
@@ -235,6 +241,12 @@ public:
 	 */
 	void setSpecularTexture(const string& pathName, const string& fileName);
 
+	/**
+	 * Set up a specular texture that has been created in memory, e.g. a texture atlas
+	 * @param texture texture
+	 */
+	void setSpecularTexture(Texture* texture);
+
 	/**
 	 * @return if material has a specular texture
 	 */
@@ -270,6 +282,12 @@ public:
 	 */
 	void setNormalTexture(const string& pathName, const string& fileName);
 
+	/**
+	 * Set up a normal texture that has been created in memory, e.g. a texture atlas
+	 * @param texture texture
+	 */
+	void setNormalTexture(Texture* texture);
+
 	/**
 	 * @return if material has a normal texture
 	 */
@@ -0,0 +1,337 @@
+#include <tdme/engine/model/TextureAtlasBaker.h>
+
+#include <algorithm>
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <tdme/engine/fileio/textures/Texture.h>
+#include <tdme/engine/model/Color4.h>
+#include <tdme/engine/model/Face.h>
+#include <tdme/engine/model/FacesEntity.h>
+#include <tdme/engine/model/Group.h>
+#include <tdme/engine/model/Material.h>
+#include <tdme/engine/model/Model.h>
+#include <tdme/engine/model/SpecularMaterialProperties.h>
+#include <tdme/engine/model/TextureAtlasStatistics.h>
+#include <tdme/engine/model/TextureCoordinate.h>
+#include <tdme/math/Math.h>
+#include <tdme/math/Matrix2D3x3.h>
+#include <tdme/math/Vector2.h>
+#include <tdme/utils/ByteBuffer.h>
+
+using std::array;
+using std::find;
+using std::map;
+using std::sort;
+using std::string;
+using std::to_string;
+using std::vector;
+
+using tdme::engine::model::TextureAtlasBaker;
+using tdme::engine::fileio::textures::Texture;
+using tdme::engine::model::Color4;
+using tdme::engine::model::Face;
+using tdme::engine::model::FacesEntity;
+using tdme::engine::model::Group;
+using tdme::engine::model::Material;
+using tdme::engine::model::Model;
+using tdme::engine::model::SpecularMaterialProperties;
+using tdme::engine::model::TextureAtlasStatistics;
+using tdme::engine::model::TextureCoordinate;
+using tdme::math::Math;
+using tdme::math::Matrix2D3x3;
+using tdme::math::Vector2;
+using tdme::utils::ByteBuffer;
+
+TextureAtlasBaker::TextureAtlasBaker(const string& id, int32_t atlasSizeMax, int32_t padding): id(id), atlasSizeMax(atlasSizeMax), padding(padding)
+{
+}
+
+TextureAtlasBaker::~TextureAtlasBaker() {
+	for (auto atlasMaterial: atlasMaterials) delete atlasMaterial;
+}
+
+int32_t TextureAtlasBaker::getMaterialEntryIdx(const Material* material) {
+	auto materialEntriesByMaterialIt = materialEntriesByMaterial.find(material);
+	if (materialEntriesByMaterialIt != materialEntriesByMaterial.end()) return materialEntriesByMaterialIt->second;
+	auto specularMaterialProperties = material->getSpecularMaterialProperties();
+	MaterialEntry materialEntry;
+	materialEntry.material = material;
+	materialEntry.eligible =
+		specularMaterialProperties != nullptr &&
+		material->getPBRMaterialProperties() == nullptr &&
+		specularMaterialProperties->hasDiffuseTexture() == true &&
+		specularMaterialProperties->getDiffuseTexture()->getTextureWidth() + padding * 2 <= atlasSizeMax &&
+		specularMaterialProperties->getDiffuseTexture()->getTextureHeight() + padding * 2 <= atlasSizeMax;
+	materialEntry.textureSetIdx = -1;
+	auto materialEntryIdx = static_cast<int32_t>(materialEntries.size());
+	materialEntries.push_back(materialEntry);
+	materialEntriesByMaterial[material] = materialEntryIdx;
+	return materialEntryIdx;
+}
+
+void TextureAtlasBaker::addModel(Model* model) {
+	for (auto groupIt: model->getSubGroups()) {
+		addGroup(groupIt.second);
+	}
+}
+
+void TextureAtlasBaker::addGroup(Group* group) {
+	auto& textureCoordinates = group->getTextureCoordinates();
+	map<int32_t, int32_t> materialEntryIdxByTextureCoordinateIdx;
+	for (auto& facesEntity: group->getFacesEntities()) {
+		auto material = facesEntity.getMaterial();
+		if (material == nullptr || facesEntity.getFaces().size() == 0) continue;
+		auto materialEntryIdx = getMaterialEntryIdx(material);
+		auto& materialEntry = materialEntries[materialEntryIdx];
+		// texture coordinates must not wrap and must not be shared with other materials as we remap them
+		Vector2 textureCoordinate;
+		Vector2 textureCoordinateTransformed;
+		for (auto& face: facesEntity.getFaces()) {
+			for (auto textureCoordinateIdx: face.getTextureCoordinateIndices()) {
+				if (textureCoordinateIdx == -1 || textureCoordinateIdx >= textureCoordinates.size()) {
+					materialEntry.eligible = false;
+					continue;
+				}
+				auto materialEntryIdxByTextureCoordinateIdxIt = materialEntryIdxByTextureCoordinateIdx.find(textureCoordinateIdx);
+				if (materialEntryIdxByTextureCoordinateIdxIt == materialEntryIdxByTextureCoordinateIdx.end()) {
+					materialEntryIdxByTextureCoordinateIdx[textureCoordinateIdx] = materialEntryIdx;
+				} else
+				if (materialEntryIdxByTextureCoordinateIdxIt->second != materialEntryIdx) {
+					materialEntry.eligible = false;
+					materialEntries[materialEntryIdxByTextureCoordinateIdxIt->second].eligible = false;
+				}
+				if (materialEntry.eligible == false) continue;
+				auto& uv = textureCoordinates[textureCoordinateIdx].getArray();
+				material->getTextureMatrix().multiply(textureCoordinate.set(uv[0], uv[1]), textureCoordinateTransformed);
+				if (textureCoordinateTransformed.getX() < -TEXTURECOORDINATE_EPSILON || textureCoordinateTransformed.getX() > 1.0f + TEXTURECOORDINATE_EPSILON ||
+					textureCoordinateTransformed.getY() < -TEXTURECOORDINATE_EPSILON || textureCoordinateTransformed.getY() > 1.0f + TEXTURECOORDINATE_EPSILON) {
+					materialEntry.eligible = false;
+				}
+			}
+		}
+	}
+	for (auto subGroupIt: group->getSubGroups()) {
+		addGroup(subGroupIt.second);
+	}
+}
+
+const string TextureAtlasBaker::getMaterialPropertiesKey(const Material* material) {
+	auto specularMaterialProperties = material->getSpecularMaterialProperties();
+	string key;
+	for (auto color: {&specularMaterialProperties->getAmbientColor(), &specularMaterialProperties->getDiffuseColor(), &specularMaterialProperties->getSpecularColor(), &specularMaterialProperties->getEmissionColor()}) {
+		for (auto component: color->getArray()) key+= to_string(component) + ",";
+	}
+	key+= to_string(specularMaterialProperties->getShininess()) + ",";
+	key+= string(specularMaterialProperties->hasDiffuseTextureMaskedTransparency() == true?"1":"0") + ",";
+	key+= to_string(specularMaterialProperties->getDiffuseTextureMaskedTransparencyThreshold()) + ",";
+	key+= string(specularMaterialProperties->hasDiffuseTextureTransparency() == true?"1":"0") + ",";
+	key+= string(specularMaterialProperties->hasSpecularTexture() == true?"1":"0") + ",";
+	key+= string(specularMaterialProperties->hasNormalTexture() == true?"1":"0");
+	return key;
+}
+
+void TextureAtlasBaker::pack(const vector<int32_t>& textureSetIndices, int32_t size, vector<int32_t>& packedTextureSetIndices) {
+	packedTextureSetIndices.clear();
+	auto shelfX = 0;
+	auto shelfY = 0;
+	auto shelfHeight = 0;
+	for (auto textureSetIdx: textureSetIndices) {
+		auto& textureSet = textureSets[textureSetIdx];
+		auto width = textureSet.width + padding * 2;
+		auto height = textureSet.height + padding * 2;
+		if (shelfX + width > size) {
+			shelfX = 0;
+			shelfY+= shelfHeight;
+			shelfHeight = 0;
+		}
+		if (shelfX + width > size || shelfY + height > size) continue;
+		textureSet.x = shelfX + padding;
+		textureSet.y = shelfY + padding;
+		shelfX+= width;
+		shelfHeight = Math::max(shelfHeight, height);
+		packedTextureSetIndices.push_back(textureSetIdx);
+	}
+}
+
+void TextureAtlasBaker::copyTexture(Texture* texture, ByteBuffer* atlasTextureData, int32_t atlasSize, int32_t x, int32_t y, int32_t width, int32_t height) {
+	auto textureData = texture->getTextureData()->getBuffer();
+	auto textureWidth = texture->getTextureWidth();
+	auto textureHeight = texture->getTextureHeight();
+	auto textureBytesPerPixel = texture->getDepth() / 8;
+	auto atlasData = atlasTextureData->getBuffer();
+	// copy texture and replicate its edges into padding area
+	for (auto atlasY = y - padding; atlasY < y + height + padding; atlasY++) {
+		auto textureY = Math::clamp(atlasY - y, 0, height - 1) * textureHeight / height;
+		for (auto atlasX = x - padding; atlasX < x + width + padding; atlasX++) {
+			auto textureX = Math::clamp(atlasX - x, 0, width - 1) * textureWidth / width;
+			auto texturePixel = &textureData[(textureY * textureWidth + textureX) * textureBytesPerPixel];
+			auto atlasPixel = &atlasData[(atlasY * atlasSize + atlasX) * 4];
+			atlasPixel[0] = texturePixel[0];
+			atlasPixel[1] = texturePixel[1];
+			atlasPixel[2] = texturePixel[2];
+			atlasPixel[3] = textureBytesPerPixel == 4?texturePixel[3]:255;
+		}
+	}
+}
+
+void TextureAtlasBaker::bake(TextureAtlasStatistics* statistics) {
+	// bucket eligible materials by properties that need to match to share a atlas material
+	map<string, vector<int32_t>> materialEntryIndicesByKey;
+	vector<string> keys;
+	for (auto i = 0; i < materialEntries.size(); i++) {
+		auto& materialEntry = materialEntries[i];
+		if (materialEntry.eligible == false) continue;
+		auto key = getMaterialPropertiesKey(materialEntry.material);
+		auto& materialEntryIndices = materialEntryIndicesByKey[key];
+		if (materialEntryIndices.empty() == true) keys.push_back(key);
+		materialEntryIndices.push_back(i);
+	}
+
+	//
+	auto atlasMaterialCount = 0;
+	auto atlasTextureCount = 0;
+	uint64_t usedTexels = 0LL;
+	uint64_t atlasTexels = 0LL;
+	for (auto& key: keys) {
+		auto& materialEntryIndices = materialEntryIndicesByKey[key];
+		// a single material would not reduce draw calls
+		if (materialEntryIndices.size() < 2) {
+			materialEntries[materialEntryIndices[0]].eligible = false;
+			continue;
+		}
+
+		// determine unique texture sets
+		vector<int32_t> textureSetIndices;
+		for (auto materialEntryIdx: materialEntryIndices) {
+			auto& materialEntry = materialEntries[materialEntryIdx];
+			auto specularMaterialProperties = materialEntry.material->getSpecularMaterialProperties();
+			for (auto textureSetIdx: textureSetIndices) {
+				auto& textureSet = textureSets[textureSetIdx];
+				if (textureSet.diffuseTexture == specularMaterialProperties->getDiffuseTexture() &&
+					textureSet.specularTexture == specularMaterialProperties->getSpecularTexture() &&
+					textureSet.normalTexture == specularMaterialProperties->getNormalTexture()) {
+					materialEntry.textureSetIdx = textureSetIdx;
+					break;
+				}
+			}
+			if (materialEntry.textureSetIdx != -1) continue;
+			TextureSet textureSet;
+			textureSet.diffuseTexture = specularMaterialProperties->getDiffuseTexture();
+			textureSet.specularTexture = specularMaterialProperties->getSpecularTexture();
+			textureSet.normalTexture = specularMaterialProperties->getNormalTexture();
+			textureSet.width = textureSet.diffuseTexture->getTextureWidth();
+			textureSet.height = textureSet.diffuseTexture->getTextureHeight();
+			textureSet.atlasIdx = -1;
+			textureSet.x = 0;
+			textureSet.y = 0;
+			materialEntry.textureSetIdx = textureSets.size();
+			textureSetIndices.push_back(textureSets.size());
+			textureSets.push_back(textureSet);
+		}
+		sort(textureSetIndices.begin(), textureSetIndices.end(), [&](int32_t textureSetIdxA, int32_t textureSetIdxB) {
+			return textureSets[textureSetIdxA].height > textureSets[textureSetIdxB].height;
+		});
+
+		// pack texture sets into as few and as small atlases as possible
+		while (textureSetIndices.empty() == false) {
+			auto atlasIdx = static_cast<int32_t>(atlasSizes.size());
+			auto atlasSize = 1;
+			while (atlasSize < textureSets[textureSetIndices[0]].height + padding * 2) atlasSize*= 2;
+			vector<int32_t> packedTextureSetIndices;
+			for (; atlasSize <= atlasSizeMax; atlasSize*= 2) {
+				pack(textureSetIndices, atlasSize, packedTextureSetIndices);
+				if (packedTextureSetIndices.size() == textureSetIndices.size()) break;
+			}
+			if (atlasSize > atlasSizeMax) atlasSize = atlasSizeMax;
+			atlasSizes.push_back(atlasSize);
+			vector<int32_t> remainingTextureSetIndices;
+			for (auto textureSetIdx: textureSetIndices) {
+				if (find(packedTextureSetIndices.begin(), packedTextureSetIndices.end(), textureSetIdx) == packedTextureSetIndices.end()) {
+					remainingTextureSetIndices.push_back(textureSetIdx);
+				}
+			}
+			textureSetIndices = remainingTextureSetIndices;
+
+			// create atlas textures
+			auto atlasId = id + ".atlas." + to_string(atlasIdx);
+			auto diffuseTextureData = ByteBuffer::allocate(atlasSize * atlasSize * 4);
+			auto specularTextureData = packedTextureSetIndices.size() > 0 && textureSets[packedTextureSetIndices[0]].specularTexture != nullptr?ByteBuffer::allocate(atlasSize * atlasSize * 4):nullptr;
+			auto normalTextureData = packedTextureSetIndices.size() > 0 && textureSets[packedTextureSetIndices[0]].normalTexture != nullptr?ByteBuffer::allocate(atlasSize * atlasSize * 4):nullptr;
+			// unused areas should not make the atlas appear transparent
+			for (auto i = 0; i < atlasSize * atlasSize; i++) diffuseTextureData->getBuffer()[i * 4 + 3] = 255;
+			for (auto textureSetIdx: packedTextureSetIndices) {
+				auto& textureSet = textureSets[textureSetIdx];
+				textureSet.atlasIdx = atlasIdx;
+				copyTexture(textureSet.diffuseTexture, diffuseTextureData, atlasSize, textureSet.x, textureSet.y, textureSet.width, textureSet.height);
+				if (specularTextureData != nullptr) copyTexture(textureSet.specularTexture, specularTextureData, atlasSize, textureSet.x, textureSet.y, textureSet.width, textureSet.height);
+				if (normalTextureData != nullptr) copyTexture(textureSet.normalTexture, normalTextureData, atlasSize, textureSet.x, textureSet.y, textureSet.width, textureSet.height);
+				usedTexels+= textureSet.width * textureSet.height;
+			}
+			atlasTexels+= atlasSize * atlasSize;
+			auto diffuseTexture = new Texture(atlasId + ".diffuse", 32, atlasSize, atlasSize, atlasSize, atlasSize, diffuseTextureData);
+			auto specularTexture = specularTextureData != nullptr?new Texture(atlasId + ".specular", 32, atlasSize, atlasSize, atlasSize, atlasSize, specularTextureData):nullptr;
+			auto normalTexture = normalTextureData != nullptr?new Texture(atlasId + ".normal", 32, atlasSize, atlasSize, atlasSize, atlasSize, normalTextureData):nullptr;
+			for (auto texture: {diffuseTexture, specularTexture, normalTexture}) {
+				if (texture == nullptr) continue;
+				texture->setRepeat(false);
+				atlasTextureCount++;
+			}
+
+			// create atlas material with properties of first material of bucket
+			auto specularMaterialProperties = materialEntries[materialEntryIndices[0]].material->getSpecularMaterialProperties();
+			auto atlasMaterial = new Material(atlasId);
+			auto atlasSpecularMaterialProperties = atlasMaterial->getSpecularMaterialProperties();
+			atlasSpecularMaterialProperties->setAmbientColor(specularMaterialProperties->getAmbientColor());
+			atlasSpecularMaterialProperties->setDiffuseColor(specularMaterialProperties->getDiffuseColor());
+			atlasSpecularMaterialProperties->setSpecularColor(specularMaterialProperties->getSpecularColor());
+			atlasSpecularMaterialProperties->setEmissionColor(specularMaterialProperties->getEmissionColor());
+			atlasSpecularMaterialProperties->setShininess(specularMaterialProperties->getShininess());
+			atlasSpecularMaterialProperties->setDiffuseTextureMaskedTransparency(specularMaterialProperties->hasDiffuseTextureMaskedTransparency());
+			atlasSpecularMaterialProperties->setDiffuseTextureMaskedTransparencyThreshold(specularMaterialProperties->getDiffuseTextureMaskedTransparencyThreshold());
+			atlasSpecularMaterialProperties->setDiffuseTexture(diffuseTexture);
+			if (specularTexture != nullptr) atlasSpecularMaterialProperties->setSpecularTexture(specularTexture);
+			if (normalTexture != nullptr) atlasSpecularMaterialProperties->setNormalTexture(normalTexture);
+			atlasMaterials.push_back(atlasMaterial);
+		}
+		atlasMaterialCount+= materialEntryIndices.size();
+	}
+
+	// store statistics
+	if (statistics != nullptr) {
+		statistics->materialCount = materialEntries.size();
+		statistics->atlasMaterialCount = atlasMaterialCount;
+		statistics->atlasTextureCount = atlasTextureCount;
+		statistics->atlasCount = atlasSizes.size();
+		statistics->packingEfficiency = atlasTexels == 0LL?0.0f:static_cast<float>(static_cast<double>(usedTexels) / static_cast<double>(atlasTexels));
+	}
+}
+
+Material* TextureAtlasBaker::getAtlasMaterial(const Material* material) {
+	auto materialEntriesByMaterialIt = materialEntriesByMaterial.find(material);
+	if (materialEntriesByMaterialIt == materialEntriesByMaterial.end()) return nullptr;
+	auto& materialEntry = materialEntries[materialEntriesByMaterialIt->second];
+	if (materialEntry.eligible == false || materialEntry.textureSetIdx == -1) return nullptr;
+	return atlasMaterials[textureSets[materialEntry.textureSetIdx].atlasIdx];
+}
+
+TextureCoordinate TextureAtlasBaker::remapTextureCoordinate(const Material* material, const TextureCoordinate& textureCoordinate) {
+	auto materialEntriesByMaterialIt = materialEntriesByMaterial.find(material);
+	if (materialEntriesByMaterialIt == materialEntriesByMaterial.end()) return textureCoordinate;
+	auto& materialEntry = materialEntries[materialEntriesByMaterialIt->second];
+	if (materialEntry.eligible == false || materialEntry.textureSetIdx == -1) return textureCoordinate;
+	auto& textureSet = textureSets[materialEntry.textureSetIdx];
+	auto atlasSize = static_cast<float>(atlasSizes[textureSet.atlasIdx]);
+	// texture coordinates are stored like they are passed to shader, so we only need to apply the material texture matrix
+	auto& uv = textureCoordinate.getArray();
+	Vector2 textureCoordinateTransformed;
+	material->getTextureMatrix().multiply(Vector2(uv[0], uv[1]), textureCoordinateTransformed);
+	return TextureCoordinate(
+		array<float, 2> {
+			(static_cast<float>(textureSet.x) + Math::clamp(textureCoordinateTransformed.getX(), 0.0f, 1.0f) * static_cast<float>(textureSet.width)) / atlasSize,
+			(static_cast<float>(textureSet.y) + Math::clamp(textureCoordinateTransformed.getY(), 0.0f, 1.0f) * static_cast<float>(textureSet.height)) / atlasSize
+		}
+	);
+}
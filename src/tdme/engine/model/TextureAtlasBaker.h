@@ -0,0 +1,154 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <vector>
+
+#include <tdme/tdme.h>
+#include <tdme/engine/fileio/textures/fwd-tdme.h>
+#include <tdme/engine/model/fwd-tdme.h>
+#include <tdme/engine/model/TextureCoordinate.h>
+#include <tdme/utils/fwd-tdme.h>
+
+using std::map;
+using std::string;
+using std::vector;
+
+using tdme::engine::fileio::textures::Texture;
+using tdme::engine::model::Group;
+using tdme::engine::model::Material;
+using tdme::engine::model::Model;
+using tdme::engine::model::TextureAtlasStatistics;
+using tdme::engine::model::TextureCoordinate;
+using tdme::utils::ByteBuffer;
+
+/**
+ * Texture atlas baker, which packs diffuse, specular and normal textures of materials of a set of models into texture atlases
+ * 	Materials that only differ by their textures share a atlas material, so geometry using them can be rendered in a single batch
+ * 	Materials are only baked if their texture coordinates do not wrap, if they use no PBR properties and if their texture coordinates are not shared with other materials
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::engine::model::TextureAtlasBaker final
+{
+public:
+	static constexpr int32_t ATLAS_SIZE_MAX { 4096 };
+	static constexpr int32_t PADDING { 8 };
+
+	/**
+	 * Public constructor
+	 * @param id id, which is used as prefix for atlas materials and textures
+	 * @param atlasSizeMax max atlas width and height, must be a power of 2
+	 * @param padding padding around each texture in atlas to avoid texture bleeding with texture filtering and mip mapping
+	 */
+	TextureAtlasBaker(const string& id, int32_t atlasSizeMax = ATLAS_SIZE_MAX, int32_t padding = PADDING);
+
+	/**
+	 * Destructor
+	 */
+	~TextureAtlasBaker();
+
+	/**
+	 * Add materials used by given model to be baked
+	 * @param model model
+	 */
+	void addModel(Model* model);
+
+	/**
+	 * Bake texture atlases and atlas materials
+	 * @param statistics statistics or null
+	 */
+	void bake(TextureAtlasStatistics* statistics = nullptr);
+
+	/**
+	 * @return atlas materials, which are owned by this texture atlas baker
+	 */
+	inline const vector<Material*>& getAtlasMaterials() {
+		return atlasMaterials;
+	}
+
+	/**
+	 * Returns atlas material of given material
+	 * @param material material
+	 * @return atlas material or null if material has not been baked into a atlas
+	 */
+	Material* getAtlasMaterial(const Material* material);
+
+	/**
+	 * Remap texture coordinate of given material into atlas texture coordinate space
+	 * @param material material
+	 * @param textureCoordinate texture coordinate
+	 * @return atlas texture coordinate or given texture coordinate if material has not been baked into a atlas
+	 */
+	TextureCoordinate remapTextureCoordinate(const Material* material, const TextureCoordinate& textureCoordinate);
+
+private:
+	static constexpr float TEXTURECOORDINATE_EPSILON { 0.01f };
+
+	struct MaterialEntry {
+		const Material* material;
+		bool eligible;
+		int32_t textureSetIdx;
+	};
+
+	struct TextureSet {
+		Texture* diffuseTexture;
+		Texture* specularTexture;
+		Texture* normalTexture;
+		int32_t width;
+		int32_t height;
+		int32_t atlasIdx;
+		int32_t x;
+		int32_t y;
+	};
+
+	string id;
+	int32_t atlasSizeMax;
+	int32_t padding;
+	vector<MaterialEntry> materialEntries;
+	map<const Material*, int32_t> materialEntriesByMaterial;
+	vector<TextureSet> textureSets;
+	vector<Material*> atlasMaterials;
+	vector<int32_t> atlasSizes;
+
+	/**
+	 * Get material entry index, material entry will be created if not yet existing
+	 * @param material material
+	 * @return material entry index
+	 */
+	int32_t getMaterialEntryIdx(const Material* material);
+
+	/**
+	 * Add materials of given group and its sub groups
+	 * @param group group
+	 */
+	void addGroup(Group* group);
+
+	/**
+	 * Returns key of material properties that need to match to share a atlas material
+	 * @param material material
+	 * @return key
+	 */
+	static const string getMaterialPropertiesKey(const Material* material);
+
+	/**
+	 * Pack texture sets with shelf packing into a square atlas of given size
+	 * @param textureSetIndices texture set indices sorted by height descending
+	 * @param size atlas width and height
+	 * @param packedTextureSetIndices packed texture set indices
+	 */
+	void pack(const vector<int32_t>& textureSetIndices, int32_t size, vector<int32_t>& packedTextureSetIndices);
+
+	/**
+	 * Copy texture into atlas including padding, texture will be scaled to given dimension if required
+	 * @param texture texture
+	 * @param atlasTextureData atlas texture data with 4 bytes per pixel
+	 * @param atlasSize atlas width and height
+	 * @param x x
+	 * @param y y
+	 * @param width width
+	 * @param height height
+	 */
+	void copyTexture(Texture* texture, ByteBuffer* atlasTextureData, int32_t atlasSize, int32_t x, int32_t y, int32_t width, int32_t height);
+
+};
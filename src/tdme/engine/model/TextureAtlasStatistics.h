@@ -0,0 +1,20 @@
+#pragma once
+
+#include <tdme/tdme.h>
+#include <tdme/engine/model/fwd-tdme.h>
+
+/**
+ * Texture atlas statistics entity
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+struct tdme::engine::model::TextureAtlasStatistics
+{
+	int32_t materialCount {  };
+	int32_t atlasMaterialCount {  };
+	int32_t atlasTextureCount {  };
+	int32_t atlasCount {  };
+	float packingEfficiency {  };
+	int32_t drawCount {  };
+	int32_t combinedDrawCount {  };
+};
@@ -71,11 +71,21 @@ public:
 	 * @return equality
 	 */
 	inline bool equals(const TextureCoordinate& textureCoordinate) const {
+		return equals(textureCoordinate, Math::EPSILON);
+	}
+
+	/**
+	 * Compares this texture coordinate with given texture coordinate
+	 * @param textureCoordinate texture coordinate
+	 * @param tolerance tolerance per component
+	 * @return equality
+	 */
+	inline bool equals(const TextureCoordinate& textureCoordinate, float tolerance) const {
 		return
 			this == &textureCoordinate ||
 			(
-				Math::abs(data[0] - textureCoordinate.data[0]) < Math::EPSILON &&
-				Math::abs(data[1] - textureCoordinate.data[1]) < Math::EPSILON
+				Math::abs(data[0] - textureCoordinate.data[0]) < tolerance &&
+				Math::abs(data[1] - textureCoordinate.data[1]) < tolerance
 			);
 	}
 
@@ -18,11 +18,14 @@ namespace model {
 	class Model;
 	class ModelHelper;
 	class ModelHelper_VertexOrder;
+	struct ModelSimplificationStatistics;
 	class PBRMaterialProperties;
 	class UpVector;
 	class RotationOrder;
 	class Skinning;
 	class SpecularMaterialProperties;
+	class TextureAtlasBaker;
+	struct TextureAtlasStatistics;
 	class TextureCoordinate;
 }  // namespace model
 }  // namespace engine
@@ -1,5 +1,7 @@
 #pragma once
 
+#include <string>
+
 #include <tdme/tdme.h>
 #include <tdme/engine/fwd-tdme.h>
 #include <tdme/engine/subsystems/renderer/fwd-tdme.h>
@@ -7,6 +9,8 @@
 #include <tdme/engine/subsystems/earlyzrejection/EZRShaderPreImplementation.h>
 #include <tdme/math/fwd-tdme.h>
 
+using std::string;
+
 using tdme::engine::Engine;
 using tdme::engine::subsystems::renderer::Renderer;
 using tdme::engine::subsystems::earlyzrejection::EZRShaderPreImplementation;
@@ -34,8 +38,15 @@ protected:
 	int32_t uniformDiffuseTextureMaskedTransparency { -1 };
 	int32_t uniformDiffuseTextureMaskedTransparencyThreshold { -1 };
 	int32_t uniformFrame { -1 };
+	int32_t uniformInstanceDataTextureUnit { -1 };
+	int32_t uniformInstanceIndicesTextureUnit { -1 };
 	bool initialized {  };
 
+	/**
+	 * @return vertex shader definitions to fetch instance data by instance indices if supported by renderer
+	 */
+	const string getInstanceDataDefinitions();
+
 public:
 
 	// overriden methods
@@ -29,7 +29,8 @@ void EZRShaderPreDefaultImplementation::initialize()
 	vertexShaderId = renderer->loadShader(
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/earlyzrejection",
-		"pre_vertexshader.c"
+		"pre_vertexshader.c",
+		getInstanceDataDefinitions()
 	);
 	if (vertexShaderId == 0) return;
 	fragmentShaderId = renderer->loadShader(
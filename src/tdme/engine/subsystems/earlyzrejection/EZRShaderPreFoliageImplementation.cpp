@@ -30,7 +30,8 @@ void EZRShaderPreFoliageImplementation::initialize()
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/earlyzrejection",
 		"pre_vertexshader.c",
-		"#define HAVE_FOLIAGE",
+		"#define HAVE_FOLIAGE" +
+		getInstanceDataDefinitions(),
 		FileSystem::getInstance()->getContentAsString(
 			"shader/" + shaderVersion + "/functions",
 			"create_rotation_matrix.inc.c"
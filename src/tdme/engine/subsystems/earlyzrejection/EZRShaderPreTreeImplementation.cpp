@@ -30,7 +30,8 @@ void EZRShaderPreTreeImplementation::initialize()
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/earlyzrejection",
 		"pre_vertexshader.c",
-		"#define HAVE_TREE",
+		"#define HAVE_TREE" +
+		getInstanceDataDefinitions(),
 		FileSystem::getInstance()->getContentAsString(
 			"shader/" + shaderVersion + "/functions",
 			"create_rotation_matrix.inc.c"
@@ -0,0 +1,331 @@
+#include <tdme/engine/subsystems/lighting/LightClusters.h>
+
+#include <vector>
+
+#include <tdme/engine/Light.h>
+#include <tdme/engine/model/Color4.h>
+#include <tdme/engine/subsystems/lighting/LightClustersStatistics.h>
+#include <tdme/engine/subsystems/renderer/Renderer.h>
+#include <tdme/engine/subsystems/rendering/ObjectBuffer.h>
+#include <tdme/math/Math.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/math/Vector4.h>
+#include <tdme/os/threading/Semaphore.h>
+#include <tdme/os/threading/Thread.h>
+#include <tdme/utils/ByteBuffer.h>
+#include <tdme/utils/Float.h>
+#include <tdme/utils/FloatBuffer.h>
+#include <tdme/utils/IntBuffer.h>
+#include <tdme/utils/Time.h>
+
+using std::vector;
+
+using tdme::engine::Light;
+using tdme::engine::model::Color4;
+using tdme::engine::subsystems::lighting::LightClusters;
+using tdme::engine::subsystems::lighting::LightClustersStatistics;
+using tdme::engine::subsystems::renderer::Renderer;
+using tdme::engine::subsystems::rendering::ObjectBuffer;
+using tdme::math::Math;
+using tdme::math::Matrix4x4;
+using tdme::math::Vector3;
+using tdme::math::Vector4;
+using tdme::os::threading::Semaphore;
+using tdme::os::threading::Thread;
+using tdme::utils::ByteBuffer;
+using tdme::utils::Float;
+using tdme::utils::FloatBuffer;
+using tdme::utils::IntBuffer;
+using tdme::utils::Time;
+
+constexpr int32_t LightClusters::LIGHTS_MAX;
+constexpr int32_t LightClusters::CLUSTERS_X;
+constexpr int32_t LightClusters::CLUSTERS_Y;
+constexpr int32_t LightClusters::CLUSTERS_Z;
+constexpr int32_t LightClusters::CLUSTER_LIGHTS_MAX;
+constexpr int32_t LightClusters::LIGHT_TEXELS;
+
+LightClusters::BinLightsThread::BinLightsThread(LightClusters* lightClusters, int threadCount, int idx, Semaphore* finishedSemaphore):
+	Thread("binlightsthread"),
+	lightClusters(lightClusters),
+	threadCount(threadCount),
+	idx(idx),
+	startSemaphore("binlightsthread_start", 0),
+	finishedSemaphore(finishedSemaphore) {
+}
+
+void LightClusters::BinLightsThread::run() {
+	while (true) {
+		startSemaphore.wait();
+		if (isStopRequested() == true) break;
+		lightClusters->binLightsFunction(threadCount, idx);
+		finishedSemaphore->increment();
+	}
+}
+
+LightClusters::LightClusters(Renderer* renderer, int threadCount): binLightsFinishedSemaphore("lightclusters_binlightsfinished", 0)
+{
+	this->renderer = renderer;
+	for (auto i = 1; i < threadCount; i++) {
+		auto binLightsThread = new BinLightsThread(this, threadCount, i, &binLightsFinishedSemaphore);
+		binLightsThread->start();
+		binLightsThreads.push_back(binLightsThread);
+	}
+	clusterBoundingBoxesMin.resize(CLUSTERS_X * CLUSTERS_Y * CLUSTERS_Z);
+	clusterBoundingBoxesMax.resize(CLUSTERS_X * CLUSTERS_Y * CLUSTERS_Z);
+	clusters.resize(CLUSTERS_X * CLUSTERS_Y * CLUSTERS_Z);
+	for (auto& cluster: clusters) cluster.reserve(CLUSTER_LIGHTS_MAX);
+	droppedClusterLights.resize(CLUSTERS_Z);
+	clusterData.resize(CLUSTERS_X * CLUSTERS_Y * CLUSTERS_Z * 2);
+}
+
+LightClusters::~LightClusters()
+{
+	for (auto binLightsThread: binLightsThreads) {
+		binLightsThread->stop();
+		binLightsThread->startSemaphore.increment();
+		binLightsThread->join();
+		delete binLightsThread;
+	}
+}
+
+void LightClusters::initialize()
+{
+	if (bufferObjectIds.empty() == false) return;
+	bufferObjectIds = renderer->createBufferObjects(3, true, false);
+}
+
+void LightClusters::dispose()
+{
+	if (bufferObjectIds.empty() == true) return;
+	renderer->disposeBufferObjects(bufferObjectIds);
+	bufferObjectIds.clear();
+}
+
+void LightClusters::computeViewSpacePoint(float x, float y, float viewDepth, Vector3& point)
+{
+	// determine normalized device z of view depth and unproject, this works with any projection matrix
+	Vector4 clipSpacePoint;
+	Vector4 viewSpacePoint;
+	projectionMatrix.multiply(Vector4(0.0f, 0.0f, -viewDepth, 1.0f), clipSpacePoint);
+	projectionMatrixInverted.multiply(Vector4(x, y, clipSpacePoint[2] / clipSpacePoint[3], 1.0f), viewSpacePoint);
+	point.set(
+		viewSpacePoint[0] / viewSpacePoint[3],
+		viewSpacePoint[1] / viewSpacePoint[3],
+		viewSpacePoint[2] / viewSpacePoint[3]
+	);
+}
+
+void LightClusters::computeClusterBoundingBoxes()
+{
+	Vector3 point;
+	for (auto z = 0; z < CLUSTERS_Z; z++) {
+		// exponential depth slices
+		auto sliceNear = zNear * Math::pow(zFar / zNear, static_cast<float>(z) / static_cast<float>(CLUSTERS_Z));
+		auto sliceFar = zNear * Math::pow(zFar / zNear, static_cast<float>(z + 1) / static_cast<float>(CLUSTERS_Z));
+		for (auto y = 0; y < CLUSTERS_Y; y++)
+		for (auto x = 0; x < CLUSTERS_X; x++) {
+			auto clusterIdx = (z * CLUSTERS_Y + y) * CLUSTERS_X + x;
+			auto& clusterBoundingBoxMin = clusterBoundingBoxesMin[clusterIdx];
+			auto& clusterBoundingBoxMax = clusterBoundingBoxesMax[clusterIdx];
+			clusterBoundingBoxMin.set(Float::MAX_VALUE, Float::MAX_VALUE, Float::MAX_VALUE);
+			clusterBoundingBoxMax.set(-Float::MAX_VALUE, -Float::MAX_VALUE, -Float::MAX_VALUE);
+			// tile corners at slice near and far
+			for (auto i = 0; i < 8; i++) {
+				computeViewSpacePoint(
+					-1.0f + 2.0f * static_cast<float>(x + (i & 1)) / static_cast<float>(CLUSTERS_X),
+					-1.0f + 2.0f * static_cast<float>(y + ((i >> 1) & 1)) / static_cast<float>(CLUSTERS_Y),
+					(i >> 2) == 0?sliceNear:sliceFar,
+					point
+				);
+				for (auto j = 0; j < 3; j++) {
+					clusterBoundingBoxMin[j] = Math::min(clusterBoundingBoxMin[j], point[j]);
+					clusterBoundingBoxMax[j] = Math::max(clusterBoundingBoxMax[j], point[j]);
+				}
+			}
+		}
+	}
+}
+
+float LightClusters::computeLightRange(const Light& light)
+{
+	// light does not contribute visibly anymore if attenuated intensity drops below 1 / 256
+	auto& diffuse = light.getDiffuse();
+	auto& specular = light.getSpecular();
+	auto intensity = Math::max(
+		Math::max(Math::max(diffuse.getRed(), diffuse.getGreen()), diffuse.getBlue()),
+		Math::max(Math::max(specular.getRed(), specular.getGreen()), specular.getBlue())
+	);
+	auto attenuation = intensity * 256.0f - light.getConstantAttenuation();
+	if (attenuation <= 0.0f) return 0.0f;
+	// solve quadratic attenuation * distance^2 + linear attenuation * distance = attenuation
+	auto linearAttenuation = light.getLinearAttenuation();
+	auto quadraticAttenuation = light.getQuadraticAttenuation();
+	if (quadraticAttenuation > Math::EPSILON) {
+		return (-linearAttenuation + Math::sqrt(linearAttenuation * linearAttenuation + 4.0f * quadraticAttenuation * attenuation)) / (2.0f * quadraticAttenuation);
+	} else
+	if (linearAttenuation > Math::EPSILON) {
+		return attenuation / linearAttenuation;
+	}
+	return -1.0f;
+}
+
+void LightClusters::update(const Matrix4x4& projectionMatrix, const Matrix4x4& cameraMatrix, float zNear, float zFar, const vector<Light>& lights)
+{
+	timeStart = Time::getCurrentNanos();
+
+	// update cluster bounding boxes if projection changed
+	if (this->projectionMatrix.equals(projectionMatrix) == false || this->zNear != zNear || this->zFar != zFar) {
+		this->projectionMatrix.set(projectionMatrix);
+		this->projectionMatrixInverted.set(projectionMatrix).invert();
+		this->zNear = zNear;
+		this->zFar = zFar;
+		clusterZScale = static_cast<float>(CLUSTERS_Z) / Math::log(zFar / zNear);
+		clusterZBias = -static_cast<float>(CLUSTERS_Z) * Math::log(zNear) / Math::log(zFar / zNear);
+		computeClusterBoundingBoxes();
+	}
+
+	// set up light data and view space light spheres
+	lightData.clear();
+	lightSpheres.clear();
+	Vector3 center;
+	for (auto i = 0; i < lights.size() && i < LIGHTS_MAX; i++) {
+		auto& light = lights[i];
+		auto& position = light.getPosition();
+		if (light.isEnabled() == false || position.getW() < Math::EPSILON) continue;
+		auto range = computeLightRange(light);
+		if (range == 0.0f) continue;
+		cameraMatrix.multiply(Vector3(position.getX(), position.getY(), position.getZ()), center);
+		auto viewDepth = -center.getZ();
+		LightSphere lightSphere;
+		lightSphere.lightIdx = lightData.size() / (LIGHT_TEXELS * 4);
+		lightSphere.center = center;
+		lightSphere.radius = range;
+		if (range < 0.0f) {
+			// no range limit
+			lightSphere.clusterZMin = 0;
+			lightSphere.clusterZMax = CLUSTERS_Z - 1;
+		} else {
+			// skip if not in view depth range
+			if (viewDepth + range < zNear || viewDepth - range > zFar) continue;
+			lightSphere.clusterZMin = computeClusterZ(viewDepth - range);
+			lightSphere.clusterZMax = computeClusterZ(viewDepth + range);
+		}
+		lightSpheres.push_back(lightSphere);
+		// position and range
+		lightData.push_back(position.getX());
+		lightData.push_back(position.getY());
+		lightData.push_back(position.getZ());
+		lightData.push_back(range);
+		// diffuse
+		for (auto j = 0; j < 4; j++) lightData.push_back(light.getDiffuse().getArray()[j]);
+		// specular
+		for (auto j = 0; j < 4; j++) lightData.push_back(light.getSpecular().getArray()[j]);
+		// spot direction and spot cos cut off
+		lightData.push_back(light.getSpotDirection().getX());
+		lightData.push_back(light.getSpotDirection().getY());
+		lightData.push_back(light.getSpotDirection().getZ());
+		lightData.push_back(Math::cos(Math::PI / 180.0f * light.getSpotCutOff()));
+		// attenuations and spot exponent
+		lightData.push_back(light.getConstantAttenuation());
+		lightData.push_back(light.getLinearAttenuation());
+		lightData.push_back(light.getQuadraticAttenuation());
+		lightData.push_back(light.getSpotExponent());
+	}
+}
+
+void LightClusters::binLights()
+{
+	// let bin lights threads do their depth slices while doing depth slices of thread index 0 in calling thread
+	for (auto binLightsThread: binLightsThreads) binLightsThread->startSemaphore.increment();
+	binLightsFunction(binLightsThreads.size() + 1, 0);
+	if (binLightsThreads.empty() == false) binLightsFinishedSemaphore.wait(binLightsThreads.size());
+}
+
+void LightClusters::binLightsFunction(int threadCount, int threadIdx)
+{
+	for (auto z = threadIdx; z < CLUSTERS_Z; z+= threadCount) {
+		droppedClusterLights[z] = 0;
+		for (auto clusterIdx = z * CLUSTERS_Y * CLUSTERS_X; clusterIdx < (z + 1) * CLUSTERS_Y * CLUSTERS_X; clusterIdx++) {
+			clusters[clusterIdx].clear();
+		}
+		for (auto& lightSphere: lightSpheres) {
+			if (z < lightSphere.clusterZMin || z > lightSphere.clusterZMax) continue;
+			auto& center = lightSphere.center;
+			auto radiusSquared = lightSphere.radius * lightSphere.radius;
+			for (auto clusterIdx = z * CLUSTERS_Y * CLUSTERS_X; clusterIdx < (z + 1) * CLUSTERS_Y * CLUSTERS_X; clusterIdx++) {
+				// sphere vs cluster bounding box
+				if (lightSphere.radius >= 0.0f) {
+					auto& clusterBoundingBoxMin = clusterBoundingBoxesMin[clusterIdx];
+					auto& clusterBoundingBoxMax = clusterBoundingBoxesMax[clusterIdx];
+					auto distanceSquared = 0.0f;
+					for (auto j = 0; j < 3; j++) {
+						auto distance = center[j] - Math::clamp(center[j], clusterBoundingBoxMin[j], clusterBoundingBoxMax[j]);
+						distanceSquared+= distance * distance;
+					}
+					if (distanceSquared > radiusSquared) continue;
+				}
+				// add light to cluster
+				auto& cluster = clusters[clusterIdx];
+				if (cluster.size() == CLUSTER_LIGHTS_MAX) {
+					droppedClusterLights[z]++;
+					continue;
+				}
+				cluster.push_back(lightSphere.lightIdx);
+			}
+		}
+	}
+}
+
+void LightClusters::collectLights()
+{
+	auto droppedClusterLightCount = 0;
+	lightIndexData.clear();
+	for (auto clusterIdx = 0; clusterIdx < clusters.size(); clusterIdx++) {
+		auto& cluster = clusters[clusterIdx];
+		clusterData[clusterIdx * 2 + 0] = lightIndexData.size();
+		clusterData[clusterIdx * 2 + 1] = cluster.size();
+		lightIndexData.insert(lightIndexData.end(), cluster.begin(), cluster.end());
+	}
+	for (auto z = 0; z < CLUSTERS_Z; z++) droppedClusterLightCount+= droppedClusterLights[z];
+
+	//
+	statistics.lights = lightSpheres.size();
+	statistics.clusterLights = lightIndexData.size();
+	statistics.droppedClusterLights = droppedClusterLightCount;
+	statistics.binningTime = Time::getCurrentNanos() - timeStart;
+}
+
+void LightClusters::upload(void* context)
+{
+	// light data
+	auto fbLightData = ObjectBuffer::getByteBuffer(context, Math::max(static_cast<int32_t>(lightData.size()), 4) * sizeof(float))->asFloatBuffer();
+	for (auto value: lightData) fbLightData.put(value);
+	if (lightData.empty() == true) for (auto i = 0; i < 4; i++) fbLightData.put(0.0f);
+	renderer->uploadBufferObject(context, bufferObjectIds[0], fbLightData.getPosition() * sizeof(float), &fbLightData);
+
+	// cluster data
+	auto ibClusterData = ObjectBuffer::getByteBuffer(context, clusterData.size() * sizeof(int32_t))->asIntBuffer();
+	for (auto value: clusterData) ibClusterData.put(value);
+	renderer->uploadBufferObject(context, bufferObjectIds[1], ibClusterData.getPosition() * sizeof(int32_t), &ibClusterData);
+
+	// light index data, texture buffers should not be empty
+	auto ibLightIndexData = ObjectBuffer::getByteBuffer(context, Math::max(static_cast<int32_t>(lightIndexData.size()), 1) * sizeof(int32_t))->asIntBuffer();
+	for (auto value: lightIndexData) ibLightIndexData.put(value);
+	if (lightIndexData.empty() == true) ibLightIndexData.put(0);
+	renderer->uploadBufferObject(context, bufferObjectIds[2], ibLightIndexData.getPosition() * sizeof(int32_t), &ibLightIndexData);
+}
+
+int32_t LightClusters::getClusterIdx(float x, float y, float viewDepth)
+{
+	auto clusterX = Math::clamp(static_cast<int32_t>((x * 0.5f + 0.5f) * CLUSTERS_X), 0, CLUSTERS_X - 1);
+	auto clusterY = Math::clamp(static_cast<int32_t>((y * 0.5f + 0.5f) * CLUSTERS_Y), 0, CLUSTERS_Y - 1);
+	auto clusterZ = computeClusterZ(viewDepth);
+	return (clusterZ * CLUSTERS_Y + clusterY) * CLUSTERS_X + clusterX;
+}
+
+void LightClusters::getStatistics(LightClustersStatistics& statistics)
+{
+	statistics = this->statistics;
+}
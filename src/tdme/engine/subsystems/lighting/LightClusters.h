@@ -0,0 +1,262 @@
+#pragma once
+
+#include <vector>
+
+#include <tdme/tdme.h>
+#include <tdme/engine/fwd-tdme.h>
+#include <tdme/engine/subsystems/lighting/fwd-tdme.h>
+#include <tdme/engine/subsystems/lighting/LightClustersStatistics.h>
+#include <tdme/engine/subsystems/renderer/fwd-tdme.h>
+#include <tdme/math/fwd-tdme.h>
+#include <tdme/math/Math.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/os/threading/Semaphore.h>
+#include <tdme/os/threading/Thread.h>
+
+using std::vector;
+
+using tdme::engine::Light;
+using tdme::engine::subsystems::lighting::LightClustersStatistics;
+using tdme::engine::subsystems::renderer::Renderer;
+using tdme::math::Math;
+using tdme::math::Matrix4x4;
+using tdme::math::Vector3;
+using tdme::os::threading::Semaphore;
+using tdme::os::threading::Thread;
+
+/**
+ * Light clusters, which bin point and spot lights into clusters of the camera view frustum, so that lighting shaders only process lights affecting a fragment
+ * 	The view frustum is divided into CLUSTERS_X * CLUSTERS_Y screen tiles and CLUSTERS_Z exponential depth slices
+ * 	Light data, cluster light offsets and counts and cluster light indices are uploaded to buffer objects, which are used as texture buffers by lighting shaders
+ * 	Binning is distributed over own bin lights threads, as engine threads are not available with renderers that do not support multi threaded rendering
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::engine::subsystems::lighting::LightClusters final
+{
+public:
+	static constexpr int32_t LIGHTS_MAX { 1024 };
+	static constexpr int32_t CLUSTERS_X { 16 };
+	static constexpr int32_t CLUSTERS_Y { 8 };
+	static constexpr int32_t CLUSTERS_Z { 24 };
+	static constexpr int32_t CLUSTER_LIGHTS_MAX { 64 };
+	static constexpr int32_t LIGHT_TEXELS { 5 };
+
+private:
+	struct LightSphere {
+		int32_t lightIdx;
+		Vector3 center;
+		float radius;
+		int32_t clusterZMin;
+		int32_t clusterZMax;
+	};
+
+	/**
+	 * Bin lights thread, which bins lights of its depth slices when signalled by binLights()
+	 */
+	class BinLightsThread final: public Thread {
+		friend class LightClusters;
+	private:
+		LightClusters* lightClusters;
+		int threadCount;
+		int idx;
+		Semaphore startSemaphore;
+		Semaphore* finishedSemaphore;
+
+	public:
+		/**
+		 * Public constructor
+		 * @param lightClusters light clusters
+		 * @param threadCount thread count including calling thread of binLights()
+		 * @param idx thread index
+		 * @param finishedSemaphore semaphore to increment after binning
+		 */
+		BinLightsThread(LightClusters* lightClusters, int threadCount, int idx, Semaphore* finishedSemaphore);
+
+		// overriden methods
+		void run() override;
+	};
+
+	Renderer* renderer { nullptr };
+	vector<BinLightsThread*> binLightsThreads;
+	Semaphore binLightsFinishedSemaphore;
+	vector<int32_t> bufferObjectIds;
+	Matrix4x4 projectionMatrix;
+	Matrix4x4 projectionMatrixInverted;
+	float zNear { 0.0f };
+	float zFar { 0.0f };
+	float clusterZScale { 0.0f };
+	float clusterZBias { 0.0f };
+	vector<Vector3> clusterBoundingBoxesMin;
+	vector<Vector3> clusterBoundingBoxesMax;
+	vector<LightSphere> lightSpheres;
+	vector<vector<int32_t>> clusters;
+	vector<int32_t> droppedClusterLights;
+	vector<float> lightData;
+	vector<int32_t> clusterData;
+	vector<int32_t> lightIndexData;
+	int64_t timeStart { 0LL };
+	LightClustersStatistics statistics;
+
+	/**
+	 * Compute view space depth slice of given view depth
+	 * @param viewDepth view depth
+	 * @return cluster z
+	 */
+	inline int32_t computeClusterZ(float viewDepth) {
+		if (viewDepth <= zNear) return 0;
+		auto clusterZ = static_cast<int32_t>(Math::log(viewDepth) * clusterZScale + clusterZBias);
+		return clusterZ < 0?0:(clusterZ >= CLUSTERS_Z?CLUSTERS_Z - 1:clusterZ);
+	}
+
+	/**
+	 * Compute view space point of given normalized device coordinates x and y at given view depth
+	 * @param x normalized device coordinate x
+	 * @param y normalized device coordinate y
+	 * @param viewDepth view depth
+	 * @param point point
+	 */
+	void computeViewSpacePoint(float x, float y, float viewDepth, Vector3& point);
+
+	/**
+	 * Compute view space bounding boxes of clusters
+	 */
+	void computeClusterBoundingBoxes();
+
+	/**
+	 * Compute range of light, which is the distance at which the light does not contribute visibly anymore
+	 * @param light light
+	 * @return range or -1.0 if light has no range limit
+	 */
+	static float computeLightRange(const Light& light);
+
+public:
+	/**
+	 * Public constructor
+	 * @param renderer renderer
+	 * @param threadCount thread count to bin lights with, including calling thread of binLights()
+	 */
+	LightClusters(Renderer* renderer, int threadCount = 1);
+
+	/**
+	 * Destructor
+	 */
+	~LightClusters();
+
+	/**
+	 * Initialize buffer objects
+	 */
+	void initialize();
+
+	/**
+	 * Dispose buffer objects
+	 */
+	void dispose();
+
+	/**
+	 * Set up light data and light view space spheres, needs to be called before binLightsFunction()
+	 * 	Lights need to be enabled and need to have a position w component of 1.0, ambient color is ignored
+	 * @param projectionMatrix camera projection matrix
+	 * @param cameraMatrix camera matrix
+	 * @param zNear camera z near
+	 * @param zFar camera z far
+	 * @param lights lights
+	 */
+	void update(const Matrix4x4& projectionMatrix, const Matrix4x4& cameraMatrix, float zNear, float zFar, const vector<Light>& lights);
+
+	/**
+	 * Bin lights into clusters using bin lights threads and calling thread, needs to be called after update()
+	 */
+	void binLights();
+
+	/**
+	 * Bin lights into clusters, each thread handles depth slices with z % threadCount == threadIdx
+	 * @param threadCount thread count
+	 * @param threadIdx thread index
+	 */
+	void binLightsFunction(int threadCount, int threadIdx);
+
+	/**
+	 * Collect binned lights into cluster data and light index data
+	 */
+	void collectLights();
+
+	/**
+	 * Upload light data, cluster data and light index data to buffer objects
+	 * @param context context
+	 */
+	void upload(void* context);
+
+	/**
+	 * @return light count
+	 */
+	inline int32_t getLightCount() {
+		return lightData.size() / (LIGHT_TEXELS * 4);
+	}
+
+	/**
+	 * @return light data, which are LIGHT_TEXELS RGBA texels per light: position and range, diffuse, specular, spot direction and spot cos cut off, attenuations and spot exponent
+	 */
+	inline const vector<float>& getLightData() {
+		return lightData;
+	}
+
+	/**
+	 * @return cluster data, which are light index offset and light count per cluster, clusters are ordered by z, y and x
+	 */
+	inline const vector<int32_t>& getClusterData() {
+		return clusterData;
+	}
+
+	/**
+	 * @return light index data
+	 */
+	inline const vector<int32_t>& getLightIndexData() {
+		return lightIndexData;
+	}
+
+	/**
+	 * @return buffer object ids of light data, cluster data and light index data
+	 */
+	inline const vector<int32_t>& getBufferObjectIds() {
+		return bufferObjectIds;
+	}
+
+	/**
+	 * @return inverted projection matrix used to determine clusters
+	 */
+	inline const Matrix4x4& getProjectionMatrixInverted() {
+		return projectionMatrixInverted;
+	}
+
+	/**
+	 * @return cluster z scale, cluster z is computed by log(view depth) * cluster z scale + cluster z bias
+	 */
+	inline float getClusterZScale() {
+		return clusterZScale;
+	}
+
+	/**
+	 * @return cluster z bias, cluster z is computed by log(view depth) * cluster z scale + cluster z bias
+	 */
+	inline float getClusterZBias() {
+		return clusterZBias;
+	}
+
+	/**
+	 * Get cluster index of given normalized device coordinates and view depth
+	 * @param x normalized device coordinate x
+	 * @param y normalized device coordinate y
+	 * @param viewDepth view depth
+	 * @return cluster index
+	 */
+	int32_t getClusterIdx(float x, float y, float viewDepth);
+
+	/**
+	 * Get statistics of last update
+	 * @param statistics statistics
+	 */
+	void getStatistics(LightClustersStatistics& statistics);
+
+};
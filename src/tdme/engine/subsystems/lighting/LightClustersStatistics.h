@@ -0,0 +1,17 @@
+#pragma once
+
+#include <tdme/tdme.h>
+#include <tdme/engine/subsystems/lighting/fwd-tdme.h>
+
+/**
+ * Light clusters statistics entity
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+struct tdme::engine::subsystems::lighting::LightClustersStatistics
+{
+	int64_t lights {  };
+	int64_t clusterLights {  };
+	int64_t droppedClusterLights {  };
+	int64_t binningTime {  };
+};
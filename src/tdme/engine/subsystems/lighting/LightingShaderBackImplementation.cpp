@@ -42,7 +42,8 @@ void LightingShaderBackImplementation::initialize()
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_vertexshader.c",
-		"#define HAVE_SOLID_SHADING\n#define HAVE_BACK"
+		"#define HAVE_SOLID_SHADING\n#define HAVE_BACK" +
+		getInstanceDataDefinitions()
 	);
 	if (renderLightingVertexShaderId == 0) return;
 
@@ -4,10 +4,12 @@
 
 #include <tdme/engine/Engine.h>
 #include <tdme/engine/Timing.h>
+#include <tdme/engine/subsystems/lighting/LightClusters.h>
 #include <tdme/engine/subsystems/lighting/LightingShaderConstants.h>
 #include <tdme/engine/subsystems/renderer/Renderer_Light.h>
 #include <tdme/engine/subsystems/renderer/Renderer_SpecularMaterial.h>
 #include <tdme/engine/subsystems/renderer/Renderer.h>
+#include <tdme/engine/subsystems/rendering/Object3DRenderer.h>
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/utils/Console.h>
 
@@ -16,11 +18,13 @@ using std::string;
 
 using tdme::engine::Engine;
 using tdme::engine::Timing;
+using tdme::engine::subsystems::lighting::LightClusters;
 using tdme::engine::subsystems::lighting::LightingShaderConstants;
 using tdme::engine::subsystems::lighting::LightingShaderBaseImplementation;
 using tdme::engine::subsystems::renderer::Renderer_Light;
 using tdme::engine::subsystems::renderer::Renderer_SpecularMaterial;
 using tdme::engine::subsystems::renderer::Renderer;
+using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::math::Matrix4x4;
 using tdme::utils::Console;
 
@@ -30,6 +34,16 @@ LightingShaderBaseImplementation::LightingShaderBaseImplementation(Renderer* ren
 	initialized = false;
 }
 
+const string LightingShaderBaseImplementation::getInstanceDataDefinitions()
+{
+	return renderer->isTextureBufferObjectsAvailable() == true?"\n#define HAVE_INSTANCE_INDICES":"";
+}
+
+const string LightingShaderBaseImplementation::getClusteredLightingDefinitions()
+{
+	return renderer->isTextureBufferObjectsAvailable() == true?"\n#define HAVE_CLUSTERED_LIGHTING":"";
+}
+
 bool LightingShaderBaseImplementation::isInitialized()
 {
 	return initialized;
@@ -123,9 +137,28 @@ void LightingShaderBaseImplementation::initialize()
 		uniformLightQuadraticAttenuation[i] = renderer->getProgramUniformLocation(renderLightingProgramId, "lights[" + to_string(i) + "].quadraticAttenuation");
 	}
 
+	//	clustered lights
+	uniformClusteredLightsEnabled = renderer->getProgramUniformLocation(renderLightingProgramId, "clusteredLightsEnabled");
+	if (uniformClusteredLightsEnabled != -1) {
+		uniformClusteredLightsLightsTextureUnit = renderer->getProgramUniformLocation(renderLightingProgramId, "clusteredLightsLightsTextureUnit");
+		uniformClusteredLightsClustersTextureUnit = renderer->getProgramUniformLocation(renderLightingProgramId, "clusteredLightsClustersTextureUnit");
+		uniformClusteredLightsLightIndicesTextureUnit = renderer->getProgramUniformLocation(renderLightingProgramId, "clusteredLightsLightIndicesTextureUnit");
+		uniformClusteredLightsProjectionMatrixInverted = renderer->getProgramUniformLocation(renderLightingProgramId, "clusteredLightsProjectionMatrixInverted");
+		uniformClusteredLightsClusterZ = renderer->getProgramUniformLocation(renderLightingProgramId, "clusteredLightsClusterZ");
+		uniformClusteredLightsViewPortSizeInverted = renderer->getProgramUniformLocation(renderLightingProgramId, "clusteredLightsViewPortSizeInverted");
+	}
+
 	// use foliage animation
 	uniformTime = renderer->getProgramUniformLocation(renderLightingProgramId, "time");
 
+	// instance data fetched by instance indices
+	if (renderer->isTextureBufferObjectsAvailable() == true) {
+		uniformInstanceDataTextureUnit = renderer->getProgramUniformLocation(renderLightingProgramId, "instanceDataTextureUnit");
+		if (uniformInstanceDataTextureUnit == -1) return;
+		uniformInstanceIndicesTextureUnit = renderer->getProgramUniformLocation(renderLightingProgramId, "instanceIndicesTextureUnit");
+		if (uniformInstanceIndicesTextureUnit == -1) return;
+	}
+
 	//
 	initialized = true;
 }
@@ -134,6 +167,8 @@ void LightingShaderBaseImplementation::useProgram(Engine* engine, void* context)
 {
 	renderer->useProgram(context, renderLightingProgramId);
 	renderer->setLighting(context, renderer->LIGHTING_SPECULAR);
+	if (uniformInstanceDataTextureUnit != -1) renderer->setProgramUniformInteger(context, uniformInstanceDataTextureUnit, Object3DRenderer::TEXTUREUNIT_INSTANCEDATA);
+	if (uniformInstanceIndicesTextureUnit != -1) renderer->setProgramUniformInteger(context, uniformInstanceIndicesTextureUnit, Object3DRenderer::TEXTUREUNIT_INSTANCEINDICES);
 	// initialize static uniforms
 	if (renderer->isInstancedRenderingAvailable() == true) {
 		renderer->setProgramUniformFloatMatrix4x4(context, uniformProjectionMatrix, renderer->getProjectionMatrix().getArray());
@@ -154,6 +189,32 @@ void LightingShaderBaseImplementation::useProgram(Engine* engine, void* context)
 	for (auto i = 0; i < Engine::LIGHTS_MAX; i++) {
 		updateLight(renderer, context, i);
 	}
+	// clustered lights
+	if (uniformClusteredLightsEnabled != -1) {
+		auto lightClusters = engine->lightClusters;
+		if (lightClusters != nullptr && engine->clusteredLights.empty() == false && lightClusters->getLightCount() > 0) {
+			auto& bufferObjectIds = lightClusters->getBufferObjectIds();
+			renderer->setProgramUniformInteger(context, uniformClusteredLightsEnabled, 1);
+			renderer->setProgramUniformInteger(context, uniformClusteredLightsLightsTextureUnit, LightingShaderConstants::SPECULAR_TEXTUREUNIT_CLUSTEREDLIGHTS_LIGHTS);
+			renderer->setProgramUniformInteger(context, uniformClusteredLightsClustersTextureUnit, LightingShaderConstants::SPECULAR_TEXTUREUNIT_CLUSTEREDLIGHTS_CLUSTERS);
+			renderer->setProgramUniformInteger(context, uniformClusteredLightsLightIndicesTextureUnit, LightingShaderConstants::SPECULAR_TEXTUREUNIT_CLUSTEREDLIGHTS_LIGHTINDICES);
+			renderer->setProgramUniformFloatMatrix4x4(context, uniformClusteredLightsProjectionMatrixInverted, lightClusters->getProjectionMatrixInverted().getArray());
+			renderer->setProgramUniformFloatVec2(context, uniformClusteredLightsClusterZ, {{ lightClusters->getClusterZScale(), lightClusters->getClusterZBias() }});
+			renderer->setProgramUniformFloatVec2(
+				context,
+				uniformClusteredLightsViewPortSizeInverted,
+				{{
+					1.0f / static_cast<float>(engine->getWidth()),
+					1.0f / static_cast<float>(engine->getHeight())
+				}}
+			);
+			renderer->bindTextureBufferObject(context, LightingShaderConstants::SPECULAR_TEXTUREUNIT_CLUSTEREDLIGHTS_LIGHTS, bufferObjectIds[0], false, 4);
+			renderer->bindTextureBufferObject(context, LightingShaderConstants::SPECULAR_TEXTUREUNIT_CLUSTEREDLIGHTS_CLUSTERS, bufferObjectIds[1], true, 2);
+			renderer->bindTextureBufferObject(context, LightingShaderConstants::SPECULAR_TEXTUREUNIT_CLUSTEREDLIGHTS_LIGHTINDICES, bufferObjectIds[2], true, 1);
+		} else {
+			renderer->setProgramUniformInteger(context, uniformClusteredLightsEnabled, 0);
+		}
+	}
 	// frame
 	if (uniformTime != -1) renderer->setProgramUniformFloat(context, uniformTime, static_cast<float>(engine->getTiming()->getTotalTime()) / 1000.0f);
 }
@@ -1,6 +1,7 @@
 #pragma once
 
 #include <array>
+#include <string>
 
 #include <tdme/tdme.h>
 #include <tdme/engine/fwd-tdme.h>
@@ -13,6 +14,7 @@
 #include <tdme/math/Matrix4x4.h>
 
 using std::array;
+using std::string;
 
 using tdme::engine::Engine;
 using tdme::engine::subsystems::lighting::LightingShaderConstants;
@@ -66,9 +68,29 @@ protected:
 	array<int32_t, Engine::LIGHTS_MAX> uniformLightConstantAttenuation;
 	array<int32_t, Engine::LIGHTS_MAX> uniformLightLinearAttenuation;
 	array<int32_t, Engine::LIGHTS_MAX> uniformLightQuadraticAttenuation;
+	int32_t uniformClusteredLightsEnabled { -1 };
+	int32_t uniformClusteredLightsLightsTextureUnit { -1 };
+	int32_t uniformClusteredLightsClustersTextureUnit { -1 };
+	int32_t uniformClusteredLightsLightIndicesTextureUnit { -1 };
+	int32_t uniformClusteredLightsProjectionMatrixInverted { -1 };
+	int32_t uniformClusteredLightsClusterZ { -1 };
+	int32_t uniformClusteredLightsViewPortSizeInverted { -1 };
+	int32_t uniformInstanceDataTextureUnit { -1 };
+	int32_t uniformInstanceIndicesTextureUnit { -1 };
 	array<float, 4> defaultSceneColor {{ 0.0f, 0.0f, 0.0f, 0.0f }};
 	bool initialized { false };
 	Renderer* renderer { nullptr };
+
+	/**
+	 * @return fragment shader definitions to enable clustered lighting if supported by renderer
+	 */
+	const string getClusteredLightingDefinitions();
+
+	/**
+	 * @return vertex shader definitions to fetch instance data by instance indices if supported by renderer
+	 */
+	const string getInstanceDataDefinitions();
+
 public:
 
 	// overriden methods
@@ -16,6 +16,9 @@ struct tdme::engine::subsystems::lighting::LightingShaderConstants final
 	static constexpr int32_t SPECULAR_TEXTUREUNIT_TERRAIN_DIRT { 5 };
 	static constexpr int32_t SPECULAR_TEXTUREUNIT_TERRAIN_STONE { 6 };
 	static constexpr int32_t SPECULAR_TEXTUREUNIT_TERRAIN_SNOW { 7 };
+	static constexpr int32_t SPECULAR_TEXTUREUNIT_CLUSTEREDLIGHTS_LIGHTS { 8 };
+	static constexpr int32_t SPECULAR_TEXTUREUNIT_CLUSTEREDLIGHTS_CLUSTERS { 9 };
+	static constexpr int32_t SPECULAR_TEXTUREUNIT_CLUSTEREDLIGHTS_LIGHTINDICES { 10 };
 
 	static constexpr int32_t PBR_TEXTUREUNIT_BASECOLOR { 0 };
 	static constexpr int32_t PBR_TEXTUREUNIT_METALLICROUGHNESS { 1 };
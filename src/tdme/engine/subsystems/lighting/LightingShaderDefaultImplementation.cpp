@@ -33,7 +33,8 @@ void LightingShaderDefaultImplementation::initialize()
 		renderer->SHADER_FRAGMENT_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_fragmentshader.c",
-		"#define HAVE_DEPTH_FOG"
+		"#define HAVE_DEPTH_FOG" +
+		getClusteredLightingDefinitions()
 	);
 	if (renderLightingFragmentShaderId == 0) return;
 
@@ -42,7 +43,8 @@ void LightingShaderDefaultImplementation::initialize()
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_vertexshader.c",
-		"#define HAVE_DEPTH_FOG"
+		"#define HAVE_DEPTH_FOG" +
+		getInstanceDataDefinitions()
 	);
 	if (renderLightingVertexShaderId == 0) return;
 
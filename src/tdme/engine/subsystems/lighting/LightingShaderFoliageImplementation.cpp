@@ -34,7 +34,8 @@ void LightingShaderFoliageImplementation::initialize()
 		renderer->SHADER_FRAGMENT_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_fragmentshader.c",
-		"#define HAVE_DEPTH_FOG"
+		"#define HAVE_DEPTH_FOG" +
+		getClusteredLightingDefinitions()
 	);
 	if (renderLightingFragmentShaderId == 0) return;
 
@@ -43,7 +44,8 @@ void LightingShaderFoliageImplementation::initialize()
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_vertexshader.c",
-		"#define HAVE_FOLIAGE\n#define HAVE_DEPTH_FOG",
+		"#define HAVE_FOLIAGE\n#define HAVE_DEPTH_FOG" +
+		getInstanceDataDefinitions(),
 		FileSystem::getInstance()->getContentAsString(
 			"shader/" + shaderVersion + "/functions",
 			"create_rotation_matrix.inc.c"
@@ -42,7 +42,8 @@ void LightingShaderFrontImplementation::initialize()
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_vertexshader.c",
-		"#define HAVE_SOLID_SHADING\n#define HAVE_FRONT"
+		"#define HAVE_SOLID_SHADING\n#define HAVE_FRONT" +
+		getInstanceDataDefinitions()
 	);
 	if (renderLightingVertexShaderId == 0) return;
 
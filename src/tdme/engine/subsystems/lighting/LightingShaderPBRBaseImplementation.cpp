@@ -7,6 +7,7 @@
 #include <tdme/engine/subsystems/lighting/LightingShaderConstants.h>
 #include <tdme/engine/subsystems/renderer/Renderer_Light.h>
 #include <tdme/engine/subsystems/renderer/Renderer.h>
+#include <tdme/engine/subsystems/rendering/Object3DRenderer.h>
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/math/Vector3.h>
 #include <tdme/utils/Console.h>
@@ -20,6 +21,7 @@ using tdme::engine::subsystems::lighting::LightingShaderConstants;
 using tdme::engine::subsystems::lighting::LightingShaderPBRBaseImplementation;
 using tdme::engine::subsystems::renderer::Renderer_Light;
 using tdme::engine::subsystems::renderer::Renderer;
+using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
 using tdme::utils::Console;
@@ -30,6 +32,11 @@ LightingShaderPBRBaseImplementation::LightingShaderPBRBaseImplementation(Rendere
 	initialized = false;
 }
 
+const string LightingShaderPBRBaseImplementation::getInstanceDataDefinitions()
+{
+	return renderer->isTextureBufferObjectsAvailable() == true?"\n#define HAVE_INSTANCE_INDICES":"";
+}
+
 bool LightingShaderPBRBaseImplementation::isInitialized()
 {
 	return initialized;
@@ -89,6 +96,14 @@ void LightingShaderPBRBaseImplementation::initialize()
 		if (uniformLightType[i] == -1) return;
 	}
 
+	// instance data fetched by instance indices
+	if (renderer->isTextureBufferObjectsAvailable() == true) {
+		uniformInstanceDataTextureUnit = renderer->getProgramUniformLocation(renderLightingProgramId, "instanceDataTextureUnit");
+		if (uniformInstanceDataTextureUnit == -1) return;
+		uniformInstanceIndicesTextureUnit = renderer->getProgramUniformLocation(renderLightingProgramId, "instanceIndicesTextureUnit");
+		if (uniformInstanceIndicesTextureUnit == -1) return;
+	}
+
 	//
 	initialized = true;
 }
@@ -97,6 +112,8 @@ void LightingShaderPBRBaseImplementation::useProgram(Engine* engine, void* conte
 {
 	renderer->useProgram(context, renderLightingProgramId);
 	renderer->setLighting(context, renderer->LIGHTING_PBR);
+	if (uniformInstanceDataTextureUnit != -1) renderer->setProgramUniformInteger(context, uniformInstanceDataTextureUnit, Object3DRenderer::TEXTUREUNIT_INSTANCEDATA);
+	if (uniformInstanceIndicesTextureUnit != -1) renderer->setProgramUniformInteger(context, uniformInstanceIndicesTextureUnit, Object3DRenderer::TEXTUREUNIT_INSTANCEINDICES);
 	renderer->setProgramUniformFloatVec4(context, uniformBaseColorFactor, {{ 1.0f, 1.0f, 1.0f, 1.0f }});
 	renderer->setProgramUniformInteger(context, uniformBaseColorSampler, LightingShaderConstants::PBR_TEXTUREUNIT_BASECOLOR);
 	renderer->setProgramUniformFloat(context, uniformExposure, 1.0f);
@@ -44,6 +44,8 @@ protected:
 	int32_t uniformNormalScale { -1 };
 	int32_t uniformRoughnessFactor { -1 };
 	int32_t uniformViewProjectionMatrix { -1 };
+	int32_t uniformInstanceDataTextureUnit { -1 };
+	int32_t uniformInstanceIndicesTextureUnit { -1 };
 	array<int32_t, Engine::LIGHTS_MAX> uniformLightEnabled;
 	array<int32_t, Engine::LIGHTS_MAX> uniformLightDirection;
 	array<int32_t, Engine::LIGHTS_MAX> uniformLightRange;
@@ -56,6 +58,11 @@ protected:
 
 	bool initialized { false };
 	Renderer* renderer { nullptr };
+	/**
+	 * @return vertex shader definitions to fetch instance data by instance indices if supported by renderer
+	 */
+	const string getInstanceDataDefinitions();
+
 public:
 
 	// overriden methods
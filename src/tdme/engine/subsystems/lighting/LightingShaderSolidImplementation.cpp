@@ -42,7 +42,8 @@ void LightingShaderSolidImplementation::initialize()
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_vertexshader.c",
-		"#define HAVE_SOLID_SHADING"
+		"#define HAVE_SOLID_SHADING" +
+		getInstanceDataDefinitions()
 	);
 	if (renderLightingVertexShaderId == 0) return;
 
@@ -44,7 +44,8 @@ void LightingShaderTerrainImplementation::initialize()
 		renderer->SHADER_FRAGMENT_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_fragmentshader.c",
-		"#define HAVE_TERRAIN_SHADER\n#define HAVE_DEPTH_FOG"
+		"#define HAVE_TERRAIN_SHADER\n#define HAVE_DEPTH_FOG" +
+		getClusteredLightingDefinitions()
 	);
 	if (renderLightingFragmentShaderId == 0) return;
 
@@ -53,7 +54,8 @@ void LightingShaderTerrainImplementation::initialize()
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_vertexshader.c",
-		"#define HAVE_TERRAIN_SHADER\n#define HAVE_DEPTH_FOG"
+		"#define HAVE_TERRAIN_SHADER\n#define HAVE_DEPTH_FOG" +
+		getInstanceDataDefinitions()
 	);
 	if (renderLightingVertexShaderId == 0) return;
 
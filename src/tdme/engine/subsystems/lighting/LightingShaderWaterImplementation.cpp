@@ -41,7 +41,8 @@ void LightingShaderWaterImplementation::initialize()
 		renderer->SHADER_FRAGMENT_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_fragmentshader.c",
-		"#define HAVE_WATER_SHADER\n#define HAVE_DEPTH_FOG"
+		"#define HAVE_WATER_SHADER\n#define HAVE_DEPTH_FOG" +
+		getClusteredLightingDefinitions()
 	);
 	if (renderLightingFragmentShaderId == 0) return;
 
@@ -50,7 +51,8 @@ void LightingShaderWaterImplementation::initialize()
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/lighting/specular",
 		"render_vertexshader.c",
-		"#define HAVE_WATER_SHADER\n#define HAVE_DEPTH_FOG",
+		"#define HAVE_WATER_SHADER\n#define HAVE_DEPTH_FOG" +
+		getInstanceDataDefinitions(),
 		FileSystem::getInstance()->getContentAsString(
 			"shader/" + shaderVersion + "/functions",
 			"render_water.inc.c"
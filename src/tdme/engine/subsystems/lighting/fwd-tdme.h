@@ -20,6 +20,8 @@ namespace lighting {
 	class LightingShaderTerrainImplementation;
 	class LightingShaderTreeImplementation;
 	class LightingShaderWaterImplementation;
+	class LightClusters;
+	struct LightClustersStatistics;
 }  // namespace lighting
 }  // namespace subsystems
 }  // namespace engine
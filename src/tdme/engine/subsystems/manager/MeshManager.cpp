@@ -3,15 +3,21 @@
 #include <map>
 #include <string>
 
+#include <tdme/engine/model/Group.h>
+#include <tdme/engine/model/Model.h>
 #include <tdme/engine/subsystems/manager/MeshManager_MeshManaged.h>
+#include <tdme/engine/subsystems/rendering/ModelMemoryStatistics.h>
 #include <tdme/engine/subsystems/rendering/Object3DGroupMesh.h>
 #include <tdme/utils/Console.h>
 
 using std::map;
 using std::string;
 
+using tdme::engine::model::Group;
+using tdme::engine::model::Model;
 using tdme::engine::subsystems::manager::MeshManager;
 using tdme::engine::subsystems::manager::MeshManager_MeshManaged;
+using tdme::engine::subsystems::rendering::ModelMemoryStatistics;
 using tdme::engine::subsystems::rendering::Object3DGroupMesh;
 using tdme::utils::Console;
 
@@ -21,6 +27,7 @@ MeshManager::MeshManager()
 
 MeshManager::~MeshManager() {
 	for (auto it = meshes.begin(); it != meshes.end(); ++it) {
+		delete it->second->getMesh();
 		delete it->second;
 	}
 }
@@ -55,9 +62,24 @@ void MeshManager::removeMesh(const string& meshId)
 		if (meshManaged->decrementReferenceCounter()) {
 			// remove from our list
 			meshes.erase(meshManagedIt);
+			delete meshManaged->getMesh();
 			delete meshManaged;
 		}
 		return;
 	}
 	Console::println(string("Warning: mesh not managed by mesh manager: " + meshId));
 }
+
+void MeshManager::computeMemoryStatistics(map<string, ModelMemoryStatistics>& modelMemoryStatistics)
+{
+	for (auto it: meshes) {
+		auto meshManaged = it.second;
+		auto mesh = meshManaged->getMesh();
+		auto& statistics = modelMemoryStatistics[mesh->group->getModel()->getId()];
+		auto meshMemoryUsage = mesh->computeMemoryUsage();
+		statistics.meshCount++;
+		statistics.meshReferenceCount+= meshManaged->getReferenceCounter();
+		statistics.meshMemoryUsage+= meshMemoryUsage;
+		statistics.meshMemoryUsageUnshared+= meshMemoryUsage * meshManaged->getReferenceCounter();
+	}
+}
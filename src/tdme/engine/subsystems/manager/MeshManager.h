@@ -11,10 +11,11 @@ using std::map;
 using std::string;
 
 using tdme::engine::subsystems::manager::MeshManager_MeshManaged;
+using tdme::engine::subsystems::rendering::ModelMemoryStatistics;
 using tdme::engine::subsystems::rendering::Object3DGroupMesh;
 
 /** 
- * Mesh manager
+ * Mesh manager, which shares meshes between object 3d instances of the same model
  * @author Andreas Drewke
  * @version $Id$
  */
@@ -45,6 +46,12 @@ public:
 	 */
 	void removeMesh(const string& meshId);
 
+	/**
+	 * Compute memory statistics of managed meshes by model id
+	 * @param modelMemoryStatistics model memory statistics by model id
+	 */
+	void computeMemoryStatistics(map<string, ModelMemoryStatistics>& modelMemoryStatistics);
+
 	/**
 	 * Public constructor
 	 */
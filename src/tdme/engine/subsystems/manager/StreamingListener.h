@@ -0,0 +1,58 @@
+#pragma once
+
+#include <string>
+#include <vector>
+
+#include <tdme/tdme.h>
+#include <tdme/engine/fileio/textures/fwd-tdme.h>
+#include <tdme/engine/model/fwd-tdme.h>
+#include <tdme/engine/subsystems/manager/fwd-tdme.h>
+
+using std::string;
+using std::vector;
+
+using tdme::engine::fileio::textures::Texture;
+using tdme::engine::model::Model;
+
+/**
+ * Streaming listener, which gets notified about finished streaming requests on main thread
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+struct tdme::engine::subsystems::manager::StreamingListener
+{
+
+	/**
+	 * Destructor
+	 */
+	virtual ~StreamingListener() {}
+
+	/**
+	 * Event fired when a model has been streamed
+	 * @param requestId request id
+	 * @param model model, which is shared between deduplicated requests and owned by application
+	 */
+	virtual void onModelStreamed(int64_t requestId, Model* model) {}
+
+	/**
+	 * Event fired when a texture has been streamed
+	 * @param requestId request id
+	 * @param texture texture, with a reference acquired for this request
+	 */
+	virtual void onTextureStreamed(int64_t requestId, Texture* texture) {}
+
+	/**
+	 * Event fired when file content has been streamed
+	 * @param requestId request id
+	 * @param content content
+	 */
+	virtual void onContentStreamed(int64_t requestId, const vector<uint8_t>& content) {}
+
+	/**
+	 * Event fired when a request failed
+	 * @param requestId request id
+	 * @param error error message
+	 */
+	virtual void onStreamingFailed(int64_t requestId, const string& error) = 0;
+
+};
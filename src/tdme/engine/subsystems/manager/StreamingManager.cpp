@@ -0,0 +1,403 @@
+#include <tdme/engine/subsystems/manager/StreamingManager.h>
+
+#include <algorithm>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <tdme/engine/Engine.h>
+#include <tdme/engine/Entity.h>
+#include <tdme/engine/Object3D.h>
+#include <tdme/engine/Transformations.h>
+#include <tdme/engine/fileio/models/TMReader.h>
+#include <tdme/engine/fileio/textures/Texture.h>
+#include <tdme/engine/fileio/textures/TextureReader.h>
+#include <tdme/engine/model/Model.h>
+#include <tdme/engine/subsystems/manager/StreamingListener.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/os/filesystem/FileSystem.h>
+#include <tdme/os/filesystem/FileSystemInterface.h>
+#include <tdme/os/threading/Thread.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/Exception.h>
+
+using std::find;
+using std::map;
+using std::string;
+using std::to_string;
+using std::unordered_map;
+using std::vector;
+
+using tdme::engine::subsystems::manager::StreamingManager;
+using tdme::engine::Engine;
+using tdme::engine::Entity;
+using tdme::engine::Object3D;
+using tdme::engine::Transformations;
+using tdme::engine::fileio::models::TMReader;
+using tdme::engine::fileio::textures::Texture;
+using tdme::engine::fileio::textures::TextureReader;
+using tdme::engine::model::Model;
+using tdme::engine::subsystems::manager::StreamingListener;
+using tdme::math::Vector3;
+using tdme::os::filesystem::FileSystem;
+using tdme::os::filesystem::FileSystemInterface;
+using tdme::os::threading::Thread;
+using tdme::utils::Console;
+using tdme::utils::Exception;
+
+StreamingManager::IOThread::IOThread(StreamingManager* streamingManager): Thread("streamingmanager-iothread"), streamingManager(streamingManager) {
+}
+
+void StreamingManager::IOThread::run() {
+	Request* request = nullptr;
+	while ((request = streamingManager->getNextQueuedRequest(this)) != nullptr) {
+		streamingManager->load(request);
+	}
+}
+
+StreamingManager::DecodeThread::DecodeThread(StreamingManager* streamingManager): Thread("streamingmanager-decodethread"), streamingManager(streamingManager) {
+}
+
+void StreamingManager::DecodeThread::run() {
+	Request* request = nullptr;
+	while ((request = streamingManager->decodeQueue.getElement()) != nullptr) {
+		streamingManager->decode(request);
+	}
+}
+
+StreamingManager::Object3DPlaceholderListener::Object3DPlaceholderListener(Engine* engine, const string& id, Object3D* placeholder, const Transformations& transformations):
+	engine(engine),
+	id(id),
+	placeholder(placeholder) {
+	this->transformations.fromTransformations(transformations);
+}
+
+void StreamingManager::Object3DPlaceholderListener::onModelStreamed(int64_t requestId, Model* model) {
+	// check if placeholder is still in use, otherwise it has been removed or replaced in the meantime
+	auto entity = engine->getEntity(id);
+	if (entity != placeholder) return;
+
+	// replace placeholder
+	auto object = new Object3D(id, model);
+	object->fromTransformations(placeholder != nullptr?placeholder->getTransformations():transformations);
+	if (placeholder != nullptr) {
+		object->setEnabled(placeholder->isEnabled());
+		object->setPickable(placeholder->isPickable());
+		object->setContributesShadows(placeholder->isContributesShadows());
+		object->setReceivesShadows(placeholder->isReceivesShadows());
+		object->setEffectColorMul(placeholder->getEffectColorMul());
+		object->setEffectColorAdd(placeholder->getEffectColorAdd());
+	}
+	engine->addEntity(object);
+}
+
+void StreamingManager::Object3DPlaceholderListener::onStreamingFailed(int64_t requestId, const string& error) {
+	Console::println("StreamingManager::Object3DPlaceholderListener::onStreamingFailed(): " + id + ": " + error);
+}
+
+StreamingManager::StreamingManager(int ioThreadCount, int decodeThreadCount):
+	ioThreadCount(ioThreadCount),
+	decodeThreadCount(decodeThreadCount),
+	mutex("streamingmanager-mutex"),
+	ioCondition("streamingmanager-iocondition"),
+	decodeQueue(0) {
+}
+
+StreamingManager::~StreamingManager() {
+	shutdown();
+	for (auto& it: requestsByKey) dispose(it.second);
+	for (auto& it: placeholderListeners) delete it.second;
+	for (auto& it: managedModels) delete it.second;
+}
+
+void StreamingManager::start() {
+	if (ioThreads.empty() == false || decodeThreads.empty() == false) return;
+	for (auto i = 0; i < ioThreadCount; i++) {
+		auto thread = new IOThread(this);
+		thread->start();
+		ioThreads.push_back(thread);
+	}
+	for (auto i = 0; i < decodeThreadCount; i++) {
+		auto thread = new DecodeThread(this);
+		thread->start();
+		decodeThreads.push_back(thread);
+	}
+}
+
+void StreamingManager::shutdown() {
+	// stop I/O threads, stop needs to be requested while holding the mutex to not miss the wake up
+	mutex.lock();
+	for (auto thread: ioThreads) thread->stop();
+	ioCondition.broadcast();
+	mutex.unlock();
+	for (auto thread: ioThreads) {
+		thread->join();
+		delete thread;
+	}
+	ioThreads.clear();
+
+	// stop decode threads, they will finish already queued requests
+	decodeQueue.stop();
+	for (auto thread: decodeThreads) {
+		thread->join();
+		delete thread;
+	}
+	decodeThreads.clear();
+}
+
+void StreamingManager::setCameraPosition(const Vector3& cameraPosition) {
+	mutex.lock();
+	this->cameraPosition.set(cameraPosition);
+	mutex.unlock();
+}
+
+int64_t StreamingManager::addRequest(RequestType type, const string& pathName, const string& fileName, const Vector3& position, StreamingListener* listener, bool managed) {
+	auto canonicalFile = FileSystem::getInstance()->getCanonicalPath(pathName, fileName);
+	auto key = (managed == true?"managed:":"") + to_string(type) + ":" + canonicalFile;
+
+	mutex.lock();
+	auto requestId = requestIdx++;
+	Request* request = nullptr;
+	auto requestIt = requestsByKey.find(key);
+	if (requestIt != requestsByKey.end()) {
+		// deduplicate with in-flight request
+		request = requestIt->second;
+	} else {
+		request = new Request();
+		request->type = type;
+		request->key = key;
+		request->pathName = FileSystem::getInstance()->getPathName(canonicalFile);
+		request->fileName = FileSystem::getInstance()->getFileName(canonicalFile);
+		request->managed = managed;
+		request->state = REQUESTSTATE_QUEUED;
+		request->model = nullptr;
+		request->texture = nullptr;
+		requestsByKey[key] = request;
+		queuedRequests.push_back(request);
+		ioCondition.signal();
+	}
+	request->tickets.push_back({requestId, listener, position});
+	requestsById[requestId] = request;
+	mutex.unlock();
+
+	return requestId;
+}
+
+int64_t StreamingManager::requestObject3D(Engine* engine, const string& id, Model* placeholderModel, const string& pathName, const string& fileName, const Transformations& transformations) {
+	// do we have this model already
+	auto managedModelIt = managedModels.find(FileSystem::getInstance()->getCanonicalPath(pathName, fileName));
+	if (managedModelIt != managedModels.end()) {
+		auto object = new Object3D(id, managedModelIt->second);
+		object->fromTransformations(transformations);
+		engine->addEntity(object);
+		return -1LL;
+	}
+
+	// nope, add placeholder and stream model
+	Object3D* placeholder = nullptr;
+	if (placeholderModel != nullptr) {
+		placeholder = new Object3D(id, placeholderModel);
+		placeholder->fromTransformations(transformations);
+		engine->addEntity(placeholder);
+	}
+	auto listener = new Object3DPlaceholderListener(engine, id, placeholder, transformations);
+	auto requestId = addRequest(REQUESTTYPE_MODEL, pathName, fileName, transformations.getTranslation(), listener, true);
+	placeholderListeners[requestId] = listener;
+	return requestId;
+}
+
+bool StreamingManager::cancel(int64_t requestId) {
+	mutex.lock();
+	auto requestIt = requestsById.find(requestId);
+	if (requestIt == requestsById.end()) {
+		mutex.unlock();
+		return false;
+	}
+	auto request = requestIt->second;
+	requestsById.erase(requestIt);
+	for (auto i = 0; i < request->tickets.size(); i++) {
+		if (request->tickets[i].requestId == requestId) {
+			request->tickets.erase(request->tickets.begin() + i);
+			break;
+		}
+	}
+	// if request is still queued and has no tickets left we can remove it right away,
+	// otherwise I/O or decode threads will dispose it when done
+	if (request->tickets.empty() == true && request->state == REQUESTSTATE_QUEUED) {
+		queuedRequests.erase(find(queuedRequests.begin(), queuedRequests.end(), request));
+		requestsByKey.erase(request->key);
+		delete request;
+	}
+	mutex.unlock();
+
+	// remove placeholder listener if any
+	auto placeholderListenerIt = placeholderListeners.find(requestId);
+	if (placeholderListenerIt != placeholderListeners.end()) {
+		delete placeholderListenerIt->second;
+		placeholderListeners.erase(placeholderListenerIt);
+	}
+
+	return true;
+}
+
+int StreamingManager::getRequestCount() {
+	mutex.lock();
+	auto requestCount = requestsByKey.size();
+	mutex.unlock();
+	return requestCount;
+}
+
+StreamingManager::Request* StreamingManager::getNextQueuedRequest(Thread* thread) {
+	mutex.lock();
+	while (queuedRequests.empty() == true && thread->isStopRequested() == false) ioCondition.wait(mutex);
+	if (thread->isStopRequested() == true) {
+		mutex.unlock();
+		return nullptr;
+	}
+	// pick request with smallest distance to camera of any of its tickets
+	auto requestIdx = -1;
+	auto requestDistanceSquared = 0.0f;
+	for (auto i = 0; i < queuedRequests.size(); i++) {
+		for (auto& ticket: queuedRequests[i]->tickets) {
+			auto distanceSquared = ticket.position.clone().sub(cameraPosition).computeLengthSquared();
+			if (requestIdx == -1 || distanceSquared < requestDistanceSquared) {
+				requestIdx = i;
+				requestDistanceSquared = distanceSquared;
+			}
+		}
+	}
+	auto request = queuedRequests[requestIdx];
+	queuedRequests.erase(queuedRequests.begin() + requestIdx);
+	request->state = REQUESTSTATE_LOADING;
+	mutex.unlock();
+	return request;
+}
+
+void StreamingManager::load(Request* request) {
+	try {
+		FileSystem::getInstance()->getContent(request->pathName, request->fileName, request->content);
+	} catch (Exception& exception) {
+		request->error = string(exception.what());
+	}
+
+	// raw content or failed requests are done, others need to get decoded
+	if (request->type == REQUESTTYPE_CONTENT || request->error.empty() == false) {
+		finish(request);
+		return;
+	}
+	mutex.lock();
+	auto cancelled = request->tickets.empty();
+	if (cancelled == true) {
+		requestsByKey.erase(request->key);
+	} else {
+		request->state = REQUESTSTATE_DECODING;
+	}
+	mutex.unlock();
+	if (cancelled == true) {
+		dispose(request);
+	} else {
+		decodeQueue.addElement(request, false);
+	}
+}
+
+void StreamingManager::decode(Request* request) {
+	try {
+		switch (request->type) {
+			case REQUESTTYPE_MODEL:
+				request->model = TMReader::read(request->content, request->pathName, request->fileName);
+				break;
+			case REQUESTTYPE_TEXTURE:
+				request->texture = TextureReader::read(request->content, request->pathName, request->fileName);
+				if (request->texture == nullptr) request->error = "Could not decode texture";
+				break;
+			default:
+				break;
+		}
+	} catch (Exception& exception) {
+		request->error = string(exception.what());
+	}
+	request->content.clear();
+	request->content.shrink_to_fit();
+	finish(request);
+}
+
+void StreamingManager::finish(Request* request) {
+	mutex.lock();
+	auto cancelled = request->tickets.empty();
+	if (cancelled == true) {
+		requestsByKey.erase(request->key);
+	} else {
+		request->state = REQUESTSTATE_FINISHED;
+		finishedRequests.push_back(request);
+	}
+	mutex.unlock();
+	if (cancelled == true) dispose(request);
+}
+
+void StreamingManager::dispose(Request* request) {
+	if (request->model != nullptr) delete request->model;
+	if (request->texture != nullptr) request->texture->releaseReference();
+	delete request;
+}
+
+int StreamingManager::processCompletions() {
+	// fetch finished requests
+	mutex.lock();
+	if (finishedRequests.empty() == true) {
+		mutex.unlock();
+		return 0;
+	}
+	auto requests = finishedRequests;
+	finishedRequests.clear();
+	for (auto request: requests) {
+		requestsByKey.erase(request->key);
+		for (auto& ticket: request->tickets) requestsById.erase(ticket.requestId);
+	}
+	mutex.unlock();
+
+	// notify listeners
+	for (auto request: requests) {
+		// all tickets cancelled in the meantime
+		if (request->tickets.empty() == true) {
+			dispose(request);
+			continue;
+		}
+
+		// take over ownership of managed models
+		if (request->managed == true && request->model != nullptr) {
+			managedModels[FileSystem::getInstance()->getCanonicalPath(request->pathName, request->fileName)] = request->model;
+		}
+
+		//
+		for (auto i = 0; i < request->tickets.size(); i++) {
+			auto& ticket = request->tickets[i];
+			if (request->error.empty() == false) {
+				ticket.listener->onStreamingFailed(ticket.requestId, request->error);
+			} else {
+				switch (request->type) {
+					case REQUESTTYPE_MODEL:
+						ticket.listener->onModelStreamed(ticket.requestId, request->model);
+						break;
+					case REQUESTTYPE_TEXTURE:
+						// decoding acquired one reference, acquire additional ones for deduplicated requests
+						if (i > 0) request->texture->acquireReference();
+						ticket.listener->onTextureStreamed(ticket.requestId, request->texture);
+						break;
+					case REQUESTTYPE_CONTENT:
+						ticket.listener->onContentStreamed(ticket.requestId, request->content);
+						break;
+				}
+			}
+			auto placeholderListenerIt = placeholderListeners.find(ticket.requestId);
+			if (placeholderListenerIt != placeholderListeners.end()) {
+				delete placeholderListenerIt->second;
+				placeholderListeners.erase(placeholderListenerIt);
+			}
+		}
+		delete request;
+	}
+
+	//
+	return requests.size();
+}
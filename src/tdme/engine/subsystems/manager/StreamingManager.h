@@ -0,0 +1,299 @@
+#pragma once
+
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include <tdme/tdme.h>
+#include <tdme/engine/fwd-tdme.h>
+#include <tdme/engine/Transformations.h>
+#include <tdme/engine/fileio/textures/fwd-tdme.h>
+#include <tdme/engine/model/fwd-tdme.h>
+#include <tdme/engine/subsystems/manager/fwd-tdme.h>
+#include <tdme/engine/subsystems/manager/StreamingListener.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/os/threading/Condition.h>
+#include <tdme/os/threading/Mutex.h>
+#include <tdme/os/threading/Queue.h>
+#include <tdme/os/threading/Thread.h>
+
+using std::map;
+using std::string;
+using std::unordered_map;
+using std::vector;
+
+using tdme::engine::Engine;
+using tdme::engine::Object3D;
+using tdme::engine::Transformations;
+using tdme::engine::fileio::textures::Texture;
+using tdme::engine::model::Model;
+using tdme::engine::subsystems::manager::StreamingListener;
+using tdme::math::Vector3;
+using tdme::os::threading::Condition;
+using tdme::os::threading::Mutex;
+using tdme::os::threading::Queue;
+using tdme::os::threading::Thread;
+
+/**
+ * Streaming manager, which loads and decodes models, textures and raw file content asynchronously
+ * 	I/O threads fetch file content in order of distance to camera, decode threads decode it,
+ * 	and listeners get notified on main thread when calling processCompletions()
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::engine::subsystems::manager::StreamingManager final
+{
+public:
+	enum RequestType { REQUESTTYPE_MODEL, REQUESTTYPE_TEXTURE, REQUESTTYPE_CONTENT };
+
+private:
+	enum RequestState { REQUESTSTATE_QUEUED, REQUESTSTATE_LOADING, REQUESTSTATE_DECODING, REQUESTSTATE_FINISHED };
+
+	/**
+	 * A single listener request for a asset
+	 */
+	struct Ticket {
+		int64_t requestId;
+		StreamingListener* listener;
+		Vector3 position;
+	};
+
+	/**
+	 * Asset request, which might be shared between multiple tickets
+	 */
+	struct Request {
+		RequestType type;
+		string key;
+		string pathName;
+		string fileName;
+		bool managed;
+		RequestState state;
+		vector<Ticket> tickets;
+		vector<uint8_t> content;
+		Model* model;
+		Texture* texture;
+		string error;
+	};
+
+	/**
+	 * I/O thread
+	 */
+	class IOThread: public Thread {
+	public:
+		/**
+		 * Constructor
+		 * @param streamingManager streaming manager
+		 */
+		IOThread(StreamingManager* streamingManager);
+
+		/**
+		 * Run
+		 */
+		virtual void run();
+
+	private:
+		StreamingManager* streamingManager;
+	};
+
+	/**
+	 * Decode thread
+	 */
+	class DecodeThread: public Thread {
+	public:
+		/**
+		 * Constructor
+		 * @param streamingManager streaming manager
+		 */
+		DecodeThread(StreamingManager* streamingManager);
+
+		/**
+		 * Run
+		 */
+		virtual void run();
+
+	private:
+		StreamingManager* streamingManager;
+	};
+
+	/**
+	 * Replaces a placeholder object 3d with a object 3d using the streamed model
+	 */
+	class Object3DPlaceholderListener: public StreamingListener {
+	public:
+		/**
+		 * Constructor
+		 * @param engine engine
+		 * @param id object 3d id
+		 * @param placeholder placeholder object 3d or null
+		 * @param transformations transformations
+		 */
+		Object3DPlaceholderListener(Engine* engine, const string& id, Object3D* placeholder, const Transformations& transformations);
+
+		// overridden methods
+		void onModelStreamed(int64_t requestId, Model* model) override;
+		void onStreamingFailed(int64_t requestId, const string& error) override;
+
+	private:
+		Engine* engine;
+		string id;
+		Object3D* placeholder;
+		Transformations transformations;
+	};
+
+	int ioThreadCount;
+	int decodeThreadCount;
+	vector<IOThread*> ioThreads;
+	vector<DecodeThread*> decodeThreads;
+	Mutex mutex;
+	Condition ioCondition;
+	Queue<Request> decodeQueue;
+	int64_t requestIdx { 0LL };
+	Vector3 cameraPosition;
+	vector<Request*> queuedRequests;
+	vector<Request*> finishedRequests;
+	unordered_map<string, Request*> requestsByKey;
+	unordered_map<int64_t, Request*> requestsById;
+	unordered_map<int64_t, Object3DPlaceholderListener*> placeholderListeners;
+	map<string, Model*> managedModels;
+
+	/**
+	 * Add a request
+	 * @param type request type
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param position position used to prioritize the request by distance to camera
+	 * @param listener listener
+	 * @param managed if model is owned by streaming manager
+	 * @return request id
+	 */
+	int64_t addRequest(RequestType type, const string& pathName, const string& fileName, const Vector3& position, StreamingListener* listener, bool managed);
+
+	/**
+	 * Fetch next queued request with highest priority, this blocks until a request is available or streaming manager has been shut down
+	 * @param thread calling thread
+	 * @return request or null if thread should stop
+	 */
+	Request* getNextQueuedRequest(Thread* thread);
+
+	/**
+	 * Load request file content, executed by I/O threads
+	 * @param request request
+	 */
+	void load(Request* request);
+
+	/**
+	 * Decode request file content, executed by decode threads
+	 * @param request request
+	 */
+	void decode(Request* request);
+
+	/**
+	 * Mark request as finished, or dispose it if all its tickets have been cancelled
+	 * @param request request
+	 */
+	void finish(Request* request);
+
+	/**
+	 * Dispose request and its decoded resources
+	 * @param request request
+	 */
+	void dispose(Request* request);
+
+public:
+	/**
+	 * Public constructor
+	 * @param ioThreadCount I/O thread count
+	 * @param decodeThreadCount decode thread count
+	 */
+	StreamingManager(int ioThreadCount = 1, int decodeThreadCount = 2);
+
+	/**
+	 * Destructor
+	 */
+	~StreamingManager();
+
+	/**
+	 * Start I/O and decode threads
+	 */
+	void start();
+
+	/**
+	 * Stop and join I/O and decode threads, pending requests will be dropped
+	 */
+	void shutdown();
+
+	/**
+	 * Set camera position, which is used to prioritize requests by distance
+	 * @param cameraPosition camera position
+	 */
+	void setCameraPosition(const Vector3& cameraPosition);
+
+	/**
+	 * Request a model
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param position position used to prioritize the request by distance to camera
+	 * @param listener listener
+	 * @return request id
+	 */
+	inline int64_t requestModel(const string& pathName, const string& fileName, const Vector3& position, StreamingListener* listener) {
+		return addRequest(REQUESTTYPE_MODEL, pathName, fileName, position, listener, false);
+	}
+
+	/**
+	 * Request a texture
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param position position used to prioritize the request by distance to camera
+	 * @param listener listener
+	 * @return request id
+	 */
+	inline int64_t requestTexture(const string& pathName, const string& fileName, const Vector3& position, StreamingListener* listener) {
+		return addRequest(REQUESTTYPE_TEXTURE, pathName, fileName, position, listener, false);
+	}
+
+	/**
+	 * Request raw file content, e.g. for levels or audio
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param position position used to prioritize the request by distance to camera
+	 * @param listener listener
+	 * @return request id
+	 */
+	inline int64_t requestContent(const string& pathName, const string& fileName, const Vector3& position, StreamingListener* listener) {
+		return addRequest(REQUESTTYPE_CONTENT, pathName, fileName, position, listener, false);
+	}
+
+	/**
+	 * Add a object 3d to engine, which shows given placeholder model until the model has been streamed
+	 * 	Models streamed this way are owned by streaming manager and reused by later requests
+	 * @param engine engine
+	 * @param id object 3d id
+	 * @param placeholderModel placeholder model or null
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param transformations transformations
+	 * @return request id or -1 if model was already available and object 3d has been added immediately
+	 */
+	int64_t requestObject3D(Engine* engine, const string& id, Model* placeholderModel, const string& pathName, const string& fileName, const Transformations& transformations);
+
+	/**
+	 * Cancel a request, its listener will not be notified
+	 * @param requestId request id
+	 * @return success
+	 */
+	bool cancel(int64_t requestId);
+
+	/**
+	 * @return number of requests not yet delivered to listeners
+	 */
+	int getRequestCount();
+
+	/**
+	 * Notify listeners about finished requests, needs to be called from main thread
+	 * @return number of finished requests
+	 */
+	int processCompletions();
+
+};
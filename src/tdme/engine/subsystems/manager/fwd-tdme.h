@@ -8,6 +8,8 @@ namespace subsystems {
 namespace manager {
 				class MeshManager;
 				class MeshManager_MeshManaged;
+				struct StreamingListener;
+				class StreamingManager;
 				class TextureManager;
 				class TextureManager_TextureManaged;
 				class VBOManager;
@@ -0,0 +1,332 @@
+#include <tdme/engine/subsystems/occlusionculling/OcclusionCulling.h>
+
+#include <algorithm>
+#include <array>
+#include <vector>
+
+#include <tdme/engine/Camera.h>
+#include <tdme/engine/Entity.h>
+#include <tdme/engine/Object3D.h>
+#include <tdme/engine/primitives/BoundingBox.h>
+#include <tdme/engine/primitives/Triangle.h>
+#include <tdme/engine/subsystems/occlusionculling/OcclusionCullingStatistics.h>
+#include <tdme/engine/subsystems/rendering/Object3DBase.h>
+#include <tdme/engine/subsystems/rendering/Object3DBase_TransformedFacesIterator.h>
+#include <tdme/math/Math.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/math/Vector4.h>
+#include <tdme/utils/Float.h>
+
+using std::array;
+using std::swap;
+using std::vector;
+
+using tdme::engine::subsystems::occlusionculling::OcclusionCulling;
+using tdme::engine::Camera;
+using tdme::engine::Entity;
+using tdme::engine::Object3D;
+using tdme::engine::primitives::BoundingBox;
+using tdme::engine::primitives::Triangle;
+using tdme::engine::subsystems::occlusionculling::OcclusionCullingStatistics;
+using tdme::engine::subsystems::rendering::Object3DBase;
+using tdme::math::Math;
+using tdme::math::Matrix4x4;
+using tdme::math::Vector3;
+using tdme::math::Vector4;
+using tdme::utils::Float;
+
+OcclusionCulling::OcclusionCulling()
+{
+	hiZLevels.resize(LEVELS);
+	for (auto i = 0; i < LEVELS; i++) {
+		hiZLevels[i].resize((WIDTH >> i) * (HEIGHT >> i));
+	}
+	mvpMatrix.identity();
+	clear();
+	updateHiZ();
+}
+
+void OcclusionCulling::clear()
+{
+	auto& depthBuffer = hiZLevels[0];
+	for (auto i = 0; i < depthBuffer.size(); i++) depthBuffer[i] = 0.0f;
+}
+
+void OcclusionCulling::reset(const Matrix4x4& mvpMatrix, float zNear)
+{
+	this->mvpMatrix.set(mvpMatrix);
+	this->zNear = zNear;
+	statistics.occluders = 0;
+	statistics.occluderTriangles = 0;
+	clear();
+}
+
+void OcclusionCulling::addOccluder(const Matrix4x4& transformationsMatrix, BoundingBox* boundingBox)
+{
+	Matrix4x4 objectMVPMatrix;
+	objectMVPMatrix.set(transformationsMatrix).multiply(mvpMatrix);
+	array<Vector4, 8> vertices;
+	auto& boundingBoxVertices = boundingBox->getVertices();
+	for (auto i = 0; i < vertices.size(); i++) {
+		objectMVPMatrix.multiply(Vector4(boundingBoxVertices[i], 1.0f), vertices[i]);
+	}
+	for (auto& faceVertexIndices: *BoundingBox::getFacesVerticesIndexes()) {
+		rasterizeTriangle(vertices[faceVertexIndices[0]], vertices[faceVertexIndices[1]], vertices[faceVertexIndices[2]]);
+	}
+	statistics.occluders++;
+	statistics.occluderTriangles+= BoundingBox::getFacesVerticesIndexes()->size();
+}
+
+void OcclusionCulling::addOccluder(const Matrix4x4& transformationsMatrix, vector<Triangle>& triangles)
+{
+	Matrix4x4 objectMVPMatrix;
+	objectMVPMatrix.set(transformationsMatrix).multiply(mvpMatrix);
+	array<Vector4, 3> vertices;
+	for (auto& triangle: triangles) {
+		auto& triangleVertices = triangle.getVertices();
+		for (auto i = 0; i < vertices.size(); i++) {
+			objectMVPMatrix.multiply(Vector4(triangleVertices[i], 1.0f), vertices[i]);
+		}
+		rasterizeTriangle(vertices[0], vertices[1], vertices[2]);
+	}
+	statistics.occluders++;
+	statistics.occluderTriangles+= triangles.size();
+}
+
+void OcclusionCulling::addOccluder(Object3DBase* object)
+{
+	// transformed faces iterator provides triangles in world space, which takes group and skinning transformations into account
+	occluderTriangles.clear();
+	for (auto it = object->getTransformedFacesIterator()->iterator(); it->hasNext();) {
+		auto& vertices = it->next();
+		occluderTriangles.push_back(Triangle(vertices[0], vertices[1], vertices[2]));
+	}
+	Matrix4x4 identityMatrix;
+	identityMatrix.identity();
+	addOccluder(identityMatrix, occluderTriangles);
+}
+
+void OcclusionCulling::update(Camera* camera, const vector<Object3D*>& occluders)
+{
+	reset(camera->getModelViewProjectionMatrix(), camera->getZNear());
+	for (auto object: occluders) {
+		auto occluderBoundingBox = object->getOccluderBoundingBox();
+		if (occluderBoundingBox != nullptr) {
+			// simplified occluder geometry given as bounding box in object space
+			addOccluder(object->getTransformationsMatrix(), occluderBoundingBox);
+		} else {
+			// model triangles in world space
+			addOccluder(object);
+		}
+	}
+	updateHiZ();
+}
+
+void OcclusionCulling::rasterizeTriangle(const Vector4& v0, const Vector4& v1, const Vector4& v2)
+{
+	// triangle completely in front of near plane
+	auto inFront0 = v0.getW() >= zNear;
+	auto inFront1 = v1.getW() >= zNear;
+	auto inFront2 = v2.getW() >= zNear;
+	if (inFront0 == true && inFront1 == true && inFront2 == true) {
+		rasterizeClippedTriangle(v0, v1, v2);
+		return;
+	}
+	// triangle completely behind near plane
+	if (inFront0 == false && inFront1 == false && inFront2 == false) return;
+
+	// clip polygon against near plane
+	array<const Vector4*, 3> vertices { &v0, &v1, &v2 };
+	array<Vector4, 4> clippedVertices;
+	auto clippedVertexCount = 0;
+	for (auto i = 0; i < 3; i++) {
+		auto& a = *vertices[i];
+		auto& b = *vertices[(i + 1) % 3];
+		auto aDistance = a.getW() - zNear;
+		auto bDistance = b.getW() - zNear;
+		if (aDistance >= 0.0f) clippedVertices[clippedVertexCount++] = a;
+		if ((aDistance >= 0.0f) != (bDistance >= 0.0f)) {
+			auto t = aDistance / (aDistance - bDistance);
+			clippedVertices[clippedVertexCount++].set(
+				a.getX() + (b.getX() - a.getX()) * t,
+				a.getY() + (b.getY() - a.getY()) * t,
+				a.getZ() + (b.getZ() - a.getZ()) * t,
+				zNear
+			);
+		}
+	}
+	for (auto i = 2; i < clippedVertexCount; i++) {
+		rasterizeClippedTriangle(clippedVertices[0], clippedVertices[i - 1], clippedVertices[i]);
+	}
+}
+
+void OcclusionCulling::rasterizeClippedTriangle(const Vector4& v0, const Vector4& v1, const Vector4& v2)
+{
+	// window coordinates and reciprocal view depth, which can be interpolated linearly in screen space
+	auto iw0 = 1.0f / v0.getW();
+	auto iw1 = 1.0f / v1.getW();
+	auto iw2 = 1.0f / v2.getW();
+	auto x0 = (v0.getX() * iw0 * 0.5f + 0.5f) * WIDTH;
+	auto y0 = (v0.getY() * iw0 * 0.5f + 0.5f) * HEIGHT;
+	auto x1 = (v1.getX() * iw1 * 0.5f + 0.5f) * WIDTH;
+	auto y1 = (v1.getY() * iw1 * 0.5f + 0.5f) * HEIGHT;
+	auto x2 = (v2.getX() * iw2 * 0.5f + 0.5f) * WIDTH;
+	auto y2 = (v2.getY() * iw2 * 0.5f + 0.5f) * HEIGHT;
+
+	// we rasterize both windings, back faces of closed occluders are behind front faces anyway
+	auto area = (x1 - x0) * (y2 - y0) - (x2 - x0) * (y1 - y0);
+	if (Math::abs(area) < Math::EPSILON) return;
+	if (area < 0.0f) {
+		swap(x1, x2);
+		swap(y1, y2);
+		swap(iw1, iw2);
+		area = -area;
+	}
+
+	// bounding rectangle clamped to depth buffer
+	auto minX = Math::max(0, static_cast<int32_t>(Math::floor(Math::min(x0, Math::min(x1, x2)))));
+	auto maxX = Math::min(WIDTH - 1, static_cast<int32_t>(Math::ceil(Math::max(x0, Math::max(x1, x2)))));
+	auto minY = Math::max(0, static_cast<int32_t>(Math::floor(Math::min(y0, Math::min(y1, y2)))));
+	auto maxY = Math::min(HEIGHT - 1, static_cast<int32_t>(Math::ceil(Math::max(y0, Math::max(y1, y2)))));
+	if (minX > maxX || minY > maxY) return;
+
+	// edge functions and their increments, evaluated at pixel centers
+	auto px = static_cast<float>(minX) + 0.5f;
+	auto py = static_cast<float>(minY) + 0.5f;
+	auto e12DX = -(y2 - y1);
+	auto e12DY = x2 - x1;
+	auto e20DX = -(y0 - y2);
+	auto e20DY = x0 - x2;
+	auto e01DX = -(y1 - y0);
+	auto e01DY = x1 - x0;
+	auto e12Row = (x2 - x1) * (py - y1) - (y2 - y1) * (px - x1);
+	auto e20Row = (x0 - x2) * (py - y2) - (y0 - y2) * (px - x2);
+	auto e01Row = (x1 - x0) * (py - y0) - (y1 - y0) * (px - x0);
+	auto areaReciprocal = 1.0f / area;
+	auto iwDX = (e12DX * iw0 + e20DX * iw1 + e01DX * iw2) * areaReciprocal;
+	auto iwDY = (e12DY * iw0 + e20DY * iw1 + e01DY * iw2) * areaReciprocal;
+	auto iwRow = (e12Row * iw0 + e20Row * iw1 + e01Row * iw2) * areaReciprocal;
+
+	// rasterize
+	auto& depthBuffer = hiZLevels[0];
+	for (auto y = minY; y <= maxY; y++) {
+		auto e12 = e12Row;
+		auto e20 = e20Row;
+		auto e01 = e01Row;
+		auto iw = iwRow;
+		auto depthBufferPtr = &depthBuffer[y * WIDTH + minX];
+		for (auto x = minX; x <= maxX; x++) {
+			if (e12 >= 0.0f && e20 >= 0.0f && e01 >= 0.0f && iw > *depthBufferPtr) *depthBufferPtr = iw;
+			e12+= e12DX;
+			e20+= e20DX;
+			e01+= e01DX;
+			iw+= iwDX;
+			depthBufferPtr++;
+		}
+		e12Row+= e12DY;
+		e20Row+= e20DY;
+		e01Row+= e01DY;
+		iwRow+= iwDY;
+	}
+}
+
+void OcclusionCulling::updateHiZ()
+{
+	// each texel of a level stores the farthest depth, which is the smallest reciprocal view depth, of the 2x2 texels of previous level
+	for (auto level = 1; level < LEVELS; level++) {
+		auto& source = hiZLevels[level - 1];
+		auto& destination = hiZLevels[level];
+		auto sourceWidth = WIDTH >> (level - 1);
+		auto width = WIDTH >> level;
+		auto height = HEIGHT >> level;
+		for (auto y = 0; y < height; y++) {
+			auto sourceRow0 = &source[(y * 2) * sourceWidth];
+			auto sourceRow1 = sourceRow0 + sourceWidth;
+			for (auto x = 0; x < width; x++) {
+				destination[y * width + x] = Math::min(
+					Math::min(sourceRow0[x * 2], sourceRow0[x * 2 + 1]),
+					Math::min(sourceRow1[x * 2], sourceRow1[x * 2 + 1])
+				);
+			}
+		}
+	}
+}
+
+bool OcclusionCulling::isVisible(BoundingBox* boundingBoxTransformed)
+{
+	// project bounding box vertices and determine screen rectangle and nearest depth
+	auto minX = Float::MAX_VALUE;
+	auto maxX = -Float::MAX_VALUE;
+	auto minY = Float::MAX_VALUE;
+	auto maxY = -Float::MAX_VALUE;
+	auto maxIW = 0.0f;
+	Vector4 vertex;
+	for (auto& boundingBoxVertex: boundingBoxTransformed->getVertices()) {
+		mvpMatrix.multiply(Vector4(boundingBoxVertex, 1.0f), vertex);
+		// bounding box intersects near plane
+		if (vertex.getW() < zNear) return true;
+		auto iw = 1.0f / vertex.getW();
+		auto x = (vertex.getX() * iw * 0.5f + 0.5f) * WIDTH;
+		auto y = (vertex.getY() * iw * 0.5f + 0.5f) * HEIGHT;
+		minX = Math::min(minX, x);
+		maxX = Math::max(maxX, x);
+		minY = Math::min(minY, y);
+		maxY = Math::max(maxY, y);
+		maxIW = Math::max(maxIW, iw);
+	}
+
+	// outside of depth buffer, let frustum culling decide
+	if (maxX < 0.0f || maxY < 0.0f || minX >= WIDTH || minY >= HEIGHT) return true;
+	auto x0 = Math::max(0, static_cast<int32_t>(minX));
+	auto x1 = Math::min(WIDTH - 1, static_cast<int32_t>(maxX));
+	auto y0 = Math::max(0, static_cast<int32_t>(minY));
+	auto y1 = Math::min(HEIGHT - 1, static_cast<int32_t>(maxY));
+
+	// choose level where rectangle covers at most 2x2 texels
+	auto level = 0;
+	while (level < LEVELS - 1 && ((x1 >> level) - (x0 >> level) > 1 || (y1 >> level) - (y0 >> level) > 1)) level++;
+
+	// visible if nearest bounding box depth is not behind farthest occluder depth of a texel
+	auto& hiZLevel = hiZLevels[level];
+	auto width = WIDTH >> level;
+	for (auto y = y0 >> level; y <= y1 >> level; y++) {
+		for (auto x = x0 >> level; x <= x1 >> level; x++) {
+			if (maxIW >= hiZLevel[y * width + x]) return true;
+		}
+	}
+	return false;
+}
+
+const vector<Entity*>& OcclusionCulling::cull(Camera* camera, const vector<Entity*>& entities)
+{
+	// collect occluders
+	occluders.clear();
+	Object3D* object = nullptr;
+	for (auto entity: entities) {
+		if ((object = dynamic_cast<Object3D*>(entity)) != nullptr && object->isOccluder() == true && object->isEnabled() == true) {
+			occluders.push_back(object);
+		}
+	}
+
+	// update depth buffer
+	update(camera, occluders);
+
+	// test entities
+	statistics.testedEntities = 0;
+	statistics.culledEntities = 0;
+	visibleEntities.clear();
+	for (auto entity: entities) {
+		if ((object = dynamic_cast<Object3D*>(entity)) != nullptr && object->isOccluder() == true) {
+			visibleEntities.push_back(entity);
+			continue;
+		}
+		statistics.testedEntities++;
+		if (occluders.empty() == false && isVisible(entity->getBoundingBoxTransformed()) == false) {
+			statistics.culledEntities++;
+			continue;
+		}
+		visibleEntities.push_back(entity);
+	}
+	return visibleEntities;
+}
@@ -0,0 +1,148 @@
+#pragma once
+
+#include <vector>
+
+#include <tdme/tdme.h>
+#include <tdme/engine/fwd-tdme.h>
+#include <tdme/engine/primitives/fwd-tdme.h>
+#include <tdme/engine/primitives/Triangle.h>
+#include <tdme/engine/subsystems/occlusionculling/fwd-tdme.h>
+#include <tdme/engine/subsystems/occlusionculling/OcclusionCullingStatistics.h>
+#include <tdme/engine/subsystems/rendering/fwd-tdme.h>
+#include <tdme/math/fwd-tdme.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/math/Vector4.h>
+
+using std::vector;
+
+using tdme::engine::Camera;
+using tdme::engine::Entity;
+using tdme::engine::Object3D;
+using tdme::engine::primitives::BoundingBox;
+using tdme::engine::primitives::Triangle;
+using tdme::engine::subsystems::occlusionculling::OcclusionCullingStatistics;
+using tdme::engine::subsystems::rendering::Object3DBase;
+using tdme::math::Matrix4x4;
+using tdme::math::Vector4;
+
+/**
+ * Occlusion culling using a low resolution CPU depth buffer
+ * 	Occluder objects are rasterized into the depth buffer, which stores the nearest reciprocal view depth per pixel
+ * 	A hierarchical depth buffer storing the farthest depth of each tile is built from it to test entity bounding boxes
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::engine::subsystems::occlusionculling::OcclusionCulling final
+{
+public:
+	static constexpr int32_t WIDTH { 256 };
+	static constexpr int32_t HEIGHT { 128 };
+	static constexpr int32_t LEVELS { 8 };
+
+private:
+	vector<vector<float>> hiZLevels;
+	vector<Entity*> visibleEntities;
+	vector<Object3D*> occluders;
+	vector<Triangle> occluderTriangles;
+	Matrix4x4 mvpMatrix;
+	float zNear { 0.1f };
+	OcclusionCullingStatistics statistics;
+
+	/**
+	 * Clear depth buffer
+	 */
+	void clear();
+
+	/**
+	 * Clip triangle in clip space against near plane and rasterize it
+	 * @param v0 vertex 0 in clip space
+	 * @param v1 vertex 1 in clip space
+	 * @param v2 vertex 2 in clip space
+	 */
+	void rasterizeTriangle(const Vector4& v0, const Vector4& v1, const Vector4& v2);
+
+	/**
+	 * Rasterize triangle in clip space that is in front of near plane
+	 * @param v0 vertex 0 in clip space
+	 * @param v1 vertex 1 in clip space
+	 * @param v2 vertex 2 in clip space
+	 */
+	void rasterizeClippedTriangle(const Vector4& v0, const Vector4& v1, const Vector4& v2);
+
+public:
+
+	/**
+	 * Public constructor
+	 */
+	OcclusionCulling();
+
+	/**
+	 * Reset depth buffer and set up projection
+	 * @param mvpMatrix model view projection matrix
+	 * @param zNear z near
+	 */
+	void reset(const Matrix4x4& mvpMatrix, float zNear);
+
+	/**
+	 * Rasterize occluder given as bounding box into depth buffer
+	 * @param transformationsMatrix transformations matrix
+	 * @param boundingBox bounding box
+	 */
+	void addOccluder(const Matrix4x4& transformationsMatrix, BoundingBox* boundingBox);
+
+	/**
+	 * Rasterize occluder given as triangles into depth buffer
+	 * @param transformationsMatrix transformations matrix
+	 * @param triangles triangles
+	 */
+	void addOccluder(const Matrix4x4& transformationsMatrix, vector<Triangle>& triangles);
+
+	/**
+	 * Rasterize occluder given as object model triangles into depth buffer
+	 * @param object object
+	 */
+	void addOccluder(Object3DBase* object);
+
+	/**
+	 * Build hierarchical depth buffer levels from depth buffer, required after adding occluders and before testing
+	 */
+	void updateHiZ();
+
+	/**
+	 * Update depth buffer with given occluders
+	 * @param camera camera
+	 * @param occluders occluders
+	 */
+	void update(Camera* camera, const vector<Object3D*>& occluders);
+
+	/**
+	 * Test if given transformed bounding box is potentially visible
+	 * @param boundingBoxTransformed bounding box in world space
+	 * @return if bounding box is potentially visible
+	 */
+	bool isVisible(BoundingBox* boundingBoxTransformed);
+
+	/**
+	 * Cull given entities, which uses occluder objects of given entities
+	 * @param camera camera
+	 * @param entities entities, usually those in camera frustum
+	 * @return entities that are potentially visible
+	 */
+	const vector<Entity*>& cull(Camera* camera, const vector<Entity*>& entities);
+
+	/**
+	 * @return depth buffer storing nearest reciprocal view depth per pixel, 0.0 means empty
+	 */
+	inline const vector<float>& getDepthBuffer() {
+		return hiZLevels[0];
+	}
+
+	/**
+	 * Get statistics of last culling
+	 * @param statistics statistics
+	 */
+	inline void getStatistics(OcclusionCullingStatistics& statistics) {
+		statistics = this->statistics;
+	}
+
+};
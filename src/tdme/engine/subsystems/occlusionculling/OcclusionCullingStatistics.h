@@ -0,0 +1,17 @@
+#pragma once
+
+#include <tdme/tdme.h>
+#include <tdme/engine/subsystems/occlusionculling/fwd-tdme.h>
+
+/**
+ * Occlusion culling statistics entity
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+struct tdme::engine::subsystems::occlusionculling::OcclusionCullingStatistics
+{
+	int64_t occluders {  };
+	int64_t occluderTriangles {  };
+	int64_t testedEntities {  };
+	int64_t culledEntities {  };
+};
@@ -0,0 +1,13 @@
+// Forward declarations for tdme.engine.subsystems.occlusionculling
+#pragma once
+
+namespace tdme {
+namespace engine {
+namespace subsystems {
+namespace occlusionculling {
+	class OcclusionCulling;
+	struct OcclusionCullingStatistics;
+}  // namespace occlusionculling
+}  // namespace subsystems
+}  // namespace engine
+}  // namespace tdme
@@ -0,0 +1,133 @@
+#include <tdme/engine/subsystems/particlesystem/ParticleBuffer.h>
+
+#include <vector>
+
+#include <tdme/engine/model/Color4.h>
+#include <tdme/engine/subsystems/particlesystem/Particle.h>
+#include <tdme/math/Math.h>
+#include <tdme/math/Vector3.h>
+
+using std::vector;
+
+using tdme::engine::model::Color4;
+using tdme::engine::subsystems::particlesystem::Particle;
+using tdme::engine::subsystems::particlesystem::ParticleBuffer;
+using tdme::math::Math;
+using tdme::math::Vector3;
+
+ParticleBuffer::ParticleBuffer(int32_t capacity): capacity(capacity)
+{
+	positionsX.resize(capacity);
+	positionsY.resize(capacity);
+	positionsZ.resize(capacity);
+	velocitiesX.resize(capacity);
+	velocitiesY.resize(capacity);
+	velocitiesZ.resize(capacity);
+	colorsR.resize(capacity);
+	colorsG.resize(capacity);
+	colorsB.resize(capacity);
+	colorsA.resize(capacity);
+	colorsAddR.resize(capacity);
+	colorsAddG.resize(capacity);
+	colorsAddB.resize(capacity);
+	colorsAddA.resize(capacity);
+	masses.resize(capacity);
+	spriteIndices.resize(capacity);
+	lifeTimesMax.resize(capacity);
+	lifeTimesCurrent.resize(capacity);
+}
+
+bool ParticleBuffer::add(const Particle& particle) {
+	if (count == capacity) return false;
+	auto& positionXYZ = particle.position.getArray();
+	auto& velocityXYZ = particle.velocity.getArray();
+	auto& colorRGBA = particle.color.getArray();
+	auto& colorAddRGBA = particle.colorAdd.getArray();
+	positionsX[count] = positionXYZ[0];
+	positionsY[count] = positionXYZ[1];
+	positionsZ[count] = positionXYZ[2];
+	velocitiesX[count] = velocityXYZ[0];
+	velocitiesY[count] = velocityXYZ[1];
+	velocitiesZ[count] = velocityXYZ[2];
+	colorsR[count] = colorRGBA[0];
+	colorsG[count] = colorRGBA[1];
+	colorsB[count] = colorRGBA[2];
+	colorsA[count] = colorRGBA[3];
+	colorsAddR[count] = colorAddRGBA[0];
+	colorsAddG[count] = colorAddRGBA[1];
+	colorsAddB[count] = colorAddRGBA[2];
+	colorsAddA[count] = colorAddRGBA[3];
+	masses[count] = particle.mass;
+	spriteIndices[count] = particle.spriteIndex;
+	lifeTimesMax[count] = particle.lifeTimeMax;
+	lifeTimesCurrent[count] = particle.lifeTimeCurrent;
+	count++;
+	return true;
+}
+
+int32_t ParticleBuffer::removeExpired(int64_t timeDelta) {
+	// life time
+	auto lifeTimesCurrentData = lifeTimesCurrent.data();
+	for (auto i = 0; i < count; i++) lifeTimesCurrentData[i]+= timeDelta;
+
+	// remove expired particles, the last alive particle takes the place of a removed one and gets checked next
+	auto removed = 0;
+	auto i = 0;
+	while (i < count) {
+		if (lifeTimesCurrent[i] < lifeTimesMax[i]) {
+			i++;
+			continue;
+		}
+		count--;
+		if (i != count) move(count, i);
+		removed++;
+	}
+	return removed;
+}
+
+void ParticleBuffer::integrate(int64_t timeDelta, float fps) {
+	auto timeDeltaFloat = static_cast<float>(timeDelta);
+	auto timeDeltaSeconds = timeDeltaFloat / 1000.0f;
+	auto spriteIndexDelta = timeDeltaSeconds * fps;
+	auto gravityDelta = 0.5f * Math::g * timeDeltaSeconds;
+
+	// the loops below work on plain arrays without branches to allow auto vectorization
+	auto spriteIndicesData = spriteIndices.data();
+	for (auto i = 0; i < count; i++) spriteIndicesData[i]+= spriteIndexDelta;
+
+	// add gravity if our particle have a noticeable mass
+	// TODO:
+	//	maybe take air resistance into account like a huge paper needs more time to fall than a sphere of paper
+	//	or heat for smoke or fire, whereas having no mass for those particles works around this problem for now
+	auto massesData = masses.data();
+	auto velocitiesYData = velocitiesY.data();
+	for (auto i = 0; i < count; i++) velocitiesYData[i]-= massesData[i] > Math::EPSILON?gravityDelta:0.0f;
+
+	// translation
+	auto positionsXData = positionsX.data();
+	auto positionsYData = positionsY.data();
+	auto positionsZData = positionsZ.data();
+	auto velocitiesXData = velocitiesX.data();
+	auto velocitiesZData = velocitiesZ.data();
+	for (auto i = 0; i < count; i++) {
+		positionsXData[i]+= velocitiesXData[i] * timeDeltaSeconds;
+		positionsYData[i]+= velocitiesYData[i] * timeDeltaSeconds;
+		positionsZData[i]+= velocitiesZData[i] * timeDeltaSeconds;
+	}
+
+	// color
+	auto colorsRData = colorsR.data();
+	auto colorsGData = colorsG.data();
+	auto colorsBData = colorsB.data();
+	auto colorsAData = colorsA.data();
+	auto colorsAddRData = colorsAddR.data();
+	auto colorsAddGData = colorsAddG.data();
+	auto colorsAddBData = colorsAddB.data();
+	auto colorsAddAData = colorsAddA.data();
+	for (auto i = 0; i < count; i++) {
+		colorsRData[i]+= colorsAddRData[i] * timeDeltaFloat;
+		colorsGData[i]+= colorsAddGData[i] * timeDeltaFloat;
+		colorsBData[i]+= colorsAddBData[i] * timeDeltaFloat;
+		colorsAData[i]+= colorsAddAData[i] * timeDeltaFloat;
+	}
+}
@@ -0,0 +1,199 @@
+#pragma once
+
+#include <vector>
+
+#include <tdme/tdme.h>
+#include <tdme/engine/model/fwd-tdme.h>
+#include <tdme/engine/model/Color4.h>
+#include <tdme/engine/subsystems/particlesystem/fwd-tdme.h>
+#include <tdme/math/fwd-tdme.h>
+#include <tdme/math/Vector3.h>
+
+using std::vector;
+
+using tdme::engine::model::Color4;
+using tdme::engine::subsystems::particlesystem::Particle;
+using tdme::math::Vector3;
+
+/**
+ * Particle buffer, which stores alive particles as structure of arrays
+ * 	Alive particles are kept compacted in [0, count), so that integration loops run over contiguous float arrays and can be vectorized by the compiler
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::engine::subsystems::particlesystem::ParticleBuffer final
+{
+private:
+	int32_t capacity;
+	int32_t count { 0 };
+	vector<float> positionsX;
+	vector<float> positionsY;
+	vector<float> positionsZ;
+	vector<float> velocitiesX;
+	vector<float> velocitiesY;
+	vector<float> velocitiesZ;
+	vector<float> colorsR;
+	vector<float> colorsG;
+	vector<float> colorsB;
+	vector<float> colorsA;
+	vector<float> colorsAddR;
+	vector<float> colorsAddG;
+	vector<float> colorsAddB;
+	vector<float> colorsAddA;
+	vector<float> masses;
+	vector<float> spriteIndices;
+	vector<int64_t> lifeTimesMax;
+	vector<int64_t> lifeTimesCurrent;
+
+	/**
+	 * Move particle
+	 * @param from from particle index
+	 * @param to to particle index
+	 */
+	inline void move(int32_t from, int32_t to) {
+		positionsX[to] = positionsX[from];
+		positionsY[to] = positionsY[from];
+		positionsZ[to] = positionsZ[from];
+		velocitiesX[to] = velocitiesX[from];
+		velocitiesY[to] = velocitiesY[from];
+		velocitiesZ[to] = velocitiesZ[from];
+		colorsR[to] = colorsR[from];
+		colorsG[to] = colorsG[from];
+		colorsB[to] = colorsB[from];
+		colorsA[to] = colorsA[from];
+		colorsAddR[to] = colorsAddR[from];
+		colorsAddG[to] = colorsAddG[from];
+		colorsAddB[to] = colorsAddB[from];
+		colorsAddA[to] = colorsAddA[from];
+		masses[to] = masses[from];
+		spriteIndices[to] = spriteIndices[from];
+		lifeTimesMax[to] = lifeTimesMax[from];
+		lifeTimesCurrent[to] = lifeTimesCurrent[from];
+	}
+
+public:
+	/**
+	 * Public constructor
+	 * @param capacity capacity
+	 */
+	ParticleBuffer(int32_t capacity);
+
+	/**
+	 * @return capacity
+	 */
+	inline int32_t getCapacity() const {
+		return capacity;
+	}
+
+	/**
+	 * @return alive particle count
+	 */
+	inline int32_t getCount() const {
+		return count;
+	}
+
+	/**
+	 * Add particle
+	 * @param particle particle
+	 * @return success, false if buffer is full
+	 */
+	bool add(const Particle& particle);
+
+	/**
+	 * Clear
+	 */
+	inline void clear() {
+		count = 0;
+	}
+
+	/**
+	 * Advance life time and remove particles whose life time has expired, the last alive particle fills the gap of a removed particle
+	 * @param timeDelta time delta in milliseconds
+	 * @return removed particle count
+	 */
+	int32_t removeExpired(int64_t timeDelta);
+
+	/**
+	 * Integrate sprite index, gravity, position and color of alive particles
+	 * @param timeDelta time delta in milliseconds
+	 * @param fps sprite frames per second
+	 */
+	void integrate(int64_t timeDelta, float fps);
+
+	/**
+	 * Get position of particle
+	 * @param idx particle index
+	 * @param position position
+	 */
+	inline void getPosition(int32_t idx, Vector3& position) const {
+		auto& positionXYZ = position.getArray();
+		positionXYZ[0] = positionsX[idx];
+		positionXYZ[1] = positionsY[idx];
+		positionXYZ[2] = positionsZ[idx];
+	}
+
+	/**
+	 * @return positions x of alive particles in [0, count)
+	 */
+	inline const vector<float>& getPositionsX() const {
+		return positionsX;
+	}
+
+	/**
+	 * @return positions y of alive particles in [0, count)
+	 */
+	inline const vector<float>& getPositionsY() const {
+		return positionsY;
+	}
+
+	/**
+	 * @return positions z of alive particles in [0, count)
+	 */
+	inline const vector<float>& getPositionsZ() const {
+		return positionsZ;
+	}
+
+	/**
+	 * Get velocity of particle
+	 * @param idx particle index
+	 * @param velocity velocity
+	 */
+	inline void getVelocity(int32_t idx, Vector3& velocity) const {
+		auto& velocityXYZ = velocity.getArray();
+		velocityXYZ[0] = velocitiesX[idx];
+		velocityXYZ[1] = velocitiesY[idx];
+		velocityXYZ[2] = velocitiesZ[idx];
+	}
+
+	/**
+	 * Get color of particle
+	 * @param idx particle index
+	 * @param color color
+	 */
+	inline void getColor(int32_t idx, Color4& color) const {
+		auto& colorRGBA = color.getArray();
+		colorRGBA[0] = colorsR[idx];
+		colorRGBA[1] = colorsG[idx];
+		colorRGBA[2] = colorsB[idx];
+		colorRGBA[3] = colorsA[idx];
+	}
+
+	/**
+	 * Get sprite index of particle
+	 * @param idx particle index
+	 * @return sprite index
+	 */
+	inline float getSpriteIndex(int32_t idx) const {
+		return spriteIndices[idx];
+	}
+
+	/**
+	 * Get current life time of particle
+	 * @param idx particle index
+	 * @return current life time in milliseconds
+	 */
+	inline int64_t getLifeTimeCurrent(int32_t idx) const {
+		return lifeTimesCurrent[idx];
+	}
+
+};
@@ -14,6 +14,7 @@
 #include <tdme/engine/subsystems/manager/TextureManager.h>
 #include <tdme/engine/subsystems/rendering/TransparentRenderPointsPool.h>
 #include <tdme/engine/subsystems/particlesystem/Particle.h>
+#include <tdme/engine/subsystems/particlesystem/ParticleBuffer.h>
 #include <tdme/engine/subsystems/particlesystem/ParticleEmitter.h>
 #include <tdme/engine/subsystems/particlesystem/ParticleSystemEntityInternal.h>
 #include <tdme/engine/subsystems/renderer/Renderer.h>
@@ -37,6 +38,7 @@ using tdme::engine::primitives::BoundingBox;
 using tdme::engine::subsystems::manager::TextureManager;
 using tdme::engine::subsystems::rendering::TransparentRenderPointsPool;
 using tdme::engine::subsystems::particlesystem::Particle;
+using tdme::engine::subsystems::particlesystem::ParticleBuffer;
 using tdme::engine::subsystems::particlesystem::ParticleEmitter;
 using tdme::engine::subsystems::particlesystem::ParticleSystemEntityInternal;
 using tdme::engine::subsystems::renderer::Renderer;
@@ -45,14 +47,13 @@ using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
 using tdme::utils::Console;
 
-PointsParticleSystemInternal::PointsParticleSystemInternal(const string& id, ParticleEmitter* emitter, int32_t maxPoints, float pointSize, bool autoEmit, Texture* texture, int32_t textureHorizontalSprites, int32_t textureVerticalSprites, float fps)
+PointsParticleSystemInternal::PointsParticleSystemInternal(const string& id, ParticleEmitter* emitter, int32_t maxPoints, float pointSize, bool autoEmit, Texture* texture, int32_t textureHorizontalSprites, int32_t textureVerticalSprites, float fps): particles(maxPoints)
 {
 	this->id = id;
 	this->enabled = true;
 	// will be activated on emit and auto unactivated if no more active particles
 	this->active = false;
 	this->emitter = emitter;
-	particles.resize(maxPoints);
 	this->maxPoints = maxPoints;
 	this->effectColorMul.set(1.0f, 1.0f, 1.0f, 1.0f);
 	this->effectColorAdd.set(0.0f, 0.0f, 0.0f, 0.0f);
@@ -68,12 +69,16 @@ PointsParticleSystemInternal::PointsParticleSystemInternal(const string& id, Par
 	this->textureVerticalSprites = textureVerticalSprites;
 	this->fps = fps;
 	this->pointsRenderPool = new TransparentRenderPointsPool(maxPoints);
+	this->pointsX.resize(maxPoints);
+	this->pointsY.resize(maxPoints);
+	this->pointsZ.resize(maxPoints);
 }
 
 PointsParticleSystemInternal::~PointsParticleSystemInternal() {
 	delete emitter;
 	if (pointsRenderPool != nullptr) delete pointsRenderPool;
-	engine->getTextureManager()->removeTexture(texture->getId());
+	// texture is only registered with texture manager if initialized by engine
+	if (engine != nullptr && texture != nullptr) engine->getTextureManager()->removeTexture(texture->getId());
 }
 
 void PointsParticleSystemInternal::initialize() {
@@ -93,6 +98,15 @@ void PointsParticleSystemInternal::fromTransformations(const Transformations& tr
 }
 
 void PointsParticleSystemInternal::updateParticles()
+{
+	if (enabled == false || active == false)
+		return;
+
+	//
+	updateParticles(engine->getTiming()->getDeltaTime());
+}
+
+void PointsParticleSystemInternal::updateParticles(int64_t timeDelta)
 {
 	if (enabled == false || active == false)
 		return;
@@ -102,81 +116,75 @@ void PointsParticleSystemInternal::updateParticles()
 	auto& localTransformationsMatrix = localTransformations.getTransformationsMatrix();
 	localTransformationsMatrix.getTranslation(center);
 	center.add(emitter->getCenter());
-	//
-	Vector3 point;
-	Vector3 velocityForTime;
-	// bounding box transformed min, max xyz
-	auto& bbMinXYZ = boundingBox.getMin().getArray();
-	auto& bbMaxXYZ = boundingBox.getMax().getArray();
-	//
-	auto haveBoundingBox = false;
-	// compute distance from camera
-	float distanceFromCamera;
-	// transformations
-	auto& transformationsMatrix = getTransformationsMatrix();
 	// process particles
 	pointsRenderPool->reset();
-	auto activeParticles = 0;
-	auto timeDelta = engine->getTiming()->getDeltaTime();
-	for (auto i = 0; i < particles.size(); i++) {
-		auto& particle = particles[i];
-		if (particle.active == false)
-			continue;
-
-		// life time
-		particle.lifeTimeCurrent += timeDelta;
-		// crop to max life time
-		if (particle.lifeTimeCurrent >= particle.lifeTimeMax) {
-			particle.active = false;
-			continue;
-		}
-		// sprite index
-		particle.spriteIndex+= (static_cast<float>(timeDelta) / 1000.0f) * fps;
-		// add gravity if our particle have a noticeable mass
-		if (particle.mass > Math::EPSILON)
-			particle.velocity.sub(Vector3(0.0f, 0.5f * Math::g * static_cast< float >(timeDelta) / 1000.0f, 0.0f));
-		// TODO:
-		//	maybe take air resistance into account like a huge paper needs more time to fall than a sphere of paper
-		//	or heat for smoke or fire, whereas having no mass for those particles works around this problem for now
-		// translation
-		particle.position.add(velocityForTime.set(particle.velocity).scale(static_cast< float >(timeDelta) / 1000.0f));
-		// color
-		auto& color = particle.color.getArray();
-		auto& colorAdd = particle.colorAdd.getArray();
-		color[0] += colorAdd[0] * static_cast< float >(timeDelta);
-		color[1] += colorAdd[1] * static_cast< float >(timeDelta);
-		color[2] += colorAdd[2] * static_cast< float >(timeDelta);
-		color[3] += colorAdd[3] * static_cast< float >(timeDelta);
-		//
-		activeParticles++;
-		// set up bounding box
-		point.set(particle.position);
-		localTransformationsMatrix.multiply(point, point);
-		point.add(center);
-		//
-		auto& pointXYZ = point.getArray();
-		if (haveBoundingBox == false) {
-			bbMinXYZ = pointXYZ;
-			bbMaxXYZ = pointXYZ;
-			haveBoundingBox = true;
-		} else {
-			if (pointXYZ[0] < bbMinXYZ[0]) bbMinXYZ[0] = pointXYZ[0];
-			if (pointXYZ[1] < bbMinXYZ[1]) bbMinXYZ[1] = pointXYZ[1];
-			if (pointXYZ[2] < bbMinXYZ[2]) bbMinXYZ[2] = pointXYZ[2];
-			if (pointXYZ[0] > bbMaxXYZ[0]) bbMaxXYZ[0] = pointXYZ[0];
-			if (pointXYZ[1] > bbMaxXYZ[1]) bbMaxXYZ[1] = pointXYZ[1];
-			if (pointXYZ[2] > bbMaxXYZ[2]) bbMaxXYZ[2] = pointXYZ[2];
-		}
-		// transform particle according to its transformations
-		transformationsMatrix.multiply(point, point);
-		// add to render points pool
-		pointsRenderPool->addPoint(point, static_cast<uint16_t>(particle.spriteIndex) % (textureHorizontalSprites * textureVerticalSprites), color, 0, this);
-	}
+	// life time, remove expired particles and integrate remaining ones
+	particles.removeExpired(timeDelta);
+	particles.integrate(timeDelta, fps);
 	// auto disable particle system if no more active particles
+	auto activeParticles = particles.getCount();
 	if (activeParticles == 0) {
 		active = false;
 		return;
 	}
+	// transform particle positions into points with local transformations and center, done as structure of arrays passes
+	auto positionsX = particles.getPositionsX().data();
+	auto positionsY = particles.getPositionsY().data();
+	auto positionsZ = particles.getPositionsZ().data();
+	auto pointsX = this->pointsX.data();
+	auto pointsY = this->pointsY.data();
+	auto pointsZ = this->pointsZ.data();
+	{
+		auto& m = localTransformationsMatrix.getArray();
+		auto& centerXYZ = center.getArray();
+		auto m0 = m[0], m1 = m[1], m2 = m[2];
+		auto m4 = m[4], m5 = m[5], m6 = m[6];
+		auto m8 = m[8], m9 = m[9], m10 = m[10];
+		auto tx = m[12] + centerXYZ[0], ty = m[13] + centerXYZ[1], tz = m[14] + centerXYZ[2];
+		for (auto i = 0; i < activeParticles; i++) {
+			pointsX[i] = positionsX[i] * m0 + positionsY[i] * m4 + positionsZ[i] * m8 + tx;
+			pointsY[i] = positionsX[i] * m1 + positionsY[i] * m5 + positionsZ[i] * m9 + ty;
+			pointsZ[i] = positionsX[i] * m2 + positionsY[i] * m6 + positionsZ[i] * m10 + tz;
+		}
+	}
+	// set up bounding box
+	{
+		auto minX = pointsX[0], minY = pointsY[0], minZ = pointsZ[0];
+		auto maxX = pointsX[0], maxY = pointsY[0], maxZ = pointsZ[0];
+		for (auto i = 1; i < activeParticles; i++) minX = pointsX[i] < minX?pointsX[i]:minX;
+		for (auto i = 1; i < activeParticles; i++) minY = pointsY[i] < minY?pointsY[i]:minY;
+		for (auto i = 1; i < activeParticles; i++) minZ = pointsZ[i] < minZ?pointsZ[i]:minZ;
+		for (auto i = 1; i < activeParticles; i++) maxX = pointsX[i] > maxX?pointsX[i]:maxX;
+		for (auto i = 1; i < activeParticles; i++) maxY = pointsY[i] > maxY?pointsY[i]:maxY;
+		for (auto i = 1; i < activeParticles; i++) maxZ = pointsZ[i] > maxZ?pointsZ[i]:maxZ;
+		boundingBox.getMin().set(minX, minY, minZ);
+		boundingBox.getMax().set(maxX, maxY, maxZ);
+	}
+	// transform points according to our transformations
+	{
+		auto& m = getTransformationsMatrix().getArray();
+		auto m0 = m[0], m1 = m[1], m2 = m[2];
+		auto m4 = m[4], m5 = m[5], m6 = m[6];
+		auto m8 = m[8], m9 = m[9], m10 = m[10];
+		auto tx = m[12], ty = m[13], tz = m[14];
+		for (auto i = 0; i < activeParticles; i++) {
+			auto x = pointsX[i];
+			auto y = pointsY[i];
+			auto z = pointsZ[i];
+			pointsX[i] = x * m0 + y * m4 + z * m8 + tx;
+			pointsY[i] = x * m1 + y * m5 + z * m9 + ty;
+			pointsZ[i] = x * m2 + y * m6 + z * m10 + tz;
+		}
+	}
+	// add to render points pool
+	Vector3 point;
+	Color4 color;
+	auto sprites = textureHorizontalSprites * textureVerticalSprites;
+	for (auto i = 0; i < activeParticles; i++) {
+		point.set(pointsX[i], pointsY[i], pointsZ[i]);
+		particles.getColor(i, color);
+		pointsRenderPool->addPoint(point, static_cast<uint16_t>(particles.getSpriteIndex(i)) % sprites, color, 0, this);
+	}
 	// scale a bit up to make picking work better
 	boundingBox.update();
 	boundingBoxTransformed.fromBoundingVolumeWithTransformations(&boundingBox, *this);
@@ -217,11 +225,9 @@ int32_t PointsParticleSystemInternal::emitParticles()
 	//
 	auto& center = emitter->getCenter();
 	// spawn
+	Particle particle;
 	auto particlesSpawned = 0;
-	for (auto i = 0; i < particles.size(); i++) {
-		auto& particle = particles[i];
-		if (particle.active == true)
-			continue;
+	while (particlesSpawned < particlesToSpawn && particles.getCount() < particles.getCapacity()) {
 		// emit particle
 		emitter->emit(&particle);
 		// add gravity if our particle have a noticable mass, add translation
@@ -230,11 +236,9 @@ int32_t PointsParticleSystemInternal::emitParticles()
 		if (particle.mass > Math::EPSILON)
 			particle.velocity.sub(Vector3(0.0f, 0.5f * Math::g * static_cast< float >(timeDeltaRnd) / 1000.0f, 0.0f));
 		particle.position.add(velocityForTime.set(particle.velocity).scale(timeDeltaRnd / 1000.0f));
-		//
+		// store particle
+		particles.add(particle);
 		particlesSpawned++;
-		// finished?
-		if (particlesSpawned == particlesToSpawn) break;
-
 	}
 	return particlesSpawned;
 }
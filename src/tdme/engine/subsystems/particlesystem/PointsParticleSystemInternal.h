@@ -13,6 +13,7 @@
 #include <tdme/engine/subsystems/rendering/fwd-tdme.h>
 #include <tdme/engine/subsystems/particlesystem/fwd-tdme.h>
 #include <tdme/engine/subsystems/particlesystem/Particle.h>
+#include <tdme/engine/subsystems/particlesystem/ParticleBuffer.h>
 #include <tdme/engine/subsystems/particlesystem/ParticleEmitter.h>
 #include <tdme/engine/subsystems/renderer/fwd-tdme.h>
 #include <tdme/engine/Transformations.h>
@@ -32,6 +33,7 @@ using tdme::engine::model::Color4;
 using tdme::engine::primitives::BoundingBox;
 using tdme::engine::subsystems::rendering::TransparentRenderPointsPool;
 using tdme::engine::subsystems::particlesystem::Particle;
+using tdme::engine::subsystems::particlesystem::ParticleBuffer;
 using tdme::engine::subsystems::particlesystem::ParticleEmitter;
 using tdme::engine::subsystems::renderer::Renderer;
 using tdme::math::Math;
@@ -56,7 +58,10 @@ protected:
 	bool enabled;
 	bool active;
 	ParticleEmitter* emitter { nullptr };
-	vector<Particle> particles;
+	ParticleBuffer particles;
+	vector<float> pointsX;
+	vector<float> pointsY;
+	vector<float> pointsZ;
 	int32_t maxPoints;
 	float pointSize;
 	float pointSizeScale;
@@ -208,6 +213,13 @@ public:
 	void update() override;
 	void fromTransformations(const Transformations& transformations) override;
 	void updateParticles() override;
+
+	/**
+	 * Update particles with given time delta
+	 * @param timeDelta time delta in milliseconds
+	 */
+	void updateParticles(int64_t timeDelta);
+
 	void dispose();
 	int32_t emitParticles() override;
 	inline const Transformations& getLocalTransformations() override {
@@ -223,6 +235,13 @@ public:
 	 */
 	TransparentRenderPointsPool* getRenderPointsPool();
 
+	/**
+	 * @return alive particle count
+	 */
+	inline int32_t getParticleCount() {
+		return particles.getCount();
+	}
+
 	/**
 	 * Public constructor
 	 * @param id id
@@ -12,6 +12,7 @@ namespace particlesystem {
 	class FogParticleSystemInternal;
 	class ObjectParticleSystemInternal;
 	class Particle;
+	class ParticleBuffer;
 	struct ParticleEmitter;
 	struct ParticleSystemEntityInternal;
 	class ParticlesShader;
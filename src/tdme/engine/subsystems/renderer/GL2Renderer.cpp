@@ -173,6 +173,14 @@ bool GL2Renderer::isGeometryShaderAvailable() {
 	return false;
 }
 
+bool GL2Renderer::isPackedVerticesAvailable() {
+	return false;
+}
+
+bool GL2Renderer::isTextureBufferObjectsAvailable() {
+	return false;
+}
+
 int32_t GL2Renderer::getTextureUnits()
 {
 	return -1;
@@ -592,6 +600,20 @@ void GL2Renderer::uploadBufferObject(void* context, int32_t bufferObjectId, int3
 	glBindBuffer(GL_ARRAY_BUFFER, ID_NONE);
 }
 
+void GL2Renderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ByteBuffer* data)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, bufferObjectId);
+	glBufferData(GL_ARRAY_BUFFER, size, data->getBuffer(), vbosUsage[bufferObjectId]);
+	glBindBuffer(GL_ARRAY_BUFFER, ID_NONE);
+}
+
+void GL2Renderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t offset, int32_t size, FloatBuffer* data)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, bufferObjectId);
+	glBufferSubData(GL_ARRAY_BUFFER, offset, size, data->getBuffer());
+	glBindBuffer(GL_ARRAY_BUFFER, ID_NONE);
+}
+
 void GL2Renderer::uploadIndicesBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data)
 {
 	Console::println(string("GL2Renderer::uploadIndicesBufferObject()::not implemented yet"));
@@ -654,6 +676,11 @@ void GL2Renderer::bindBitangentsBufferObject(void* context, int32_t bufferObject
 	Console::println(string("GL2Renderer::bindBitangentsBufferObject()::not implemented yet"));
 }
 
+void GL2Renderer::bindPackedVerticesBufferObject(void* context, int32_t bufferObjectId)
+{
+	Console::println(string("GL2Renderer::bindPackedVerticesBufferObject()::not implemented yet"));
+}
+
 void GL2Renderer::bindModelMatricesBufferObject(void* context, int32_t bufferObjectId) {
 	Console::println(string("GL2Renderer::bindModelViewMatricesBufferObject()::not implemented yet"));
 }
@@ -723,6 +750,11 @@ void GL2Renderer::disposeBufferObjects(vector<int32_t>& bufferObjectIds)
 	glDeleteBuffers(bufferObjectIds.size(), (const uint32_t*)bufferObjectIds.data());
 }
 
+void GL2Renderer::bindTextureBufferObject(void* context, int32_t textureUnit, int32_t bufferObjectId, bool integer, int32_t components)
+{
+	Console::println("GL2Renderer::bindTextureBufferObject(): Not implemented");
+}
+
 int32_t GL2Renderer::getTextureUnit(void* context)
 {
 	return activeTextureUnit;
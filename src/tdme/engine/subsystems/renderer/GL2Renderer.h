@@ -61,6 +61,8 @@ public:
 	bool isInstancedRenderingAvailable() override;
 	bool isUsingShortIndices() override;
 	bool isGeometryShaderAvailable() override;
+	bool isPackedVerticesAvailable() override;
+	bool isTextureBufferObjectsAvailable() override;
 	int32_t getTextureUnits() override;
 	int32_t loadShader(int32_t type, const string& pathName, const string& fileName, const string& definitions = string(), const string& functions = string()) override;
 	void useProgram(void* context, int32_t programId) override;
@@ -108,6 +110,8 @@ public:
 	void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, FloatBuffer* data) override;
 	void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, IntBuffer* data) override;
 	void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data) override;
+	void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ByteBuffer* data) override;
+	void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t offset, int32_t size, FloatBuffer* data) override;
 	void uploadIndicesBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data) override;
 	void uploadIndicesBufferObject(void* context, int32_t bufferObjectId, int32_t size, IntBuffer* data) override;
 	void bindIndicesBufferObject(void* context, int32_t bufferObjectId) override;
@@ -118,6 +122,7 @@ public:
 	void bindColorsBufferObject(void* context, int32_t bufferObjectId) override;
 	void bindTangentsBufferObject(void* context, int32_t bufferObjectId) override;
 	void bindBitangentsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindPackedVerticesBufferObject(void* context, int32_t bufferObjectId) override;
 	void bindModelMatricesBufferObject(void* context, int32_t bufferObjectId) override;
 	void bindEffectColorMulsBufferObject(void* context, int32_t bufferObjectId) override;
 	void bindEffectColorAddsBufferObject(void* context, int32_t bufferObjectId) override;
@@ -131,6 +136,7 @@ public:
 	void drawLinesFromBufferObjects(void* context, int32_t points, int32_t pointsOffset) override;
 	void unbindBufferObjects(void* context) override;
 	void disposeBufferObjects(vector<int32_t>& bufferObjectIds) override;
+	void bindTextureBufferObject(void* context, int32_t textureUnit, int32_t bufferObjectId, bool integer, int32_t components) override;
 	int32_t getTextureUnit(void* context) override;
 	void setTextureUnit(void* context, int32_t textureUnit) override;
 	float readPixelDepth(int32_t x, int32_t y) override;
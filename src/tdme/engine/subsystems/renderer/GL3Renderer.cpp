@@ -7,6 +7,7 @@
 	#include <GL/glew.h>
 #endif
 
+#include <stddef.h>
 #include <string.h>
 
 #include <array>
@@ -21,6 +22,7 @@
 #include <tdme/utils/ShortBuffer.h>
 #include <tdme/engine/Engine.h>
 #include <tdme/engine/fileio/textures/Texture.h>
+#include <tdme/engine/subsystems/rendering/VertexPacking.h>
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/os/filesystem/FileSystem.h>
 #include <tdme/os/filesystem/FileSystemInterface.h>
@@ -41,6 +43,7 @@ using tdme::utils::IntBuffer;
 using tdme::utils::ShortBuffer;
 using tdme::engine::Engine;
 using tdme::engine::fileio::textures::Texture;
+using tdme::engine::subsystems::rendering::VertexPacking;
 using tdme::math::Matrix4x4;
 using tdme::os::filesystem::FileSystem;
 using tdme::os::filesystem::FileSystemInterface;
@@ -171,6 +174,14 @@ bool GL3Renderer::isGeometryShaderAvailable() {
 	#endif
 }
 
+bool GL3Renderer::isPackedVerticesAvailable() {
+	return true;
+}
+
+bool GL3Renderer::isTextureBufferObjectsAvailable() {
+	return true;
+}
+
 int32_t GL3Renderer::getTextureUnits()
 {
 	return activeTextureUnit;
@@ -572,6 +583,20 @@ void GL3Renderer::uploadBufferObject(void* context, int32_t bufferObjectId, int3
 	glBindBuffer(GL_ARRAY_BUFFER, ID_NONE);
 }
 
+void GL3Renderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ByteBuffer* data)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, bufferObjectId);
+	glBufferData(GL_ARRAY_BUFFER, size, data->getBuffer(), vbosUsage[bufferObjectId]);
+	glBindBuffer(GL_ARRAY_BUFFER, ID_NONE);
+}
+
+void GL3Renderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t offset, int32_t size, FloatBuffer* data)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, bufferObjectId);
+	glBufferSubData(GL_ARRAY_BUFFER, offset, size, data->getBuffer());
+	glBindBuffer(GL_ARRAY_BUFFER, ID_NONE);
+}
+
 void GL3Renderer::uploadIndicesBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data)
 {
 	Console::println(string("GL3Renderer::uploadIndicesBufferObject()::not implemented yet"));
@@ -638,6 +663,26 @@ void GL3Renderer::bindBitangentsBufferObject(void* context, int32_t bufferObject
 	glVertexAttribPointer(5, 3, GL_FLOAT, false, 0, 0LL);
 }
 
+void GL3Renderer::bindPackedVerticesBufferObject(void* context, int32_t bufferObjectId)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, bufferObjectId);
+	// vertices
+	glEnableVertexAttribArray(0);
+	glVertexAttribPointer(0, 3, GL_FLOAT, false, sizeof(VertexPacking::PackedVertex), (void*)offsetof(VertexPacking::PackedVertex, vertex));
+	// normals
+	glEnableVertexAttribArray(1);
+	glVertexAttribPointer(1, 4, GL_INT_2_10_10_10_REV, true, sizeof(VertexPacking::PackedVertex), (void*)offsetof(VertexPacking::PackedVertex, normal));
+	// texture coordinates
+	glEnableVertexAttribArray(2);
+	glVertexAttribPointer(2, 2, GL_HALF_FLOAT, false, sizeof(VertexPacking::PackedVertex), (void*)offsetof(VertexPacking::PackedVertex, textureCoordinate));
+	// tangents, including bitangent sign in w component
+	glEnableVertexAttribArray(4);
+	glVertexAttribPointer(4, 4, GL_INT_2_10_10_10_REV, true, sizeof(VertexPacking::PackedVertex), (void*)offsetof(VertexPacking::PackedVertex, tangent));
+	// bitangents, a null bitangent tells the shader to reconstruct it
+	glDisableVertexAttribArray(5);
+	glVertexAttrib3f(5, 0.0f, 0.0f, 0.0f);
+}
+
 void GL3Renderer::bindModelMatricesBufferObject(void* context, int32_t bufferObjectId) {
 	glBindBuffer(GL_ARRAY_BUFFER, bufferObjectId);
 	glEnableVertexAttribArray(6);
@@ -731,10 +776,45 @@ void GL3Renderer::unbindBufferObjects(void* context)
 
 void GL3Renderer::disposeBufferObjects(vector<int32_t>& bufferObjectIds)
 {
-	for (auto& bufferObjectId: bufferObjectIds) vbosUsage.erase(bufferObjectId);
+	for (auto& bufferObjectId: bufferObjectIds) {
+		vbosUsage.erase(bufferObjectId);
+		// dispose texture buffer object texture if existing
+		auto textureBufferObjectTextureIdIt = textureBufferObjectTextureIds.find(bufferObjectId);
+		if (textureBufferObjectTextureIdIt != textureBufferObjectTextureIds.end()) {
+			glDeleteTextures(1, (const uint32_t*)&textureBufferObjectTextureIdIt->second);
+			textureBufferObjectTextureIds.erase(textureBufferObjectTextureIdIt);
+		}
+	}
 	glDeleteBuffers(bufferObjectIds.size(), (const uint32_t*)bufferObjectIds.data());
 }
 
+void GL3Renderer::bindTextureBufferObject(void* context, int32_t textureUnit, int32_t bufferObjectId, bool integer, int32_t components)
+{
+	// create texture for buffer object if not yet done
+	glActiveTexture(GL_TEXTURE0 + textureUnit);
+	auto textureBufferObjectTextureIdIt = textureBufferObjectTextureIds.find(bufferObjectId);
+	if (textureBufferObjectTextureIdIt == textureBufferObjectTextureIds.end()) {
+		uint32_t textureId;
+		glGenTextures(1, &textureId);
+		glBindTexture(GL_TEXTURE_BUFFER, textureId);
+		GLenum format = GL_NONE;
+		switch (components) {
+			case 1: format = integer == true?GL_R32I:GL_R32F; break;
+			case 2: format = integer == true?GL_RG32I:GL_RG32F; break;
+			case 4: format = integer == true?GL_RGBA32I:GL_RGBA32F; break;
+			default:
+				Console::println("GL3Renderer::bindTextureBufferObject(): unsupported components: " + to_string(components));
+				break;
+		}
+		glTexBuffer(GL_TEXTURE_BUFFER, format, bufferObjectId);
+		textureBufferObjectTextureIds[bufferObjectId] = textureId;
+	} else {
+		glBindTexture(GL_TEXTURE_BUFFER, textureBufferObjectTextureIdIt->second);
+	}
+	// restore active texture unit
+	glActiveTexture(GL_TEXTURE0 + activeTextureUnit);
+}
+
 int32_t GL3Renderer::getTextureUnit(void* context)
 {
 	return activeTextureUnit;
@@ -152,6 +152,14 @@ bool GLES2Renderer::isGeometryShaderAvailable() {
 	return false;
 }
 
+bool GLES2Renderer::isPackedVerticesAvailable() {
+	return false;
+}
+
+bool GLES2Renderer::isTextureBufferObjectsAvailable() {
+	return false;
+}
+
 int32_t GLES2Renderer::getTextureUnits()
 {
 	return -1;
@@ -544,6 +552,20 @@ void GLES2Renderer::uploadBufferObject(void* context, int32_t bufferObjectId, in
 	glBindBuffer(GL_ARRAY_BUFFER, ID_NONE);
 }
 
+void GLES2Renderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ByteBuffer* data)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, bufferObjectId);
+	glBufferData(GL_ARRAY_BUFFER, size, data->getBuffer(), vbosUsage[bufferObjectId]);
+	glBindBuffer(GL_ARRAY_BUFFER, ID_NONE);
+}
+
+void GLES2Renderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t offset, int32_t size, FloatBuffer* data)
+{
+	glBindBuffer(GL_ARRAY_BUFFER, bufferObjectId);
+	glBufferSubData(GL_ARRAY_BUFFER, offset, size, data->getBuffer());
+	glBindBuffer(GL_ARRAY_BUFFER, ID_NONE);
+}
+
 void GLES2Renderer::uploadIndicesBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data)
 {
 	glBindBuffer(GL_ELEMENT_ARRAY_BUFFER, bufferObjectId);
@@ -606,6 +628,11 @@ void GLES2Renderer::bindBitangentsBufferObject(void* context, int32_t bufferObje
 	Console::println("GLES2Renderer::bindBitangentsBufferObject()::not implemented");
 }
 
+void GLES2Renderer::bindPackedVerticesBufferObject(void* context, int32_t bufferObjectId)
+{
+	Console::println("GLES2Renderer::bindPackedVerticesBufferObject()::not implemented");
+}
+
 void GLES2Renderer::bindModelMatricesBufferObject(void* context, int32_t bufferObjectId) {
 	Console::println(string("GLES2Renderer::bindModelViewMatricesBufferObject()::not implemented yet"));
 }
@@ -676,6 +703,11 @@ void GLES2Renderer::disposeBufferObjects(vector<int32_t>& bufferObjectIds)
 	glDeleteBuffers(bufferObjectIds.size(), (const uint32_t*)bufferObjectIds.data());
 }
 
+void GLES2Renderer::bindTextureBufferObject(void* context, int32_t textureUnit, int32_t bufferObjectId, bool integer, int32_t components)
+{
+	Console::println("GLES2Renderer::bindTextureBufferObject(): Not implemented");
+}
+
 int32_t GLES2Renderer::getTextureUnit(void* context)
 {
 	return activeTextureUnit;
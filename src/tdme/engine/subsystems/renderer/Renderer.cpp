@@ -87,3 +87,6 @@ Matrix4x4& Renderer::getViewportMatrix()
 
 void Renderer::initializeFrame() {
 }
+
+void Renderer::onSequencePoint() {
+}
@@ -118,6 +118,12 @@ public:
 	 */
 	virtual bool isSupportingMultithreadedRendering() = 0;
 
+	/**
+	 * Sequence point, which is reached when all engine threads have finished issuing draw calls of a multi threaded render pass
+	 * 	Draw calls issued after a sequence point need to be executed after all draw calls issued before it
+	 */
+	virtual void onSequencePoint();
+
 	/**
 	 * @return if renderer is supporting multiple render queues
 	 */
@@ -176,6 +182,16 @@ public:
 	 */
 	virtual bool isGeometryShaderAvailable() = 0;
 
+	/**
+	 * @return if packed vertices, see VertexPacking, are supported
+	 */
+	virtual bool isPackedVerticesAvailable() = 0;
+
+	/**
+	 * @return if texture buffer objects are supported, which are buffer objects that can be read by shaders as texture buffers
+	 */
+	virtual bool isTextureBufferObjectsAvailable() = 0;
+
 	/**
 	 * @return number of texture units
 	 */
@@ -586,6 +602,25 @@ public:
 	 */
 	virtual void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data) = 0;
 
+	/**
+	 * Uploads buffer data to buffer object
+	 * @param context context
+	 * @param bufferObjectId buffer object id
+	 * @param size size
+	 * @param data data
+	 */
+	virtual void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ByteBuffer* data) = 0;
+
+	/**
+	 * Uploads buffer data to a range of buffer object, buffer object needs to have been uploaded with at least offset + size bytes before
+	 * @param context context
+	 * @param bufferObjectId buffer object id
+	 * @param offset offset in bytes
+	 * @param size size
+	 * @param data data
+	 */
+	virtual void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t offset, int32_t size, FloatBuffer* data) = 0;
+
 	/** 
 	 * Uploads buffer data to buffer object
 	 * @param context context
@@ -660,6 +695,14 @@ public:
 	 */
 	virtual void bindBitangentsBufferObject(void* context, int32_t bufferObjectId) = 0;
 
+	/**
+	 * Bind packed vertices buffer object, which provides vertices, normals, texture coordinates and tangents,
+	 * 	bitangents need to be reconstructed from normal, tangent and bitangent sign in tangent w component by shader
+	 * @param context context
+	 * @param bufferObjectId buffer object id
+	 */
+	virtual void bindPackedVerticesBufferObject(void* context, int32_t bufferObjectId) = 0;
+
 	/** 
 	 * Bind model matrices buffer object
 	 * @param context context
@@ -756,6 +799,16 @@ public:
 	 */
 	virtual void disposeBufferObjects(vector<int32_t>& bufferObjectIds) = 0;
 
+	/**
+	 * Bind buffer object as texture buffer to given texture unit
+	 * @param context context
+	 * @param textureUnit texture unit
+	 * @param bufferObjectId buffer object id
+	 * @param integer if buffer object contains 32 bit integers, otherwise it contains 32 bit floats
+	 * @param components components per texel, which are 1, 2 or 4
+	 */
+	virtual void bindTextureBufferObject(void* context, int32_t textureUnit, int32_t bufferObjectId, bool integer, int32_t components) = 0;
+
 	/** 
 	 * Get texture unit
 	 * @param context context
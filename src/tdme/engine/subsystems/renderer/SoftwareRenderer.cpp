@@ -0,0 +1,1567 @@
+#include <tdme/engine/subsystems/renderer/SoftwareRenderer.h>
+
+#include <string.h>
+
+#include <algorithm>
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <tdme/engine/Engine.h>
+#include <tdme/engine/fileio/textures/Texture.h>
+#include <tdme/math/Math.h>
+#include <tdme/math/Matrix2D3x3.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/math/Vector4.h>
+#include <tdme/os/threading/AtomicOperations.h>
+#include <tdme/os/threading/Mutex.h>
+#include <tdme/os/threading/ReadWriteLock.h>
+#include <tdme/os/threading/Thread.h>
+#include <tdme/utils/Buffer.h>
+#include <tdme/utils/ByteBuffer.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/FloatBuffer.h>
+#include <tdme/utils/IntBuffer.h>
+#include <tdme/utils/ShortBuffer.h>
+
+using std::array;
+using std::max;
+using std::min;
+using std::pair;
+using std::stable_sort;
+using std::string;
+using std::to_string;
+using std::unordered_map;
+using std::vector;
+
+using tdme::engine::subsystems::renderer::SoftwareRenderer;
+using tdme::engine::Engine;
+using tdme::engine::fileio::textures::Texture;
+using tdme::math::Math;
+using tdme::math::Matrix2D3x3;
+using tdme::math::Matrix4x4;
+using tdme::math::Vector4;
+using tdme::os::threading::AtomicOperations;
+using tdme::os::threading::Mutex;
+using tdme::os::threading::ReadWriteLock;
+using tdme::os::threading::Thread;
+using tdme::utils::Buffer;
+using tdme::utils::ByteBuffer;
+using tdme::utils::Console;
+using tdme::utils::FloatBuffer;
+using tdme::utils::IntBuffer;
+using tdme::utils::ShortBuffer;
+
+SoftwareRenderer::RasterizerThread::RasterizerThread(SoftwareRenderer* renderer):
+	Thread("softwarerenderer-rasterizer-thread"),
+	renderer(renderer) {
+}
+
+void SoftwareRenderer::RasterizerThread::run() {
+	while (isStopRequested() == false) {
+		switch(state) {
+			case STATE_WAITING:
+				Thread::nanoSleep(10000LL);
+				break;
+			case STATE_RASTERIZING:
+				renderer->rasterizeTiles();
+				state = STATE_WAITING;
+				break;
+		}
+	}
+}
+
+SoftwareRenderer::SoftwareRenderer():
+	flushMutex("softwarerenderer-flush-mutex"),
+	texturesRWLock("softwarerenderer-textures-rwlock"),
+	buffersRWLock("softwarerenderer-buffers-rwlock")
+{
+	// setup consts
+	ID_NONE = 0;
+	CLEAR_COLOR_BUFFER_BIT = 1;
+	CLEAR_DEPTH_BUFFER_BIT = 2;
+	CULLFACE_FRONT = 1;
+	CULLFACE_BACK = 2;
+	FRONTFACE_CW = 1;
+	FRONTFACE_CCW = 2;
+	SHADER_FRAGMENT_SHADER = 1;
+	SHADER_VERTEX_SHADER = 2;
+	SHADER_GEOMETRY_SHADER = 3;
+	SHADER_COMPUTE_SHADER = 4;
+	DEPTHFUNCTION_ALWAYS = 1;
+	DEPTHFUNCTION_EQUAL = 2;
+	DEPTHFUNCTION_LESSEQUAL = 3;
+	DEPTHFUNCTION_GREATEREQUAL = 4;
+	FRAMEBUFFER_DEFAULT = 0;
+	TEXTUREUNITS_MAX = TEXTUREUNITS;
+	cullFace = CULLFACE_BACK;
+	depthFunction = DEPTHFUNCTION_LESSEQUAL;
+	defaultDepthBuffer.depthTexture = true;
+	// uniforms that drive the fixed function pipeline
+	uniformsByName["mvpMatrix"] = UNIFORM_MVPMATRIX;
+	uniformsByName["mvMatrix"] = UNIFORM_MVMATRIX;
+	uniformsByName["projectionMatrix"] = UNIFORM_PROJECTIONMATRIX;
+	uniformsByName["cameraMatrix"] = UNIFORM_CAMERAMATRIX;
+	uniformsByName["textureMatrix"] = UNIFORM_TEXTUREMATRIX;
+	uniformsByName["material.diffuse"] = UNIFORM_MATERIAL_DIFFUSE;
+	uniformsByName["material.emission"] = UNIFORM_MATERIAL_EMISSION;
+	uniformsByName["u_BaseColorFactor"] = UNIFORM_BASECOLORFACTOR;
+	uniformsByName["effectColorMul"] = UNIFORM_EFFECTCOLORMUL;
+	uniformsByName["effectColorAdd"] = UNIFORM_EFFECTCOLORADD;
+	uniformsByName["diffuseTextureUnit"] = UNIFORM_TEXTUREUNIT;
+	uniformsByName["textureUnit"] = UNIFORM_TEXTUREUNIT;
+	uniformsByName["colorBufferTextureUnit"] = UNIFORM_TEXTUREUNIT;
+	uniformsByName["u_BaseColorSampler"] = UNIFORM_TEXTUREUNIT;
+	uniformsByName["diffuseTextureAvailable"] = UNIFORM_TEXTUREAVAILABLE;
+	uniformsByName["u_BaseColorSamplerAvailable"] = UNIFORM_TEXTUREAVAILABLE;
+	uniformsByName["depthBufferTextureUnit"] = UNIFORM_DEPTHTEXTUREUNIT;
+	uniformsByName["diffuseTextureMaskedTransparency"] = UNIFORM_MASKEDTRANSPARENCY;
+	uniformsByName["diffuseTextureMaskedTransparencyThreshold"] = UNIFORM_MASKEDTRANSPARENCYTHRESHOLD;
+	uniformsByName["pointSize"] = UNIFORM_POINTSIZE;
+	uniformsByName["spritesHorizontal"] = UNIFORM_SPRITESHORIZONTAL;
+	uniformsByName["spritesVertical"] = UNIFORM_SPRITESVERTICAL;
+}
+
+SoftwareRenderer::~SoftwareRenderer() {
+	for (auto rasterizerThread: rasterizerThreads) {
+		rasterizerThread->stop();
+		rasterizerThread->join();
+		delete rasterizerThread;
+	}
+	for (auto& it: textures) delete it.second;
+	for (auto& it: buffers) delete it.second;
+	for (auto& it: programs) delete it.second;
+}
+
+void* SoftwareRenderer::getDefaultContext() {
+	return &contexts[0];
+}
+
+void* SoftwareRenderer::getContext(int contextIdx) {
+	return &contexts[contextIdx];
+}
+
+int SoftwareRenderer::getContextIndex(void* context) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	return contextTyped.idx;
+}
+
+void SoftwareRenderer::initialize()
+{
+	// one context per engine thread, rasterizer threads support the calling thread when flushing
+	auto threadCount = Math::max(Engine::getThreadCount(), 1);
+	contexts.resize(threadCount);
+	for (auto contextIdx = 0; contextIdx < threadCount; contextIdx++) {
+		contexts[contextIdx].idx = contextIdx;
+		contexts[contextIdx].frontFace = FRONTFACE_CCW;
+	}
+	for (auto i = 0; i < threadCount - 1; i++) {
+		auto rasterizerThread = new RasterizerThread(this);
+		rasterizerThread->start();
+		rasterizerThreads.push_back(rasterizerThread);
+	}
+}
+
+void SoftwareRenderer::initializeFrame()
+{
+	Renderer::initializeFrame();
+}
+
+void SoftwareRenderer::finishFrame()
+{
+	flush();
+}
+
+const string SoftwareRenderer::getShaderVersion()
+{
+	return "gl3";
+}
+
+bool SoftwareRenderer::isSupportingMultithreadedRendering() {
+	return true;
+}
+
+void SoftwareRenderer::onSequencePoint() {
+	// engine threads do not issue draw calls at a sequence point
+	sequenceIdx++;
+}
+
+bool SoftwareRenderer::isSupportingMultipleRenderQueues() {
+	return false;
+}
+
+bool SoftwareRenderer::isSupportingVertexArrays() {
+	return false;
+}
+
+bool SoftwareRenderer::isBufferObjectsAvailable()
+{
+	return true;
+}
+
+bool SoftwareRenderer::isDepthTextureAvailable()
+{
+	return true;
+}
+
+bool SoftwareRenderer::isUsingProgramAttributeLocation()
+{
+	return false;
+}
+
+bool SoftwareRenderer::isSpecularMappingAvailable()
+{
+	return false;
+}
+
+bool SoftwareRenderer::isNormalMappingAvailable()
+{
+	return false;
+}
+
+bool SoftwareRenderer::isPBRAvailable()
+{
+	return false;
+}
+
+bool SoftwareRenderer::isInstancedRenderingAvailable() {
+	return true;
+}
+
+bool SoftwareRenderer::isUsingShortIndices() {
+	return false;
+}
+
+bool SoftwareRenderer::isGeometryShaderAvailable() {
+	return false;
+}
+
+bool SoftwareRenderer::isPackedVerticesAvailable() {
+	return false;
+}
+
+bool SoftwareRenderer::isTextureBufferObjectsAvailable() {
+	return false;
+}
+
+int32_t SoftwareRenderer::getTextureUnits()
+{
+	return TEXTUREUNITS;
+}
+
+int32_t SoftwareRenderer::loadShader(int32_t type, const string& pathName, const string& fileName, const string& definitions, const string& functions)
+{
+	// shaders are not executed, so just hand out a handle
+	return ++shaderIdx;
+}
+
+void SoftwareRenderer::useProgram(void* context, int32_t programId)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	auto programIt = programs.find(programId);
+	contextTyped.program = programIt == programs.end()?nullptr:programIt->second;
+}
+
+int32_t SoftwareRenderer::createProgram(int type)
+{
+	auto program = new program_type();
+	program->id = ++programIdx;
+	program->uniforms.fill(-1);
+	programs[program->id] = program;
+	return program->id;
+}
+
+void SoftwareRenderer::attachShaderToProgram(int32_t programId, int32_t shaderId)
+{
+}
+
+bool SoftwareRenderer::linkProgram(int32_t programId)
+{
+	return programs.find(programId) != programs.end();
+}
+
+int32_t SoftwareRenderer::getProgramUniformLocation(int32_t programId, const string& name)
+{
+	auto programIt = programs.find(programId);
+	if (programIt == programs.end()) return -1;
+	auto program = programIt->second;
+	auto uniformLocationIt = program->uniformLocations.find(name);
+	if (uniformLocationIt != program->uniformLocations.end()) return uniformLocationIt->second;
+	// locations are unique across programs, so uniform values can be stored per context by location
+	auto uniformLocation = uniformIdx++;
+	program->uniformLocations[name] = uniformLocation;
+	auto uniformIt = uniformsByName.find(name);
+	if (uniformIt != uniformsByName.end()) program->uniforms[uniformIt->second] = uniformLocation;
+	return uniformLocation;
+}
+
+void SoftwareRenderer::setProgramUniform(context_type& context, int32_t uniformId, const float* data, int32_t size)
+{
+	if (uniformId < 0) return;
+	if (uniformId >= context.uniformValues.size()) context.uniformValues.resize(uniformId + 1, array<float, UNIFORM_SIZE> {  });
+	memcpy(context.uniformValues[uniformId].data(), data, Math::min(size, UNIFORM_SIZE) * sizeof(float));
+}
+
+const array<float, SoftwareRenderer::UNIFORM_SIZE>* SoftwareRenderer::getProgramUniform(context_type& context, Uniform uniform)
+{
+	static const array<float, UNIFORM_SIZE> zeroUniformValue {  };
+	if (context.program == nullptr) return nullptr;
+	auto uniformId = context.program->uniforms[uniform];
+	if (uniformId == -1) return nullptr;
+	// like with GL uniforms that have not been set are zero
+	if (uniformId >= context.uniformValues.size()) return &zeroUniformValue;
+	return &context.uniformValues[uniformId];
+}
+
+void SoftwareRenderer::setProgramUniformInteger(void* context, int32_t uniformId, int32_t value)
+{
+	float data = static_cast<float>(value);
+	setProgramUniform(*static_cast<context_type*>(context), uniformId, &data, 1);
+}
+
+void SoftwareRenderer::setProgramUniformFloat(void* context, int32_t uniformId, float value)
+{
+	setProgramUniform(*static_cast<context_type*>(context), uniformId, &value, 1);
+}
+
+void SoftwareRenderer::setProgramUniformFloatMatrix3x3(void* context, int32_t uniformId, const array<float, 9>& data)
+{
+	setProgramUniform(*static_cast<context_type*>(context), uniformId, data.data(), data.size());
+}
+
+void SoftwareRenderer::setProgramUniformFloatMatrix4x4(void* context, int32_t uniformId, const array<float, 16>& data)
+{
+	setProgramUniform(*static_cast<context_type*>(context), uniformId, data.data(), data.size());
+}
+
+void SoftwareRenderer::setProgramUniformFloatMatrices4x4(void* context, int32_t uniformId, int32_t count, FloatBuffer* data)
+{
+	// only the first matrix is relevant for the fixed function pipeline
+	if (count > 0) setProgramUniform(*static_cast<context_type*>(context), uniformId, (float*)data->getBuffer(), 16);
+}
+
+void SoftwareRenderer::setProgramUniformFloatVec4(void* context, int32_t uniformId, const array<float, 4>& data)
+{
+	setProgramUniform(*static_cast<context_type*>(context), uniformId, data.data(), data.size());
+}
+
+void SoftwareRenderer::setProgramUniformFloatVec3(void* context, int32_t uniformId, const array<float, 3>& data)
+{
+	setProgramUniform(*static_cast<context_type*>(context), uniformId, data.data(), data.size());
+}
+
+void SoftwareRenderer::setProgramUniformFloatVec2(void* context, int32_t uniformId, const array<float, 2>& data)
+{
+	setProgramUniform(*static_cast<context_type*>(context), uniformId, data.data(), data.size());
+}
+
+void SoftwareRenderer::setProgramAttributeLocation(int32_t programId, int32_t location, const string& name)
+{
+}
+
+int32_t SoftwareRenderer::getLighting(void* context) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	return contextTyped.lighting;
+}
+
+void SoftwareRenderer::setLighting(void* context, int32_t lighting) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	contextTyped.lighting = lighting;
+}
+
+void SoftwareRenderer::setViewPort(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+	this->viewPortX = x;
+	this->viewPortY = y;
+	this->viewPortWidth = width;
+	this->viewPortHeight = height;
+	this->pointSize = width > height ? width / 120.0f : height / 120.0f * 16 / 9;
+}
+
+void SoftwareRenderer::updateViewPort()
+{
+	// default frame buffer grows with view port as there is no window that provides it
+	if (boundFrameBufferId != FRAMEBUFFER_DEFAULT) return;
+	auto width = Math::max(defaultColorBuffer.width, viewPortX + viewPortWidth);
+	auto height = Math::max(defaultColorBuffer.height, viewPortY + viewPortHeight);
+	if (width == defaultColorBuffer.width && height == defaultColorBuffer.height) return;
+	flush();
+	resizeTexture(&defaultColorBuffer, width, height);
+	resizeTexture(&defaultDepthBuffer, width, height);
+}
+
+Matrix2D3x3& SoftwareRenderer::getTextureMatrix(void* context) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	return contextTyped.textureMatrix;
+}
+
+void SoftwareRenderer::setClearColor(float red, float green, float blue, float alpha)
+{
+	clearColor = {{ red, green, blue, alpha }};
+}
+
+void SoftwareRenderer::enableCulling(void* context)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	contextTyped.culling = true;
+}
+
+void SoftwareRenderer::disableCulling(void* context)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	contextTyped.culling = false;
+}
+
+void SoftwareRenderer::setFrontFace(void* context, int32_t frontFace)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	contextTyped.frontFace = frontFace;
+}
+
+void SoftwareRenderer::setCullFace(int32_t cullFace)
+{
+	this->cullFace = cullFace;
+}
+
+void SoftwareRenderer::enableBlending()
+{
+	blending = true;
+}
+
+void SoftwareRenderer::disableBlending()
+{
+	blending = false;
+}
+
+void SoftwareRenderer::enableDepthBufferWriting()
+{
+	depthBufferWriting = true;
+}
+
+void SoftwareRenderer::disableDepthBufferWriting()
+{
+	depthBufferWriting = false;
+}
+
+void SoftwareRenderer::disableDepthBufferTest()
+{
+	depthBufferTest = false;
+}
+
+void SoftwareRenderer::enableDepthBufferTest()
+{
+	depthBufferTest = true;
+}
+
+void SoftwareRenderer::setDepthFunction(int32_t depthFunction)
+{
+	this->depthFunction = depthFunction;
+}
+
+void SoftwareRenderer::setColorMask(bool red, bool green, bool blue, bool alpha)
+{
+	colorMask = {{ red, green, blue, alpha }};
+}
+
+void SoftwareRenderer::clear(int32_t mask)
+{
+	flush();
+	texture_type* colorBuffer = &defaultColorBuffer;
+	texture_type* depthBuffer = &defaultDepthBuffer;
+	if (boundFrameBufferId != FRAMEBUFFER_DEFAULT) {
+		auto frameBufferIt = framebuffers.find(boundFrameBufferId);
+		if (frameBufferIt == framebuffers.end()) return;
+		colorBuffer = getTexture(frameBufferIt->second.colorBufferTextureId);
+		depthBuffer = getTexture(frameBufferIt->second.depthBufferTextureId);
+	}
+	if ((mask & CLEAR_COLOR_BUFFER_BIT) == CLEAR_COLOR_BUFFER_BIT && colorBuffer != nullptr) {
+		array<uint8_t, 4> clearColorBytes;
+		for (auto i = 0; i < 4; i++) clearColorBytes[i] = static_cast<uint8_t>(Math::clamp(clearColor[i], 0.0f, 1.0f) * 255.0f + 0.5f);
+		auto pixels = colorBuffer->width * colorBuffer->height;
+		for (auto i = 0; i < pixels; i++) {
+			for (auto j = 0; j < 4; j++) {
+				if (colorMask[j] == true) colorBuffer->colors[i * 4 + j] = clearColorBytes[j];
+			}
+		}
+	}
+	if ((mask & CLEAR_DEPTH_BUFFER_BIT) == CLEAR_DEPTH_BUFFER_BIT && depthBuffer != nullptr && depthBufferWriting == true) {
+		fill(depthBuffer->depths.begin(), depthBuffer->depths.end(), 1.0f);
+	}
+}
+
+SoftwareRenderer::texture_type* SoftwareRenderer::getTexture(int32_t textureId) {
+	if (textureId == ID_NONE) return nullptr;
+	texturesRWLock.readLock();
+	auto textureIt = textures.find(textureId);
+	auto texture = textureIt == textures.end()?nullptr:textureIt->second;
+	texturesRWLock.unlock();
+	return texture;
+}
+
+void SoftwareRenderer::resizeTexture(texture_type* texture, int32_t width, int32_t height) {
+	texture->width = width;
+	texture->height = height;
+	if (texture->depthTexture == true) {
+		texture->depths.assign(width * height, 1.0f);
+	} else {
+		texture->colors.assign(width * height * 4, 0);
+	}
+}
+
+int32_t SoftwareRenderer::createTexture()
+{
+	auto texture = new texture_type();
+	texturesRWLock.writeLock();
+	texture->id = ++textureIdx;
+	textures[texture->id] = texture;
+	texturesRWLock.unlock();
+	return texture->id;
+}
+
+int32_t SoftwareRenderer::createDepthBufferTexture(int32_t width, int32_t height)
+{
+	auto textureId = createTexture();
+	auto texture = getTexture(textureId);
+	texture->depthTexture = true;
+	texture->repeat = false;
+	resizeTexture(texture, width, height);
+	return textureId;
+}
+
+int32_t SoftwareRenderer::createColorBufferTexture(int32_t width, int32_t height)
+{
+	auto textureId = createTexture();
+	resizeTexture(getTexture(textureId), width, height);
+	return textureId;
+}
+
+void SoftwareRenderer::uploadTexture(void* context, Texture* texture)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	auto textureTyped = getTexture(contextTyped.boundTextures[contextTyped.textureUnit]);
+	if (textureTyped == nullptr) return;
+	// pending triangles might sample the previous texture data
+	if (textureTyped->width > 0) flush();
+	auto textureData = texture->getTextureData();
+	auto bytesPerPixel = texture->getDepth() / 8;
+	textureTyped->depthTexture = false;
+	textureTyped->repeat = texture->isRepeat();
+	resizeTexture(textureTyped, texture->getTextureWidth(), texture->getTextureHeight());
+	auto pixels = textureTyped->width * textureTyped->height;
+	for (auto i = 0; i < pixels; i++) {
+		textureTyped->colors[i * 4 + 0] = textureData->get(i * bytesPerPixel + 0);
+		textureTyped->colors[i * 4 + 1] = textureData->get(i * bytesPerPixel + 1);
+		textureTyped->colors[i * 4 + 2] = textureData->get(i * bytesPerPixel + 2);
+		textureTyped->colors[i * 4 + 3] = bytesPerPixel == 4?textureData->get(i * bytesPerPixel + 3):255;
+	}
+}
+
+void SoftwareRenderer::resizeDepthBufferTexture(int32_t textureId, int32_t width, int32_t height)
+{
+	auto texture = getTexture(textureId);
+	if (texture == nullptr) return;
+	flush();
+	resizeTexture(texture, width, height);
+}
+
+void SoftwareRenderer::resizeColorBufferTexture(int32_t textureId, int32_t width, int32_t height)
+{
+	auto texture = getTexture(textureId);
+	if (texture == nullptr) return;
+	flush();
+	resizeTexture(texture, width, height);
+}
+
+void SoftwareRenderer::bindTexture(void* context, int32_t textureId)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	contextTyped.boundTextures[contextTyped.textureUnit] = textureId;
+	onBindTexture(context, textureId);
+}
+
+void SoftwareRenderer::disposeTexture(int32_t textureId)
+{
+	// pending triangles reference textures
+	flush();
+	texturesRWLock.writeLock();
+	auto textureIt = textures.find(textureId);
+	if (textureIt != textures.end()) {
+		delete textureIt->second;
+		textures.erase(textureIt);
+	}
+	texturesRWLock.unlock();
+}
+
+int32_t SoftwareRenderer::createFramebufferObject(int32_t depthBufferTextureGlId, int32_t colorBufferTextureGlId)
+{
+	framebuffer_type frameBuffer;
+	frameBuffer.id = ++frameBufferIdx;
+	frameBuffer.depthBufferTextureId = depthBufferTextureGlId;
+	frameBuffer.colorBufferTextureId = colorBufferTextureGlId;
+	framebuffers[frameBuffer.id] = frameBuffer;
+	return frameBuffer.id;
+}
+
+void SoftwareRenderer::bindFrameBuffer(int32_t frameBufferId)
+{
+	if (frameBufferId == boundFrameBufferId) return;
+	flush();
+	boundFrameBufferId = frameBufferId;
+}
+
+void SoftwareRenderer::disposeFrameBufferObject(int32_t frameBufferId)
+{
+	if (frameBufferId == boundFrameBufferId) {
+		flush();
+		boundFrameBufferId = FRAMEBUFFER_DEFAULT;
+	}
+	framebuffers.erase(frameBufferId);
+}
+
+vector<int32_t> SoftwareRenderer::createBufferObjects(int32_t buffers, bool useGPUMemory, bool shared)
+{
+	vector<int32_t> bufferObjectIds;
+	buffersRWLock.writeLock();
+	for (auto i = 0; i < buffers; i++) {
+		auto buffer = new buffer_type();
+		buffer->id = ++bufferIdx;
+		this->buffers[buffer->id] = buffer;
+		bufferObjectIds.push_back(buffer->id);
+	}
+	buffersRWLock.unlock();
+	return bufferObjectIds;
+}
+
+void SoftwareRenderer::uploadBufferObject(int32_t bufferObjectId, int32_t size, const uint8_t* data)
+{
+	buffersRWLock.readLock();
+	auto bufferIt = buffers.find(bufferObjectId);
+	auto buffer = bufferIt == buffers.end()?nullptr:bufferIt->second;
+	buffersRWLock.unlock();
+	if (buffer == nullptr) return;
+	buffer->data.assign(data, data + size);
+}
+
+void SoftwareRenderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, FloatBuffer* data)
+{
+	uploadBufferObject(bufferObjectId, size, data->getBuffer());
+}
+
+void SoftwareRenderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data)
+{
+	uploadBufferObject(bufferObjectId, size, data->getBuffer());
+}
+
+void SoftwareRenderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ByteBuffer* data)
+{
+	uploadBufferObject(bufferObjectId, size, data->getBuffer());
+}
+
+void SoftwareRenderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, IntBuffer* data)
+{
+	uploadBufferObject(bufferObjectId, size, data->getBuffer());
+}
+
+void SoftwareRenderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t offset, int32_t size, FloatBuffer* data)
+{
+	buffersRWLock.readLock();
+	auto bufferIt = buffers.find(bufferObjectId);
+	auto buffer = bufferIt == buffers.end()?nullptr:bufferIt->second;
+	buffersRWLock.unlock();
+	if (buffer == nullptr || offset + size > buffer->data.size()) return;
+	memcpy(buffer->data.data() + offset, data->getBuffer(), size);
+}
+
+void SoftwareRenderer::uploadIndicesBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data)
+{
+	// widen short indices as indices are fetched as int
+	vector<int32_t> indices(size / sizeof(uint16_t));
+	auto shortIndices = (const uint16_t*)data->getBuffer();
+	for (auto i = 0; i < indices.size(); i++) indices[i] = shortIndices[i];
+	uploadBufferObject(bufferObjectId, indices.size() * sizeof(int32_t), (const uint8_t*)indices.data());
+}
+
+void SoftwareRenderer::uploadIndicesBufferObject(void* context, int32_t bufferObjectId, int32_t size, IntBuffer* data)
+{
+	uploadBufferObject(bufferObjectId, size, data->getBuffer());
+}
+
+void SoftwareRenderer::bindBufferObject(context_type& context, BufferBinding binding, int32_t bufferObjectId)
+{
+	buffersRWLock.readLock();
+	auto bufferIt = buffers.find(bufferObjectId);
+	context.boundBuffers[binding] = bufferIt == buffers.end()?nullptr:bufferIt->second;
+	buffersRWLock.unlock();
+}
+
+void SoftwareRenderer::bindIndicesBufferObject(void* context, int32_t bufferObjectId)
+{
+	bindBufferObject(*static_cast<context_type*>(context), BUFFER_INDICES, bufferObjectId);
+}
+
+void SoftwareRenderer::bindTextureCoordinatesBufferObject(void* context, int32_t bufferObjectId)
+{
+	bindBufferObject(*static_cast<context_type*>(context), BUFFER_TEXTURECOORDINATES, bufferObjectId);
+}
+
+void SoftwareRenderer::bindVerticesBufferObject(void* context, int32_t bufferObjectId)
+{
+	bindBufferObject(*static_cast<context_type*>(context), BUFFER_VERTICES, bufferObjectId);
+}
+
+void SoftwareRenderer::bindNormalsBufferObject(void* context, int32_t bufferObjectId)
+{
+	// no op, lighting is not evaluated
+}
+
+void SoftwareRenderer::bindSpriteIndicesBufferObject(void* context, int32_t bufferObjectId)
+{
+	bindBufferObject(*static_cast<context_type*>(context), BUFFER_SPRITEINDICES, bufferObjectId);
+}
+
+void SoftwareRenderer::bindColorsBufferObject(void* context, int32_t bufferObjectId)
+{
+	bindBufferObject(*static_cast<context_type*>(context), BUFFER_COLORS, bufferObjectId);
+}
+
+void SoftwareRenderer::bindTangentsBufferObject(void* context, int32_t bufferObjectId)
+{
+	// no op, normal mapping is not supported
+}
+
+void SoftwareRenderer::bindBitangentsBufferObject(void* context, int32_t bufferObjectId)
+{
+	// no op, normal mapping is not supported
+}
+
+void SoftwareRenderer::bindPackedVerticesBufferObject(void* context, int32_t bufferObjectId)
+{
+	Console::println("SoftwareRenderer::bindPackedVerticesBufferObject(): Not implemented");
+}
+
+void SoftwareRenderer::bindModelMatricesBufferObject(void* context, int32_t bufferObjectId)
+{
+	bindBufferObject(*static_cast<context_type*>(context), BUFFER_MODELMATRICES, bufferObjectId);
+}
+
+void SoftwareRenderer::bindEffectColorMulsBufferObject(void* context, int32_t bufferObjectId)
+{
+	bindBufferObject(*static_cast<context_type*>(context), BUFFER_EFFECTCOLORMULS, bufferObjectId);
+}
+
+void SoftwareRenderer::bindEffectColorAddsBufferObject(void* context, int32_t bufferObjectId)
+{
+	bindBufferObject(*static_cast<context_type*>(context), BUFFER_EFFECTCOLORADDS, bufferObjectId);
+}
+
+void SoftwareRenderer::bindOrigins(void* context, int32_t bufferObjectId)
+{
+	// no op, origins are only used by shader specific vertex transformations
+}
+
+int32_t SoftwareRenderer::createState(context_type& context)
+{
+	state_type state;
+	auto textureUnit = getProgramUniform(context, UNIFORM_TEXTUREUNIT);
+	auto textureAvailable = getProgramUniform(context, UNIFORM_TEXTUREAVAILABLE);
+	if (textureUnit != nullptr && (textureAvailable == nullptr || static_cast<int32_t>((*textureAvailable)[0]) == 1)) {
+		auto unit = static_cast<int32_t>((*textureUnit)[0]);
+		if (unit >= 0 && unit < TEXTUREUNITS) state.texture = getTexture(context.boundTextures[unit]);
+		if (state.texture != nullptr && state.texture->width == 0) state.texture = nullptr;
+	}
+	auto depthTextureUnit = getProgramUniform(context, UNIFORM_DEPTHTEXTUREUNIT);
+	if (depthTextureUnit != nullptr) {
+		auto unit = static_cast<int32_t>((*depthTextureUnit)[0]);
+		if (unit >= 0 && unit < TEXTUREUNITS) state.depthTexture = getTexture(context.boundTextures[unit]);
+		if (state.depthTexture != nullptr && (state.depthTexture->depthTexture == false || state.depthTexture->width == 0)) state.depthTexture = nullptr;
+	}
+	auto maskedTransparency = getProgramUniform(context, UNIFORM_MASKEDTRANSPARENCY);
+	auto maskedTransparencyThreshold = getProgramUniform(context, UNIFORM_MASKEDTRANSPARENCYTHRESHOLD);
+	if (maskedTransparency != nullptr && maskedTransparencyThreshold != nullptr && static_cast<int32_t>((*maskedTransparency)[0]) == 1) {
+		state.maskedTransparencyThreshold = (*maskedTransparencyThreshold)[0];
+	}
+	state.blending = blending;
+	state.depthBufferTest = depthBufferTest;
+	state.depthBufferWriting = depthBufferWriting;
+	state.depthFunction = depthFunction;
+	state.colorMask = colorMask;
+	state.viewPortX = viewPortX;
+	state.viewPortY = viewPortY;
+	state.viewPortWidth = viewPortWidth;
+	state.viewPortHeight = viewPortHeight;
+	// reuse last state if nothing changed
+	if (context.states.empty() == false) {
+		auto& lastState = context.states[context.states.size() - 1];
+		if (lastState.texture == state.texture &&
+			lastState.depthTexture == state.depthTexture &&
+			lastState.maskedTransparencyThreshold == state.maskedTransparencyThreshold &&
+			lastState.blending == state.blending &&
+			lastState.depthBufferTest == state.depthBufferTest &&
+			lastState.depthBufferWriting == state.depthBufferWriting &&
+			lastState.depthFunction == state.depthFunction &&
+			lastState.colorMask == state.colorMask &&
+			lastState.viewPortX == state.viewPortX &&
+			lastState.viewPortY == state.viewPortY &&
+			lastState.viewPortWidth == state.viewPortWidth &&
+			lastState.viewPortHeight == state.viewPortHeight) {
+			return context.states.size() - 1;
+		}
+	}
+	context.states.push_back(state);
+	return context.states.size() - 1;
+}
+
+void SoftwareRenderer::computeMVPMatrix(context_type& context, int32_t instanceIdx, Matrix4x4& mvpMatrix)
+{
+	auto projectionMatrix = getProgramUniform(context, UNIFORM_PROJECTIONMATRIX);
+	auto cameraMatrix = getProgramUniform(context, UNIFORM_CAMERAMATRIX);
+	auto mvpMatrixUniform = getProgramUniform(context, UNIFORM_MVPMATRIX);
+	if (projectionMatrix != nullptr && cameraMatrix != nullptr) {
+		// instanced rendering provides model matrices per instance
+		auto modelMatrices = context.boundBuffers[BUFFER_MODELMATRICES];
+		if (modelMatrices != nullptr && (instanceIdx + 1) * 16 * sizeof(float) <= modelMatrices->data.size()) {
+			array<float, 16> modelMatrix;
+			memcpy(modelMatrix.data(), &modelMatrices->data[instanceIdx * 16 * sizeof(float)], 16 * sizeof(float));
+			mvpMatrix.set(modelMatrix);
+		} else {
+			mvpMatrix.identity();
+		}
+		Matrix4x4 matrix;
+		mvpMatrix.multiply(matrix.set(*cameraMatrix)).multiply(matrix.set(*projectionMatrix));
+	} else
+	if (mvpMatrixUniform != nullptr) {
+		mvpMatrix.set(*mvpMatrixUniform);
+	} else {
+		// vertices are given in normalized device coordinates, e.g. GUI and frame buffer rendering
+		mvpMatrix.identity();
+	}
+}
+
+void SoftwareRenderer::computeColors(context_type& context, int32_t instanceIdx, array<float, 4>& color, array<float, 4>& colorAdd)
+{
+	color = {{ 1.0f, 1.0f, 1.0f, 1.0f }};
+	colorAdd = {{ 0.0f, 0.0f, 0.0f, 0.0f }};
+	auto materialDiffuse = getProgramUniform(context, UNIFORM_MATERIAL_DIFFUSE);
+	auto materialEmission = getProgramUniform(context, UNIFORM_MATERIAL_EMISSION);
+	auto baseColorFactor = getProgramUniform(context, UNIFORM_BASECOLORFACTOR);
+	if (materialDiffuse != nullptr) {
+		// unlit approximation of lighting model
+		for (auto i = 0; i < 4; i++) color[i] = (*materialDiffuse)[i];
+		if (materialEmission != nullptr) for (auto i = 0; i < 3; i++) color[i] = Math::min(color[i] + (*materialEmission)[i], 1.0f);
+	} else
+	if (baseColorFactor != nullptr) {
+		for (auto i = 0; i < 4; i++) color[i] = (*baseColorFactor)[i];
+	}
+	// effect colors are provided per instance with instanced rendering or as uniforms
+	auto effectColorMuls = context.boundBuffers[BUFFER_EFFECTCOLORMULS];
+	auto effectColorMul = getProgramUniform(context, UNIFORM_EFFECTCOLORMUL);
+	if (effectColorMuls != nullptr && (instanceIdx + 1) * 4 * sizeof(float) <= effectColorMuls->data.size()) {
+		auto effectColorMulData = (const float*)&effectColorMuls->data[instanceIdx * 4 * sizeof(float)];
+		for (auto i = 0; i < 4; i++) color[i]*= effectColorMulData[i];
+	} else
+	if (effectColorMul != nullptr) {
+		for (auto i = 0; i < 4; i++) color[i]*= (*effectColorMul)[i];
+	}
+	auto effectColorAdds = context.boundBuffers[BUFFER_EFFECTCOLORADDS];
+	auto effectColorAdd = getProgramUniform(context, UNIFORM_EFFECTCOLORADD);
+	if (effectColorAdds != nullptr && (instanceIdx + 1) * 4 * sizeof(float) <= effectColorAdds->data.size()) {
+		auto effectColorAddData = (const float*)&effectColorAdds->data[instanceIdx * 4 * sizeof(float)];
+		for (auto i = 0; i < 4; i++) colorAdd[i] = effectColorAddData[i];
+	} else
+	if (effectColorAdd != nullptr) {
+		for (auto i = 0; i < 4; i++) colorAdd[i] = (*effectColorAdd)[i];
+	}
+}
+
+void SoftwareRenderer::fetchVertex(context_type& context, int32_t vertexIdx, int32_t instanceIdx, const Matrix4x4& mvpMatrix, const array<float, 4>& color, const array<float, 4>& colorAdd, vertex_type& vertex)
+{
+	auto vertices = (const float*)context.boundBuffers[BUFFER_VERTICES]->data.data();
+	Vector4 position(vertices[vertexIdx * 3 + 0], vertices[vertexIdx * 3 + 1], vertices[vertexIdx * 3 + 2], 1.0f);
+	Vector4 clipPosition;
+	vertex.position = mvpMatrix.multiply(position, clipPosition).getArray();
+	vertex.color = color;
+	vertex.colorAdd = colorAdd;
+	vertex.textureCoordinate = {{ 0.0f, 0.0f }};
+	auto textureCoordinates = context.boundBuffers[BUFFER_TEXTURECOORDINATES];
+	if (textureCoordinates != nullptr && (vertexIdx + 1) * 2 * sizeof(float) <= textureCoordinates->data.size()) {
+		auto textureCoordinate = (const float*)&textureCoordinates->data[vertexIdx * 2 * sizeof(float)];
+		auto textureMatrix = getProgramUniform(context, UNIFORM_TEXTUREMATRIX);
+		if (textureMatrix != nullptr) {
+			vertex.textureCoordinate[0] = (*textureMatrix)[0] * textureCoordinate[0] + (*textureMatrix)[3] * textureCoordinate[1] + (*textureMatrix)[6];
+			vertex.textureCoordinate[1] = (*textureMatrix)[1] * textureCoordinate[0] + (*textureMatrix)[4] * textureCoordinate[1] + (*textureMatrix)[7];
+		} else {
+			vertex.textureCoordinate[0] = textureCoordinate[0];
+			vertex.textureCoordinate[1] = textureCoordinate[1];
+		}
+	}
+	auto colors = context.boundBuffers[BUFFER_COLORS];
+	if (colors != nullptr && (vertexIdx + 1) * 4 * sizeof(float) <= colors->data.size()) {
+		auto vertexColor = (const float*)&colors->data[vertexIdx * 4 * sizeof(float)];
+		for (auto i = 0; i < 4; i++) vertex.color[i]*= vertexColor[i];
+	}
+}
+
+void SoftwareRenderer::interpolateVertex(const vertex_type& v0, const vertex_type& v1, float t, vertex_type& vertex) {
+	for (auto i = 0; i < 4; i++) {
+		vertex.position[i] = v0.position[i] + (v1.position[i] - v0.position[i]) * t;
+		vertex.color[i] = v0.color[i] + (v1.color[i] - v0.color[i]) * t;
+		vertex.colorAdd[i] = v0.colorAdd[i] + (v1.colorAdd[i] - v0.colorAdd[i]) * t;
+	}
+	for (auto i = 0; i < 2; i++) {
+		vertex.textureCoordinate[i] = v0.textureCoordinate[i] + (v1.textureCoordinate[i] - v0.textureCoordinate[i]) * t;
+	}
+}
+
+void SoftwareRenderer::transformToWindow(const vertex_type& vertex, window_position_type& position, window_attributes_type& attributes) {
+	auto oneOverW = 1.0f / vertex.position[3];
+	position[0] = viewPortX + (vertex.position[0] * oneOverW + 1.0f) * 0.5f * viewPortWidth;
+	position[1] = viewPortY + (vertex.position[1] * oneOverW + 1.0f) * 0.5f * viewPortHeight;
+	position[2] = (vertex.position[2] * oneOverW + 1.0f) * 0.5f;
+	position[3] = oneOverW;
+	for (auto i = 0; i < 4; i++) {
+		attributes[i] = vertex.color[i] * oneOverW;
+		attributes[4 + i] = vertex.colorAdd[i] * oneOverW;
+	}
+	attributes[8] = vertex.textureCoordinate[0] * oneOverW;
+	attributes[9] = vertex.textureCoordinate[1] * oneOverW;
+}
+
+void SoftwareRenderer::emitTriangle(context_type& context, const vertex_type& v0, const vertex_type& v1, const vertex_type& v2, int32_t stateIdx, bool cull)
+{
+	// clip against near plane, which is z >= -w in clip space
+	const vertex_type* vertices[] = { &v0, &v1, &v2 };
+	array<float, 3> distances;
+	auto inside = 0;
+	for (auto i = 0; i < 3; i++) {
+		distances[i] = vertices[i]->position[2] + vertices[i]->position[3];
+		if (distances[i] >= 0.0f) inside++;
+	}
+	if (inside == 0) return;
+	if (inside == 3) {
+		emitClippedTriangle(context, v0, v1, v2, stateIdx, cull);
+		return;
+	}
+	array<vertex_type, 4> polygon;
+	auto polygonVertexCount = 0;
+	for (auto i = 0; i < 3; i++) {
+		auto j = (i + 1) % 3;
+		if (distances[i] >= 0.0f) polygon[polygonVertexCount++] = *vertices[i];
+		if ((distances[i] >= 0.0f) != (distances[j] >= 0.0f)) {
+			interpolateVertex(*vertices[i], *vertices[j], distances[i] / (distances[i] - distances[j]), polygon[polygonVertexCount++]);
+		}
+	}
+	for (auto i = 1; i < polygonVertexCount - 1; i++) {
+		emitClippedTriangle(context, polygon[0], polygon[i], polygon[i + 1], stateIdx, cull);
+	}
+}
+
+void SoftwareRenderer::emitClippedTriangle(context_type& context, const vertex_type& v0, const vertex_type& v1, const vertex_type& v2, int32_t stateIdx, bool cull)
+{
+	// vertices on near plane with w == 0 can not be projected
+	if (v0.position[3] <= Math::EPSILON || v1.position[3] <= Math::EPSILON || v2.position[3] <= Math::EPSILON) return;
+	array<window_position_type, 3> positions;
+	array<window_attributes_type, 3> attributes;
+	transformToWindow(v0, positions[0], attributes[0]);
+	transformToWindow(v1, positions[1], attributes[1]);
+	transformToWindow(v2, positions[2], attributes[2]);
+	auto area =
+		(positions[1][0] - positions[0][0]) * (positions[2][1] - positions[0][1]) -
+		(positions[2][0] - positions[0][0]) * (positions[1][1] - positions[0][1]);
+	if (area == 0.0f) return;
+	if (cull == true && context.culling == true) {
+		auto frontFacing = context.frontFace == FRONTFACE_CCW?area > 0.0f:area < 0.0f;
+		if (cullFace == CULLFACE_BACK && frontFacing == false) return;
+		if (cullFace == CULLFACE_FRONT && frontFacing == true) return;
+	}
+	emitWindowTriangle(context, positions[0], attributes[0], positions[1], attributes[1], positions[2], attributes[2], stateIdx);
+}
+
+void SoftwareRenderer::emitWindowTriangle(context_type& context, const window_position_type& p0, const window_attributes_type& a0, const window_position_type& p1, const window_attributes_type& a1, const window_position_type& p2, const window_attributes_type& a2, int32_t stateIdx)
+{
+	triangle_type triangle;
+	triangle.positions[0] = p0;
+	triangle.positions[1] = p1;
+	triangle.positions[2] = p2;
+	triangle.attributes[0] = a0;
+	triangle.attributes[1] = a1;
+	triangle.attributes[2] = a2;
+	triangle.stateIdx = stateIdx;
+	context.triangles.push_back(triangle);
+}
+
+void SoftwareRenderer::beginBatch(context_type& context)
+{
+	batch_type batch;
+	batch.sequenceIdx = sequenceIdx;
+	batch.contextIdx = context.idx;
+	batch.triangleIdx = context.triangles.size();
+	batch.triangleCount = 0;
+	context.batches.push_back(batch);
+}
+
+void SoftwareRenderer::drawTriangles(context_type& context, int32_t vertexCount, int32_t vertexOffset, int32_t instances, bool indexed)
+{
+	auto verticesBuffer = context.boundBuffers[BUFFER_VERTICES];
+	auto indicesBuffer = context.boundBuffers[BUFFER_INDICES];
+	if (context.program == nullptr || verticesBuffer == nullptr || (indexed == true && indicesBuffer == nullptr)) return;
+	auto vertices = static_cast<int32_t>(verticesBuffer->data.size() / (3 * sizeof(float)));
+	auto indices = indexed == true?(const int32_t*)indicesBuffer->data.data():nullptr;
+	auto indexCount = indexed == true?static_cast<int32_t>(indicesBuffer->data.size() / sizeof(int32_t)):0;
+	if (indexed == true && vertexOffset + vertexCount > indexCount) return;
+	beginBatch(context);
+	auto stateIdx = createState(context);
+	Matrix4x4 mvpMatrix;
+	array<float, 4> color;
+	array<float, 4> colorAdd;
+	array<vertex_type, 3> triangleVertices;
+	for (auto instanceIdx = 0; instanceIdx < instances; instanceIdx++) {
+		computeMVPMatrix(context, instanceIdx, mvpMatrix);
+		computeColors(context, instanceIdx, color, colorAdd);
+		for (auto i = 0; i + 2 < vertexCount; i+= 3) {
+			auto valid = true;
+			for (auto j = 0; j < 3; j++) {
+				auto vertexIdx = indexed == true?indices[vertexOffset + i + j]:vertexOffset + i + j;
+				if (vertexIdx < 0 || vertexIdx >= vertices) {
+					valid = false;
+					break;
+				}
+				fetchVertex(context, vertexIdx, instanceIdx, mvpMatrix, color, colorAdd, triangleVertices[j]);
+			}
+			if (valid == true) emitTriangle(context, triangleVertices[0], triangleVertices[1], triangleVertices[2], stateIdx, true);
+		}
+	}
+}
+
+void SoftwareRenderer::drawInstancedIndexedTrianglesFromBufferObjects(void* context, int32_t triangles, int32_t trianglesOffset, int32_t instances)
+{
+	drawTriangles(*static_cast<context_type*>(context), triangles * 3, trianglesOffset * 3, instances, true);
+}
+
+void SoftwareRenderer::drawIndexedTrianglesFromBufferObjects(void* context, int32_t triangles, int32_t trianglesOffset)
+{
+	drawTriangles(*static_cast<context_type*>(context), triangles * 3, trianglesOffset * 3, 1, true);
+}
+
+void SoftwareRenderer::drawInstancedTrianglesFromBufferObjects(void* context, int32_t triangles, int32_t trianglesOffset, int32_t instances)
+{
+	drawTriangles(*static_cast<context_type*>(context), triangles * 3, trianglesOffset * 3, instances, false);
+}
+
+void SoftwareRenderer::drawTrianglesFromBufferObjects(void* context, int32_t triangles, int32_t trianglesOffset)
+{
+	drawTriangles(*static_cast<context_type*>(context), triangles * 3, trianglesOffset * 3, 1, false);
+}
+
+void SoftwareRenderer::drawPointsFromBufferObjects(void* context, int32_t points, int32_t pointsOffset)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	auto verticesBuffer = contextTyped.boundBuffers[BUFFER_VERTICES];
+	if (contextTyped.program == nullptr || verticesBuffer == nullptr) return;
+	auto vertices = static_cast<int32_t>(verticesBuffer->data.size() / (3 * sizeof(float)));
+	beginBatch(contextTyped);
+	auto stateIdx = createState(contextTyped);
+	Matrix4x4 mvpMatrix;
+	array<float, 4> color;
+	array<float, 4> colorAdd;
+	computeMVPMatrix(contextTyped, 0, mvpMatrix);
+	computeColors(contextTyped, 0, color, colorAdd);
+	auto pointSizeUniform = getProgramUniform(contextTyped, UNIFORM_POINTSIZE);
+	auto mvMatrixUniform = getProgramUniform(contextTyped, UNIFORM_MVMATRIX);
+	auto spritesHorizontalUniform = getProgramUniform(contextTyped, UNIFORM_SPRITESHORIZONTAL);
+	auto spritesVerticalUniform = getProgramUniform(contextTyped, UNIFORM_SPRITESVERTICAL);
+	auto spritesHorizontal = spritesHorizontalUniform == nullptr?1.0f:Math::max((*spritesHorizontalUniform)[0], 1.0f);
+	auto spritesVertical = spritesVerticalUniform == nullptr?1.0f:Math::max((*spritesVerticalUniform)[0], 1.0f);
+	auto spriteIndices = contextTyped.boundBuffers[BUFFER_SPRITEINDICES];
+	Matrix4x4 mvMatrix;
+	if (mvMatrixUniform != nullptr) mvMatrix.set(*mvMatrixUniform);
+	vertex_type vertex;
+	for (auto pointIdx = pointsOffset; pointIdx < pointsOffset + points && pointIdx < vertices; pointIdx++) {
+		fetchVertex(contextTyped, pointIdx, 0, mvpMatrix, color, colorAdd, vertex);
+		// points get clipped as a whole
+		if (vertex.position[3] <= Math::EPSILON || vertex.position[2] < -vertex.position[3]) continue;
+		// point size like particles shader does
+		auto pointSize = pointSizeUniform == nullptr?1.0f:(*pointSizeUniform)[0];
+		if (mvMatrixUniform != nullptr) {
+			auto vertices = (const float*)verticesBuffer->data.data();
+			Vector4 viewPosition;
+			mvMatrix.multiply(Vector4(vertices[pointIdx * 3 + 0], vertices[pointIdx * 3 + 1], vertices[pointIdx * 3 + 2], 1.0f), viewPosition);
+			if (viewPosition.getZ() >= 0.0f) continue;
+			pointSize = pointSize * -1.0f / viewPosition.getZ();
+		}
+		// sprite texture coordinates like particles shader does, point coordinates start at left top
+		auto spriteIdx = 0;
+		if (spriteIndices != nullptr && (pointIdx + 1) * sizeof(uint16_t) <= spriteIndices->data.size()) {
+			spriteIdx = ((const uint16_t*)spriteIndices->data.data())[pointIdx];
+		}
+		auto spriteU = (1.0f / spritesHorizontal) * (spriteIdx % 4);
+		auto spriteV = 1.0f - (1.0f / spritesHorizontal) * (spriteIdx / 4);
+		window_position_type position;
+		window_attributes_type attributes;
+		transformToWindow(vertex, position, attributes);
+		array<window_position_type, 4> positions;
+		array<window_attributes_type, 4> cornerAttributes;
+		array<array<float, 2>, 4> pointCoordinates {{ {{ 0.0f, 1.0f }}, {{ 1.0f, 1.0f }}, {{ 1.0f, 0.0f }}, {{ 0.0f, 0.0f }} }};
+		for (auto i = 0; i < 4; i++) {
+			positions[i] = position;
+			positions[i][0]+= (pointCoordinates[i][0] - 0.5f) * pointSize;
+			positions[i][1]+= (0.5f - pointCoordinates[i][1]) * pointSize;
+			cornerAttributes[i] = attributes;
+			cornerAttributes[i][8] = (pointCoordinates[i][0] / spritesHorizontal + spriteU) * position[3];
+			cornerAttributes[i][9] = (pointCoordinates[i][1] / spritesVertical + spriteV) * position[3];
+		}
+		emitWindowTriangle(contextTyped, positions[0], cornerAttributes[0], positions[1], cornerAttributes[1], positions[2], cornerAttributes[2], stateIdx);
+		emitWindowTriangle(contextTyped, positions[2], cornerAttributes[2], positions[3], cornerAttributes[3], positions[0], cornerAttributes[0], stateIdx);
+	}
+}
+
+void SoftwareRenderer::setLineWidth(float lineWidth)
+{
+	this->lineWidth = lineWidth;
+}
+
+void SoftwareRenderer::drawLinesFromBufferObjects(void* context, int32_t points, int32_t pointsOffset)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	auto verticesBuffer = contextTyped.boundBuffers[BUFFER_VERTICES];
+	if (contextTyped.program == nullptr || verticesBuffer == nullptr) return;
+	auto vertices = static_cast<int32_t>(verticesBuffer->data.size() / (3 * sizeof(float)));
+	beginBatch(contextTyped);
+	auto stateIdx = createState(contextTyped);
+	Matrix4x4 mvpMatrix;
+	array<float, 4> color;
+	array<float, 4> colorAdd;
+	computeMVPMatrix(contextTyped, 0, mvpMatrix);
+	computeColors(contextTyped, 0, color, colorAdd);
+	array<vertex_type, 2> lineVertices;
+	for (auto pointIdx = pointsOffset; pointIdx + 1 < pointsOffset + points && pointIdx + 1 < vertices; pointIdx+= 2) {
+		fetchVertex(contextTyped, pointIdx, 0, mvpMatrix, color, colorAdd, lineVertices[0]);
+		fetchVertex(contextTyped, pointIdx + 1, 0, mvpMatrix, color, colorAdd, lineVertices[1]);
+		// clip against near plane
+		auto distance0 = lineVertices[0].position[2] + lineVertices[0].position[3];
+		auto distance1 = lineVertices[1].position[2] + lineVertices[1].position[3];
+		if (distance0 < 0.0f && distance1 < 0.0f) continue;
+		if (distance0 < 0.0f) interpolateVertex(lineVertices[0], lineVertices[1], distance0 / (distance0 - distance1), lineVertices[0]);
+		if (distance1 < 0.0f) interpolateVertex(lineVertices[1], lineVertices[0], distance1 / (distance1 - distance0), lineVertices[1]);
+		if (lineVertices[0].position[3] <= Math::EPSILON || lineVertices[1].position[3] <= Math::EPSILON) continue;
+		// lines are rendered as window space quads with line width, textures are sampled at their center
+		array<window_position_type, 2> positions;
+		array<window_attributes_type, 2> attributes;
+		for (auto i = 0; i < 2; i++) {
+			lineVertices[i].textureCoordinate = {{ 0.5f, 0.5f }};
+			transformToWindow(lineVertices[i], positions[i], attributes[i]);
+		}
+		auto dx = positions[1][0] - positions[0][0];
+		auto dy = positions[1][1] - positions[0][1];
+		auto length = Math::sqrt(dx * dx + dy * dy);
+		if (length < Math::EPSILON) continue;
+		auto nx = -dy / length * lineWidth * 0.5f;
+		auto ny = dx / length * lineWidth * 0.5f;
+		array<window_position_type, 4> quadPositions { positions[0], positions[1], positions[1], positions[0] };
+		quadPositions[0][0]+= nx; quadPositions[0][1]+= ny;
+		quadPositions[1][0]+= nx; quadPositions[1][1]+= ny;
+		quadPositions[2][0]-= nx; quadPositions[2][1]-= ny;
+		quadPositions[3][0]-= nx; quadPositions[3][1]-= ny;
+		emitWindowTriangle(contextTyped, quadPositions[0], attributes[0], quadPositions[1], attributes[1], quadPositions[2], attributes[1], stateIdx);
+		emitWindowTriangle(contextTyped, quadPositions[2], attributes[1], quadPositions[3], attributes[0], quadPositions[0], attributes[0], stateIdx);
+	}
+}
+
+void SoftwareRenderer::unbindBufferObjects(void* context)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	contextTyped.boundBuffers.fill(nullptr);
+}
+
+void SoftwareRenderer::disposeBufferObjects(vector<int32_t>& bufferObjectIds)
+{
+	buffersRWLock.writeLock();
+	for (auto bufferObjectId: bufferObjectIds) {
+		auto bufferIt = buffers.find(bufferObjectId);
+		if (bufferIt == buffers.end()) continue;
+		for (auto& context: contexts) {
+			for (auto& boundBuffer: context.boundBuffers) {
+				if (boundBuffer == bufferIt->second) boundBuffer = nullptr;
+			}
+		}
+		delete bufferIt->second;
+		buffers.erase(bufferIt);
+	}
+	buffersRWLock.unlock();
+}
+
+void SoftwareRenderer::bindTextureBufferObject(void* context, int32_t textureUnit, int32_t bufferObjectId, bool integer, int32_t components)
+{
+	Console::println("SoftwareRenderer::bindTextureBufferObject(): Not implemented");
+}
+
+int32_t SoftwareRenderer::getTextureUnit(void* context)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	return contextTyped.textureUnit;
+}
+
+void SoftwareRenderer::setTextureUnit(void* context, int32_t textureUnit)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	contextTyped.textureUnit = Math::clamp(textureUnit, 0, TEXTUREUNITS - 1);
+}
+
+Renderer_Light& SoftwareRenderer::getLight(void* context, int32_t lightId) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	return contextTyped.lights[lightId];
+}
+
+array<float, 4>& SoftwareRenderer::getEffectColorMul(void* context) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	return contextTyped.effectColorMul;
+}
+
+array<float, 4>& SoftwareRenderer::getEffectColorAdd(void* context) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	return contextTyped.effectColorAdd;
+}
+
+Renderer_SpecularMaterial& SoftwareRenderer::getSpecularMaterial(void* context) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	return contextTyped.specularMaterial;
+}
+
+const string SoftwareRenderer::getShader(void* context) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	return contextTyped.shader;
+}
+
+void SoftwareRenderer::setShader(void* context, const string& id) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	contextTyped.shader = id;
+}
+
+void SoftwareRenderer::flush()
+{
+	flushMutex.lock();
+
+	// collect batches of all contexts in order of sequence points, then in context index order and in submission order within a context
+	//	draw calls of different contexts are issued concurrently by engine threads, so a global submission order only exists between sequence points
+	vector<batch_type> batches;
+	for (auto& context: contexts) {
+		for (auto i = 0; i < context.batches.size(); i++) {
+			auto& batch = context.batches[i];
+			batch.triangleCount = (i + 1 < context.batches.size()?context.batches[i + 1].triangleIdx:context.triangles.size()) - batch.triangleIdx;
+			if (batch.triangleCount > 0) batches.push_back(batch);
+		}
+	}
+	stable_sort(
+		batches.begin(),
+		batches.end(),
+		[](const batch_type& batch1, const batch_type& batch2) {
+			return batch1.sequenceIdx < batch2.sequenceIdx;
+		}
+	);
+
+	// determine frame buffer
+	rasterizerColorBuffer = &defaultColorBuffer;
+	rasterizerDepthBuffer = &defaultDepthBuffer;
+	if (boundFrameBufferId != FRAMEBUFFER_DEFAULT) {
+		auto frameBufferIt = framebuffers.find(boundFrameBufferId);
+		rasterizerColorBuffer = frameBufferIt == framebuffers.end()?nullptr:getTexture(frameBufferIt->second.colorBufferTextureId);
+		rasterizerDepthBuffer = frameBufferIt == framebuffers.end()?nullptr:getTexture(frameBufferIt->second.depthBufferTextureId);
+	}
+	auto width = rasterizerColorBuffer != nullptr?rasterizerColorBuffer->width:(rasterizerDepthBuffer != nullptr?rasterizerDepthBuffer->width:0);
+	auto height = rasterizerColorBuffer != nullptr?rasterizerColorBuffer->height:(rasterizerDepthBuffer != nullptr?rasterizerDepthBuffer->height:0);
+	if (rasterizerDepthBuffer != nullptr && (rasterizerDepthBuffer->width != width || rasterizerDepthBuffer->height != height)) rasterizerDepthBuffer = nullptr;
+
+	if (batches.empty() == false && width > 0 && height > 0) {
+		// bin triangles into tiles
+		auto tilesHorizontal = (width + TILE_SIZE - 1) / TILE_SIZE;
+		auto tilesVertical = (height + TILE_SIZE - 1) / TILE_SIZE;
+		tiles.resize(tilesHorizontal * tilesVertical);
+		for (auto y = 0; y < tilesVertical; y++) {
+			for (auto x = 0; x < tilesHorizontal; x++) {
+				auto& tile = tiles[y * tilesHorizontal + x];
+				tile.left = x * TILE_SIZE;
+				tile.bottom = y * TILE_SIZE;
+				tile.right = Math::min((x + 1) * TILE_SIZE, width) - 1;
+				tile.top = Math::min((y + 1) * TILE_SIZE, height) - 1;
+				tile.triangles.clear();
+			}
+		}
+		for (auto& batch: batches) {
+			auto& context = contexts[batch.contextIdx];
+			for (auto i = batch.triangleIdx; i < batch.triangleIdx + batch.triangleCount; i++) {
+				auto& triangle = context.triangles[i];
+				auto& state = context.states[triangle.stateIdx];
+				auto left = Math::max(Math::max(static_cast<int32_t>(Math::floor(Math::min(Math::min(triangle.positions[0][0], triangle.positions[1][0]), triangle.positions[2][0]))), state.viewPortX), 0);
+				auto right = Math::min(Math::min(static_cast<int32_t>(Math::ceil(Math::max(Math::max(triangle.positions[0][0], triangle.positions[1][0]), triangle.positions[2][0]))), state.viewPortX + state.viewPortWidth - 1), width - 1);
+				auto bottom = Math::max(Math::max(static_cast<int32_t>(Math::floor(Math::min(Math::min(triangle.positions[0][1], triangle.positions[1][1]), triangle.positions[2][1]))), state.viewPortY), 0);
+				auto top = Math::min(Math::min(static_cast<int32_t>(Math::ceil(Math::max(Math::max(triangle.positions[0][1], triangle.positions[1][1]), triangle.positions[2][1]))), state.viewPortY + state.viewPortHeight - 1), height - 1);
+				if (left > right || bottom > top) continue;
+				for (auto y = bottom / TILE_SIZE; y <= top / TILE_SIZE; y++) {
+					for (auto x = left / TILE_SIZE; x <= right / TILE_SIZE; x++) {
+						tiles[y * tilesHorizontal + x].triangles.push_back(pair<const triangle_type*, const state_type*>(&triangle, &state));
+					}
+				}
+			}
+		}
+
+		// rasterize tiles, tiles do not overlap, so the result does not depend on thread count
+		tileIdx = 0LL;
+		for (auto rasterizerThread: rasterizerThreads) rasterizerThread->state = RasterizerThread::STATE_RASTERIZING;
+		rasterizeTiles();
+		for (auto rasterizerThread: rasterizerThreads) while (rasterizerThread->state == RasterizerThread::STATE_RASTERIZING);
+	}
+
+	// reset
+	for (auto& context: contexts) {
+		context.states.clear();
+		context.triangles.clear();
+		context.batches.clear();
+	}
+	sequenceIdx = 0;
+
+	flushMutex.unlock();
+}
+
+void SoftwareRenderer::rasterizeTiles()
+{
+	uint64_t i;
+	while ((i = AtomicOperations::add(tileIdx) - 1) < tiles.size()) {
+		auto& tile = tiles[i];
+		for (auto& triangle: tile.triangles) rasterizeTriangle(tile, *triangle.first, *triangle.second);
+	}
+}
+
+void SoftwareRenderer::sampleTexture(const texture_type* texture, float u, float v, array<float, 4>& color) {
+	auto x = static_cast<int32_t>(Math::floor(u * texture->width));
+	auto y = static_cast<int32_t>(Math::floor(v * texture->height));
+	if (texture->repeat == true) {
+		x = ((x % texture->width) + texture->width) % texture->width;
+		y = ((y % texture->height) + texture->height) % texture->height;
+	} else {
+		x = Math::clamp(x, 0, texture->width - 1);
+		y = Math::clamp(y, 0, texture->height - 1);
+	}
+	if (texture->depthTexture == true) {
+		auto depth = texture->depths[y * texture->width + x];
+		color = {{ depth, depth, depth, 1.0f }};
+		return;
+	}
+	auto texel = &texture->colors[(y * texture->width + x) * 4];
+	for (auto i = 0; i < 4; i++) color[i] = texel[i] / 255.0f;
+}
+
+void SoftwareRenderer::rasterizeTriangle(const tile_type& tile, const triangle_type& triangle, const state_type& state)
+{
+	auto& p0 = triangle.positions[0];
+	auto& p1 = triangle.positions[1];
+	auto& p2 = triangle.positions[2];
+	auto area = (p1[0] - p0[0]) * (p2[1] - p0[1]) - (p2[0] - p0[0]) * (p1[1] - p0[1]);
+	if (area == 0.0f) return;
+	// bounding box within tile and view port
+	auto left = Math::max(Math::max(static_cast<int32_t>(Math::floor(Math::min(Math::min(p0[0], p1[0]), p2[0]))), state.viewPortX), tile.left);
+	auto right = Math::min(Math::min(static_cast<int32_t>(Math::ceil(Math::max(Math::max(p0[0], p1[0]), p2[0]))), state.viewPortX + state.viewPortWidth - 1), tile.right);
+	auto bottom = Math::max(Math::max(static_cast<int32_t>(Math::floor(Math::min(Math::min(p0[1], p1[1]), p2[1]))), state.viewPortY), tile.bottom);
+	auto top = Math::min(Math::min(static_cast<int32_t>(Math::ceil(Math::max(Math::max(p0[1], p1[1]), p2[1]))), state.viewPortY + state.viewPortHeight - 1), tile.top);
+	if (left > right || bottom > top) return;
+	// edge functions, normalized to positive area
+	auto areaSign = area > 0.0f?1.0f:-1.0f;
+	auto oneOverArea = 1.0f / (area * areaSign);
+	array<float, 3> edgeStepX {{ (p1[1] - p2[1]) * areaSign, (p2[1] - p0[1]) * areaSign, (p0[1] - p1[1]) * areaSign }};
+	array<float, 3> edgeStepY {{ (p2[0] - p1[0]) * areaSign, (p0[0] - p2[0]) * areaSign, (p1[0] - p0[0]) * areaSign }};
+	auto startX = left + 0.5f;
+	auto startY = bottom + 0.5f;
+	array<float, 3> edgeRow {{
+		((p2[0] - p1[0]) * (startY - p1[1]) - (p2[1] - p1[1]) * (startX - p1[0])) * areaSign,
+		((p0[0] - p2[0]) * (startY - p2[1]) - (p0[1] - p2[1]) * (startX - p2[0])) * areaSign,
+		((p1[0] - p0[0]) * (startY - p0[1]) - (p1[1] - p0[1]) * (startX - p0[0])) * areaSign
+	}};
+	auto colorBuffer = rasterizerColorBuffer;
+	auto depthBuffer = rasterizerDepthBuffer;
+	auto frameBufferWidth = colorBuffer != nullptr?colorBuffer->width:depthBuffer->width;
+	auto& a0 = triangle.attributes[0];
+	auto& a1 = triangle.attributes[1];
+	auto& a2 = triangle.attributes[2];
+	array<float, 10> attributes;
+	array<float, 4> texel;
+	array<float, 4> color;
+	for (auto y = bottom; y <= top; y++) {
+		array<float, 3> edge = edgeRow;
+		for (auto x = left; x <= right; x++) {
+			if (edge[0] >= 0.0f && edge[1] >= 0.0f && edge[2] >= 0.0f) {
+				auto b0 = edge[0] * oneOverArea;
+				auto b1 = edge[1] * oneOverArea;
+				auto b2 = edge[2] * oneOverArea;
+				auto pixelIdx = y * frameBufferWidth + x;
+				// perspective correct attributes
+				auto oneOverW = b0 * p0[3] + b1 * p1[3] + b2 * p2[3];
+				auto w = 1.0f / oneOverW;
+				for (auto i = 0; i < 10; i++) attributes[i] = (b0 * a0[i] + b1 * a1[i] + b2 * a2[i]) * w;
+				// depth
+				auto depth = b0 * p0[2] + b1 * p1[2] + b2 * p2[2];
+				if (state.depthTexture != nullptr) {
+					sampleTexture(state.depthTexture, attributes[8], attributes[9], texel);
+					depth = texel[0];
+				}
+				auto fragmentVisible = depth >= 0.0f && depth <= 1.0f;
+				if (fragmentVisible == true && state.depthBufferTest == true && depthBuffer != nullptr) {
+					auto bufferDepth = depthBuffer->depths[pixelIdx];
+					if (state.depthFunction == DEPTHFUNCTION_LESSEQUAL) {
+						fragmentVisible = depth <= bufferDepth;
+					} else
+					if (state.depthFunction == DEPTHFUNCTION_GREATEREQUAL) {
+						fragmentVisible = depth >= bufferDepth;
+					} else
+					if (state.depthFunction == DEPTHFUNCTION_EQUAL) {
+						fragmentVisible = Math::abs(depth - bufferDepth) <= Math::EPSILON;
+					}
+				}
+				// color
+				if (fragmentVisible == true) {
+					for (auto i = 0; i < 4; i++) color[i] = attributes[i];
+					if (state.texture != nullptr) {
+						sampleTexture(state.texture, attributes[8], attributes[9], texel);
+						if (state.maskedTransparencyThreshold >= 0.0f && texel[3] < state.maskedTransparencyThreshold) fragmentVisible = false;
+						for (auto i = 0; i < 4; i++) color[i]*= texel[i];
+					}
+				}
+				if (fragmentVisible == true) {
+					if (state.depthBufferWriting == true && depthBuffer != nullptr) depthBuffer->depths[pixelIdx] = depth;
+					if (colorBuffer != nullptr) {
+						for (auto i = 0; i < 4; i++) color[i] = Math::clamp(color[i] + attributes[4 + i], 0.0f, 1.0f);
+						auto pixel = &colorBuffer->colors[pixelIdx * 4];
+						auto alpha = color[3];
+						for (auto i = 0; i < 4; i++) {
+							if (state.colorMask[i] == false) continue;
+							auto value = state.blending == true?color[i] * alpha + (pixel[i] / 255.0f) * (1.0f - alpha):color[i];
+							pixel[i] = static_cast<uint8_t>(value * 255.0f + 0.5f);
+						}
+					}
+				}
+			}
+			for (auto i = 0; i < 3; i++) edge[i]+= edgeStepX[i];
+		}
+		for (auto i = 0; i < 3; i++) edgeRow[i]+= edgeStepY[i];
+	}
+}
+
+float SoftwareRenderer::readPixelDepth(int32_t x, int32_t y)
+{
+	flush();
+	auto depthBuffer = &defaultDepthBuffer;
+	if (boundFrameBufferId != FRAMEBUFFER_DEFAULT) {
+		auto frameBufferIt = framebuffers.find(boundFrameBufferId);
+		depthBuffer = frameBufferIt == framebuffers.end()?nullptr:getTexture(frameBufferIt->second.depthBufferTextureId);
+	}
+	if (depthBuffer == nullptr || x < 0 || y < 0 || x >= depthBuffer->width || y >= depthBuffer->height) return 1.0f;
+	return depthBuffer->depths[y * depthBuffer->width + x];
+}
+
+ByteBuffer* SoftwareRenderer::readPixels(int32_t x, int32_t y, int32_t width, int32_t height)
+{
+	flush();
+	auto pixelBuffer = ByteBuffer::allocate(width * height * 4);
+	auto colorBuffer = &defaultColorBuffer;
+	if (boundFrameBufferId != FRAMEBUFFER_DEFAULT) {
+		auto frameBufferIt = framebuffers.find(boundFrameBufferId);
+		colorBuffer = frameBufferIt == framebuffers.end()?nullptr:getTexture(frameBufferIt->second.colorBufferTextureId);
+	}
+	for (auto pixelY = y; pixelY < y + height; pixelY++) {
+		for (auto pixelX = x; pixelX < x + width; pixelX++) {
+			if (colorBuffer != nullptr && pixelX >= 0 && pixelY >= 0 && pixelX < colorBuffer->width && pixelY < colorBuffer->height) {
+				pixelBuffer->put(&colorBuffer->colors[(pixelY * colorBuffer->width + pixelX) * 4], 4);
+			} else {
+				for (auto i = 0; i < 4; i++) pixelBuffer->put(0);
+			}
+		}
+	}
+	return pixelBuffer;
+}
+
+void SoftwareRenderer::initGuiMode()
+{
+	setTextureUnit(getDefaultContext(), 0);
+	bindTexture(getDefaultContext(), ID_NONE);
+	enableBlending();
+	disableDepthBufferTest();
+	disableCulling(getDefaultContext());
+}
+
+void SoftwareRenderer::doneGuiMode()
+{
+	bindTexture(getDefaultContext(), ID_NONE);
+	disableBlending();
+	enableDepthBufferTest();
+	enableCulling(getDefaultContext());
+}
+
+void SoftwareRenderer::dispatchCompute(void* context, int32_t numGroupsX, int32_t numGroupsY, int32_t numGroupsZ) {
+	Console::println("SoftwareRenderer::dispatchCompute(): Not implemented");
+}
+
+void SoftwareRenderer::memoryBarrier() {
+	flush();
+}
+
+void SoftwareRenderer::uploadSkinningBufferObject(void* context, int32_t bufferObjectId, int32_t size, FloatBuffer* data) {
+	Console::println("SoftwareRenderer::uploadSkinningBufferObject(): Not implemented");
+}
+
+void SoftwareRenderer::uploadSkinningBufferObject(void* context, int32_t bufferObjectId, int32_t size, IntBuffer* data) {
+	Console::println("SoftwareRenderer::uploadSkinningBufferObject(): Not implemented");
+}
+
+void SoftwareRenderer::bindSkinningVerticesBufferObject(void* context, int32_t bufferObjectId) {
+	Console::println("SoftwareRenderer::bindSkinningVerticesBufferObject(): Not implemented");
+}
+
+void SoftwareRenderer::bindSkinningNormalsBufferObject(void* context, int32_t bufferObjectId) {
+	Console::println("SoftwareRenderer::bindSkinningNormalsBufferObject(): Not implemented");
+}
+
+void SoftwareRenderer::bindSkinningVertexJointsBufferObject(void* context, int32_t bufferObjectId) {
+	Console::println("SoftwareRenderer::bindSkinningVertexJointsBufferObject(): Not implemented");
+}
+
+void SoftwareRenderer::bindSkinningVertexJointIdxsBufferObject(void* context, int32_t bufferObjectId) {
+	Console::println("SoftwareRenderer::bindSkinningVertexJointIdxsBufferObject(): Not implemented");
+}
+
+void SoftwareRenderer::bindSkinningVertexJointWeightsBufferObject(void* context, int32_t bufferObjectId) {
+	Console::println("SoftwareRenderer::bindSkinningVertexJointWeightsBufferObject(): Not implemented");
+}
+
+void SoftwareRenderer::bindSkinningVerticesResultBufferObject(void* context, int32_t bufferObjectId) {
+	Console::println("SoftwareRenderer::bindSkinningVerticesResultBufferObject(): Not implemented");
+}
+
+void SoftwareRenderer::bindSkinningNormalsResultBufferObject(void* context, int32_t bufferObjectId) {
+	Console::println("SoftwareRenderer::bindSkinningNormalsResultBufferObject(): Not implemented");
+}
+
+void SoftwareRenderer::bindSkinningMatricesBufferObject(void* context, int32_t bufferObjectId) {
+	Console::println("SoftwareRenderer::bindSkinningMatricesBufferObject(): Not implemented");
+}
+
+int32_t SoftwareRenderer::createVertexArrayObject() {
+	Console::println("SoftwareRenderer::createVertexArrayObject(): Not implemented");
+	return -1;
+}
+
+void SoftwareRenderer::disposeVertexArrayObject(int32_t vertexArrayObjectId) {
+	Console::println("SoftwareRenderer::disposeVertexArrayObject(): Not implemented");
+}
+
+void SoftwareRenderer::bindVertexArrayObject(int32_t vertexArrayObjectId) {
+	Console::println("SoftwareRenderer::bindVertexArrayObject(): Not implemented");
+}
+
+float SoftwareRenderer::getMaskMaxValue(void* context) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	return contextTyped.maskMaxValue;
+}
+
+void SoftwareRenderer::setMaskMaxValue(void* context, float maskMaxValue) {
+	auto& contextTyped = *static_cast<context_type*>(context);
+	contextTyped.maskMaxValue = maskMaxValue;
+}
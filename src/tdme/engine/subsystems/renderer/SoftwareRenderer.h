@@ -0,0 +1,573 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+#include <tdme/tdme.h>
+#include <tdme/utils/fwd-tdme.h>
+#include <tdme/engine/fileio/textures/fwd-tdme.h>
+#include <tdme/engine/subsystems/renderer/fwd-tdme.h>
+#include <tdme/engine/subsystems/renderer/Renderer.h>
+#include <tdme/engine/subsystems/renderer/Renderer_Light.h>
+#include <tdme/engine/subsystems/renderer/Renderer_SpecularMaterial.h>
+#include <tdme/math/fwd-tdme.h>
+#include <tdme/math/Matrix2D3x3.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/os/threading/Mutex.h>
+#include <tdme/os/threading/ReadWriteLock.h>
+#include <tdme/os/threading/Thread.h>
+
+using std::array;
+using std::pair;
+using std::string;
+using std::unordered_map;
+using std::vector;
+
+using tdme::utils::ByteBuffer;
+using tdme::utils::FloatBuffer;
+using tdme::utils::IntBuffer;
+using tdme::utils::ShortBuffer;
+using tdme::engine::fileio::textures::Texture;
+using tdme::engine::subsystems::renderer::Renderer;
+using tdme::engine::subsystems::renderer::Renderer_Light;
+using tdme::engine::subsystems::renderer::Renderer_SpecularMaterial;
+using tdme::math::Matrix2D3x3;
+using tdme::math::Matrix4x4;
+using tdme::os::threading::Mutex;
+using tdme::os::threading::ReadWriteLock;
+using tdme::os::threading::Thread;
+
+/**
+ * Software renderer, which rasterizes indexed triangles, points and lines on CPU into RGBA color and float depth buffers
+ * 	It does not need a GPU or a window, so it can be used for headless tests and deterministic frame benchmarks
+ * 	Shader programs are not executed, instead well known uniforms like mvpMatrix, projectionMatrix, cameraMatrix, textureMatrix,
+ * 	material.diffuse, effectColorMul/Add and the diffuse texture unit drive a unlit fixed function pipeline, lighting and shadows are not evaluated
+ * 	Draw calls of each context are transformed and clipped by the calling thread, the resulting screen space triangles are
+ * 	binned into tiles and rasterized by rasterizer threads when a frame buffer is bound, cleared, read back or a frame is finished
+ * 	Draw calls are rasterized in order of sequence points, then in context index order and in submission order within a context,
+ * 	so results are reproducible for a given engine thread count, but equal depths or blending within a pass can differ between thread counts
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::engine::subsystems::renderer::SoftwareRenderer: public Renderer
+{
+private:
+	static constexpr int32_t TILE_SIZE { 64 };
+	static constexpr int32_t TEXTUREUNITS { 16 };
+	static constexpr int32_t UNIFORM_SIZE { 16 };
+
+	enum Uniform {
+		UNIFORM_MVPMATRIX,
+		UNIFORM_MVMATRIX,
+		UNIFORM_PROJECTIONMATRIX,
+		UNIFORM_CAMERAMATRIX,
+		UNIFORM_TEXTUREMATRIX,
+		UNIFORM_MATERIAL_DIFFUSE,
+		UNIFORM_MATERIAL_EMISSION,
+		UNIFORM_BASECOLORFACTOR,
+		UNIFORM_EFFECTCOLORMUL,
+		UNIFORM_EFFECTCOLORADD,
+		UNIFORM_TEXTUREUNIT,
+		UNIFORM_TEXTUREAVAILABLE,
+		UNIFORM_DEPTHTEXTUREUNIT,
+		UNIFORM_MASKEDTRANSPARENCY,
+		UNIFORM_MASKEDTRANSPARENCYTHRESHOLD,
+		UNIFORM_POINTSIZE,
+		UNIFORM_SPRITESHORIZONTAL,
+		UNIFORM_SPRITESVERTICAL,
+		UNIFORM_MAX
+	};
+
+	enum BufferBinding {
+		BUFFER_INDICES,
+		BUFFER_VERTICES,
+		BUFFER_TEXTURECOORDINATES,
+		BUFFER_COLORS,
+		BUFFER_SPRITEINDICES,
+		BUFFER_MODELMATRICES,
+		BUFFER_EFFECTCOLORMULS,
+		BUFFER_EFFECTCOLORADDS,
+		BUFFER_MAX
+	};
+
+	struct texture_type {
+		int32_t id { 0 };
+		int32_t width { 0 };
+		int32_t height { 0 };
+		bool depthTexture { false };
+		bool repeat { true };
+		vector<uint8_t> colors;
+		vector<float> depths;
+	};
+
+	struct framebuffer_type {
+		int32_t id { 0 };
+		int32_t depthBufferTextureId { 0 };
+		int32_t colorBufferTextureId { 0 };
+	};
+
+	struct buffer_type {
+		int32_t id { 0 };
+		vector<uint8_t> data;
+	};
+
+	struct program_type {
+		int32_t id { 0 };
+		unordered_map<string, int32_t> uniformLocations;
+		array<int32_t, UNIFORM_MAX> uniforms;
+	};
+
+	struct state_type {
+		texture_type* texture { nullptr };
+		texture_type* depthTexture { nullptr };
+		float maskedTransparencyThreshold { -1.0f };
+		bool blending { false };
+		bool depthBufferTest { true };
+		bool depthBufferWriting { true };
+		int32_t depthFunction { 0 };
+		array<bool, 4> colorMask {{ true, true, true, true }};
+		int32_t viewPortX { 0 };
+		int32_t viewPortY { 0 };
+		int32_t viewPortWidth { 0 };
+		int32_t viewPortHeight { 0 };
+	};
+
+	struct vertex_type {
+		// clip space position
+		array<float, 4> position;
+		// color, which already includes material and effect color mul
+		array<float, 4> color;
+		array<float, 4> colorAdd;
+		array<float, 2> textureCoordinate;
+	};
+
+	typedef array<float, 4> window_position_type;
+	typedef array<float, 10> window_attributes_type;
+
+	struct triangle_type {
+		// window space x, y, depth and 1 / w of vertices
+		array<window_position_type, 3> positions;
+		// attributes divided by w: color, color add, texture coordinate
+		array<window_attributes_type, 3> attributes;
+		int32_t stateIdx;
+	};
+
+	struct batch_type {
+		int32_t sequenceIdx;
+		int32_t contextIdx;
+		int32_t triangleIdx;
+		int32_t triangleCount;
+	};
+
+	struct context_type {
+		int32_t idx { 0 };
+		program_type* program { nullptr };
+		vector<array<float, UNIFORM_SIZE>> uniformValues;
+		int32_t textureUnit { 0 };
+		array<int32_t, TEXTUREUNITS> boundTextures {  };
+		array<buffer_type*, BUFFER_MAX> boundBuffers {  };
+		bool culling { true };
+		int32_t frontFace { 0 };
+		string shader;
+		array<float, 4> effectColorMul {{ 1.0f, 1.0f, 1.0f, 1.0f }};
+		array<float, 4> effectColorAdd {{ 0.0f, 0.0f, 0.0f, 0.0f }};
+		Renderer_SpecularMaterial specularMaterial;
+		array<Renderer_Light, 8> lights;
+		Matrix2D3x3 textureMatrix;
+		float maskMaxValue { 1.0f };
+		int32_t lighting { 0 };
+		vector<state_type> states;
+		vector<triangle_type> triangles;
+		vector<batch_type> batches;
+	};
+
+	struct tile_type {
+		int32_t left;
+		int32_t bottom;
+		int32_t right;
+		int32_t top;
+		vector<pair<const triangle_type*, const state_type*>> triangles;
+	};
+
+	/**
+	 * Rasterizer thread, which rasterizes tiles of a flush
+	 */
+	class RasterizerThread: public Thread {
+		friend class SoftwareRenderer;
+	public:
+		enum State { STATE_WAITING, STATE_RASTERIZING };
+
+	private:
+		SoftwareRenderer* renderer;
+		volatile State state { STATE_WAITING };
+
+		/**
+		 * Constructor
+		 * @param renderer renderer
+		 */
+		RasterizerThread(SoftwareRenderer* renderer);
+
+		/**
+		 * Run
+		 */
+		virtual void run();
+	};
+
+	vector<context_type> contexts;
+	vector<RasterizerThread*> rasterizerThreads;
+	Mutex flushMutex;
+	ReadWriteLock texturesRWLock;
+	ReadWriteLock buffersRWLock;
+	unordered_map<int32_t, texture_type*> textures;
+	unordered_map<int32_t, framebuffer_type> framebuffers;
+	unordered_map<int32_t, buffer_type*> buffers;
+	unordered_map<int32_t, program_type*> programs;
+	unordered_map<string, Uniform> uniformsByName;
+	int32_t sequenceIdx { 0 };
+	int32_t textureIdx { 0 };
+	int32_t bufferIdx { 0 };
+	int32_t shaderIdx { 0 };
+	int32_t programIdx { 0 };
+	int32_t frameBufferIdx { 0 };
+	int32_t uniformIdx { 0 };
+	texture_type defaultColorBuffer;
+	texture_type defaultDepthBuffer;
+	int32_t boundFrameBufferId { 0 };
+	array<float, 4> clearColor {{ 0.0f, 0.0f, 0.0f, 1.0f }};
+	int32_t cullFace { 0 };
+	bool blending { false };
+	bool depthBufferTest { true };
+	bool depthBufferWriting { true };
+	int32_t depthFunction { 0 };
+	array<bool, 4> colorMask {{ true, true, true, true }};
+	float lineWidth { 1.0f };
+	vector<tile_type> tiles;
+	volatile uint64_t tileIdx { 0LL };
+	texture_type* rasterizerColorBuffer { nullptr };
+	texture_type* rasterizerDepthBuffer { nullptr };
+
+public:
+	// overriden methods
+	void* getDefaultContext() override;
+	void* getContext(int contextIdx) override;
+	int getContextIndex(void* context) override;
+	void initialize() override;
+	void initializeFrame() override;
+	void finishFrame() override;
+	const string getShaderVersion() override;
+	bool isSupportingMultithreadedRendering() override;
+	void onSequencePoint() override;
+	bool isSupportingMultipleRenderQueues() override;
+	bool isSupportingVertexArrays() override;
+	bool isBufferObjectsAvailable() override;
+	bool isDepthTextureAvailable() override;
+	bool isUsingProgramAttributeLocation() override;
+	bool isSpecularMappingAvailable() override;
+	bool isNormalMappingAvailable() override;
+	bool isPBRAvailable() override;
+	bool isInstancedRenderingAvailable() override;
+	bool isUsingShortIndices() override;
+	bool isGeometryShaderAvailable() override;
+	bool isPackedVerticesAvailable() override;
+	bool isTextureBufferObjectsAvailable() override;
+	int32_t getTextureUnits() override;
+	int32_t loadShader(int32_t type, const string& pathName, const string& fileName, const string& definitions = string(), const string& functions = string()) override;
+	void useProgram(void* context, int32_t programId) override;
+	int32_t createProgram(int type) override;
+	void attachShaderToProgram(int32_t programId, int32_t shaderId) override;
+	bool linkProgram(int32_t programId) override;
+	int32_t getProgramUniformLocation(int32_t programId, const string& name) override;
+	void setProgramUniformInteger(void* context, int32_t uniformId, int32_t value) override;
+	void setProgramUniformFloat(void* context, int32_t uniformId, float value) override;
+	void setProgramUniformFloatMatrix3x3(void* context, int32_t uniformId, const array<float, 9>& data) override;
+	void setProgramUniformFloatMatrix4x4(void* context, int32_t uniformId, const array<float, 16>& data) override;
+	void setProgramUniformFloatMatrices4x4(void* context, int32_t uniformId, int32_t count, FloatBuffer* data) override;
+	void setProgramUniformFloatVec4(void* context, int32_t uniformId, const array<float, 4>& data) override;
+	void setProgramUniformFloatVec3(void* context, int32_t uniformId, const array<float, 3>& data) override;
+	void setProgramUniformFloatVec2(void* context, int32_t uniformId, const array<float, 2>& data) override;
+	void setProgramAttributeLocation(int32_t programId, int32_t location, const string& name) override;
+	int32_t getLighting(void* context) override;
+	void setLighting(void* context, int32_t lighting) override;
+	void setViewPort(int32_t x, int32_t y, int32_t width, int32_t height) override;
+	void updateViewPort() override;
+	Matrix2D3x3& getTextureMatrix(void* context) override;
+	void setClearColor(float red, float green, float blue, float alpha) override;
+	void enableCulling(void* context) override;
+	void disableCulling(void* context) override;
+	void setFrontFace(void* context, int32_t frontFace) override;
+	void setCullFace(int32_t cullFace) override;
+	void enableBlending() override;
+	void disableBlending() override;
+	void enableDepthBufferWriting() override;
+	void disableDepthBufferWriting() override;
+	void disableDepthBufferTest() override;
+	void enableDepthBufferTest() override;
+	void setDepthFunction(int32_t depthFunction) override;
+	void setColorMask(bool red, bool green, bool blue, bool alpha) override;
+	void clear(int32_t mask) override;
+	int32_t createTexture() override;
+	int32_t createDepthBufferTexture(int32_t width, int32_t height) override;
+	int32_t createColorBufferTexture(int32_t width, int32_t height) override;
+	void uploadTexture(void* context, Texture* texture) override;
+	void resizeDepthBufferTexture(int32_t textureId, int32_t width, int32_t height) override;
+	void resizeColorBufferTexture(int32_t textureId, int32_t width, int32_t height) override;
+	void bindTexture(void* context, int32_t textureId) override;
+	void disposeTexture(int32_t textureId) override;
+	int32_t createFramebufferObject(int32_t depthBufferTextureGlId, int32_t colorBufferTextureGlId) override;
+	void bindFrameBuffer(int32_t frameBufferId) override;
+	void disposeFrameBufferObject(int32_t frameBufferId) override;
+	vector<int32_t> createBufferObjects(int32_t buffers, bool useGPUMemory, bool shared) override;
+	void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, FloatBuffer* data) override;
+	void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data) override;
+	void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ByteBuffer* data) override;
+	void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, IntBuffer* data) override;
+	void uploadBufferObject(void* context, int32_t bufferObjectId, int32_t offset, int32_t size, FloatBuffer* data) override;
+	void uploadIndicesBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data) override;
+	void uploadIndicesBufferObject(void* context, int32_t bufferObjectId, int32_t size, IntBuffer* data) override;
+	void bindIndicesBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindTextureCoordinatesBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindVerticesBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindNormalsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindSpriteIndicesBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindColorsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindTangentsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindBitangentsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindPackedVerticesBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindModelMatricesBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindEffectColorMulsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindEffectColorAddsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindOrigins(void* context, int32_t bufferObjectId) override;
+	void drawInstancedIndexedTrianglesFromBufferObjects(void* context, int32_t triangles, int32_t trianglesOffset, int32_t instances) override;
+	void drawIndexedTrianglesFromBufferObjects(void* context, int32_t triangles, int32_t trianglesOffset) override;
+	void drawInstancedTrianglesFromBufferObjects(void* context, int32_t triangles, int32_t trianglesOffset, int32_t instances) override;
+	void drawTrianglesFromBufferObjects(void* context, int32_t triangles, int32_t trianglesOffset) override;
+	void drawPointsFromBufferObjects(void* context, int32_t points, int32_t pointsOffset) override;
+	void setLineWidth(float lineWidth) override;
+	void drawLinesFromBufferObjects(void* context, int32_t points, int32_t pointsOffset) override;
+	void unbindBufferObjects(void* context) override;
+	void disposeBufferObjects(vector<int32_t>& bufferObjectIds) override;
+	void bindTextureBufferObject(void* context, int32_t textureUnit, int32_t bufferObjectId, bool integer, int32_t components) override;
+	int32_t getTextureUnit(void* context) override;
+	void setTextureUnit(void* context, int32_t textureUnit) override;
+	Renderer_Light& getLight(void* context, int32_t lightId) override;
+	array<float, 4>& getEffectColorMul(void* context) override;
+	array<float, 4>& getEffectColorAdd(void* context) override;
+	Renderer_SpecularMaterial& getSpecularMaterial(void* context) override;
+	const string getShader(void* context) override;
+	void setShader(void* context, const string& id) override;
+	float readPixelDepth(int32_t x, int32_t y) override;
+	ByteBuffer* readPixels(int32_t x, int32_t y, int32_t width, int32_t height) override;
+	void initGuiMode() override;
+	void doneGuiMode() override;
+	void dispatchCompute(void* context, int32_t numGroupsX, int32_t numGroupsY, int32_t numGroupsZ) override;
+	void memoryBarrier() override;
+	void uploadSkinningBufferObject(void* context, int32_t bufferObjectId, int32_t size, FloatBuffer* data) override;
+	void uploadSkinningBufferObject(void* context, int32_t bufferObjectId, int32_t size, IntBuffer* data) override;
+	void bindSkinningVerticesBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindSkinningNormalsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindSkinningVertexJointsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindSkinningVertexJointIdxsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindSkinningVertexJointWeightsBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindSkinningVerticesResultBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindSkinningNormalsResultBufferObject(void* context, int32_t bufferObjectId) override;
+	void bindSkinningMatricesBufferObject(void* context, int32_t bufferObjectId) override;
+	int32_t createVertexArrayObject() override;
+	void disposeVertexArrayObject(int32_t vertexArrayObjectId) override;
+	void bindVertexArrayObject(int32_t vertexArrayObjectId) override;
+	float getMaskMaxValue(void* context) override;
+	void setMaskMaxValue(void* context, float maskMaxValue) override;
+
+private:
+	/**
+	 * Get texture by id
+	 * @param textureId texture id
+	 * @return texture or null
+	 */
+	texture_type* getTexture(int32_t textureId);
+
+	/**
+	 * Bind buffer object to given binding
+	 * @param context context
+	 * @param binding binding
+	 * @param bufferObjectId buffer object id
+	 */
+	void bindBufferObject(context_type& context, BufferBinding binding, int32_t bufferObjectId);
+
+	/**
+	 * Upload data into buffer object
+	 * @param bufferObjectId buffer object id
+	 * @param size size
+	 * @param data data
+	 */
+	void uploadBufferObject(int32_t bufferObjectId, int32_t size, const uint8_t* data);
+
+	/**
+	 * Set uniform value
+	 * @param context context
+	 * @param uniformId uniform id
+	 * @param data data
+	 * @param size size in floats
+	 */
+	void setProgramUniform(context_type& context, int32_t uniformId, const float* data, int32_t size);
+
+	/**
+	 * Get uniform value of current program
+	 * @param context context
+	 * @param uniform uniform
+	 * @return pointer to uniform value or null if current program does not use the uniform
+	 */
+	const array<float, UNIFORM_SIZE>* getProgramUniform(context_type& context, Uniform uniform);
+
+	/**
+	 * Snapshot current render state of given context
+	 * @param context context
+	 * @return state index
+	 */
+	int32_t createState(context_type& context);
+
+	/**
+	 * Transform vertices and emit triangles
+	 * @param context context
+	 * @param vertexCount vertex count
+	 * @param vertexOffset vertex offset, which is a index offset if indexed
+	 * @param instances instances
+	 * @param indexed indexed
+	 */
+	void drawTriangles(context_type& context, int32_t vertexCount, int32_t vertexOffset, int32_t instances, bool indexed);
+
+	/**
+	 * Fetch vertex attributes
+	 * @param context context
+	 * @param vertexIdx vertex index
+	 * @param instanceIdx instance index
+	 * @param mvpMatrix model view projection matrix
+	 * @param color color of draw call
+	 * @param colorAdd color add of draw call
+	 * @param vertex vertex
+	 */
+	void fetchVertex(context_type& context, int32_t vertexIdx, int32_t instanceIdx, const Matrix4x4& mvpMatrix, const array<float, 4>& color, const array<float, 4>& colorAdd, vertex_type& vertex);
+
+	/**
+	 * Compute model view projection matrix of given instance from current program uniforms and bound model matrices
+	 * @param context context
+	 * @param instanceIdx instance index
+	 * @param mvpMatrix model view projection matrix
+	 */
+	void computeMVPMatrix(context_type& context, int32_t instanceIdx, Matrix4x4& mvpMatrix);
+
+	/**
+	 * Compute color and color add of a draw call from current program uniforms and bound effect colors
+	 * @param context context
+	 * @param instanceIdx instance index
+	 * @param color color
+	 * @param colorAdd color add
+	 */
+	void computeColors(context_type& context, int32_t instanceIdx, array<float, 4>& color, array<float, 4>& colorAdd);
+
+	/**
+	 * Clip triangle against near plane and emit screen space triangles
+	 * @param context context
+	 * @param v0 vertex 0
+	 * @param v1 vertex 1
+	 * @param v2 vertex 2
+	 * @param stateIdx state index
+	 * @param cull if to apply face culling
+	 */
+	void emitTriangle(context_type& context, const vertex_type& v0, const vertex_type& v1, const vertex_type& v2, int32_t stateIdx, bool cull);
+
+	/**
+	 * Emit a window space triangle of near plane clipped vertices
+	 * @param context context
+	 * @param v0 vertex 0
+	 * @param v1 vertex 1
+	 * @param v2 vertex 2
+	 * @param stateIdx state index
+	 * @param cull if to apply face culling
+	 */
+	void emitClippedTriangle(context_type& context, const vertex_type& v0, const vertex_type& v1, const vertex_type& v2, int32_t stateIdx, bool cull);
+
+	/**
+	 * Emit window space triangle
+	 * @param context context
+	 * @param p0 window position 0
+	 * @param a0 window attributes 0
+	 * @param p1 window position 1
+	 * @param a1 window attributes 1
+	 * @param p2 window position 2
+	 * @param a2 window attributes 2
+	 * @param stateIdx state index
+	 */
+	void emitWindowTriangle(context_type& context, const window_position_type& p0, const window_attributes_type& a0, const window_position_type& p1, const window_attributes_type& a1, const window_position_type& p2, const window_attributes_type& a2, int32_t stateIdx);
+
+	/**
+	 * Interpolate vertex
+	 * @param v0 vertex 0
+	 * @param v1 vertex 1
+	 * @param t interpolation factor between vertex 0 and vertex 1
+	 * @param vertex vertex
+	 */
+	static void interpolateVertex(const vertex_type& v0, const vertex_type& v1, float t, vertex_type& vertex);
+
+	/**
+	 * Transform clip space vertex into window space
+	 * @param vertex vertex
+	 * @param position window position
+	 * @param attributes window attributes
+	 */
+	void transformToWindow(const vertex_type& vertex, window_position_type& position, window_attributes_type& attributes);
+
+	/**
+	 * Begin a batch of triangles of a draw call
+	 * @param context context
+	 */
+	void beginBatch(context_type& context);
+
+	/**
+	 * Rasterize all pending triangles of all contexts into current frame buffer
+	 */
+	void flush();
+
+	/**
+	 * Rasterize tiles until there are no more tiles left, called by rasterizer threads and flush()
+	 */
+	void rasterizeTiles();
+
+	/**
+	 * Rasterize triangle into tile
+	 * @param tile tile
+	 * @param triangle triangle
+	 * @param state state
+	 */
+	void rasterizeTriangle(const tile_type& tile, const triangle_type& triangle, const state_type& state);
+
+	/**
+	 * Sample texture with nearest filtering
+	 * @param texture texture
+	 * @param u u
+	 * @param v v
+	 * @param color color
+	 */
+	static void sampleTexture(const texture_type* texture, float u, float v, array<float, 4>& color);
+
+	/**
+	 * Resize texture
+	 * @param texture texture
+	 * @param width width
+	 * @param height height
+	 */
+	static void resizeTexture(texture_type* texture, int32_t width, int32_t height);
+
+public:
+	/**
+	 * Public constructor
+	 */
+	SoftwareRenderer();
+
+	/**
+	 * Destructor
+	 */
+	virtual ~SoftwareRenderer();
+};
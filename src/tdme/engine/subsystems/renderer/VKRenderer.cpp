@@ -1708,6 +1708,15 @@ bool VKRenderer::isGeometryShaderAvailable() {
 	return false;
 }
 
+bool VKRenderer::isPackedVerticesAvailable() {
+	if (VERBOSE == true) Console::println("VKRenderer::" + string(__FUNCTION__) + "()");
+	return false;
+}
+
+bool VKRenderer::isTextureBufferObjectsAvailable() {
+	return false;
+}
+
 int32_t VKRenderer::getTextureUnits()
 {
 	if (VERBOSE == true) Console::println("VKRenderer::" + string(__FUNCTION__) + "()");
@@ -4933,6 +4942,18 @@ void VKRenderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32
 	uploadBufferObjectInternal(contextTyped.idx, bufferObjectId, size, data->getBuffer(), (VkBufferUsageFlagBits)(VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
 }
 
+void VKRenderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t size, ByteBuffer* data)
+{
+	auto& contextTyped = *static_cast<context_type*>(context);
+	uploadBufferObjectInternal(contextTyped.idx, bufferObjectId, size, data->getBuffer(), (VkBufferUsageFlagBits)(VK_BUFFER_USAGE_TRANSFER_DST_BIT | VK_BUFFER_USAGE_VERTEX_BUFFER_BIT | VK_BUFFER_USAGE_STORAGE_BUFFER_BIT));
+}
+
+void VKRenderer::uploadBufferObject(void* context, int32_t bufferObjectId, int32_t offset, int32_t size, FloatBuffer* data)
+{
+	// buffer objects are replaced with reusable buffers on each upload, so updating a range would need a copy of the whole buffer
+	Console::println("VKRenderer::uploadBufferObject(): Not implemented");
+}
+
 void VKRenderer::uploadIndicesBufferObject(void* context, int32_t bufferObjectId, int32_t size, ShortBuffer* data)
 {
 	auto& contextTyped = *static_cast<context_type*>(context);
@@ -4985,6 +5006,11 @@ void VKRenderer::bindBitangentsBufferObject(void* context, int32_t bufferObjectI
 	(*static_cast<context_type*>(context)).bound_buffers[5] = bufferObjectId;
 }
 
+void VKRenderer::bindPackedVerticesBufferObject(void* context, int32_t bufferObjectId)
+{
+	Console::println("VKRenderer::bindPackedVerticesBufferObject(): Not implemented");
+}
+
 void VKRenderer::bindModelMatricesBufferObject(void* context, int32_t bufferObjectId)
 {
 	(*static_cast<context_type*>(context)).bound_buffers[6] = bufferObjectId;
@@ -5678,6 +5704,11 @@ void VKRenderer::disposeBufferObjects(vector<int32_t>& bufferObjectIds)
 	}
 }
 
+void VKRenderer::bindTextureBufferObject(void* context, int32_t textureUnit, int32_t bufferObjectId, bool integer, int32_t components)
+{
+	Console::println("VKRenderer::bindTextureBufferObject(): Not implemented");
+}
+
 int32_t VKRenderer::getTextureUnit(void* context)
 {
 	return (*static_cast<context_type*>(context)).texture_unit_active;
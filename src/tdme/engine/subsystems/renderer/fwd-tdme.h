@@ -13,6 +13,7 @@ namespace renderer {
 	class Renderer_Light;
 	class Renderer_SpecularMaterial;
 	class SingleThreadedRenderer;
+	class SoftwareRenderer;
 	class VKRenderer;
 }  // namespace renderer
 }  // namespace subsystems
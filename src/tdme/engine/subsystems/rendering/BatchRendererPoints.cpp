@@ -56,14 +56,12 @@ void BatchRendererPoints::initialize()
 	}
 }
 
-void BatchRendererPoints::render(void* context)
+void BatchRendererPoints::upload(void* context)
 {
 	// skip if no vertex data exists
 	if (fbVertices.getPosition() == 0 || fbColors.getPosition() == 0)
 		return;
 
-	// determine point count
-	auto points = fbVertices.getPosition() / 3 /* 3 components */;
 	// upload vertices
 	renderer->uploadBufferObject(context, (*vboIds)[0], fbVertices.getPosition() * sizeof(float), &fbVertices);
 	// upload sprite indices
@@ -76,8 +74,15 @@ void BatchRendererPoints::render(void* context)
 	renderer->bindSpriteIndicesBufferObject(context, (*vboIds)[1]);
 	// bind colors
 	renderer->bindColorsBufferObject(context, (*vboIds)[2]);
+}
+
+void BatchRendererPoints::render(void* context, int32_t points, int32_t pointsOffset)
+{
+	// skip if no points to render
+	if (points == 0) return;
+
 	// draw
-	renderer->drawPointsFromBufferObjects(context, points, 0);
+	renderer->drawPointsFromBufferObjects(context, points, pointsOffset);
 }
 
 void BatchRendererPoints::dispose()
@@ -41,10 +41,18 @@ private:
 	FloatBuffer fbColors;
 
 	/**
-	 * Render
+	 * Upload points and bind buffer objects, which are used by subsequent render calls
 	 * @param context context
 	 */
-	void render(void* context);
+	void upload(void* context);
+
+	/**
+	 * Render uploaded points
+	 * @param context context
+	 * @param points points
+	 * @param pointsOffset points offset
+	 */
+	void render(void* context, int32_t points, int32_t pointsOffset);
 
 	/**
 	 * Clears this batch vbo renderer
@@ -61,6 +69,13 @@ private:
 		fbColors.put(point->color.getArray());
 	}
 
+	/**
+	 * @return point count
+	 */
+	inline int32_t getPointCount() {
+		return fbVertices.getPosition() / 3 /* 3 components */;
+	}
+
 	/**
 	 * @return has points
 	 */
@@ -4,10 +4,12 @@
 
 #include <tdme/utils/ByteBuffer.h>
 #include <tdme/utils/FloatBuffer.h>
+#include <tdme/utils/IntBuffer.h>
 #include <tdme/engine/Engine.h>
 #include <tdme/engine/model/TextureCoordinate.h>
 #include <tdme/engine/subsystems/manager/VBOManager_VBOManaged.h>
 #include <tdme/engine/subsystems/manager/VBOManager.h>
+#include <tdme/engine/subsystems/rendering/Object3DRenderer.h>
 #include <tdme/engine/subsystems/rendering/ObjectBuffer.h>
 #include <tdme/engine/subsystems/renderer/Renderer.h>
 #include <tdme/math/Vector3.h>
@@ -18,10 +20,12 @@ using std::to_string;
 using tdme::engine::subsystems::rendering::BatchRendererTriangles;
 using tdme::utils::ByteBuffer;
 using tdme::utils::FloatBuffer;
+using tdme::utils::IntBuffer;
 using tdme::engine::Engine;
 using tdme::engine::model::TextureCoordinate;
 using tdme::engine::subsystems::manager::VBOManager_VBOManaged;
 using tdme::engine::subsystems::manager::VBOManager;
+using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::engine::subsystems::rendering::ObjectBuffer;
 using tdme::engine::subsystems::renderer::Renderer;
 using tdme::math::Vector3;
@@ -107,16 +111,30 @@ void BatchRendererTriangles::render()
 	// handle instanced rendering
 	//	TODO: check if to move somewhere else
 	if (renderer->isInstancedRenderingAvailable() == true) {
-		fbEffectColorMuls.clear();
-		fbEffectColorMuls.put(renderer->getEffectColorMul(context));
-		fbEffectColorAdds.clear();
-		fbEffectColorAdds.put(renderer->getEffectColorAdd(context));
-		renderer->uploadBufferObject(context, (*vboIds)[3], fbModelMatrices.getPosition() * sizeof(float), &fbModelMatrices);
-		renderer->bindModelMatricesBufferObject(context, (*vboIds)[3]);
-		renderer->uploadBufferObject(context, (*vboIds)[4], fbEffectColorMuls.getPosition() * sizeof(float), &fbEffectColorMuls);
-		renderer->bindEffectColorMulsBufferObject(context, (*vboIds)[4]);
-		renderer->uploadBufferObject(context, (*vboIds)[5], fbEffectColorAdds.getPosition() * sizeof(float), &fbEffectColorAdds);
-		renderer->bindEffectColorAddsBufferObject(context, (*vboIds)[5]);
+		if (renderer->isTextureBufferObjectsAvailable() == true) {
+			// instance data is fetched by instance indices from texture buffers, see Object3DRenderer
+			auto fbInstanceData = ObjectBuffer::getByteBuffer(context, 24 * sizeof(float))->asFloatBuffer();
+			fbInstanceData.put(Matrix4x4().identity().getArray());
+			fbInstanceData.put(renderer->getEffectColorMul(context));
+			fbInstanceData.put(renderer->getEffectColorAdd(context));
+			renderer->uploadBufferObject(context, (*vboIds)[3], fbInstanceData.getPosition() * sizeof(float), &fbInstanceData);
+			auto ibInstanceIndices = ObjectBuffer::getByteBuffer(context, 1 * sizeof(int32_t))->asIntBuffer();
+			ibInstanceIndices.put(0);
+			renderer->uploadBufferObject(context, (*vboIds)[4], ibInstanceIndices.getPosition() * sizeof(int32_t), &ibInstanceIndices);
+			renderer->bindTextureBufferObject(context, Object3DRenderer::TEXTUREUNIT_INSTANCEDATA, (*vboIds)[3], false, 4);
+			renderer->bindTextureBufferObject(context, Object3DRenderer::TEXTUREUNIT_INSTANCEINDICES, (*vboIds)[4], true, 1);
+		} else {
+			fbEffectColorMuls.clear();
+			fbEffectColorMuls.put(renderer->getEffectColorMul(context));
+			fbEffectColorAdds.clear();
+			fbEffectColorAdds.put(renderer->getEffectColorAdd(context));
+			renderer->uploadBufferObject(context, (*vboIds)[3], fbModelMatrices.getPosition() * sizeof(float), &fbModelMatrices);
+			renderer->bindModelMatricesBufferObject(context, (*vboIds)[3]);
+			renderer->uploadBufferObject(context, (*vboIds)[4], fbEffectColorMuls.getPosition() * sizeof(float), &fbEffectColorMuls);
+			renderer->bindEffectColorMulsBufferObject(context, (*vboIds)[4]);
+			renderer->uploadBufferObject(context, (*vboIds)[5], fbEffectColorAdds.getPosition() * sizeof(float), &fbEffectColorAdds);
+			renderer->bindEffectColorAddsBufferObject(context, (*vboIds)[5]);
+		}
 
 		// draw
 		renderer->drawInstancedTrianglesFromBufferObjects(context, triangles, 0, 1);
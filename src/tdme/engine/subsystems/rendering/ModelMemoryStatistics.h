@@ -0,0 +1,19 @@
+#pragma once
+
+#include <tdme/tdme.h>
+#include <tdme/engine/subsystems/rendering/fwd-tdme.h>
+
+/** 
+ * Model memory statistics entity
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+struct tdme::engine::subsystems::rendering::ModelMemoryStatistics
+{
+	int32_t objectCount {  };
+	int32_t meshCount {  };
+	int32_t meshReferenceCount {  };
+	int64_t meshMemoryUsage {  };
+	int64_t meshMemoryUsageUnshared {  };
+	int64_t instanceMemoryUsage {  };
+};
@@ -14,4 +14,6 @@ struct tdme::engine::subsystems::rendering::ModelStatistics
 {	int32_t opaqueFaceCount {  };
 	int32_t transparentFaceCount {  };
 	int32_t materialCount {  };
+	float acmr {  };
+	float atvr {  };
 };
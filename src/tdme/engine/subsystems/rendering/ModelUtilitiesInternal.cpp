@@ -2,6 +2,7 @@
 
 #include <map>
 #include <string>
+#include <vector>
 
 #include <tdme/engine/Timing.h>
 #include <tdme/engine/model/AnimationSetup.h>
@@ -10,6 +11,7 @@
 #include <tdme/engine/model/Group.h>
 #include <tdme/engine/model/Material.h>
 #include <tdme/engine/model/Model.h>
+#include <tdme/engine/model/ModelHelper.h>
 #include <tdme/engine/model/SpecularMaterialProperties.h>
 #include <tdme/engine/primitives/BoundingBox.h>
 #include <tdme/engine/subsystems/rendering/AnimationState.h>
@@ -22,6 +24,7 @@
 
 using std::map;
 using std::string;
+using std::vector;
 
 using tdme::engine::subsystems::rendering::ModelUtilitiesInternal;
 using tdme::engine::Timing;
@@ -30,6 +33,7 @@ using tdme::engine::model::Face;
 using tdme::engine::model::Group;
 using tdme::engine::model::Material;
 using tdme::engine::model::Model;
+using tdme::engine::model::ModelHelper;
 using tdme::engine::model::FacesEntity;
 using tdme::engine::model::SpecularMaterialProperties;
 using tdme::engine::primitives::BoundingBox;
@@ -181,7 +185,24 @@ void ModelUtilitiesInternal::computeModelStatistics(Object3DModelInternal* objec
 	map<string, int32_t> materialCountById;
 	auto opaqueFaceCount = 0;
 	auto transparentFaceCount = 0;
+	int64_t transformedVertexCount = 0LL;
+	int64_t usedVertexCount = 0LL;
 	for (auto object3DGroup : object3DModelInternal->object3dGroups) {
+		// simulate post transform vertex cache, faces entities are rendered with separate draw calls
+		{
+			vector<bool> usedVertices;
+			usedVertices.resize(object3DGroup->group->getVertices().size(), false);
+			for (auto& facesEntity: object3DGroup->group->getFacesEntities()) {
+				transformedVertexCount+= ModelHelper::computeTransformedVertexCount(facesEntity.getFaces());
+				for (auto& face: facesEntity.getFaces()) {
+					for (auto vertexIdx: face.getVertexIndices()) {
+						if (usedVertices[vertexIdx] == true) continue;
+						usedVertices[vertexIdx] = true;
+						usedVertexCount++;
+					}
+				}
+			}
+		}
 		// check each faces entity
 		auto& facesEntities = object3DGroup->group->getFacesEntities();
 		auto facesEntityIdxCount = facesEntities.size();
@@ -218,6 +239,8 @@ void ModelUtilitiesInternal::computeModelStatistics(Object3DModelInternal* objec
 	modelStatistics->opaqueFaceCount = opaqueFaceCount;
 	modelStatistics->transparentFaceCount = transparentFaceCount;
 	modelStatistics->materialCount = materialCount;
+	modelStatistics->acmr = opaqueFaceCount + transparentFaceCount == 0?0.0f:static_cast<float>(transformedVertexCount) / static_cast<float>(opaqueFaceCount + transparentFaceCount);
+	modelStatistics->atvr = usedVertexCount == 0LL?0.0f:static_cast<float>(transformedVertexCount) / static_cast<float>(usedVertexCount);
 }
 
 bool ModelUtilitiesInternal::equals(Model* model1, Model* model2)
@@ -88,6 +88,18 @@ Object3DAnimation::~Object3DAnimation() {
 	}
 }
 
+int64_t Object3DAnimation::computeMemoryUsage() {
+	// a matrix map entry consists of tree node, key value pair and the matrix itself
+	auto matrixEntryMemoryUsage = 4 * sizeof(void*) + sizeof(map<string, Matrix4x4*>::value_type) + sizeof(Matrix4x4);
+	int64_t memoryUsage = sizeof(Object3DAnimation);
+	for (auto& baseAnimationTransformationsMatrices: transformationsMatrices) memoryUsage+= baseAnimationTransformationsMatrices.size() * matrixEntryMemoryUsage;
+	for (auto& skinningGroupMatrices: skinningGroupsMatrices) memoryUsage+= skinningGroupMatrices.size() * matrixEntryMemoryUsage;
+	memoryUsage+= overridenTransformationsMatrices.size() * matrixEntryMemoryUsage;
+	memoryUsage+= skinningGroups.capacity() * sizeof(Group*);
+	memoryUsage+= baseAnimations.capacity() * sizeof(AnimationState);
+	return memoryUsage;
+}
+
 void Object3DAnimation::setAnimation(const string& id, float speed)
 {
 	auto _animationActiveSetup = model->getAnimationSetup(id);
@@ -110,6 +110,12 @@ protected:
 	 */
 	map<string, Matrix4x4*>* getSkinningGroupsMatrices(Group* group);
 
+	/**
+	 * Compute memory usage of this animation, which are mainly the group transformations matrices
+	 * @return memory usage in bytes
+	 */
+	int64_t computeMemoryUsage();
+
 	/**
 	 * Public constructor
 	 * @param model model
@@ -58,6 +58,8 @@ using tdme::utils::Console;
 using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
 
+volatile uint64_t Object3DBase::instanceDataVersionCounter = 0LL;
+
 Object3DBase::Object3DBase(Model* model, bool useManagers, Engine::AnimationProcessingTarget animationProcessingTarget, int instances)
 {
 	this->model = model;
@@ -78,6 +80,8 @@ Object3DBase::Object3DBase(Model* model, bool useManagers, Engine::AnimationProc
 	Object3DGroup::createGroups(this, useManagers, animationProcessingTarget, object3dGroups);
 	// do initial transformations if doing CPU no rendering for deriving bounding boxes and such
 	if (animationProcessingTarget == Engine::AnimationProcessingTarget::CPU_NORENDERING) Object3DGroup::computeTransformations(nullptr, object3dGroups);
+	// initial instance data version
+	markInstanceDataDirty();
 }
 
 Object3DBase::~Object3DBase() {
@@ -95,7 +99,7 @@ void Object3DBase::getTriangles(vector<Triangle>& triangles, int groupIdx)
 {
 	if (groupIdx == -1) {
 		for (auto object3DGroup : object3dGroups) {
-			auto groupVerticesTransformed = &object3DGroup->mesh->transformedVertices;
+			auto groupVerticesTransformed = object3DGroup->mesh->vertices;
 			for (auto& facesEntity : object3DGroup->group->getFacesEntities())
 			for (auto& face : facesEntity.getFaces()) {
 				auto faceVertexIndices = face.getVertexIndices();
@@ -110,7 +114,7 @@ void Object3DBase::getTriangles(vector<Triangle>& triangles, int groupIdx)
 		}
 	} else {
 		auto object3DGroup = object3dGroups[groupIdx];
-		auto groupVerticesTransformed = &object3DGroup->mesh->transformedVertices;
+		auto groupVerticesTransformed = object3DGroup->mesh->vertices;
 		for (auto& facesEntity : object3DGroup->group->getFacesEntities())
 		for (auto& face : facesEntity.getFaces()) {
 			auto faceVertexIndices = face.getVertexIndices();
@@ -144,6 +148,15 @@ Object3DGroupMesh* Object3DBase::getMesh(const string& groupId)
 	return nullptr;
 }
 
+int64_t Object3DBase::computeInstanceMemoryUsage()
+{
+	int64_t memoryUsage = 0LL;
+	for (auto object3DGroup: object3dGroups) memoryUsage+= object3DGroup->computeMemoryUsage();
+	for (auto animation: instanceAnimations) memoryUsage+= animation->computeMemoryUsage();
+	memoryUsage+= instanceVisibility.capacity() / 8 + instanceTransformations.capacity() * sizeof(Transformations);
+	return memoryUsage;
+}
+
 void Object3DBase::initialize()
 {
 	auto meshManager = Engine::getInstance()->getMeshManager();
@@ -169,6 +182,7 @@ void Object3DBase::initialize()
 						instancesTransformationsMatrices,
 						instancesSkinningGroupsMatrices
 					);
+					meshManager->addMesh(object3DGroup->id, object3DGroup->mesh);
 				}
 			} else {
 				object3DGroup->mesh = Object3DGroupMesh::createMesh(
@@ -14,6 +14,7 @@
 #include <tdme/engine/subsystems/rendering/Object3DAnimation.h>
 #include <tdme/engine/subsystems/rendering/Object3DGroup.h>
 #include <tdme/engine/subsystems/skinning/fwd-tdme.h>
+#include <tdme/os/threading/AtomicOperations.h>
 #include <tdme/utils/fwd-tdme.h>
 
 using std::map;
@@ -29,6 +30,7 @@ using tdme::engine::subsystems::rendering::Object3DAnimation;
 using tdme::engine::subsystems::rendering::Object3DBase_TransformedFacesIterator;
 using tdme::engine::subsystems::rendering::Object3DGroup;
 using tdme::engine::subsystems::rendering::Object3DGroupMesh;
+using tdme::os::threading::AtomicOperations;
 
 /** 
  * Object3D base class
@@ -43,7 +45,10 @@ class tdme::engine::subsystems::rendering::Object3DBase
 	friend class tdme::engine::subsystems::skinning::SkinningShader;
 
 private:
+	static volatile uint64_t instanceDataVersionCounter;
+
 	Object3DBase_TransformedFacesIterator* transformedFacesIterator { nullptr };
+	uint64_t instanceDataVersion { 0ULL };
 
 protected:
 	Model* model;
@@ -71,6 +76,13 @@ protected:
 	 */
 	virtual ~Object3DBase();
 
+	/**
+	 * Mark instance data as changed, which are group transformations matrices, transformations matrix and effect colors used for rendering
+	 */
+	inline void markInstanceDataDirty() {
+		instanceDataVersion = AtomicOperations::add(instanceDataVersionCounter);
+	}
+
 public:
 
 	/** 
@@ -94,8 +106,16 @@ public:
 			visibleInstances++;
 		}
 		Object3DGroup::computeTransformations(context, object3dGroups);
+		markInstanceDataDirty();
 	} 
 
+	/**
+	 * @return instance data version, which changes whenever instance data used for rendering has changed, versions are unique across objects
+	 */
+	inline uint64_t getInstanceDataVersion() {
+		return instanceDataVersion;
+	}
+
 	/**
 	 * @return group count
 	 */
@@ -120,6 +140,12 @@ public:
 	 */
 	Object3DGroupMesh* getMesh(const string& groupId);
 
+	/**
+	 * Compute memory usage of instance state, which are object 3d groups and animations, but not meshes as they can be shared between objects
+	 * @return memory usage in bytes
+	 */
+	int64_t computeInstanceMemoryUsage();
+
 	/** 
 	 * Initiates this object3d 
 	 */
@@ -143,6 +169,7 @@ public:
 	 */
 	inline void setCurrentInstance(int currentInstance) {
 		this->currentInstance = currentInstance;
+		markInstanceDataDirty();
 	}
 
 	/**
@@ -306,3 +306,18 @@ void Object3DGroup::dispose()
 		}
 	}
 }
+
+int64_t Object3DGroup::computeMemoryUsage()
+{
+	int64_t memoryUsage = sizeof(Object3DGroup) + sizeof(Object3DGroupRenderer);
+	memoryUsage+= id.capacity();
+	memoryUsage+= textureMatricesByEntities.capacity() * sizeof(Matrix2D3x3);
+	memoryUsage+= specularMaterialDiffuseTextureIdsByEntities.capacity() * sizeof(int32_t);
+	memoryUsage+= specularMaterialDynamicDiffuseTextureIdsByEntities.capacity() * sizeof(int32_t);
+	memoryUsage+= specularMaterialSpecularTextureIdsByEntities.capacity() * sizeof(int32_t);
+	memoryUsage+= specularMaterialNormalTextureIdsByEntities.capacity() * sizeof(int32_t);
+	memoryUsage+= pbrMaterialBaseColorTextureIdsByEntities.capacity() * sizeof(int32_t);
+	memoryUsage+= pbrMaterialMetallicRoughnessTextureIdsByEntities.capacity() * sizeof(int32_t);
+	memoryUsage+= pbrMaterialNormalTextureIdsByEntities.capacity() * sizeof(int32_t);
+	return memoryUsage;
+}
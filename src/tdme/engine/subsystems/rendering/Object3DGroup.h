@@ -113,6 +113,12 @@ private:
 	 */
 	void dispose();
 
+	/**
+	 * Compute memory usage of this object 3d group, without the mesh which might be shared
+	 * @return memory usage in bytes
+	 */
+	int64_t computeMemoryUsage();
+
 public:
 	/**
 	 * Public constructor
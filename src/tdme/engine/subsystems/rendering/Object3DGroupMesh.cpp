@@ -18,6 +18,7 @@
 #include <tdme/engine/subsystems/rendering/Object3DBase.h>
 #include <tdme/engine/subsystems/rendering/Object3DGroupMesh.h>
 #include <tdme/engine/subsystems/rendering/Object3DGroupRenderer.h>
+#include <tdme/engine/subsystems/rendering/VertexPacking.h>
 #include <tdme/engine/subsystems/renderer/Renderer.h>
 #include <tdme/engine/subsystems/skinning/SkinningShader.h>
 #include <tdme/math/Math.h>
@@ -42,6 +43,7 @@ using tdme::engine::model::TextureCoordinate;
 using tdme::engine::subsystems::rendering::Object3DBase;
 using tdme::engine::subsystems::rendering::Object3DGroupRenderer;
 using tdme::engine::subsystems::rendering::ObjectBuffer;
+using tdme::engine::subsystems::rendering::VertexPacking;
 using tdme::engine::subsystems::renderer::Renderer;
 using tdme::engine::subsystems::skinning::SkinningShader;
 using tdme::math::Math;
@@ -54,6 +56,8 @@ Object3DGroupMesh::Object3DGroupMesh()
 	object3D = nullptr;
 	object3DGroupRenderer = nullptr;
 	group = nullptr;
+	instances = 1;
+	verticesReplicas = 1;
 	vertices = nullptr;
 	normals = nullptr;
 	tangents = nullptr;
@@ -88,36 +92,42 @@ Object3DGroupMesh* Object3DGroupMesh::createMesh(Object3DGroupRenderer* object3D
 	auto skinning = group->getSkinning();
 	mesh->skinning = skinning != nullptr;
 	mesh->skinningMatrices = skinningMatrices;
-	// set up transformed vertices, normals and friends
-	if (mesh->object3D->instances > 1 || (skinning != nullptr && animationProcessingTarget == Engine::AnimationProcessingTarget::CPU) ||
+	// vertex data replicas in buffers
+	mesh->instances = mesh->object3D->instances;
+	mesh->verticesReplicas = mesh->instances;
+	// set up transformed vertices, normals and friends only if they get transformed on CPU,
+	// otherwise we use model data, which is shared across all object 3d instances of this model
+	if ((skinning != nullptr && animationProcessingTarget == Engine::AnimationProcessingTarget::CPU) ||
 		animationProcessingTarget == Engine::AnimationProcessingTarget::CPU_NORENDERING) {
+		// transformed vertex data already contains all instances
+		mesh->verticesReplicas = 1;
 		// transformed mesh vertices
-		mesh->transformedVertices.resize(groupVertices.size() * mesh->object3D->instances);
+		mesh->transformedVertices.resize(groupVertices.size() * mesh->instances);
 		mesh->vertices = &mesh->transformedVertices;
 		{
 			auto idx = 0;
-			for (auto i = 0; i < mesh->object3D->instances; i++)
+			for (auto i = 0; i < mesh->instances; i++)
 			for (auto j = 0; j < groupVertices.size(); j++) {
 				mesh->transformedVertices[idx++].set(groupVertices[j]);
 			}
 		}
 		// transformed mesh normals
-		mesh->transformedNormals.resize(groupNormals.size() * mesh->object3D->instances);
+		mesh->transformedNormals.resize(groupNormals.size() * mesh->instances);
 		mesh->normals = &mesh->transformedNormals;
 		{
 			auto idx = 0;
-			for (auto i = 0; i < mesh->object3D->instances; i++)
+			for (auto i = 0; i < mesh->instances; i++)
 			for (auto j = 0; j < groupNormals.size(); j++) {
 				mesh->transformedNormals[idx++].set(groupNormals[j]);
 			}
 		}
-		if (mesh->object3D->instances > 1) {
+		if (mesh->instances > 1) {
 			// transformed mesh texture coordinates
-			mesh->transformedTextureCoordinates.resize(groupTextureCoordinates.size() * mesh->object3D->instances);
+			mesh->transformedTextureCoordinates.resize(groupTextureCoordinates.size() * mesh->instances);
 			mesh->textureCoordinates = &mesh->transformedTextureCoordinates;
 			{
 				auto idx = 0;
-				for (auto i = 0; i < mesh->object3D->instances; i++)
+				for (auto i = 0; i < mesh->instances; i++)
 				for (auto j = 0; j < groupTextureCoordinates.size(); j++) {
 					mesh->transformedTextureCoordinates[idx++].set(groupTextureCoordinates[j]);
 				}
@@ -127,11 +137,11 @@ Object3DGroupMesh* Object3DGroupMesh::createMesh(Object3DGroupRenderer* object3D
 		}
 		// transformed mesh tangents
 		if (groupTangents.size() > 0) {
-			mesh->transformedTangents.resize(groupTangents.size() * mesh->object3D->instances);
+			mesh->transformedTangents.resize(groupTangents.size() * mesh->instances);
 			mesh->tangents = &mesh->transformedTangents;
 			{
 				auto idx = 0;
-				for (auto i = 0; i < mesh->object3D->instances; i++)
+				for (auto i = 0; i < mesh->instances; i++)
 				for (auto j = 0; j < groupTangents.size(); j++) {
 					mesh->transformedTangents[idx++].set(groupTangents[j]);
 				}
@@ -139,18 +149,18 @@ Object3DGroupMesh* Object3DGroupMesh::createMesh(Object3DGroupRenderer* object3D
 		}
 		// transformed mesh bitangents
 		if (groupBitangents.size() > 0) {
-			mesh->transformedBitangents.resize(groupBitangents.size() * mesh->object3D->instances);
+			mesh->transformedBitangents.resize(groupBitangents.size() * mesh->instances);
 			mesh->bitangents = &mesh->transformedBitangents;
 			{
 				auto idx = 0;
-				for (auto i = 0; i < mesh->object3D->instances; i++)
+				for (auto i = 0; i < mesh->instances; i++)
 				for (auto j = 0; j < groupBitangents.size(); j++) {
 					mesh->transformedBitangents[idx++].set(groupBitangents[j]);
 				}
 			}
 		}
 	} else {
-		// no transformations on CPU, we can use model data
+		// no transformations on CPU, we can use model data, instances get replicated when setting up buffers
 		mesh->vertices = &groupVertices;
 		mesh->normals = &groupNormals;
 		mesh->textureCoordinates = &groupTextureCoordinates;
@@ -167,11 +177,11 @@ Object3DGroupMesh* Object3DGroupMesh::createMesh(Object3DGroupRenderer* object3D
 	for (auto& facesEntity : group->getFacesEntities()) {
 		indicesCount += 3 * facesEntity.getFaces().size();
 	}
-	mesh->indices.resize(mesh->object3D->instances * indicesCount);
+	mesh->indices.resize(mesh->instances * indicesCount);
 	{
 		auto j = 0;
 		for (auto& facesEntity : group->getFacesEntities()) {
-			for (auto i = 0; i < mesh->object3D->instances; i++) {
+			for (auto i = 0; i < mesh->instances; i++) {
 				for (auto& face : facesEntity.getFaces())
 				for (auto& vertexIndex : face.getVertexIndices()) {
 					mesh->indices[j++] = groupVertices.size() * i + vertexIndex;
@@ -195,8 +205,8 @@ Object3DGroupMesh* Object3DGroupMesh::createMesh(Object3DGroupRenderer* object3D
 		// skinning computation caches if computing skinning on CPU
 		if (mesh->animationProcessingTarget == Engine::AnimationProcessingTarget::CPU || mesh->animationProcessingTarget == Engine::AnimationProcessingTarget::CPU_NORENDERING) {
 			mesh->cSkinningJointWeight.resize(groupVertices.size());
-			mesh->cSkinningJointTransformationsMatrices.resize(mesh->object3D->instances);
-			for (auto i = 0; i < mesh->object3D->instances; i++) mesh->cSkinningJointTransformationsMatrices[i].resize(groupVertices.size());
+			mesh->cSkinningJointTransformationsMatrices.resize(mesh->instances);
+			for (auto i = 0; i < mesh->instances; i++) mesh->cSkinningJointTransformationsMatrices[i].resize(groupVertices.size());
 			// compute joint weight caches
 			auto& joints = skinning->getJoints();
 			auto& weights = skinning->getWeights();
@@ -205,7 +215,7 @@ Object3DGroupMesh* Object3DGroupMesh::createMesh(Object3DGroupRenderer* object3D
 				auto vertexJointWeights = jointsWeights[vertexIndex].size();
 				if (vertexJointWeights > mesh->cSkinningMaxVertexWeights) mesh->cSkinningMaxVertexWeights = vertexJointWeights;
 				mesh->cSkinningJointWeight[vertexIndex].resize(vertexJointWeights);
-				for (auto i = 0; i < mesh->object3D->instances; i++) mesh->cSkinningJointTransformationsMatrices[i][vertexIndex].resize(vertexJointWeights);
+				for (auto i = 0; i < mesh->instances; i++) mesh->cSkinningJointTransformationsMatrices[i][vertexIndex].resize(vertexJointWeights);
 				{
 					auto jointWeightIdx = 0;
 					for (auto& jointWeight : jointsWeights[vertexIndex]) {
@@ -215,7 +225,7 @@ Object3DGroupMesh* Object3DGroupMesh::createMesh(Object3DGroupRenderer* object3D
 						jointWeightIdx++;
 					}
 				}
-				for (auto i = 0; i < mesh->object3D->instances; i++) {
+				for (auto i = 0; i < mesh->instances; i++) {
 					auto jointWeightIdx = 0;
 					for (auto& jointWeight : jointsWeights[vertexIndex]) {
 						auto& joint = joints[jointWeight.getJointIndex()];
@@ -356,9 +366,9 @@ bool Object3DGroupMesh::getRecreatedBuffers()
 }
 
 void Object3DGroupMesh::setupVertexIndicesBuffer(Renderer *renderer, void *context, int32_t vboId) {
-	// upload
+	// upload, indices already contain all instances
 	if (renderer->isUsingShortIndices() == true) {
-		if (object3D->instances * indices.size() > 65535) {
+		if (indices.size() > 65535) {
 			Console::println(
 				"Object3DGroupMesh::setupVertexIndicesBuffer(): " +
 				group->getModel()->getName() + ":" +
@@ -367,18 +377,16 @@ void Object3DGroupMesh::setupVertexIndicesBuffer(Renderer *renderer, void *conte
 				to_string(indices.size())
 			);
 		}
-		auto sbIndices = ObjectBuffer::getByteBuffer(context, object3D->instances * faceCount * 3 * sizeof(uint16_t))->asShortBuffer();
+		auto sbIndices = ObjectBuffer::getByteBuffer(context, indices.size() * sizeof(uint16_t))->asShortBuffer();
 		// create face vertex indices, will never be changed in engine
-		for (auto i = 0; i < object3D->instances; i++)
 		for (auto index: indices) {
 			sbIndices.put(index);
 		}
 		// done, upload
 		renderer->uploadIndicesBufferObject(context, vboId, sbIndices.getPosition() * sizeof(uint16_t), &sbIndices);
 	} else {
-		auto ibIndices = ObjectBuffer::getByteBuffer(context, object3D->instances * faceCount * 3 * sizeof(uint32_t))->asIntBuffer();
+		auto ibIndices = ObjectBuffer::getByteBuffer(context, indices.size() * sizeof(uint32_t))->asIntBuffer();
 		// create face vertex indices, will never be changed in engine
-		for (auto i = 0; i < object3D->instances; i++)
 		for (auto index: indices) {
 			ibIndices.put(index);
 		}
@@ -391,9 +399,12 @@ void Object3DGroupMesh::setupVertexIndicesBuffer(Renderer *renderer, void *conte
 void Object3DGroupMesh::setupTextureCoordinatesBuffer(Renderer* renderer, void* context, int32_t vboId)
 {
 	if (textureCoordinates->size() == 0) return;
+	// texture coordinates are only replicated if not already transformed for each instance
+	auto replicas = textureCoordinates == &transformedTextureCoordinates?1:verticesReplicas;
 	// create texture coordinates buffer, will never be changed in engine
-	auto fbTextureCoordinates = ObjectBuffer::getByteBuffer(context, textureCoordinates->size() * 2 * sizeof(float))->asFloatBuffer();
+	auto fbTextureCoordinates = ObjectBuffer::getByteBuffer(context, replicas * textureCoordinates->size() * 2 * sizeof(float))->asFloatBuffer();
 	// construct texture coordinates byte buffer as this will not change usually
+	for (auto i = 0; i < replicas; i++)
 	for (auto& textureCoordinate: *textureCoordinates) {
 		fbTextureCoordinates.put(textureCoordinate.getArray());
 	}
@@ -403,8 +414,9 @@ void Object3DGroupMesh::setupTextureCoordinatesBuffer(Renderer* renderer, void*
 
 void Object3DGroupMesh::setupVerticesBuffer(Renderer* renderer, void* context, int32_t vboId)
 {
-	auto fbVertices = ObjectBuffer::getByteBuffer(context, vertices->size() * 3 * sizeof(float))->asFloatBuffer();
+	auto fbVertices = ObjectBuffer::getByteBuffer(context, verticesReplicas * vertices->size() * 3 * sizeof(float))->asFloatBuffer();
 	// create vertices buffers
+	for (auto i = 0; i < verticesReplicas; i++)
 	for (auto& vertex: *vertices) {
 		fbVertices.put(vertex.getArray());
 	}
@@ -414,8 +426,9 @@ void Object3DGroupMesh::setupVerticesBuffer(Renderer* renderer, void* context, i
 
 void Object3DGroupMesh::setupNormalsBuffer(Renderer* renderer, void* context, int32_t vboId)
 {
-	auto fbNormals = ObjectBuffer::getByteBuffer(context, normals->size() * 3 * sizeof(float))->asFloatBuffer();
+	auto fbNormals = ObjectBuffer::getByteBuffer(context, verticesReplicas * normals->size() * 3 * sizeof(float))->asFloatBuffer();
 	// create normals buffers
+	for (auto i = 0; i < verticesReplicas; i++)
 	for (auto& normal: *normals) {
 		fbNormals.put(normal.getArray());
 	}
@@ -427,8 +440,9 @@ void Object3DGroupMesh::setupTangentsBuffer(Renderer* renderer, void* context, i
 {
 	// check if we have tangents
 	if (tangents == nullptr) return;
-	auto fbTangents = ObjectBuffer::getByteBuffer(context, tangents->size() * 3 * sizeof(float))->asFloatBuffer();
+	auto fbTangents = ObjectBuffer::getByteBuffer(context, verticesReplicas * tangents->size() * 3 * sizeof(float))->asFloatBuffer();
 	// create tangents buffers
+	for (auto i = 0; i < verticesReplicas; i++)
 	for (auto& tangent: *tangents) {
 		fbTangents.put(tangent.getArray());
 	}
@@ -440,8 +454,9 @@ void Object3DGroupMesh::setupBitangentsBuffer(Renderer* renderer, void* context,
 {
 	// check if we have bitangents
 	if (bitangents == nullptr) return;
-	auto fbBitangents = ObjectBuffer::getByteBuffer(context, bitangents->size() * 3 * sizeof(float))->asFloatBuffer();
+	auto fbBitangents = ObjectBuffer::getByteBuffer(context, verticesReplicas * bitangents->size() * 3 * sizeof(float))->asFloatBuffer();
 	// create bitangents buffers
+	for (auto i = 0; i < verticesReplicas; i++)
 	for (auto& bitangent: *bitangents) {
 		fbBitangents.put(bitangent.getArray());
 	}
@@ -449,6 +464,52 @@ void Object3DGroupMesh::setupBitangentsBuffer(Renderer* renderer, void* context,
 	renderer->uploadBufferObject(context, vboId, fbBitangents.getPosition() * sizeof(float), &fbBitangents);
 }
 
+void Object3DGroupMesh::setupPackedVerticesBuffer(Renderer* renderer, void* context, int32_t vboId)
+{
+	auto bbPackedVertices = ObjectBuffer::getByteBuffer(context, verticesReplicas * vertices->size() * sizeof(VertexPacking::PackedVertex));
+	// create packed vertices buffer
+	VertexPacking::PackedVertex packedVertex;
+	auto haveTextureCoordinates = textureCoordinates->size() == vertices->size();
+	for (auto i = 0; i < vertices->size(); i++) {
+		VertexPacking::pack(
+			(*vertices)[i],
+			(*normals)[i],
+			tangents != nullptr?&(*tangents)[i]:nullptr,
+			bitangents != nullptr?&(*bitangents)[i]:nullptr,
+			haveTextureCoordinates == true?&(*textureCoordinates)[i]:nullptr,
+			packedVertex
+		);
+		bbPackedVertices->put((const uint8_t*)&packedVertex, sizeof(packedVertex));
+	}
+	// replicate packed vertices for further instances
+	auto packedVerticesSize = bbPackedVertices->getPosition();
+	for (auto i = 1; i < verticesReplicas; i++) {
+		bbPackedVertices->put((const uint8_t*)bbPackedVertices->getBuffer(), packedVerticesSize);
+	}
+	// done, upload
+	renderer->uploadBufferObject(context, vboId, bbPackedVertices->getPosition(), bbPackedVertices);
+}
+
+int64_t Object3DGroupMesh::computeMemoryUsage()
+{
+	int64_t memoryUsage = sizeof(Object3DGroupMesh);
+	memoryUsage+= indices.capacity() * sizeof(int32_t);
+	memoryUsage+= transformedVertices.capacity() * sizeof(Vector3);
+	memoryUsage+= transformedNormals.capacity() * sizeof(Vector3);
+	memoryUsage+= transformedTangents.capacity() * sizeof(Vector3);
+	memoryUsage+= transformedBitangents.capacity() * sizeof(Vector3);
+	memoryUsage+= transformedTextureCoordinates.capacity() * sizeof(TextureCoordinate);
+	memoryUsage+= skinningMatrices.capacity() * sizeof(map<string, Matrix4x4*>*);
+	memoryUsage+= cSkinningJointWeight.capacity() * sizeof(vector<float>);
+	for (auto& jointWeights: cSkinningJointWeight) memoryUsage+= jointWeights.capacity() * sizeof(float);
+	memoryUsage+= cSkinningJointTransformationsMatrices.capacity() * sizeof(vector<vector<Matrix4x4*>>);
+	for (auto& instanceJointTransformationsMatrices: cSkinningJointTransformationsMatrices) {
+		memoryUsage+= instanceJointTransformationsMatrices.capacity() * sizeof(vector<Matrix4x4*>);
+		for (auto& jointTransformationsMatrices: instanceJointTransformationsMatrices) memoryUsage+= jointTransformationsMatrices.capacity() * sizeof(Matrix4x4*);
+	}
+	return memoryUsage;
+}
+
 void Object3DGroupMesh::setupOriginsBuffer(Renderer* renderer, void* context, int32_t vboId) {
 	// check if we have texture coordinates
 	auto& origins = group->getOrigins();
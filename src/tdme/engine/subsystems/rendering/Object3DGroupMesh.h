@@ -9,6 +9,9 @@
 #include <tdme/engine/fwd-tdme.h>
 #include <tdme/engine/Engine.h>
 #include <tdme/engine/model/fwd-tdme.h>
+#include <tdme/engine/model/Group.h>
+#include <tdme/engine/model/TextureCoordinate.h>
+#include <tdme/engine/subsystems/manager/fwd-tdme.h>
 #include <tdme/engine/subsystems/rendering/fwd-tdme.h>
 #include <tdme/engine/subsystems/skinning/fwd-tdme.h>
 #include <tdme/math/fwd-tdme.h>
@@ -43,12 +46,16 @@ class tdme::engine::subsystems::rendering::Object3DGroupMesh final
 	friend class Object3DGroupRenderer;
 	friend class Object3DRenderer;
 	friend class TransparentRenderFacesPool;
+	friend class tdme::engine::subsystems::manager::MeshManager;
 	friend class tdme::engine::subsystems::skinning::SkinningShader;
 
 private:
+	// object 3d and its group renderer which created this mesh, only used by skinning as skinned meshes are not shared
 	Object3DBase* object3D;
 	Object3DGroupRenderer* object3DGroupRenderer;
 	Group* group;
+	int32_t instances;
+	int32_t verticesReplicas;
 	int32_t faceCount;
 	const vector<Vector3>* vertices;
 	const vector<Vector3>* normals;
@@ -163,6 +170,27 @@ private:
 	 */
 	void setupBitangentsBuffer(Renderer* renderer, void* context, int32_t vboId);
 
+	/**
+	 * Compute memory usage of this mesh, model data shared with other meshes is not included
+	 * @return memory usage in bytes
+	 */
+	int64_t computeMemoryUsage();
+
+	/**
+	 * @return if mesh has static vertices, which are neither transformed on CPU nor on GPU
+	 */
+	inline bool hasStaticVertices() {
+		return vertices == &group->getVertices() && skinning == false;
+	}
+
+	/**
+	 * Set up packed vertices buffer, which interleaves vertices, normals, tangents, bitangent signs and texture coordinates
+	 * @param renderer renderer
+	 * @param context context
+	 * @param vboId vbo id
+	 */
+	void setupPackedVerticesBuffer(Renderer* renderer, void* context, int32_t vboId);
+
 	/**
 	 * Set up render group object origins data buffer
 	 * @param renderer renderer
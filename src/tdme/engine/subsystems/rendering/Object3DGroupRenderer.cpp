@@ -42,9 +42,14 @@ void Object3DGroupRenderer::preRender(void* context)
 
 	// initialize if not yet done
 	if (vboBaseIds == nullptr) {
+		// static meshes can use packed vertices, which are indices and a single interleaved vertex buffer
+		packedVertices =
+			Engine::isPackedVertices() == true &&
+			Engine::renderer->isPackedVerticesAvailable() == true &&
+			object3DGroup->mesh->hasStaticVertices() == true;
 		vboManagedBase = Engine::getInstance()->getVBOManager()->addVBO(
 			object3DGroup->id,
-			3 + (object3DGroup->mesh->group->getTextureCoordinates().size() > 0?1:0),
+			packedVertices == true?2:3 + (object3DGroup->mesh->group->getTextureCoordinates().size() > 0?1:0),
 			true,
 			true,
 			created
@@ -55,7 +60,8 @@ void Object3DGroupRenderer::preRender(void* context)
 	}
 
 	// initialize tangents, bitangents
-	if (Engine::renderer->isNormalMappingAvailable() &&
+	if (packedVertices == false &&
+		Engine::renderer->isNormalMappingAvailable() &&
 		object3DGroup->mesh->group->getTangents().size() > 0 &&
 		object3DGroup->mesh->group->getBitangents().size() > 0 &&
 		vboNormalMappingIds == nullptr) {
@@ -81,7 +87,7 @@ void Object3DGroupRenderer::preRender(void* context)
 			// upload indices
 			object3DGroup->mesh->setupVertexIndicesBuffer(Engine::renderer, context, (*vboBaseIds)[0]);
 			// upload texture coordinates
-			if (object3DGroup->mesh->group->getTextureCoordinates().size() > 0) {
+			if (packedVertices == false && object3DGroup->mesh->group->getTextureCoordinates().size() > 0) {
 				object3DGroup->mesh->setupTextureCoordinatesBuffer(Engine::renderer, context, (*vboBaseIds)[3]);
 			}
 			// upload render group object origins
@@ -90,10 +96,15 @@ void Object3DGroupRenderer::preRender(void* context)
 				vboManagedOrigins->setUploaded(true);
 			}
 		}
-		// upload vertices
-		object3DGroup->mesh->setupVerticesBuffer(Engine::renderer, context, (*vboBaseIds)[1]);
-		// upload normals
-		object3DGroup->mesh->setupNormalsBuffer(Engine::renderer, context, (*vboBaseIds)[2]);
+		if (packedVertices == true) {
+			// upload packed vertices
+			object3DGroup->mesh->setupPackedVerticesBuffer(Engine::renderer, context, (*vboBaseIds)[1]);
+		} else {
+			// upload vertices
+			object3DGroup->mesh->setupVerticesBuffer(Engine::renderer, context, (*vboBaseIds)[1]);
+			// upload normals
+			object3DGroup->mesh->setupNormalsBuffer(Engine::renderer, context, (*vboBaseIds)[2]);
+		}
 		// tangents, bitangents
 		if (vboNormalMappingIds != nullptr) {
 			object3DGroup->mesh->setupTangentsBuffer(Engine::renderer, context, (*vboNormalMappingIds)[0]);
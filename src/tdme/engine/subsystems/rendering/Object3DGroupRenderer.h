@@ -39,6 +39,7 @@ private:
 	vector<int32_t>* vboNormalMappingIds { nullptr  };
 	vector<int32_t>* vboOrigins { nullptr };
 	bool haveVBOs { false };
+	bool packedVertices { false };
 public:
 
 	/**
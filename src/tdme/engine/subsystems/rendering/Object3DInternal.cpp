@@ -122,12 +122,14 @@ void Object3DInternal::unsetGroupTransformationsMatrix(const string& id) {
 void Object3DInternal::fromTransformations(const Transformations& transformations)
 {
 	instanceTransformations[currentInstance].fromTransformations(transformations);
+	markInstanceDataDirty();
 	updateBoundingBox();
 }
 
 void Object3DInternal::update()
 {
 	instanceTransformations[currentInstance].update();
+	markInstanceDataDirty();
 	updateBoundingBox();
 }
 
@@ -130,6 +130,7 @@ public:
 	 * @param effectColorMul effect color
 	 */
 	inline void setEffectColorMul(const Color4& effectColorMul) {
+		if (this->effectColorMul.getArray() != effectColorMul.getArray()) markInstanceDataDirty();
 		this->effectColorMul = effectColorMul;
 	}
 
@@ -146,6 +147,7 @@ public:
 	 * @return effect color
 	 */
 	inline void setEffectColorAdd(const Color4& effectColorAdd) {
+		if (this->effectColorAdd.getArray() != effectColorAdd.getArray()) markInstanceDataDirty();
 		this->effectColorAdd = effectColorAdd;
 	}
 
@@ -60,6 +60,7 @@
 #include <tdme/os/threading/Thread.h>
 #include <tdme/utils/ByteBuffer.h>
 #include <tdme/utils/FloatBuffer.h>
+#include <tdme/utils/IntBuffer.h>
 #include <tdme/utils/Pool.h>
 #include <tdme/utils/Console.h>
 
@@ -124,11 +125,22 @@ using tdme::os::threading::Semaphore;
 using tdme::os::threading::Thread;
 using tdme::utils::ByteBuffer;
 using tdme::utils::FloatBuffer;
+using tdme::utils::IntBuffer;
 using tdme::utils::Pool;
 using tdme::utils::Console;
 
 constexpr int32_t Object3DRenderer::BATCHRENDERER_MAX;
 constexpr int32_t Object3DRenderer::INSTANCEDRENDERING_OBJECTS_MAX;
+constexpr int32_t Object3DRenderer::INSTANCEDATA_TEXELS;
+constexpr int32_t Object3DRenderer::INSTANCEDATA_SLOTS_MIN;
+constexpr int64_t Object3DRenderer::INSTANCEDATA_UNUSED_FRAMES_MAX;
+constexpr int32_t Object3DRenderer::RENDERQUEUEKEY_DEPTH_BITS;
+constexpr int32_t Object3DRenderer::RENDERQUEUEKEY_INSTANCES_BITS;
+constexpr int32_t Object3DRenderer::RENDERQUEUEKEY_MODEL_BITS;
+constexpr int32_t Object3DRenderer::RENDERQUEUEKEY_SHADER_BITS;
+constexpr uint64_t Object3DRenderer::MATERIALKEY_NONE;
+
+unordered_map<string, int32_t> Object3DRenderer::shaderIdxByShaderIds {{ "default", 0 }};
 
 Object3DRenderer::Object3DRenderer(Engine* engine, Renderer* renderer) {
 	this->engine = engine;
@@ -141,6 +153,7 @@ Object3DRenderer::Object3DRenderer(Engine* engine, Renderer* renderer) {
 	contexts.resize(threadCount);
 	if (this->renderer->isInstancedRenderingAvailable() == true) {
 		for (auto& context: contexts) {
+			context.bbInstanceIndices = ByteBuffer::allocate(sizeof(int32_t) * INSTANCEDRENDERING_OBJECTS_MAX);
 			context.bbEffectColorMuls = ByteBuffer::allocate(4 * sizeof(float) * INSTANCEDRENDERING_OBJECTS_MAX);
 			context.bbEffectColorAdds = ByteBuffer::allocate(4 * sizeof(float) * INSTANCEDRENDERING_OBJECTS_MAX);
 			context.bbMvMatrices = ByteBuffer::allocate(16 * sizeof(float) * INSTANCEDRENDERING_OBJECTS_MAX);
@@ -156,6 +169,12 @@ Object3DRenderer::~Object3DRenderer() {
 	delete transparentRenderFacesPool;
 	delete renderTransparentRenderPointsPool;
 	delete psePointBatchRenderer;
+	for (auto& context: contexts) {
+		if (context.bbInstanceIndices != nullptr) delete context.bbInstanceIndices;
+		if (context.bbEffectColorMuls != nullptr) delete context.bbEffectColorMuls;
+		if (context.bbEffectColorAdds != nullptr) delete context.bbEffectColorAdds;
+		if (context.bbMvMatrices != nullptr) delete context.bbMvMatrices;
+	}
 }
 
 void Object3DRenderer::initialize()
@@ -163,7 +182,7 @@ void Object3DRenderer::initialize()
 	psePointBatchRenderer->initialize();
 	for (auto i = 0; i < threadCount; i++) {
 		auto created = false;
-		auto vboManaged = Engine::getInstance()->getVBOManager()->addVBO("tdme.object3drenderer.instancedrendering." + to_string(i), 3, false, false, created);
+		auto vboManaged = Engine::getInstance()->getVBOManager()->addVBO("tdme.object3drenderer.instancedrendering." + to_string(i), 4, false, false, created);
 		contexts[i].vboInstancedRenderingIds = vboManaged->getVBOIds();
 	}
 }
@@ -174,6 +193,13 @@ void Object3DRenderer::dispose()
 	for (auto i = 0; i < threadCount; i++) {
 		Engine::getInstance()->getVBOManager()->removeVBO("tdme.object3drenderer.instancedrendering." + to_string(i));
 	}
+	// dispose instance data buffers
+	for (auto& context: contexts) {
+		for (auto& instanceDataBufferIt: context.instanceDataBuffersByModel) {
+			disposeInstanceDataBuffer(instanceDataBufferIt.second);
+		}
+		context.instanceDataBuffersByModel.clear();
+	}
 	// dispose batch vbo renderer
 	for (auto batchRenderer: trianglesBatchRenderers) {
 		batchRenderer->dispose();
@@ -205,7 +231,152 @@ BatchRendererTriangles* Object3DRenderer::acquireTrianglesBatchRenderer()
 
 void Object3DRenderer::reset()
 {
-	objectsByShadersAndModels.clear();
+	for (auto& context: contexts) {
+		context.renderQueue.clear();
+		context.objectsByModel.clear();
+	}
+}
+
+int32_t Object3DRenderer::getShaderIdx(const string& shaderId) {
+	auto shaderIdxByShaderIdIt = shaderIdxByShaderIds.find(shaderId);
+	if (shaderIdxByShaderIdIt != shaderIdxByShaderIds.end()) return shaderIdxByShaderIdIt->second;
+	auto shaderIdx = static_cast<int32_t>(shaderIdxByShaderIds.size());
+	shaderIdxByShaderIds[shaderId] = shaderIdx;
+	return shaderIdx;
+}
+
+void Object3DRenderer::resetStatistics() {
+	for (auto& context: contexts) context.statistics = RenderingStatistics();
+}
+
+void Object3DRenderer::getStatistics(RenderingStatistics& statistics) {
+	statistics = RenderingStatistics();
+	for (auto& context: contexts) {
+		statistics.renderQueueEntries+= context.statistics.renderQueueEntries;
+		statistics.batches+= context.statistics.batches;
+		statistics.shaderChanges+= context.statistics.shaderChanges;
+		statistics.materialChanges+= context.statistics.materialChanges;
+		statistics.textureChanges+= context.statistics.textureChanges;
+		statistics.drawCalls+= context.statistics.drawCalls;
+		statistics.instances+= context.statistics.instances;
+		statistics.instanceDataUploadedBytes+= context.statistics.instanceDataUploadedBytes;
+		statistics.instanceIndicesUploadedBytes+= context.statistics.instanceIndicesUploadedBytes;
+	}
+}
+
+void Object3DRenderer::prepareInstanceDataBuffers() {
+	frame++;
+	// release unused instance data only from time to time
+	if (frame % INSTANCEDATA_UNUSED_FRAMES_MAX != 0) return;
+	for (auto& context: contexts) {
+		for (auto instanceDataBufferIt = context.instanceDataBuffersByModel.begin(); instanceDataBufferIt != context.instanceDataBuffersByModel.end();) {
+			auto instanceDataBuffer = instanceDataBufferIt->second;
+			// dispose instance data buffers of models that have not been rendered for a while
+			if (frame - instanceDataBuffer->frame > INSTANCEDATA_UNUSED_FRAMES_MAX) {
+				disposeInstanceDataBuffer(instanceDataBuffer);
+				instanceDataBufferIt = context.instanceDataBuffersByModel.erase(instanceDataBufferIt);
+				continue;
+			}
+			// release slots of objects that have not been rendered for a while, objects could have been disposed already
+			for (auto slotIt = instanceDataBuffer->slots.begin(); slotIt != instanceDataBuffer->slots.end();) {
+				if (frame - slotIt->second.frame > INSTANCEDATA_UNUSED_FRAMES_MAX) {
+					instanceDataBuffer->freeSlots.push_back(slotIt->second.idx);
+					slotIt = instanceDataBuffer->slots.erase(slotIt);
+					continue;
+				}
+				++slotIt;
+			}
+			++instanceDataBufferIt;
+		}
+	}
+}
+
+void Object3DRenderer::disposeInstanceDataBuffer(InstanceDataBuffer* instanceDataBuffer) {
+	vector<int32_t> vboIds { instanceDataBuffer->vboId };
+	renderer->disposeBufferObjects(vboIds);
+	delete instanceDataBuffer;
+}
+
+Object3DRenderer::InstanceDataBuffer* Object3DRenderer::updateInstanceData(void* context, Object3DRenderContext& object3DRenderContext, const vector<Object3D*>& objects) {
+	auto firstObject = objects[0];
+	auto& instanceDataBuffer = object3DRenderContext.instanceDataBuffersByModel[firstObject->getModel()];
+	if (instanceDataBuffer == nullptr) {
+		instanceDataBuffer = new InstanceDataBuffer();
+		instanceDataBuffer->vboId = renderer->createBufferObjects(1, false, false)[0];
+		instanceDataBuffer->groupCount = firstObject->object3dGroups.size();
+	}
+	instanceDataBuffer->frame = frame;
+
+	// update slots of objects whose instance data changed since last write
+	auto slotBytes = instanceDataBuffer->groupCount * INSTANCEDATA_TEXELS * 4 * sizeof(float);
+	ByteBuffer bbData(&instanceDataBuffer->data);
+	auto fbData = bbData.asFloatBuffer();
+	Matrix4x4 modelMatrix;
+	for (auto object: objects) {
+		auto slotIt = instanceDataBuffer->slots.find(object);
+		if (slotIt == instanceDataBuffer->slots.end()) {
+			// acquire slot, grow instance data buffer if required
+			int32_t slotIdx;
+			if (instanceDataBuffer->freeSlots.empty() == false) {
+				slotIdx = instanceDataBuffer->freeSlots[instanceDataBuffer->freeSlots.size() - 1];
+				instanceDataBuffer->freeSlots.erase(instanceDataBuffer->freeSlots.end() - 1);
+			} else {
+				slotIdx = instanceDataBuffer->slots.size();
+				if (slotIdx == instanceDataBuffer->slotCapacity) {
+					instanceDataBuffer->slotCapacity = Math::max(INSTANCEDATA_SLOTS_MIN, instanceDataBuffer->slotCapacity * 2);
+					instanceDataBuffer->data.resize(instanceDataBuffer->slotCapacity * slotBytes);
+					instanceDataBuffer->reallocate = true;
+				}
+			}
+			slotIt = instanceDataBuffer->slots.insert({ object, { slotIdx, 0ULL, frame }}).first;
+		}
+		auto& slot = slotIt->second;
+		slot.frame = frame;
+		if (slot.version == object->getInstanceDataVersion()) continue;
+		slot.version = object->getInstanceDataVersion();
+		// write model matrix, effect color mul and effect color add of each object 3d group
+		fbData.setPosition(slot.idx * slotBytes);
+		for (auto object3DGroup: object->object3dGroups) {
+			fbData.put(
+				object3DGroup->mesh->skinning == true?
+					modelMatrix.identity().getArray():
+					modelMatrix.set(*object3DGroup->groupTransformationsMatrix).multiply(object->getTransformationsMatrix()).getArray()
+			);
+			fbData.put(object->effectColorMul.getArray());
+			fbData.put(object->effectColorAdd.getArray());
+		}
+		if (instanceDataBuffer->reallocate == false) instanceDataBuffer->changedSlots.push_back(slot.idx);
+	}
+
+	// upload instance data buffer completely if it had to grow
+	if (instanceDataBuffer->reallocate == true) {
+		auto size = static_cast<int32_t>(instanceDataBuffer->data.size());
+		renderer->uploadBufferObject(context, instanceDataBuffer->vboId, size, &fbData);
+		object3DRenderContext.statistics.instanceDataUploadedBytes+= size;
+		instanceDataBuffer->reallocate = false;
+		instanceDataBuffer->changedSlots.clear();
+		return instanceDataBuffer;
+	}
+
+	// otherwise upload runs of consecutive changed slots
+	auto& changedSlots = instanceDataBuffer->changedSlots;
+	if (changedSlots.empty() == true) return instanceDataBuffer;
+	sort(changedSlots.begin(), changedSlots.end());
+	auto changedSlotIdx = 0;
+	while (changedSlotIdx < changedSlots.size()) {
+		auto firstSlotIdx = changedSlots[changedSlotIdx++];
+		auto lastSlotIdx = firstSlotIdx;
+		while (changedSlotIdx < changedSlots.size() && changedSlots[changedSlotIdx] == lastSlotIdx + 1) lastSlotIdx = changedSlots[changedSlotIdx++];
+		auto offset = firstSlotIdx * slotBytes;
+		auto size = (lastSlotIdx - firstSlotIdx + 1) * slotBytes;
+		auto bbRange = ObjectBuffer::getByteBuffer(context, size);
+		bbRange->put(&instanceDataBuffer->data[offset], size);
+		auto fbRange = bbRange->asFloatBuffer();
+		renderer->uploadBufferObject(context, instanceDataBuffer->vboId, offset, size, &fbRange);
+		object3DRenderContext.statistics.instanceDataUploadedBytes+= size;
+	}
+	changedSlots.clear();
+	return instanceDataBuffer;
 }
 
 void Object3DRenderer::render(const vector<Object3D*>& objects, bool renderTransparentFaces, int32_t renderTypes)
@@ -213,9 +384,10 @@ void Object3DRenderer::render(const vector<Object3D*>& objects, bool renderTrans
 	// clear transparent render faces data
 	transparentRenderFacesPool->reset();
 	releaseTransparentFacesGroups();
+	transparentFacesObjectSorting = Engine::getTransparencySorting() == Engine::TRANSPARENCYSORTING_OBJECTS;
 
 	if (renderer->isSupportingMultithreadedRendering() == false) {
-		renderFunction(1, 0, objects, objectsByShadersAndModels, renderTransparentFaces, renderTypes, transparentRenderFacesPool);
+		renderFunction(1, 0, objects, renderTransparentFaces, renderTypes, transparentRenderFacesPool);
 	} else {
 		Object3DRenderer_InstancedRenderFunctionParameters parameters;
 		parameters.objects = objects;
@@ -226,19 +398,21 @@ void Object3DRenderer::render(const vector<Object3D*>& objects, bool renderTrans
 		for (auto engineThread: Engine::engineThreads) engineThread->rendering.parameters = parameters;
 		for (auto engineThread: Engine::engineThreads) engineThread->state = Engine::EngineThread::STATE_RENDERING;
 
-		renderFunction(threadCount, 0, objects, objectsByShadersAndModels, renderTransparentFaces, renderTypes, transparentRenderFacesPool);
+		renderFunction(threadCount, 0, objects, renderTransparentFaces, renderTypes, transparentRenderFacesPool);
 
 		for (auto engineThread: Engine::engineThreads) while(engineThread->state == Engine::EngineThread::STATE_RENDERING);
 		for (auto engineThread: Engine::engineThreads) transparentRenderFacesPool->merge(engineThread->rendering.transparentRenderFacesPool);
+
+		// draw calls of transparent faces, particles and lines in default context follow draw calls of all engine threads
+		renderer->onSequencePoint();
 	}
 
 	// use default context
 	auto context = renderer->getDefaultContext();
 	// render transparent render faces if any exist
-	auto& transparentRenderFaces = transparentRenderFacesPool->getTransparentRenderFaces();
-	if (transparentRenderFaces.size() > 0) {
+	if (transparentRenderFacesPool->getTransparentRenderFaces().size() > 0) {
 		// sort transparent render faces from far to near
-		sort(transparentRenderFaces.begin(), transparentRenderFaces.end(), TransparentRenderFace::compare);
+		auto& transparentRenderFaces = transparentRenderFacesPool->getSortedTransparentRenderFaces();
 		// second render pass, draw color buffer for transparent objects
 		// 	set up blending, but no culling and no depth buffer
 		//	TODO: enabling depth buffer let shadow disappear
@@ -293,6 +467,26 @@ void Object3DRenderer::render(const vector<Object3D*>& objects, bool renderTrans
 	}
 }
 
+void Object3DRenderer::createTransparentRenderFaces(TransparentRenderFacesPool* transparentRenderFacesPool, const Matrix4x4& cameraMatrix, Object3D* object, Object3DGroup* object3DGroup, int32_t facesEntityIdx, int32_t faceIdx) {
+	if (transparentFacesObjectSorting == true) {
+		// all faces share distance of object
+		Vector3 objectCenter;
+		cameraMatrix.multiply(object->getBoundingBoxTransformed()->getCenter(), objectCenter);
+		transparentRenderFacesPool->createTransparentRenderFaces(-objectCenter.getZ(), object3DGroup, facesEntityIdx, faceIdx);
+	} else {
+		Matrix4x4 modelViewMatrix;
+		transparentRenderFacesPool->createTransparentRenderFaces(
+			(object3DGroup->mesh->skinning == true?
+				modelViewMatrix.identity():
+				modelViewMatrix.set(*object3DGroup->groupTransformationsMatrix).multiply(object->getTransformationsMatrix())
+			).multiply(cameraMatrix),
+			object3DGroup,
+			facesEntityIdx,
+			faceIdx
+		);
+	}
+}
+
 void Object3DRenderer::prepareTransparentFaces(const vector<TransparentRenderFace*>& transparentRenderFaces)
 {
 	// all those faces should share the object and object 3d group, ...
@@ -314,6 +508,7 @@ void Object3DRenderer::prepareTransparentFaces(const vector<TransparentRenderFac
 	auto& effectColorMul = object3D->getEffectColorMul();
 	const Material* material = nullptr;
 	auto textureCoordinates = false;
+	TransparentRenderFacesGroup* trfGroup = nullptr;
 	Vector3 transformedVector;
 	Vector3 transformedNormal;
 	Vector2 transformedTextureCoordinate;
@@ -321,35 +516,36 @@ void Object3DRenderer::prepareTransparentFaces(const vector<TransparentRenderFac
 	for (auto i = 0; i < transparentRenderFaces.size(); i++) {
 		auto transparentRenderFace = transparentRenderFaces[i];
 		auto facesEntityIdx = transparentRenderFace->facesEntityIdx;
-		// determine if faces entity and so material did switch between last face and current face
+		// determine if faces entity and so material and group did switch between last face and current face
 		if (facesEntity != &facesEntities[facesEntityIdx]) {
 			facesEntity = &facesEntities[facesEntityIdx];
 			material = facesEntity->getMaterial();
-		}
-		textureCoordinates = facesEntity->isTextureCoordinatesAvailable();
-		// create group key
-		string transparentRenderFacesGroupKey = TransparentRenderFacesGroup::createKey(model, object3DGroup, facesEntityIdx, effectColorAdd, effectColorMul, material, textureCoordinates, object3D->getShader());
-		// get group
-		TransparentRenderFacesGroup* trfGroup = nullptr;
-		auto trfGroupIt = transparentRenderFacesGroups.find(transparentRenderFacesGroupKey);
-		if (trfGroupIt != transparentRenderFacesGroups.end()) {
-			trfGroup = trfGroupIt->second;
-		}
-		if (trfGroup == nullptr) {
-			// we do not have the group, create group
-			trfGroup = transparentRenderFacesGroupPool->allocate();
-			trfGroup->set(this, model, object3DGroup, facesEntityIdx, effectColorAdd, effectColorMul, material, textureCoordinates, object3D->getShader());
-			transparentRenderFacesGroups[transparentRenderFacesGroupKey] = trfGroup;
+			textureCoordinates = facesEntity->isTextureCoordinatesAvailable();
+			// create group key
+			string transparentRenderFacesGroupKey = TransparentRenderFacesGroup::createKey(model, object3DGroup, facesEntityIdx, effectColorAdd, effectColorMul, material, textureCoordinates, object3D->getShader());
+			// get group
+			trfGroup = nullptr;
+			auto trfGroupIt = transparentRenderFacesGroups.find(transparentRenderFacesGroupKey);
+			if (trfGroupIt != transparentRenderFacesGroups.end()) {
+				trfGroup = trfGroupIt->second;
+			}
+			if (trfGroup == nullptr) {
+				// we do not have the group, create group
+				trfGroup = transparentRenderFacesGroupPool->allocate();
+				trfGroup->set(this, model, object3DGroup, facesEntityIdx, effectColorAdd, effectColorMul, material, textureCoordinates, object3D->getShader());
+				transparentRenderFacesGroups[transparentRenderFacesGroupKey] = trfGroup;
+			}
 		}
 		auto& textureCoordinates = transparentRenderFace->object3DGroup->mesh->group->getTextureCoordinates();
 		for (auto vertexIdx = 0; vertexIdx < 3; vertexIdx++) {
-			auto arrayIdx = transparentRenderFace->object3DGroup->mesh->indices[transparentRenderFace->faceIdx * 3 + vertexIdx];
+			// indices address all instances, but untransformed meshes only store model data once
+			auto arrayIdx = transparentRenderFace->object3DGroup->mesh->indices[transparentRenderFace->faceIdx * 3 + vertexIdx] % transparentRenderFace->object3DGroup->mesh->vertices->size();
 			trfGroup->addVertex(
 				modelViewMatrix.multiply((*transparentRenderFace->object3DGroup->mesh->vertices)[arrayIdx], transformedVector),
 				modelViewMatrix.multiplyNoTranslation((*transparentRenderFace->object3DGroup->mesh->normals)[arrayIdx], transformedNormal),
 				transparentRenderFace->object3DGroup->textureMatricesByEntities[facesEntityIdx].multiply(
 					textureCoordinates.size() > 0?
-						Vector2(textureCoordinates[arrayIdx].getArray()):
+						Vector2(textureCoordinates[arrayIdx % textureCoordinates.size()].getArray()):
 						Vector2(0.0f, 0.0f),
 					transformedTextureCoordinate
 				)
@@ -426,15 +622,7 @@ void Object3DRenderer::renderObjectsOfSameTypeNonInstanced(const vector<Object3D
 					Object3DGroup::setupTextures(renderer, context, object3DGroup, faceEntityIdx);
 					// set up transparent render faces
 					if (collectTransparentFaces == true) {
-						transparentRenderFacesPool->createTransparentRenderFaces(
-							(_object3DGroup->mesh->skinning == true?
-								modelViewMatrix.identity():
-								modelViewMatrix.set(*_object3DGroup->groupTransformationsMatrix).multiply(object->getTransformationsMatrix())
-							).multiply(cameraMatrix),
-							object->object3dGroups[object3DGroupIdx],
-							faceEntityIdx,
-							faceIdx
-						);
+						createTransparentRenderFaces(transparentRenderFacesPool, cameraMatrix, object, _object3DGroup, faceEntityIdx, faceIdx);
 					}
 				}
 				// keep track of rendered faces
@@ -453,21 +641,13 @@ void Object3DRenderer::renderObjectsOfSameTypeNonInstanced(const vector<Object3D
 					object->effectColorAdd.getAlpha() < -Math::EPSILON) {
 					// add to transparent render faces, if requested
 					if (collectTransparentFaces == true) {
-						transparentRenderFacesPool->createTransparentRenderFaces(
-							(_object3DGroup->mesh->skinning == true ?
-								modelViewMatrix.identity() :
-								modelViewMatrix.set(*_object3DGroup->groupTransformationsMatrix).multiply(object->getTransformationsMatrix())
-							).multiply(cameraMatrix),
-							_object3DGroup,
-							faceEntityIdx,
-							faceIdx
-						);
+						createTransparentRenderFaces(transparentRenderFacesPool, cameraMatrix, object, _object3DGroup, faceEntityIdx, faceIdx);
 					}
 					// skip to next object
 					continue;
 				}
 				// shader
-				auto objectShader = object->getDistanceShader().length() == 0?
+				auto& objectShader = object->getDistanceShader().length() == 0?
 					object->getShader():
 					objectCamFromAxis.set(object->getBoundingBoxTransformed()->getCenter()).sub(camera->getLookFrom()).computeLengthSquared() < Math::square(object->getDistanceShaderDistance())?
 						object->getShader():
@@ -475,12 +655,13 @@ void Object3DRenderer::renderObjectsOfSameTypeNonInstanced(const vector<Object3D
 				if (renderer->getShader(context) != objectShader) {
 					renderer->setShader(context, objectShader);
 					renderer->onUpdateShader(context);
+					object3DRenderContext.statistics.shaderChanges++;
 					// update lights
 					for (auto j = 0; j < engine->lights.size(); j++) engine->lights[j].update(context);
 					materialUpdateOnly = false;
 				}
 				// set up material on first object
-				string materialKey;
+				uint64_t materialKey;
 				if (materialUpdateOnly == false || checkMaterialChangable(_object3DGroup, faceEntityIdx, renderTypes) == true) {
 					setupMaterial(context, _object3DGroup, faceEntityIdx, renderTypes, materialUpdateOnly, materialKey);
 					// only update materials for next calls
@@ -490,18 +671,25 @@ void Object3DRenderer::renderObjectsOfSameTypeNonInstanced(const vector<Object3D
 				auto currentVBOIds = _object3DGroup->renderer->vboBaseIds;
 				if (boundVBOBaseIds != currentVBOIds) {
 					boundVBOBaseIds = currentVBOIds;
-					//	texture coordinates
-					if (isTextureCoordinatesAvailable == true &&
-						(((renderTypes & RENDERTYPE_TEXTUREARRAYS) == RENDERTYPE_TEXTUREARRAYS) ||
-						((renderTypes & RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY) == RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY && specularMaterialProperties != nullptr && specularMaterialProperties->hasDiffuseTextureMaskedTransparency() == true))) {
-						renderer->bindTextureCoordinatesBufferObject(context, (*currentVBOIds)[3]);
+					if (_object3DGroup->renderer->packedVertices == true) {
+						// 	indices
+						renderer->bindIndicesBufferObject(context, (*currentVBOIds)[0]);
+						//	packed vertices, normals, texture coordinates, tangents and bitangent signs
+						renderer->bindPackedVerticesBufferObject(context, (*currentVBOIds)[1]);
+					} else {
+						//	texture coordinates
+						if (isTextureCoordinatesAvailable == true &&
+							(((renderTypes & RENDERTYPE_TEXTUREARRAYS) == RENDERTYPE_TEXTUREARRAYS) ||
+							((renderTypes & RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY) == RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY && specularMaterialProperties != nullptr && specularMaterialProperties->hasDiffuseTextureMaskedTransparency() == true))) {
+							renderer->bindTextureCoordinatesBufferObject(context, (*currentVBOIds)[3]);
+						}
+						// 	indices
+						renderer->bindIndicesBufferObject(context, (*currentVBOIds)[0]);
+						// 	vertices
+						renderer->bindVerticesBufferObject(context, (*currentVBOIds)[1]);
+						// 	normals
+						if ((renderTypes & RENDERTYPE_NORMALS) == RENDERTYPE_NORMALS) renderer->bindNormalsBufferObject(context, (*currentVBOIds)[2]);
 					}
-					// 	indices
-					renderer->bindIndicesBufferObject(context, (*currentVBOIds)[0]);
-					// 	vertices
-					renderer->bindVerticesBufferObject(context, (*currentVBOIds)[1]);
-					// 	normals
-					if ((renderTypes & RENDERTYPE_NORMALS) == RENDERTYPE_NORMALS) renderer->bindNormalsBufferObject(context, (*currentVBOIds)[2]);
 				}
 				// bind tangent, bitangend buffers if not yet bound
 				auto currentVBONormalMappingIds = _object3DGroup->renderer->vboNormalMappingIds;
@@ -555,6 +743,8 @@ void Object3DRenderer::renderObjectsOfSameTypeNonInstanced(const vector<Object3D
 				}
 				// draw
 				renderer->drawIndexedTrianglesFromBufferObjects(context, facesToRender, faceIdx);
+				object3DRenderContext.statistics.drawCalls++;
+				object3DRenderContext.statistics.instances++;
 				// do transformations end to shadow mapping
 				if ((renderTypes & RENDERTYPE_SHADOWMAPPING) == RENDERTYPE_SHADOWMAPPING &&
 					shadowMapping != nullptr) {
@@ -582,6 +772,9 @@ void Object3DRenderer::renderObjectsOfSameTypeInstanced(int threadIdx, const vec
 	auto& object3DRenderContext = contexts[threadIdx];
 	auto context = renderer->getContext(threadIdx);
 
+	// update persistent instance data if instance data is fetched by instance indices from texture buffers
+	auto instanceDataBuffer = renderer->isTextureBufferObjectsAvailable() == true?updateInstanceData(context, object3DRenderContext, objects):nullptr;
+
 	//
 	Vector3 objectCamFromAxis;
 	Matrix4x4 cameraMatrix(renderer->getCameraMatrix());
@@ -628,15 +821,7 @@ void Object3DRenderer::renderObjectsOfSameTypeInstanced(int threadIdx, const vec
 						Object3DGroup::setupTextures(renderer, context, object3DGroup, faceEntityIdx);
 						// set up transparent render faces
 						if (collectTransparentFaces == true) {
-							transparentRenderFacesPool->createTransparentRenderFaces(
-								(_object3DGroup->mesh->skinning == true?
-									modelViewMatrixTemp.identity() :
-									modelViewMatrixTemp.set(*_object3DGroup->groupTransformationsMatrix).multiply(object->getTransformationsMatrix())
-								).multiply(cameraMatrix),
-								object->object3dGroups[object3DGroupIdx],
-								faceEntityIdx,
-								faceIdx
-							);
+							createTransparentRenderFaces(transparentRenderFacesPool, cameraMatrix, object, _object3DGroup, faceEntityIdx, faceIdx);
 						}
 					}
 					// keep track of rendered faces
@@ -668,16 +853,18 @@ void Object3DRenderer::renderObjectsOfSameTypeInstanced(int threadIdx, const vec
 				Matrix4x4 modelViewMatrixTemp;
 				Matrix4x4 modelViewMatrix;
 
+				IntBuffer ibInstanceIndices = object3DRenderContext.bbInstanceIndices->asIntBuffer();
 				FloatBuffer fbEffectColorMuls = object3DRenderContext.bbEffectColorMuls->asFloatBuffer();
 				FloatBuffer fbEffectColorAdds = object3DRenderContext.bbEffectColorAdds->asFloatBuffer();
 				FloatBuffer fbMvMatrices = object3DRenderContext.bbMvMatrices->asFloatBuffer();
 
-				string materialKey;
+				uint64_t materialKey = MATERIALKEY_NONE;
 				bool materialUpdateOnly = false;
 				vector<int32_t>* boundVBOBaseIds = nullptr;
 				vector<int32_t>* boundVBOTangentBitangentIds = nullptr;
 				vector<int32_t>* boundVBOOrigins = nullptr;
 				auto objectCount = object3DRenderContext.objectsToRender.size();
+				auto objectsToRenderIssue = 0;
 
 				//
 				auto textureMatrix = object3DRenderContext.objectsToRender[0]->object3dGroups[object3DGroupIdx]->textureMatricesByEntities[faceEntityIdx];
@@ -693,22 +880,14 @@ void Object3DRenderer::renderObjectsOfSameTypeInstanced(int threadIdx, const vec
 						object->effectColorAdd.getAlpha() < -Math::EPSILON) {
 						// add to transparent render faces, if requested
 						if (collectTransparentFaces == true) {
-							transparentRenderFacesPool->createTransparentRenderFaces(
-								(_object3DGroup->mesh->skinning == true ?
-									modelViewMatrixTemp.identity() :
-									modelViewMatrixTemp.set(*_object3DGroup->groupTransformationsMatrix).multiply(object->getTransformationsMatrix())
-								).multiply(cameraMatrix),
-								_object3DGroup,
-								faceEntityIdx,
-								faceIdx
-							);
+							createTransparentRenderFaces(transparentRenderFacesPool, cameraMatrix, object, _object3DGroup, faceEntityIdx, faceIdx);
 						}
 						// skip to next object
 						continue;
 					}
 
 					// limit objects to render to INSTANCEDRENDERING_OBJECTS_MAX
-					if (fbMvMatrices.getPosition() / 16 == INSTANCEDRENDERING_OBJECTS_MAX) {
+					if (objectsToRenderIssue == INSTANCEDRENDERING_OBJECTS_MAX) {
 						object3DRenderContext.objectsNotRendered.push_back(object);
 						continue;
 					}
@@ -721,7 +900,7 @@ void Object3DRenderer::renderObjectsOfSameTypeInstanced(int threadIdx, const vec
 
 					// check if shader did change
 					// shader
-					auto objectShader = object->getDistanceShader().length() == 0?
+					auto& objectShader = object->getDistanceShader().length() == 0?
 						object->getShader():
 						objectCamFromAxis.set(object->getBoundingBoxTransformed()->getCenter()).sub(camera->getLookFrom()).computeLengthSquared() < Math::square(object->getDistanceShaderDistance())?
 							object->getShader():
@@ -730,6 +909,7 @@ void Object3DRenderer::renderObjectsOfSameTypeInstanced(int threadIdx, const vec
 						if (objectShader != renderer->getShader(context)) {
 							renderer->setShader(context, objectShader);
 							renderer->onUpdateShader(context);
+							object3DRenderContext.statistics.shaderChanges++;
 							for (auto j = 0; j < engine->lights.size(); j++) engine->lights[j].update(context);
 							// issue upload matrices
 							renderer->onUpdateCameraMatrix(context);
@@ -764,19 +944,26 @@ void Object3DRenderer::renderObjectsOfSameTypeInstanced(int threadIdx, const vec
 					auto currentVBOBaseIds = _object3DGroup->renderer->vboBaseIds;
 					if (boundVBOBaseIds == nullptr) {
 						boundVBOBaseIds = currentVBOBaseIds;
-						//	texture coordinates
-						if (isTextureCoordinatesAvailable == true &&
-							(((renderTypes & RENDERTYPE_TEXTUREARRAYS) == RENDERTYPE_TEXTUREARRAYS) ||
-							((renderTypes & RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY) == RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY && specularMaterialProperties != nullptr && specularMaterialProperties->hasDiffuseTextureMaskedTransparency() == true))) {
-							renderer->bindTextureCoordinatesBufferObject(context, (*currentVBOBaseIds)[3]);
-						}
-						// 	indices
-						renderer->bindIndicesBufferObject(context, (*currentVBOBaseIds)[0]);
-						// 	vertices
-						renderer->bindVerticesBufferObject(context, (*currentVBOBaseIds)[1]);
-						// 	normals
-						if ((renderTypes & RENDERTYPE_NORMALS) == RENDERTYPE_NORMALS) {
-							renderer->bindNormalsBufferObject(context, (*currentVBOBaseIds)[2]);
+						if (_object3DGroup->renderer->packedVertices == true) {
+							// 	indices
+							renderer->bindIndicesBufferObject(context, (*currentVBOBaseIds)[0]);
+							//	packed vertices, normals, texture coordinates, tangents and bitangent signs
+							renderer->bindPackedVerticesBufferObject(context, (*currentVBOBaseIds)[1]);
+						} else {
+							//	texture coordinates
+							if (isTextureCoordinatesAvailable == true &&
+								(((renderTypes & RENDERTYPE_TEXTUREARRAYS) == RENDERTYPE_TEXTUREARRAYS) ||
+								((renderTypes & RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY) == RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY && specularMaterialProperties != nullptr && specularMaterialProperties->hasDiffuseTextureMaskedTransparency() == true))) {
+								renderer->bindTextureCoordinatesBufferObject(context, (*currentVBOBaseIds)[3]);
+							}
+							// 	indices
+							renderer->bindIndicesBufferObject(context, (*currentVBOBaseIds)[0]);
+							// 	vertices
+							renderer->bindVerticesBufferObject(context, (*currentVBOBaseIds)[1]);
+							// 	normals
+							if ((renderTypes & RENDERTYPE_NORMALS) == RENDERTYPE_NORMALS) {
+								renderer->bindNormalsBufferObject(context, (*currentVBOBaseIds)[2]);
+							}
 						}
 					} else
 					// check if buffers did change, then skip and render in next step
@@ -842,32 +1029,46 @@ void Object3DRenderer::renderObjectsOfSameTypeInstanced(int threadIdx, const vec
 						}
 					}
 
-					// set up effect color
-					if ((renderTypes & RENDERTYPE_EFFECTCOLORS) == RENDERTYPE_EFFECTCOLORS) {
-						fbEffectColorMuls.put(object->effectColorMul.getArray());
-						fbEffectColorAdds.put(object->effectColorAdd.getArray());
-					}
+					if (instanceDataBuffer != nullptr) {
+						// push instance data index of object 3d group
+						ibInstanceIndices.put(instanceDataBuffer->slots.find(object)->second.idx * instanceDataBuffer->groupCount + object3DGroupIdx);
+					} else {
+						// set up effect color
+						if ((renderTypes & RENDERTYPE_EFFECTCOLORS) == RENDERTYPE_EFFECTCOLORS) {
+							fbEffectColorMuls.put(object->effectColorMul.getArray());
+							fbEffectColorAdds.put(object->effectColorAdd.getArray());
+						}
 
-					// push mv, mvp to layouts
-					fbMvMatrices.put(modelViewMatrix.getArray());
+						// push mv, mvp to layouts
+						fbMvMatrices.put(modelViewMatrix.getArray());
+					}
+					objectsToRenderIssue++;
 				}
 
 				// it can happen that all faces to be rendered were transparent ones, check this and skip if feasible
-				auto objectsToRenderIssue = fbMvMatrices.getPosition() / 16;
 				if (objectsToRenderIssue > 0) {
-					// upload model view matrices
-					{
+					if (instanceDataBuffer != nullptr) {
+						// upload instance data indices
+						renderer->uploadBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[3], ibInstanceIndices.getPosition() * sizeof(int32_t), &ibInstanceIndices);
+						object3DRenderContext.statistics.instanceIndicesUploadedBytes+= ibInstanceIndices.getPosition() * sizeof(int32_t);
+
+						// bind instance data and instance data indices
+						renderer->bindTextureBufferObject(context, TEXTUREUNIT_INSTANCEDATA, instanceDataBuffer->vboId, false, 4);
+						renderer->bindTextureBufferObject(context, TEXTUREUNIT_INSTANCEINDICES, (*object3DRenderContext.vboInstancedRenderingIds)[3], true, 1);
+					} else {
+						// upload model view matrices
 						renderer->uploadBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[0], fbMvMatrices.getPosition() * sizeof(float), &fbMvMatrices);
 						renderer->bindModelMatricesBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[0]);
-					}
-
-					// upload effects
-					if ((renderTypes & RENDERTYPE_EFFECTCOLORS) == RENDERTYPE_EFFECTCOLORS) {
-						// upload effect color mul
-						renderer->uploadBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[1], fbEffectColorMuls.getPosition() * sizeof(float), &fbEffectColorMuls);
-						renderer->bindEffectColorMulsBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[1]);
-						renderer->uploadBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[2], fbEffectColorAdds.getPosition() * sizeof(float), &fbEffectColorAdds);
-						renderer->bindEffectColorAddsBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[2]);
+						object3DRenderContext.statistics.instanceDataUploadedBytes+= fbMvMatrices.getPosition() * sizeof(float);
+
+						// upload effects
+						if ((renderTypes & RENDERTYPE_EFFECTCOLORS) == RENDERTYPE_EFFECTCOLORS) {
+							renderer->uploadBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[1], fbEffectColorMuls.getPosition() * sizeof(float), &fbEffectColorMuls);
+							renderer->bindEffectColorMulsBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[1]);
+							renderer->uploadBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[2], fbEffectColorAdds.getPosition() * sizeof(float), &fbEffectColorAdds);
+							renderer->bindEffectColorAddsBufferObject(context, (*object3DRenderContext.vboInstancedRenderingIds)[2]);
+							object3DRenderContext.statistics.instanceDataUploadedBytes+= (fbEffectColorMuls.getPosition() + fbEffectColorAdds.getPosition()) * sizeof(float);
+						}
 					}
 
 					// set up texture matrix
@@ -880,6 +1081,8 @@ void Object3DRenderer::renderObjectsOfSameTypeInstanced(int threadIdx, const vec
 
 					// draw
 					renderer->drawInstancedIndexedTrianglesFromBufferObjects(context, facesToRender, faceIdx, objectsToRenderIssue);
+					object3DRenderContext.statistics.drawCalls++;
+					object3DRenderContext.statistics.instances+= objectsToRenderIssue;
 				}
 
 				// clear list of objects we did not render
@@ -906,8 +1109,9 @@ void Object3DRenderer::renderObjectsOfSameTypeInstanced(int threadIdx, const vec
 	object3DRenderContext.objectsNotRendered.clear();
 }
 
-void Object3DRenderer::setupMaterial(void* context, Object3DGroup* object3DGroup, int32_t facesEntityIdx, int32_t renderTypes, bool updateOnly, string& materialKey, const string& currentMaterialKey)
+void Object3DRenderer::setupMaterial(void* context, Object3DGroup* object3DGroup, int32_t facesEntityIdx, int32_t renderTypes, bool updateOnly, uint64_t& materialKey, uint64_t currentMaterialKey)
 {
+	auto& object3DRenderContext = contexts[renderer->getContextIndex(context)];
 	auto& facesEntities = object3DGroup->group->getFacesEntities();
 	auto material = facesEntities[facesEntityIdx].getMaterial();
 	// get material or use default
@@ -915,13 +1119,14 @@ void Object3DRenderer::setupMaterial(void* context, Object3DGroup* object3DGroup
 	auto specularMaterialProperties = material->getSpecularMaterialProperties();
 
 	// material key
-	materialKey = material->getId();
+	materialKey = static_cast<uint64_t>(material->getUniqueIdx()) << 32;
 
 	// setup textures
 	Object3DGroup::setupTextures(renderer, context, object3DGroup, facesEntityIdx);
 
 	//
 	if (updateOnly == false) {
+		object3DRenderContext.statistics.materialChanges++;
 		if (renderer->getLighting(context) == renderer->LIGHTING_SPECULAR) {
 			// apply materials
 			if ((renderTypes & RENDERTYPE_MATERIALS) == RENDERTYPE_MATERIALS) {
@@ -982,11 +1187,11 @@ void Object3DRenderer::setupMaterial(void* context, Object3DGroup* object3DGroup
 					object3DGroup->specularMaterialDynamicDiffuseTextureIdsByEntities[facesEntityIdx] != Object3DGroup::TEXTUREID_NONE ?
 					object3DGroup->specularMaterialDynamicDiffuseTextureIdsByEntities[facesEntityIdx] :
 					object3DGroup->specularMaterialDiffuseTextureIdsByEntities[facesEntityIdx];
-				materialKey+= ",";
-				materialKey.append((const char*)&diffuseTextureId, sizeof(diffuseTextureId));
-				if (updateOnly == false || currentMaterialKey.empty() == true) {
+				materialKey|= static_cast<uint32_t>(diffuseTextureId);
+				if (updateOnly == false || currentMaterialKey == MATERIALKEY_NONE) {
 					renderer->setTextureUnit(context, LightingShaderConstants::SPECULAR_TEXTUREUNIT_DIFFUSE);
 					renderer->bindTexture(context, diffuseTextureId);
+					object3DRenderContext.statistics.textureChanges++;
 				}
 			}
 		} else
@@ -1076,6 +1281,7 @@ void Object3DRenderer::render(const vector<Entity*>& pses)
 	for (auto entityOuter: sortedVisiblePses) {
 		auto particleSystemsCount = 0;
 		if (rendererPses.find(entityOuter) != rendererPses.end()) continue;
+		auto pointsBegin = renderTransparentRenderPointsPool->getTransparentRenderPointsCount();
 		{
 			auto ppse = dynamic_cast<PointsParticleSystem*>(entityOuter);
 			if (ppse != nullptr) {
@@ -1139,39 +1345,39 @@ void Object3DRenderer::render(const vector<Entity*>& pses)
 				}
 			}
 		}
-		if (renderTransparentRenderPointsPool->getTransparentRenderPointsCount() > 0) {
-			renderTransparentRenderPointsPool->sort();
-			// render
-			auto firstPoint = renderTransparentRenderPointsPool->getTransparentRenderPoints()[0];
-			PseParameters* pseParameters = &rendererPseParameters.find(firstPoint->particleSystem)->second;
-			auto currentPpse = static_cast<void*>(firstPoint->particleSystem);
-			for (auto point: renderTransparentRenderPointsPool->getTransparentRenderPoints()) {
-				if (point == nullptr || point->acquired == false || point->particleSystem != (void*)currentPpse) {
-					// issue rendering
-					renderer->getEffectColorAdd(context) = pseParameters->effectColorAdd->getArray();
-					renderer->getEffectColorMul(context) = pseParameters->effectColorMul->getArray();
-					renderer->onUpdateEffect(context);
-					// TODO: maybe use onBindTexture() or onUpdatePointSize()
-					engine->getParticlesShader()->setParameters(context, pseParameters->textureId, pseParameters->textureHorizontalSprites, pseParameters->textureVerticalSprites, pseParameters->pointSize);
-					// render, clear
-					psePointBatchRenderer->render(context);
-					psePointBatchRenderer->clear();
-					//
-					if (point != nullptr && point->acquired == true) {
-						pseParameters = &rendererPseParameters.find(point->particleSystem)->second;
-						currentPpse = point->particleSystem;
-						psePointBatchRenderer->addPoint(point);
-					} else {
-						break;
-					}
-				} else {
-					psePointBatchRenderer->addPoint(point);
-				}
+		// sort points of combined particle systems
+		renderTransparentRenderPointsPool->sort(pointsBegin, renderTransparentRenderPointsPool->getTransparentRenderPointsCount());
+	}
+
+	// write points of all particle systems into the point buffer, then render ranges of points that share a particle system
+	//	if the point buffer is full, its points get uploaded and rendered and the point buffer is reused for the remaining points
+	auto pointsCount = renderTransparentRenderPointsPool->getTransparentRenderPointsCount();
+	if (pointsCount > 0) {
+		auto& points = renderTransparentRenderPointsPool->getTransparentRenderPoints();
+		auto batchBegin = 0;
+		for (auto i = 0; i < pointsCount; i++) {
+			psePointBatchRenderer->addPoint(points[i]);
+			if (i < pointsCount - 1 && psePointBatchRenderer->getPointCount() < BatchRendererPoints::POINT_COUNT) continue;
+			psePointBatchRenderer->upload(context);
+			auto batchPointsCount = i + 1 - batchBegin;
+			auto pointsBegin = 0;
+			for (auto j = 1; j <= batchPointsCount; j++) {
+				if (j < batchPointsCount && points[batchBegin + j]->particleSystem == points[batchBegin + pointsBegin]->particleSystem) continue;
+				auto pseParameters = &rendererPseParameters.find(points[batchBegin + pointsBegin]->particleSystem)->second;
+				renderer->getEffectColorAdd(context) = pseParameters->effectColorAdd->getArray();
+				renderer->getEffectColorMul(context) = pseParameters->effectColorMul->getArray();
+				renderer->onUpdateEffect(context);
+				// TODO: maybe use onBindTexture() or onUpdatePointSize()
+				engine->getParticlesShader()->setParameters(context, pseParameters->textureId, pseParameters->textureHorizontalSprites, pseParameters->textureVerticalSprites, pseParameters->pointSize);
+				// render
+				psePointBatchRenderer->render(context, j - pointsBegin, pointsBegin);
+				pointsBegin = j;
 			}
-			// done
-			renderTransparentRenderPointsPool->reset();
-			rendererPseParameters.clear();
+			psePointBatchRenderer->clear();
+			batchBegin = i + 1;
 		}
+		// done
+		renderTransparentRenderPointsPool->reset();
 	}
 
 	// unbind texture
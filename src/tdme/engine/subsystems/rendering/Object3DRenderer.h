@@ -17,6 +17,7 @@
 #include <tdme/engine/subsystems/renderer/Renderer.h>
 #include <tdme/engine/subsystems/rendering/fwd-tdme.h>
 #include <tdme/engine/subsystems/rendering/Object3DGroup.h>
+#include <tdme/engine/subsystems/rendering/RenderingStatistics.h>
 #include <tdme/engine/subsystems/rendering/TransparentRenderFacesPool.h>
 #include <tdme/math/fwd-tdme.h>
 #include <tdme/math/Matrix2D3x3.h>
@@ -24,7 +25,9 @@
 #include <tdme/math/Matrix4x4Negative.h>
 #include <tdme/utils/fwd-tdme.h>
 #include <tdme/utils/ByteBuffer.h>
+#include <tdme/utils/FloatBuffer.h>
 #include <tdme/utils/Pool.h>
+#include <tdme/utils/RadixSort.h>
 
 using std::unordered_map;
 using std::string;
@@ -42,6 +45,7 @@ using tdme::engine::model::Model;
 using tdme::engine::subsystems::rendering::BatchRendererPoints;
 using tdme::engine::subsystems::rendering::BatchRendererTriangles;
 using tdme::engine::subsystems::rendering::Object3DGroup;
+using tdme::engine::subsystems::rendering::RenderingStatistics;
 using tdme::engine::subsystems::rendering::TransparentRenderFacesPool;
 using tdme::engine::subsystems::rendering::TransparentRenderPointsPool;
 using tdme::engine::subsystems::renderer::Renderer;
@@ -50,7 +54,9 @@ using tdme::math::Matrix4x4;
 using tdme::math::Matrix4x4Negative;
 using tdme::math::Vector3;
 using tdme::utils::ByteBuffer;
+using tdme::utils::FloatBuffer;
 using tdme::utils::Pool;
+using tdme::utils::RadixSort;
 
 /** 
  * Rendering class
@@ -65,24 +71,73 @@ class tdme::engine::subsystems::rendering::Object3DRenderer final {
 private:
 	static constexpr int32_t BATCHRENDERER_MAX { 256 };
 	static constexpr int32_t INSTANCEDRENDERING_OBJECTS_MAX { 16384 };
+	static constexpr int32_t INSTANCEDATA_TEXELS { 6 };
+	static constexpr int32_t INSTANCEDATA_SLOTS_MIN { 64 };
+	static constexpr int64_t INSTANCEDATA_UNUSED_FRAMES_MAX { 300LL };
+	static constexpr int32_t RENDERQUEUEKEY_DEPTH_BITS { 12 };
+	static constexpr int32_t RENDERQUEUEKEY_INSTANCES_BITS { 16 };
+	static constexpr int32_t RENDERQUEUEKEY_MODEL_BITS { 24 };
+	static constexpr int32_t RENDERQUEUEKEY_SHADER_BITS { 12 };
+	static constexpr uint64_t MATERIALKEY_NONE { 0xFFFFFFFFFFFFFFFFULL };
+
+	/**
+	 * Render queue entry
+	 * 	key bits from most to least significant: shader index, model unique index, instances, depth
+	 */
+	struct RenderQueueEntry {
+		uint64_t key;
+		Object3D* object;
+	};
+
+	/**
+	 * Instance data slot of a object in a instance data buffer
+	 */
+	struct InstanceDataSlot {
+		int32_t idx;
+		uint64_t version;
+		int64_t frame;
+	};
+
+	/**
+	 * Persistent instance data buffer of a model, which keeps model matrix, effect color mul and effect color add of each object 3d group of its objects in slots
+	 * 	Slots are only written and uploaded if the instance data version of a object changed, instances are drawn by a small per draw call buffer of instance data indices
+	 */
+	struct InstanceDataBuffer {
+		int32_t vboId;
+		int32_t groupCount;
+		int32_t slotCapacity { 0 };
+		bool reallocate { true };
+		vector<uint8_t> data;
+		unordered_map<Object3D*, InstanceDataSlot> slots;
+		vector<int32_t> freeSlots;
+		vector<int32_t> changedSlots;
+		int64_t frame { -1LL };
+	};
 
 	struct Object3DRenderContext {
 		vector<int32_t>* vboInstancedRenderingIds { nullptr };
+		unordered_map<Model*, InstanceDataBuffer*> instanceDataBuffersByModel;
+		ByteBuffer* bbInstanceIndices { nullptr };
 		ByteBuffer* bbEffectColorMuls { nullptr };
 		ByteBuffer* bbEffectColorAdds { nullptr };
 		ByteBuffer* bbMvMatrices { nullptr };
 		Matrix4x4Negative matrix4x4Negative;
 		vector<Object3D*> objectsToRender;
 		vector<Object3D*> objectsNotRendered;
+		vector<Object3D*> objectsByModel;
 		vector<Object3D*> objectsByModelToRender;
 		vector<Object3D*> objectsByModelNotRendered;
+		vector<RenderQueueEntry> renderQueue;
+		vector<RenderQueueEntry> renderQueueSortBuffer;
+		RenderingStatistics statistics;
 	};
 
+	static unordered_map<string, int32_t> shaderIdxByShaderIds;
+
 	Engine* engine { nullptr };
 	Renderer* renderer { nullptr };
 
 	vector<BatchRendererTriangles*> trianglesBatchRenderers;
-	unordered_map<string, unordered_map<string, vector<Object3D*>>> objectsByShadersAndModels;
 	vector<TransparentRenderFace*> groupTransparentRenderFaces;
 	Object3DRenderer_TransparentRenderFacesGroupPool* transparentRenderFacesGroupPool { nullptr };
 	TransparentRenderFacesPool* transparentRenderFacesPool { nullptr };
@@ -91,6 +146,19 @@ private:
 	BatchRendererPoints* psePointBatchRenderer { nullptr };
 	int threadCount;
 	vector<Object3DRenderContext> contexts;
+	int64_t frame { 0LL };
+	bool transparentFacesObjectSorting { false };
+
+	/**
+	 * Create transparent render faces of given object 3d group faces entity, either per face or as cluster by object distance
+	 * @param transparentRenderFacesPool transparent render faces pool
+	 * @param cameraMatrix camera matrix
+	 * @param object object
+	 * @param object3DGroup object 3d group
+	 * @param facesEntityIdx faces entity index
+	 * @param faceIdx face index
+	 */
+	void createTransparentRenderFaces(TransparentRenderFacesPool* transparentRenderFacesPool, const Matrix4x4& cameraMatrix, Object3D* object, Object3DGroup* object3DGroup, int32_t facesEntityIdx, int32_t faceIdx);
 
 	/** 
 	 * Renders transparent faces
@@ -144,6 +212,22 @@ private:
 	 */
 	void renderObjectsOfSameTypeInstanced(int threadIdx, const vector<Object3D*>& objects, bool collectTransparentFaces, int32_t renderTypes, TransparentRenderFacesPool* transparentRenderFacesPool);
 
+	/**
+	 * Update instance data slots of given objects in persistent instance data buffer of their model and upload changed slots
+	 * 	Consecutive changed slots are uploaded as one range, the instance data buffer is uploaded completely if it had to grow
+	 * @param context context
+	 * @param object3DRenderContext object 3d render context
+	 * @param objects objects of same type/ with same models
+	 * @return instance data buffer
+	 */
+	InstanceDataBuffer* updateInstanceData(void* context, Object3DRenderContext& object3DRenderContext, const vector<Object3D*>& objects);
+
+	/**
+	 * Dispose given instance data buffer
+	 * @param instanceDataBuffer instance data buffer
+	 */
+	void disposeInstanceDataBuffer(InstanceDataBuffer* instanceDataBuffer);
+
 	/**
 	 * Checks if a material could change when having multiple objects but same model
 	 * @param object3DGroup object 3d group
@@ -162,9 +246,9 @@ private:
 	 * @param renderTypes render types
 	 * @param updateOnly update only, means material has been set up already, only do changes
 	 * @param materialKey material key
-	 * @param currentMaterialKey current material key or empty
+	 * @param currentMaterialKey current material key or MATERIALKEY_NONE
 	 */
-	void setupMaterial(void* context, Object3DGroup* object3DGroup, int32_t facesEntityIdx, int32_t renderTypes, bool updateOnly, string& materialKey, const string& currentMaterialKey = string());
+	void setupMaterial(void* context, Object3DGroup* object3DGroup, int32_t facesEntityIdx, int32_t renderTypes, bool updateOnly, uint64_t& materialKey, uint64_t currentMaterialKey = MATERIALKEY_NONE);
 
 	/** 
 	 * Clear material for rendering
@@ -172,69 +256,91 @@ private:
 	 */
 	void clearMaterial(void* context);
 
+	/**
+	 * Create render queue key
+	 * @param object object
+	 * @param objectDistanceSquared squared distance of object to camera
+	 * @return render queue key
+	 */
+	inline static uint64_t createRenderQueueKey(Object3D* object, float objectDistanceSquared) {
+		auto shaderIdx =
+			object->distanceShaderIdx == -1 || objectDistanceSquared < Math::square(object->getDistanceShaderDistance())?
+				object->shaderIdx:
+				object->distanceShaderIdx;
+		auto instances = object->instances < (1 << RENDERQUEUEKEY_INSTANCES_BITS) - 1?object->instances:(1 << RENDERQUEUEKEY_INSTANCES_BITS) - 1;
+		uint64_t key = static_cast<uint64_t>(shaderIdx) & ((1ULL << RENDERQUEUEKEY_SHADER_BITS) - 1);
+		key = (key << RENDERQUEUEKEY_MODEL_BITS) | (static_cast<uint64_t>(object->getModel()->getUniqueIdx()) & ((1ULL << RENDERQUEUEKEY_MODEL_BITS) - 1));
+		key = (key << RENDERQUEUEKEY_INSTANCES_BITS) | static_cast<uint64_t>(instances);
+		// near objects first
+		key = (key << RENDERQUEUEKEY_DEPTH_BITS) | (RadixSort::getFloatKey(objectDistanceSquared) >> (32 - RENDERQUEUEKEY_DEPTH_BITS));
+		return key;
+	}
+
 	/**
 	 * Render function
 	 * @param threadCount thread count
 	 * @param threadIdx thread index
 	 * @param objects objects
-	 * @param visibleObjectsByModels objects by models storage
 	 * @param renderTransparentFaces render transparent faces
 	 * @param renderTypes render types
+	 * @param transparentRenderFacesPool transparent render faces pool
 	 */
 	inline void renderFunction(
 		int threadCount,
 		int threadIdx,
 		const vector<Object3D*>& objects,
-		unordered_map<string, unordered_map<string, vector<Object3D*>>>& objectsByShadersAndModels,
 		bool renderTransparentFaces,
 		int renderTypes,
 		TransparentRenderFacesPool* transparentRenderFacesPool) {
 		// reset shader
 		renderer->setShader(renderer->getContext(threadIdx), string());
 
-		// sort objects by model
+		// create render queue
+		auto& context = contexts[threadIdx];
+		auto& renderQueue = context.renderQueue;
 		Vector3 objectCamFromAxis;
 		auto camera = engine->getCamera();
 		for (auto objectIdx = 0; objectIdx < objects.size(); objectIdx++) {
 			if (threadCount > 1 && objectIdx % threadCount != threadIdx) continue;
 			auto object = objects[objectIdx];
-			auto objectShader = object->getDistanceShader().length() == 0?
-				object->getShader():
-				objectCamFromAxis.set(object->getBoundingBoxTransformed()->getCenter()).sub(camera->getLookFrom()).computeLengthSquared() < Math::square(object->getDistanceShaderDistance())?
-					object->getShader():
-					object->getDistanceShader();
-			auto& objectsByShaders = objectsByShadersAndModels[objectShader];
-			auto& objectsByModel = objectsByShaders[object->getModel()->getId()];
-			objectsByModel.push_back(object);
+			auto objectDistanceSquared = objectCamFromAxis.set(object->getBoundingBoxTransformed()->getCenter()).sub(camera->getLookFrom()).computeLengthSquared();
+			renderQueue.push_back({ createRenderQueueKey(object, objectDistanceSquared), object });
 		}
-
-		// render objects
-		auto& context = contexts[threadIdx];
-		for (auto& objectsByShaderAndModelIt: objectsByShadersAndModels) {
-			auto& objectsByModels = objectsByShaderAndModelIt.second;
-			for (auto& objectsByModelIt: objectsByModels) {
-				auto& objectsByModel = objectsByModelIt.second;
-				if (objectsByModel.size() == 0) {
-					continue;
-				} else
-				if (objectsByModel.size() > 0) {
-					do {
-						for (auto object: objectsByModel) {
-							if (context.objectsByModelToRender.size() == 0 || object->instances == context.objectsByModelToRender[0]->instances) {
-								context.objectsByModelToRender.push_back(object);
-							} else {
-								context.objectsByModelNotRendered.push_back(object);
-							}
-						}
-						renderObjectsOfSameType(threadIdx, context.objectsByModelToRender, renderTransparentFaces, renderTypes, transparentRenderFacesPool);
-						objectsByModel = context.objectsByModelNotRendered;
-						context.objectsByModelToRender.clear();
-						context.objectsByModelNotRendered.clear();
-					} while (objectsByModel.size() > 0);
-				}
-				objectsByModel.clear();
+		context.statistics.renderQueueEntries+= renderQueue.size();
+
+		// sort render queue by shader, model, instances and depth
+		RadixSort::sort(renderQueue, context.renderQueueSortBuffer);
+
+		// render objects, a batch is a run of entries with equal keys ignoring depth
+		auto& objectsByModel = context.objectsByModel;
+		auto renderQueueEntryIdx = 0;
+		while (renderQueueEntryIdx < renderQueue.size()) {
+			auto batchKey = renderQueue[renderQueueEntryIdx].key >> RENDERQUEUEKEY_DEPTH_BITS;
+			auto batchModel = renderQueue[renderQueueEntryIdx].object->getModel();
+			// model unique indices are truncated in keys, so also compare models
+			while (renderQueueEntryIdx < renderQueue.size() &&
+				renderQueue[renderQueueEntryIdx].key >> RENDERQUEUEKEY_DEPTH_BITS == batchKey &&
+				renderQueue[renderQueueEntryIdx].object->getModel() == batchModel) {
+				objectsByModel.push_back(renderQueue[renderQueueEntryIdx].object);
+				renderQueueEntryIdx++;
 			}
+			// instances are clamped in keys, so split up by instances if required
+			do {
+				for (auto object: objectsByModel) {
+					if (context.objectsByModelToRender.size() == 0 || object->instances == context.objectsByModelToRender[0]->instances) {
+						context.objectsByModelToRender.push_back(object);
+					} else {
+						context.objectsByModelNotRendered.push_back(object);
+					}
+				}
+				context.statistics.batches++;
+				renderObjectsOfSameType(threadIdx, context.objectsByModelToRender, renderTransparentFaces, renderTypes, transparentRenderFacesPool);
+				objectsByModel = context.objectsByModelNotRendered;
+				context.objectsByModelToRender.clear();
+				context.objectsByModelNotRendered.clear();
+			} while (objectsByModel.size() > 0);
 		}
+		renderQueue.clear();
 	}
 
 public:
@@ -250,6 +356,8 @@ public:
 	static constexpr int32_t RENDERTYPE_SHADOWMAPPING { 512 };
 	static constexpr int32_t RENDERTYPE_RENDERGROUP_OBJECTORIGIN { 1024 };
 	static constexpr int32_t RENDERTYPE_ALL { 2047 };
+	static constexpr int32_t TEXTUREUNIT_INSTANCEDATA { 11 };
+	static constexpr int32_t TEXTUREUNIT_INSTANCEINDICES { 12 };
 
 	/**
 	 * Init
@@ -291,6 +399,29 @@ public:
 	 */
 	void render(const vector<LinesObject3D*>& objects);
 
+	/**
+	 * Get shader index for given shader id, shader indices are used in render queue keys
+	 * @param shaderId shader id
+	 * @return shader index
+	 */
+	static int32_t getShaderIdx(const string& shaderId);
+
+	/**
+	 * Reset rendering statistics
+	 */
+	void resetStatistics();
+
+	/**
+	 * Prepare persistent instance data buffers for a new frame, instance data slots and buffers that have not been used for a while get released
+	 */
+	void prepareInstanceDataBuffers();
+
+	/**
+	 * Get rendering statistics, which sums up statistics of all render contexts
+	 * @param statistics statistics
+	 */
+	void getStatistics(RenderingStatistics& statistics);
+
 	/**
 	 * Public constructor
 	 * @param engine engine
@@ -11,6 +11,7 @@
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/math/Vector3.h>
 #include <tdme/utils/Console.h>
+#include <tdme/utils/RadixSort.h>
 
 using std::vector;
 using std::string;
@@ -23,10 +24,11 @@ using tdme::engine::subsystems::rendering::TransparentRenderPointsPool;
 using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
 using tdme::utils::Console;
+using tdme::utils::RadixSort;
 
-RenderTransparentRenderPointsPool::RenderTransparentRenderPointsPool(int32_t pointsMax)
+RenderTransparentRenderPointsPool::RenderTransparentRenderPointsPool(int32_t pointsCapacity)
 {
-	transparentRenderPoints.resize(pointsMax);
+	transparentRenderPoints.resize(pointsCapacity);
 	reset();
 }
 
@@ -38,15 +40,15 @@ void RenderTransparentRenderPointsPool::merge(TransparentRenderPointsPool* pool2
 	for (auto point: pool2->transparentRenderPoints) {
 		// skip if point is not in use
 		if (point->acquired == false) break;
-		// check for pool overflow
-		if (poolIdx >= transparentRenderPoints.size()) {
-			Console::println(string("RenderTransparentRenderPointsPool::merge(): Too many transparent render points"));
-			break;
-		}
 		//
 		cameraMatrix.multiply(point->point, point->point);
-		// create point in pool
-		transparentRenderPoints[poolIdx++] = point;
+		// create point in pool, pool grows as it holds points of all visible particle systems
+		if (poolIdx == transparentRenderPoints.size()) {
+			transparentRenderPoints.push_back(point);
+			poolIdx++;
+		} else {
+			transparentRenderPoints[poolIdx++] = point;
+		}
 	}
 }
 
@@ -56,7 +58,22 @@ void RenderTransparentRenderPointsPool::reset()
 	for (auto i = 0; i < transparentRenderPoints.size(); i++) transparentRenderPoints[i] = nullptr;
 }
 
-void RenderTransparentRenderPointsPool::sort()
+void RenderTransparentRenderPointsPool::sort(int32_t begin, int32_t end)
 {
-	std::sort(transparentRenderPoints.begin(), transparentRenderPoints.begin() + poolIdx, TransparentRenderPoint::compare);
+	if (end - begin < 2) return;
+	// far points have lower camera space z and are rendered first
+	// 	dropping the lowest 8 bits of keys lets radix sort skip a pass, which is precise enough for ordering points
+	sortEntries.clear();
+	auto unsortedPoints = 0;
+	for (auto i = begin; i < end; i++) {
+		auto key = RadixSort::getFloatKey(transparentRenderPoints[i]->point.getZ()) & 0xffffff00;
+		if (sortEntries.empty() == false && key < sortEntries.back().key) unsortedPoints++;
+		sortEntries.push_back({ key, static_cast<uint32_t>(i) });
+	}
+	// skip if points are sorted already
+	if (unsortedPoints == 0) return;
+	RadixSort::sort(sortEntries, sortEntriesBuffer);
+	sortedTransparentRenderPoints.clear();
+	for (auto& sortEntry: sortEntries) sortedTransparentRenderPoints.push_back(transparentRenderPoints[sortEntry.idx]);
+	for (auto i = 0; i < sortedTransparentRenderPoints.size(); i++) transparentRenderPoints[begin + i] = sortedTransparentRenderPoints[i];
 }
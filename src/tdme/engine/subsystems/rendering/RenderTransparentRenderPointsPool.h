@@ -10,6 +10,7 @@
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/utils/fwd-tdme.h>
 #include <tdme/utils/Console.h>
+#include <tdme/utils/RadixSort.h>
 
 using std::vector;
 
@@ -18,6 +19,7 @@ using tdme::engine::subsystems::rendering::TransparentRenderPoint;
 using tdme::engine::subsystems::rendering::TransparentRenderPointsPool;
 using tdme::math::Matrix4x4;
 using tdme::utils::Console;
+using tdme::utils::RadixSort;
 
 /** 
  * Render transparent render points pool
@@ -26,9 +28,21 @@ using tdme::utils::Console;
  */
 class tdme::engine::subsystems::rendering::RenderTransparentRenderPointsPool final
 {
+public:
+	/**
+	 * Sort entry, which packs a quantized depth key and a point index
+	 */
+	struct SortEntry {
+		uint32_t key;
+		uint32_t idx;
+	};
+
 private:
 	vector<TransparentRenderPoint*> transparentRenderPoints;
 	int32_t poolIdx;
+	vector<SortEntry> sortEntries;
+	vector<SortEntry> sortEntriesBuffer;
+	vector<TransparentRenderPoint*> sortedTransparentRenderPoints;
 
 public:
 	/** 
@@ -60,13 +74,22 @@ public:
 	/** 
 	 * Sort transparent render points
 	 */
-	void sort();
+	inline void sort() {
+		sort(0, poolIdx);
+	}
+
+	/**
+	 * Sort transparent render points in given range far to near using radix sort on quantized camera space depth
+	 * @param begin begin index
+	 * @param end end index
+	 */
+	void sort(int32_t begin, int32_t end);
 
 	/**
 	 * Public constructor
-	 * @param pointsMax points max
+	 * @param pointsCapacity initial points capacity
 	 */
-	RenderTransparentRenderPointsPool(int32_t pointsMax);
+	RenderTransparentRenderPointsPool(int32_t pointsCapacity);
 
 	/**
 	 * Destructor
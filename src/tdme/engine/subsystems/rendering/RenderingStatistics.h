@@ -0,0 +1,22 @@
+#pragma once
+
+#include <tdme/tdme.h>
+#include <tdme/engine/subsystems/rendering/fwd-tdme.h>
+
+/**
+ * Rendering statistics entity
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+struct tdme::engine::subsystems::rendering::RenderingStatistics
+{
+	int64_t renderQueueEntries {  };
+	int64_t batches {  };
+	int64_t shaderChanges {  };
+	int64_t materialChanges {  };
+	int64_t textureChanges {  };
+	int64_t drawCalls {  };
+	int64_t instances {  };
+	int64_t instanceDataUploadedBytes {  };
+	int64_t instanceIndicesUploadedBytes {  };
+};
@@ -111,7 +111,7 @@ void TransparentRenderFacesGroup::render(Engine* engine, Renderer* renderer, voi
 	renderer->getEffectColorAdd(context) = effectColorAdd.getArray();
 	renderer->onUpdateEffect(context);
 	// material
-	string materialKey;
+	uint64_t materialKey;
 	object3DRenderer->setupMaterial(context, object3DGroup, facesEntityIdx, Object3DRenderer::RENDERTYPE_ALL, false, materialKey);
 	// model view matrix
 	renderer->getModelViewMatrix().identity();
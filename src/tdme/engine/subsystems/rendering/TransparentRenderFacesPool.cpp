@@ -14,6 +14,7 @@
 #include <tdme/math/Vector3.h>
 #include <tdme/utils/Pool.h>
 #include <tdme/utils/Console.h>
+#include <tdme/utils/RadixSort.h>
 
 using std::vector;
 using std::string;
@@ -30,6 +31,7 @@ using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
 using tdme::utils::Pool;
 using tdme::utils::Console;
+using tdme::utils::RadixSort;
 
 constexpr int32_t TransparentRenderFacesPool::FACES_MAX;
 
@@ -46,6 +48,7 @@ void TransparentRenderFacesPool::reset()
 {
 	transparentRenderFacesPool.reset();
 	transparentRenderFaces.clear();
+	transparentRenderFacesClusters.clear();
 }
 
 vector<TransparentRenderFace*>& TransparentRenderFacesPool::getTransparentRenderFaces()
@@ -53,3 +56,38 @@ vector<TransparentRenderFace*>& TransparentRenderFacesPool::getTransparentRender
 	return transparentRenderFaces;
 }
 
+
+vector<TransparentRenderFace*>& TransparentRenderFacesPool::getSortedTransparentRenderFaces()
+{
+	sort(transparentRenderFaces, transparentRenderFacesClusters, sortEntries, sortEntriesBuffer, sortedTransparentRenderFaces);
+	return sortedTransparentRenderFaces;
+}
+
+void TransparentRenderFacesPool::sort(
+	const vector<TransparentRenderFace*>& transparentRenderFaces,
+	const vector<int32_t>& transparentRenderFacesClusters,
+	vector<SortEntry>& sortEntries,
+	vector<SortEntry>& sortEntriesBuffer,
+	vector<TransparentRenderFace*>& sortedTransparentRenderFaces
+) {
+	sortEntries.clear();
+	sortedTransparentRenderFaces.clear();
+	// inverted float keys sort far faces first
+	if (transparentRenderFacesClusters.size() == 0) {
+		for (auto i = 0; i < transparentRenderFaces.size(); i++) {
+			sortEntries.push_back({ ~RadixSort::getFloatKey(transparentRenderFaces[i]->distanceFromCamera), static_cast<uint32_t>(i) });
+		}
+		RadixSort::sort(sortEntries, sortEntriesBuffer);
+		for (auto& sortEntry: sortEntries) sortedTransparentRenderFaces.push_back(transparentRenderFaces[sortEntry.idx]);
+	} else {
+		for (auto i = 0; i < transparentRenderFacesClusters.size(); i++) {
+			sortEntries.push_back({ ~RadixSort::getFloatKey(transparentRenderFaces[transparentRenderFacesClusters[i]]->distanceFromCamera), static_cast<uint32_t>(i) });
+		}
+		RadixSort::sort(sortEntries, sortEntriesBuffer);
+		for (auto& sortEntry: sortEntries) {
+			auto clusterStart = transparentRenderFacesClusters[sortEntry.idx];
+			auto clusterEnd = sortEntry.idx + 1 < transparentRenderFacesClusters.size()?transparentRenderFacesClusters[sortEntry.idx + 1]:transparentRenderFaces.size();
+			for (auto i = clusterStart; i < clusterEnd; i++) sortedTransparentRenderFaces.push_back(transparentRenderFaces[i]);
+		}
+	}
+}
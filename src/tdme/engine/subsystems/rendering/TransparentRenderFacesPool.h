@@ -18,6 +18,7 @@
 #include <tdme/utils/fwd-tdme.h>
 #include <tdme/utils/Console.h>
 #include <tdme/utils/Pool.h>
+#include <tdme/utils/RadixSort.h>
 
 using std::vector;
 using std::string;
@@ -34,6 +35,7 @@ using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
 using tdme::utils::Pool;
 using tdme::utils::Console;
+using tdme::utils::RadixSort;
 
 /** 
  * Transparent render faces pool
@@ -45,9 +47,22 @@ class tdme::engine::subsystems::rendering::TransparentRenderFacesPool final
 	friend class Object3DRenderer;
 	friend class tdme::engine::Engine;
 
+public:
+	/**
+	 * Sort entry, which packs a depth key and a face or cluster index
+	 */
+	struct SortEntry {
+		uint32_t key;
+		uint32_t idx;
+	};
+
 private:
 	static constexpr int32_t FACES_MAX { 16384 };
 	vector<TransparentRenderFace*> transparentRenderFaces;
+	vector<int32_t> transparentRenderFacesClusters;
+	vector<SortEntry> sortEntries;
+	vector<SortEntry> sortEntriesBuffer;
+	vector<TransparentRenderFace*> sortedTransparentRenderFaces;
 	TransparentRenderFacesPool_TransparentRenderFacesPool transparentRenderFacesPool;
 
 	/** 
@@ -93,11 +108,50 @@ private:
 		}
 	}
 
+	/**
+	 * Creates transparent render faces as a cluster, which shares the given distance from camera and is sorted as a whole
+	 * @param distanceFromCamera distance from camera
+	 * @param object3DGroup object3D group
+	 * @param facesEntityIdx faces entity index
+	 * @param faceIdx face index
+	 */
+	inline void createTransparentRenderFaces(float distanceFromCamera, Object3DGroup* object3DGroup, int32_t facesEntityIdx, int32_t faceIdx) {
+		auto& faces = object3DGroup->group->getFacesEntities()[facesEntityIdx].getFaces();
+		if (faces.size() == 0) return;
+		// check for pool overflow
+		if (transparentRenderFacesPool.size() >= FACES_MAX) {
+			Console::println(string("TransparentRenderFacesPool::createTransparentRenderFaces(): Too many transparent render faces"));
+			return;
+		}
+		// start cluster
+		transparentRenderFacesClusters.push_back(transparentRenderFaces.size());
+		// create transparent render faces
+		for (auto i = 0; i < faces.size(); i++) {
+			// check for pool overflow
+			if (transparentRenderFacesPool.size() >= FACES_MAX) {
+				Console::println(string("TransparentRenderFacesPool::createTransparentRenderFaces(): Too many transparent render faces"));
+				break;
+			}
+			// create transparent render face
+			auto transparentRenderFace = transparentRenderFacesPool.allocate();
+			transparentRenderFace->object3DGroup = object3DGroup;
+			transparentRenderFace->facesEntityIdx = facesEntityIdx;
+			transparentRenderFace->faceIdx = faceIdx;
+			transparentRenderFace->distanceFromCamera = distanceFromCamera;
+			transparentRenderFaces.push_back(transparentRenderFace);
+			faceIdx++;
+		}
+	}
+
 	/** 
 	 * Merges given transparent render faces pool into this pool
 	 * @param srcTransparentRenderFacesPool transparent render faces pool
 	 */
 	inline void merge(TransparentRenderFacesPool* srcTransparentRenderFacesPool) {
+		auto transparentRenderFacesOffset = transparentRenderFaces.size();
+		for (auto srcTransparentRenderFacesCluster: srcTransparentRenderFacesPool->transparentRenderFacesClusters) {
+			transparentRenderFacesClusters.push_back(transparentRenderFacesOffset + srcTransparentRenderFacesCluster);
+		}
 		for (auto srcTransparentRenderFace: srcTransparentRenderFacesPool->transparentRenderFaces) {
 			auto transparentRenderFace = transparentRenderFacesPool.allocate();
 			*transparentRenderFace = *srcTransparentRenderFace;
@@ -115,6 +169,11 @@ private:
 	 */
 	vector<TransparentRenderFace*>& getTransparentRenderFaces();
 
+	/**
+	 * @return transparent render faces vector sorted from far to near
+	 */
+	vector<TransparentRenderFace*>& getSortedTransparentRenderFaces();
+
 	/**
 	 * Public constructor
 	 */
@@ -122,6 +181,23 @@ private:
 
 public:
 
+	/**
+	 * Sort transparent render faces from far to near with radix sort
+	 * 	If clusters are given, clusters are sorted by distance of its first face and faces keep their order within a cluster
+	 * @param transparentRenderFaces transparent render faces
+	 * @param transparentRenderFacesClusters start indices of clusters in transparent render faces or empty to sort each face
+	 * @param sortEntries sort entries, which should be reused between calls
+	 * @param sortEntriesBuffer sort entries buffer, which should be reused between calls
+	 * @param sortedTransparentRenderFaces sorted transparent render faces
+	 */
+	static void sort(
+		const vector<TransparentRenderFace*>& transparentRenderFaces,
+		const vector<int32_t>& transparentRenderFacesClusters,
+		vector<SortEntry>& sortEntries,
+		vector<SortEntry>& sortEntriesBuffer,
+		vector<TransparentRenderFace*>& sortedTransparentRenderFaces
+	);
+
 	/**
 	 * @return allocated faces
 	 */
@@ -0,0 +1,186 @@
+#pragma once
+
+#include <array>
+#include <cstring>
+
+#include <tdme/tdme.h>
+#include <tdme/engine/model/fwd-tdme.h>
+#include <tdme/engine/model/TextureCoordinate.h>
+#include <tdme/engine/subsystems/rendering/fwd-tdme.h>
+#include <tdme/math/Math.h>
+#include <tdme/math/Vector3.h>
+
+using std::array;
+using std::memcpy;
+
+using tdme::engine::model::TextureCoordinate;
+using tdme::math::Math;
+using tdme::math::Vector3;
+
+/**
+ * Vertex packing, which encodes vertices into a interleaved and quantized vertex layout
+ * 	Vertices are stored as floats, normals and tangents as signed normalized 10:10:10:2 integers,
+ * 	texture coordinates as half floats and bitangents only by their sign in tangent w component
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::engine::subsystems::rendering::VertexPacking final
+{
+public:
+	/**
+	 * Packed vertex, 24 bytes instead of 56 bytes with separate float buffers
+	 */
+	struct PackedVertex {
+		float vertex[3];
+		uint32_t normal;
+		uint32_t tangent;
+		uint16_t textureCoordinate[2];
+	};
+
+	/**
+	 * Encode float into half float with round to nearest even
+	 * @param value value
+	 * @return half float
+	 */
+	inline static uint16_t encodeHalfFloat(float value) {
+		uint32_t bits;
+		memcpy(&bits, &value, sizeof(bits));
+		auto sign = static_cast<uint16_t>((bits >> 16) & 0x8000);
+		auto exponentMantissa = bits & 0x7FFFFFFF;
+		// infinity or NaN
+		if (exponentMantissa >= 0x7F800000) return sign | 0x7C00 | (exponentMantissa > 0x7F800000?0x200:0x000);
+		// overflow
+		if (exponentMantissa >= 0x47800000) return sign | 0x7C00;
+		// subnormal half float
+		if (exponentMantissa < 0x38800000) {
+			if (exponentMantissa < 0x33000000) return sign;
+			auto shift = 126 - (exponentMantissa >> 23);
+			auto mantissa = (exponentMantissa & 0x7FFFFF) | 0x800000;
+			auto halfMantissa = mantissa >> shift;
+			auto remainder = mantissa & ((1 << shift) - 1);
+			auto halfway = 1u << (shift - 1);
+			if (remainder > halfway || (remainder == halfway && (halfMantissa & 1) != 0)) halfMantissa++;
+			return sign | static_cast<uint16_t>(halfMantissa);
+		}
+		// normalized half float, rounding can carry into exponent
+		auto half = (exponentMantissa - 0x38000000) >> 13;
+		auto remainder = exponentMantissa & 0x1FFF;
+		if (remainder > 0x1000 || (remainder == 0x1000 && (half & 1) != 0)) half++;
+		return sign | static_cast<uint16_t>(half);
+	}
+
+	/**
+	 * Decode half float into float
+	 * @param value half float
+	 * @return value
+	 */
+	inline static float decodeHalfFloat(uint16_t value) {
+		auto sign = static_cast<uint32_t>(value & 0x8000) << 16;
+		auto exponent = static_cast<uint32_t>(value >> 10) & 0x1F;
+		auto mantissa = static_cast<uint32_t>(value) & 0x3FF;
+		uint32_t bits;
+		if (exponent == 0) {
+			if (mantissa == 0) {
+				bits = sign;
+			} else {
+				// normalize subnormal half float
+				exponent = 113;
+				while ((mantissa & 0x400) == 0) {
+					mantissa<<= 1;
+					exponent--;
+				}
+				bits = sign | (exponent << 23) | ((mantissa & 0x3FF) << 13);
+			}
+		} else
+		if (exponent == 31) {
+			bits = sign | 0x7F800000 | (mantissa << 13);
+		} else {
+			bits = sign | ((exponent + 112) << 23) | (mantissa << 13);
+		}
+		float result;
+		memcpy(&result, &bits, sizeof(result));
+		return result;
+	}
+
+	/**
+	 * Encode unit vector and w component into signed normalized 10:10:10:2 integer
+	 * @param vector vector
+	 * @param w w component, which is -1, 0 or 1
+	 * @return packed vector
+	 */
+	inline static uint32_t encodeSignedNormalized1010102(const Vector3& vector, int32_t w = 0) {
+		auto& xyz = vector.getArray();
+		uint32_t result = (static_cast<uint32_t>(w) & 0x3) << 30;
+		for (auto i = 0; i < 3; i++) {
+			auto component = static_cast<int32_t>(Math::floor(Math::clamp(xyz[i], -1.0f, 1.0f) * 511.0f + 0.5f));
+			result|= (static_cast<uint32_t>(component) & 0x3FF) << (i * 10);
+		}
+		return result;
+	}
+
+	/**
+	 * Decode signed normalized 10:10:10:2 integer into vector
+	 * @param value packed vector
+	 * @param vector vector
+	 * @return w component
+	 */
+	inline static int32_t decodeSignedNormalized1010102(uint32_t value, Vector3& vector) {
+		for (auto i = 0; i < 3; i++) {
+			auto component = static_cast<int32_t>(value << (22 - i * 10)) >> 22;
+			vector[i] = Math::max(static_cast<float>(component) / 511.0f, -1.0f);
+		}
+		return static_cast<int32_t>(value) >> 30;
+	}
+
+	/**
+	 * Compute bitangent sign, which is the handedness of tangent space
+	 * @param normal normal
+	 * @param tangent tangent
+	 * @param bitangent bitangent
+	 * @return bitangent sign
+	 */
+	inline static int32_t computeBitangentSign(const Vector3& normal, const Vector3& tangent, const Vector3& bitangent) {
+		Vector3 normalCrossTangent;
+		return Vector3::computeDotProduct(Vector3::computeCrossProduct(normal, tangent, normalCrossTangent), bitangent) < 0.0f?-1:1;
+	}
+
+	/**
+	 * Pack vertex
+	 * @param vertex vertex
+	 * @param normal normal
+	 * @param tangent tangent or null
+	 * @param bitangent bitangent or null
+	 * @param textureCoordinate texture coordinate or null
+	 * @param packedVertex packed vertex
+	 */
+	inline static void pack(const Vector3& vertex, const Vector3& normal, const Vector3* tangent, const Vector3* bitangent, const TextureCoordinate* textureCoordinate, PackedVertex& packedVertex) {
+		packedVertex.vertex[0] = vertex[0];
+		packedVertex.vertex[1] = vertex[1];
+		packedVertex.vertex[2] = vertex[2];
+		packedVertex.normal = encodeSignedNormalized1010102(normal);
+		packedVertex.tangent =
+			tangent != nullptr?
+				encodeSignedNormalized1010102(*tangent, bitangent != nullptr?computeBitangentSign(normal, *tangent, *bitangent):1):
+				0;
+		packedVertex.textureCoordinate[0] = textureCoordinate != nullptr?encodeHalfFloat(textureCoordinate->getArray()[0]):0;
+		packedVertex.textureCoordinate[1] = textureCoordinate != nullptr?encodeHalfFloat(textureCoordinate->getArray()[1]):0;
+	}
+
+	/**
+	 * Unpack vertex, bitangent will be reconstructed from normal, tangent and bitangent sign
+	 * @param packedVertex packed vertex
+	 * @param vertex vertex
+	 * @param normal normal
+	 * @param tangent tangent
+	 * @param bitangent bitangent
+	 * @param textureCoordinate texture coordinate
+	 */
+	inline static void unpack(const PackedVertex& packedVertex, Vector3& vertex, Vector3& normal, Vector3& tangent, Vector3& bitangent, TextureCoordinate& textureCoordinate) {
+		vertex.set(packedVertex.vertex[0], packedVertex.vertex[1], packedVertex.vertex[2]);
+		decodeSignedNormalized1010102(packedVertex.normal, normal);
+		auto bitangentSign = decodeSignedNormalized1010102(packedVertex.tangent, tangent);
+		Vector3::computeCrossProduct(normal, tangent, bitangent).scale(static_cast<float>(bitangentSign));
+		textureCoordinate.set(array<float, 2> {{ decodeHalfFloat(packedVertex.textureCoordinate[0]), decodeHalfFloat(packedVertex.textureCoordinate[1]) }});
+	}
+
+};
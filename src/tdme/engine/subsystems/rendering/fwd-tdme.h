@@ -10,6 +10,7 @@ namespace rendering {
 	class BatchRendererPoints;
 	class BatchRendererTriangles;
 	class ModelUtilitiesInternal;
+	class ModelMemoryStatistics;
 	class ModelStatistics;
 	class Object3DAnimation;
 	class Object3DBase;
@@ -22,6 +23,7 @@ namespace rendering {
 	class Object3DRenderer;
 	class Object3DRenderer_InstancedRenderFunctionParameters;
 	class Object3DRenderer_TransparentRenderFacesGroupPool;
+	struct RenderingStatistics;
 	class RenderTransparentRenderPointsPool;
 	struct TransparentRenderFace;
 	class TransparentRenderFacesGroup;
@@ -29,6 +31,7 @@ namespace rendering {
 	class TransparentRenderFacesPool_TransparentRenderFacesPool;
 	struct TransparentRenderPoint;
 	class TransparentRenderPointsPool;
+	class VertexPacking;
 	class ObjectBuffer;
 }  // namespace rendering
 }  // namespace subsystems
@@ -14,6 +14,7 @@
 #include <tdme/engine/ObjectParticleSystem.h>
 #include <tdme/engine/ParticleSystemGroup.h>
 #include <tdme/engine/Partition.h>
+#include <tdme/engine/Timing.h>
 #include <tdme/engine/primitives/BoundingBox.h>
 #include <tdme/engine/subsystems/rendering/Object3DRenderer.h>
 #include <tdme/engine/subsystems/renderer/Renderer.h>
@@ -21,6 +22,7 @@
 #include <tdme/math/Math.h>
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/math/Vector3.h>
+#include <tdme/utils/Time.h>
 
 using std::vector;
 
@@ -36,6 +38,7 @@ using tdme::engine::Object3DRenderGroup;
 using tdme::engine::LODObject3D;
 using tdme::engine::ObjectParticleSystem;
 using tdme::engine::Partition;
+using tdme::engine::Timing;
 using tdme::engine::primitives::BoundingBox;
 using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::engine::subsystems::renderer::Renderer;
@@ -43,6 +46,7 @@ using tdme::engine::subsystems::shadowmapping::ShadowMapping;
 using tdme::math::Math;
 using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
+using tdme::utils::Time;
 
 ShadowMap::ShadowMap(ShadowMapping* shadowMapping, int32_t width, int32_t height)
 {
@@ -107,16 +111,116 @@ Camera* ShadowMap::getCamera()
 	return lightCamera;
 }
 
-void ShadowMap::render(Light* light)
+void ShadowMap::update(Light* light, float cascadeNear, float cascadeFar)
 {
 	// use default context
-	// TODO: object->preRender only uses default context, lets see how to make this multithreaded
 	auto context = shadowMapping->renderer->getDefaultContext();
 
+	//
+	auto timeStart = Time::getCurrentNanos();
+
+	//
+	auto camera = shadowMapping->engine->getCamera();
+
+	// store cascade
+	this->cascadeNear = cascadeNear;
+	this->cascadeFar = cascadeFar;
+
+	// try to determine light position
+	Vector3 center;
+	float width;
+	if (cascadeFar > cascadeNear) {
+		// cascade: center of cascade view depth range on camera view axis
+		center.set(camera->getForwardVector()).scale((cascadeNear + cascadeFar) / 2.0f).add(camera->getLookFrom());
+		//	width is camera frustum width at cascade far distance
+		width = 2.0f * cascadeFar / camera->getProjectionMatrix().getArray()[0] * Engine::getShadowMapLightEyeDistanceScale();
+	} else {
+		// 	left
+		Vector4 left;
+		camera->getModelViewProjectionInvertedMatrix().multiply(
+			Vector4(
+				(2.0f * 0.0f) - 1.0f,
+				1.0f - (2.0f * 0.5f),
+				2.0f * 0.997f - 1.0f,
+				1.0f
+			),
+			left
+		);
+		left.scale(1.0f / left.getW());
+
+		//	right
+		Vector4 right;
+		camera->getModelViewProjectionInvertedMatrix().multiply(
+			Vector4(
+				(2.0f * 1.0f) - 1.0f,
+				1.0f - (2.0f * 0.5f),
+				2.0f * 0.997f - 1.0f,
+				1.0f
+			),
+			right
+		);
+		right.scale(1.0f / right.getW());
+
+		//	center
+		Vector4 center4;
+		camera->getModelViewProjectionInvertedMatrix().multiply(
+			Vector4(
+				(2.0f * 0.5f) - 1.0f,
+				1.0f - (2.0f * 0.5f),
+				2.0f * 0.8f - 1.0f,
+				1.0f
+			),
+			center4
+		);
+		center4.scale(1.0f / center4.getW());
+
+		// so we get some contraints for the shadow map camera, TODO: improve me
+		center.set(center4.getX(), center4.getY(), center4.getZ());
+		width = Vector3(right.getX(), right.getY(), right.getZ()).sub(Vector3(left.getX(), left.getY(), left.getZ())).computeLength() * Engine::getShadowMapLightEyeDistanceScale();
+	}
+
+	// viewers camera
+	Vector3 lightDirection;
+	Vector3 lightLookFrom;
+	// compute camera from view of light
+	lightDirection.set(light->getSpotDirection()).normalize();
+	lightLookFrom
+		.set(center)
+		.sub(lightDirection.clone().scale(width * 1.25f));
+	// set up light camera from view of light
+	Vector3 lightCameraUpVector;
+	Vector3 lightCameraSideVector;
+	lightCamera->setZNear(camera->getZNear());
+	lightCamera->setZFar(150.0f);
+	lightCamera->setLookFrom(lightLookFrom);
+	lightCamera->setForwardVector(lightDirection);
+	lightCamera->setSideVector(Vector3(1.0f, 0.0f, 0.0f));
+	// TODO: fix cross product NaN if side vector == forward vector
+	Vector3::computeCrossProduct(lightCamera->getForwardVector(), lightCamera->getSideVector(), lightCameraUpVector);
+	lightCamera->setUpVector(lightCameraUpVector);
+	Vector3::computeCrossProduct(lightCamera->getForwardVector(), lightCamera->getUpVector(), lightCameraSideVector);
+	lightCamera->setSideVector(lightCameraSideVector);
+	lightCamera->setUpVector(lightCameraUpVector);
+	lightCamera->update(context, frameBuffer->getWidth(), frameBuffer->getHeight());
+
+	// determine shadow caster entities using light camera frustum, which starts at light eye and so covers off screen casters too
+	//	reuse or patch entities from last frame if light camera frustum did not change
+	casterEntities = casterEntitiesCache.getVisibleEntities(shadowMapping->engine->getPartition(), lightCamera->getFrustum());
+
+	//
+	casterTime = Time::getCurrentNanos() - timeStart;
+}
+
+void ShadowMap::determineCasters()
+{
+	//
+	auto timeStart = Time::getCurrentNanos();
+
 	// clear visible objects
 	visibleObjects.clear();
 
-	// determine visible objects and objects that should generate a shadow
+	// determine objects that should generate a shadow
+	//	this runs on several engine threads, so LOD objects are fetched without applying LOD effect colors
 	Entity* orgEntity = nullptr;
 	Object3D* object = nullptr;
 	LODObject3D* lodObject = nullptr;
@@ -124,41 +228,32 @@ void ShadowMap::render(Light* light)
 	ObjectParticleSystem* opse = nullptr;
 	ParticleSystemGroup* psg = nullptr;
 	EntityHierarchy* eh = nullptr;
-	for (auto entity: shadowMapping->engine->getPartition()->getVisibleEntities(shadowMapping->engine->getCamera()->getFrustum())) {
+	for (auto entity: casterEntities) {
 		if ((org = dynamic_cast<Object3DRenderGroup*>(entity)) != nullptr) {
 			if ((orgEntity = org->getEntity()) != nullptr) {
 				if (orgEntity->isContributesShadows() == false) continue;
 				if ((object = dynamic_cast<Object3D*>(orgEntity)) != nullptr) {
-					object->preRender(context);
 					visibleObjects.push_back(object);
 				} else
 				if ((lodObject = dynamic_cast<LODObject3D*>(orgEntity)) != nullptr) {
 					if (lodObject->isContributesShadows() == false) continue;
-					auto object = lodObject->getLODObject();
-					if (object != nullptr) {
-						object->preRender(context);
-						visibleObjects.push_back(object);
-					}
+					auto object = lodObject->getCurrentLODObject();
+					if (object != nullptr) visibleObjects.push_back(object);
 				}
 			}
 		} else
 		if ((object = dynamic_cast<Object3D*>(entity)) != nullptr) {
 			if (object->isContributesShadows() == false) continue;
-			object->preRender(context);
 			visibleObjects.push_back(object);
 		} else
 		if ((lodObject = dynamic_cast<LODObject3D*>(entity)) != nullptr) {
 			if (lodObject->isContributesShadows() == false) continue;
-			auto object = lodObject->getLODObject();
-			if (object != nullptr) {
-				object->preRender(context);
-				visibleObjects.push_back(object);
-			}
+			auto object = lodObject->getCurrentLODObject();
+			if (object != nullptr) visibleObjects.push_back(object);
 		} else
 		if ((opse = dynamic_cast<ObjectParticleSystem*>(entity)) != nullptr) {
 			if (opse->isContributesShadows() == false) continue;
 			for (auto object: opse->getEnabledObjects()) {
-				object->preRender(context);
 				visibleObjects.push_back(object);
 			}
 		} else
@@ -168,7 +263,6 @@ void ShadowMap::render(Light* light)
 				if (opse == nullptr) continue;
 				if (opse->isContributesShadows() == false) continue;
 				for (auto object: opse->getEnabledObjects()) {
-					object->preRender(context);
 					visibleObjects.push_back(object);
 				}
 			}
@@ -178,82 +272,22 @@ void ShadowMap::render(Light* light)
 			for (auto entity: eh->getEntities()) {
 				auto object = dynamic_cast<Object3D*>(entity);
 				if (object == nullptr || object->isEnabled() == false) continue;
-				object->preRender(context);
 				visibleObjects.push_back(object);
 			}
 		}
 	}
 
 	//
-	auto camera = shadowMapping->engine->getCamera();
-
-	// try to determine light position
-
-	// 	left
-	Vector4 left;
-	camera->getModelViewProjectionInvertedMatrix().multiply(
-		Vector4(
-			(2.0f * 0.0f) - 1.0f,
-			1.0f - (2.0f * 0.5f),
-			2.0f * 0.997f - 1.0f,
-			1.0f
-		),
-		left
-	);
-	left.scale(1.0f / left.getW());
-
-	//	right
-	Vector4 right;
-	camera->getModelViewProjectionInvertedMatrix().multiply(
-		Vector4(
-			(2.0f * 1.0f) - 1.0f,
-			1.0f - (2.0f * 0.5f),
-			2.0f * 0.997f - 1.0f,
-			1.0f
-		),
-		right
-	);
-	right.scale(1.0f / right.getW());
-
-	//	center
-	Vector4 center4;
-	camera->getModelViewProjectionInvertedMatrix().multiply(
-		Vector4(
-			(2.0f * 0.5f) - 1.0f,
-			1.0f - (2.0f * 0.5f),
-			2.0f * 0.8f - 1.0f,
-			1.0f
-		),
-		center4
-	);
-	center4.scale(1.0f / center4.getW());
-
-	// so we get some contraints for the shadow map camera, TODO: improve me
-	Vector3 center(Vector3(center4.getX(), center4.getY(), center4.getZ()));
-	auto width = Vector3(right.getX(), right.getY(), right.getZ()).sub(Vector3(left.getX(), left.getY(), left.getZ())).computeLength() * Engine::getShadowMapLightEyeDistanceScale();
+	casterTime+= Time::getCurrentNanos() - timeStart;
+}
 
-	// viewers camera
-	Vector3 lightDirection;
-	Vector3 lightLookFrom;
-	// compute camera from view of light
-	lightDirection.set(light->getSpotDirection()).normalize();
-	lightLookFrom
-		.set(center)
-		.sub(lightDirection.clone().scale(width * 1.25f));
-	// set up light camera from view of light
-	Vector3 lightCameraUpVector;
-	Vector3 lightCameraSideVector;
-	lightCamera->setZNear(camera->getZNear());
-	lightCamera->setZFar(150.0f);
-	lightCamera->setLookFrom(lightLookFrom);
-	lightCamera->setForwardVector(lightDirection);
-	lightCamera->setSideVector(Vector3(1.0f, 0.0f, 0.0f));
-	// TODO: fix cross product NaN if side vector == forward vector
-	Vector3::computeCrossProduct(lightCamera->getForwardVector(), lightCamera->getSideVector(), lightCameraUpVector);
-	lightCamera->setUpVector(lightCameraUpVector);
-	Vector3::computeCrossProduct(lightCamera->getForwardVector(), lightCamera->getUpVector(), lightCameraSideVector);
-	lightCamera->setSideVector(lightCameraSideVector);
-	lightCamera->setUpVector(lightCameraUpVector);
+void ShadowMap::render()
+{
+	//
+	auto timeStart = Time::getCurrentNanos();
+	// use default context
+	auto context = shadowMapping->renderer->getDefaultContext();
+	// set up light camera matrices
 	lightCamera->update(context, frameBuffer->getWidth(), frameBuffer->getHeight());
 	// Bind frame buffer to shadow map fbo id
 	frameBuffer->enableFrameBuffer();
@@ -268,6 +302,8 @@ void ShadowMap::render(Light* light)
 		Object3DRenderer::RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY |
 		Object3DRenderer::RENDERTYPE_TEXTURES_DIFFUSEMASKEDTRANSPARENCY
 	);
+	//
+	renderTime = Time::getCurrentNanos() - timeStart;
 }
 
 void ShadowMap::computeDepthBiasMVPMatrix()
@@ -4,6 +4,7 @@
 
 #include <tdme/tdme.h>
 #include <tdme/engine/fwd-tdme.h>
+#include <tdme/engine/VisibilityCache.h>
 #include <tdme/engine/subsystems/shadowmapping/fwd-tdme.h>
 #include <tdme/math/fwd-tdme.h>
 #include <tdme/math/Vector3.h>
@@ -13,9 +14,12 @@
 using std::vector;
 
 using tdme::engine::Camera;
+using tdme::engine::Entity;
 using tdme::engine::FrameBuffer;
 using tdme::engine::Light;
 using tdme::engine::Object3D;
+using tdme::engine::Partition;
+using tdme::engine::VisibilityCache;
 using tdme::engine::subsystems::shadowmapping::ShadowMapping;
 using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
@@ -31,6 +35,12 @@ class tdme::engine::subsystems::shadowmapping::ShadowMap final
 
 private:
 	vector<Object3D*> visibleObjects;
+	vector<Entity*> casterEntities;
+	VisibilityCache casterEntitiesCache;
+	float cascadeNear { 0.0f };
+	float cascadeFar { 0.0f };
+	int64_t casterTime { 0LL };
+	int64_t renderTime { 0LL };
 	ShadowMapping* shadowMapping { nullptr };
 	Camera* lightCamera { nullptr };
 	FrameBuffer* frameBuffer { nullptr };
@@ -65,11 +75,67 @@ private:
 	 */
 	Camera* getCamera();
 
-	/** 
-	 * Renders given objects to shadow map
+	/**
+	 * @return cascade near distance in camera view depth
+	 */
+	inline float getCascadeNear() {
+		return cascadeNear;
+	}
+
+	/**
+	 * @return cascade far distance in camera view depth, if less or equal cascade near this shadow map is not cascaded
+	 */
+	inline float getCascadeFar() {
+		return cascadeFar;
+	}
+
+	/**
+	 * Set up light camera and determine shadow caster entities using the light camera frustum
+	 * 	Shadow casters are cached as long as light camera frustum and partition did not change
 	 * @param light light
+	 * @param cascadeNear cascade near distance in camera view depth
+	 * @param cascadeFar cascade far distance in camera view depth, if less or equal cascade near shadow map will cover the whole shadow distance
+	 */
+	void update(Light* light, float cascadeNear = 0.0f, float cascadeFar = 0.0f);
+
+	/**
+	 * Determine shadow casters from shadow caster entities determined by update()
+	 * 	This does not use the renderer and can be called from engine threads for different shadow maps in parallel
+	 */
+	void determineCasters();
+
+	/**
+	 * @return shadow casters determined by determineCasters()
+	 */
+	inline const vector<Object3D*>& getCasters() {
+		return visibleObjects;
+	}
+
+	/**
+	 * @return shadow caster entities determined by update()
+	 */
+	inline const vector<Entity*>& getCasterEntities() {
+		return casterEntities;
+	}
+
+	/**
+	 * @return time in nanoseconds used to determine shadow casters in last frame
+	 */
+	inline int64_t getCasterTime() {
+		return casterTime;
+	}
+
+	/**
+	 * @return time in nanoseconds used to render shadow map in last frame
+	 */
+	inline int64_t getRenderTime() {
+		return renderTime;
+	}
+
+	/** 
+	 * Renders shadow casters determined by update() to shadow map
 	 */
-	void render(Light* light);
+	void render();
 
 	/** 
 	 * Computes shadow texture matrix and stores it
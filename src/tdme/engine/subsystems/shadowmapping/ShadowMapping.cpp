@@ -1,38 +1,55 @@
 #include <tdme/engine/subsystems/shadowmapping/ShadowMapping.h>
 
+#include <algorithm>
 #include <string>
 #include <vector>
 
+#include <tdme/engine/Camera.h>
 #include <tdme/engine/Engine.h>
 #include <tdme/engine/Light.h>
+#include <tdme/engine/Object3D.h>
+#include <tdme/engine/Timing.h>
+#include <tdme/engine/primitives/BoundingBox.h>
 #include <tdme/engine/subsystems/rendering/Object3DRenderer.h>
 #include <tdme/engine/subsystems/renderer/Renderer.h>
 #include <tdme/engine/subsystems/shadowmapping/ShadowMap.h>
 #include <tdme/engine/subsystems/shadowmapping/ShadowMappingShaderPreImplementation.h>
 #include <tdme/engine/subsystems/shadowmapping/ShadowMappingShaderPre.h>
 #include <tdme/engine/subsystems/shadowmapping/ShadowMappingShaderRender.h>
+#include <tdme/engine/subsystems/shadowmapping/ShadowMappingStatistics.h>
+#include <tdme/math/Math.h>
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/math/Vector3.h>
 #include <tdme/math/Vector4.h>
 #include <tdme/utils/Console.h>
+#include <tdme/utils/Float.h>
 
+using std::sort;
+using std::unique;
 using std::vector;
 using std::string;
 using std::to_string;
 
 using tdme::engine::subsystems::shadowmapping::ShadowMapping;
+using tdme::engine::Camera;
 using tdme::engine::Engine;
 using tdme::engine::Light;
+using tdme::engine::Object3D;
+using tdme::engine::Timing;
+using tdme::engine::primitives::BoundingBox;
 using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::engine::subsystems::renderer::Renderer;
 using tdme::engine::subsystems::shadowmapping::ShadowMap;
 using tdme::engine::subsystems::shadowmapping::ShadowMapping_RunState;
 using tdme::engine::subsystems::shadowmapping::ShadowMappingShaderPre;
 using tdme::engine::subsystems::shadowmapping::ShadowMappingShaderRender;
+using tdme::engine::subsystems::shadowmapping::ShadowMappingStatistics;
+using tdme::math::Math;
 using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
 using tdme::math::Vector4;
 using tdme::utils::Console;
+using tdme::utils::Float;
 
 ShadowMapping::ShadowMapping(Engine* engine, Renderer* renderer, Object3DRenderer* object3DRenderer)
 {
@@ -40,16 +57,13 @@ ShadowMapping::ShadowMapping(Engine* engine, Renderer* renderer, Object3DRendere
 	this->renderer = renderer;
 	this->object3DRenderer = object3DRenderer;
 	shadowMaps.resize(engine->getLightCount());
-	for (auto i = 0; i < shadowMaps.size(); i++) {
-		shadowMaps[i] = nullptr;
-	}
 	depthBiasMVPMatrix.identity();
 	runState = ShadowMapping_RunState::NONE;
 }
 
 ShadowMapping::~ShadowMapping() {
 	for (auto i = 0; i < shadowMaps.size(); i++) {
-		if (shadowMaps[i] != nullptr) delete shadowMaps[i];
+		for (auto shadowMap: shadowMaps[i]) delete shadowMap;
 	}
 }
 
@@ -62,35 +76,131 @@ void ShadowMapping::reshape(int32_t width, int32_t height)
 {
 }
 
+float ShadowMapping::computeCascadeSplit(float zNear, float zFar, int32_t idx, int32_t cascades)
+{
+	auto splitLambda = Engine::getShadowMapCascadeSplitLambda();
+	auto f = static_cast<float>(idx) / static_cast<float>(cascades);
+	auto logarithmicSplit = zNear * Math::pow(zFar / zNear, f);
+	auto uniformSplit = zNear + (zFar - zNear) * f;
+	return splitLambda * logarithmicSplit + (1.0f - splitLambda) * uniformSplit;
+}
+
+void ShadowMapping::disposeShadowMaps(int32_t lightIdx)
+{
+	for (auto shadowMap: shadowMaps[lightIdx]) {
+		shadowMap->dispose();
+		delete shadowMap;
+	}
+	shadowMaps[lightIdx].clear();
+}
+
+void ShadowMapping::updateShadowMaps()
+{
+	//
+	updatedShadowMaps.clear();
+
+	//
+	auto camera = engine->getCamera();
+
+	// shadow distance in camera view depth used for cascades
+	Vector4 cascadesFar4;
+	camera->getModelViewProjectionInvertedMatrix().multiply(
+		Vector4(
+			0.0f,
+			0.0f,
+			2.0f * 0.997f - 1.0f,
+			1.0f
+		),
+		cascadesFar4
+	);
+	cascadesFar4.scale(1.0f / cascadesFar4.getW());
+	auto cascadesNear = camera->getZNear();
+	auto cascadesFar = Vector3::computeDotProduct(
+		Vector3(cascadesFar4.getX(), cascadesFar4.getY(), cascadesFar4.getZ()).sub(camera->getLookFrom()),
+		camera->getForwardVector()
+	);
+
+	// update shadow maps, which sets up light cameras and determines shadow caster entities
+	for (auto i = 0; i < engine->getLightCount(); i++) {
+		auto light = engine->getLightAt(i);
+		if (light->isEnabled() == true) {
+			// directional lights get cascaded shadow maps
+			auto cascades = light->getPosition().getW() == 0.0f && cascadesFar > cascadesNear?Engine::getShadowMapCascades():1;
+			// create shadow maps for light, if required
+			if (shadowMaps[i].size() != cascades) {
+				disposeShadowMaps(i);
+				for (auto j = 0; j < cascades; j++) {
+					auto shadowMap = new ShadowMap(this, Engine::getShadowMapWidth(), Engine::getShadowMapHeight());
+					shadowMap->initialize();
+					shadowMaps[i].push_back(shadowMap);
+				}
+			}
+			// update
+			if (cascades == 1) {
+				shadowMaps[i][0]->update(light);
+			} else {
+				for (auto j = 0; j < cascades; j++) {
+					shadowMaps[i][j]->update(
+						light,
+						computeCascadeSplit(cascadesNear, cascadesFar, j, cascades),
+						computeCascadeSplit(cascadesNear, cascadesFar, j + 1, cascades)
+					);
+				}
+			}
+			for (auto shadowMap: shadowMaps[i]) updatedShadowMaps.push_back(shadowMap);
+		} else {
+			// dispose shadow maps
+			disposeShadowMaps(i);
+		}
+	}
+}
+
+void ShadowMapping::determineShadowCastersFunction(int threadCount, int threadIdx)
+{
+	for (auto i = 0; i < updatedShadowMaps.size(); i++) {
+		if (threadCount > 1 && i % threadCount != threadIdx) continue;
+		updatedShadowMaps[i]->determineCasters();
+	}
+}
+
+void ShadowMapping::collectShadowCasters()
+{
+	// collect shadow casters of all shadow maps, objects can cast shadows into several shadow maps
+	casters.clear();
+	for (auto shadowMap: updatedShadowMaps) {
+		for (auto object: shadowMap->getCasters()) casters.push_back(object);
+	}
+	sort(casters.begin(), casters.end());
+	casters.erase(unique(casters.begin(), casters.end()), casters.end());
+}
+
+void ShadowMapping::preRenderShadowCastersFunction(int threadCount, int threadIdx)
+{
+	auto context = renderer->getContext(threadIdx);
+	auto frame = engine->getTiming()->getFrame();
+	for (auto i = 0; i < casters.size(); i++) {
+		if (threadCount > 1 && i % threadCount != threadIdx) continue;
+		auto object = casters[i];
+		// off screen casters did not get their transformations computed by engine in this frame
+		if (object->frameTransformationsLast != frame) object->computeTransformations(context);
+		object->preRender(context);
+	}
+}
+
 void ShadowMapping::createShadowMaps()
 {
+	//
 	runState = ShadowMapping_RunState::PRE;
 	// disable color rendering, we only want to write to the Z-Buffer
 	renderer->setColorMask(false, false, false, false);
 	// render backfaces only, avoid self-shadowing
 	renderer->setCullFace(renderer->CULLFACE_FRONT);
 	// render to shadow maps
-	for (auto i = 0; i < engine->getLightCount(); i++) {
-		auto light = engine->getLightAt(i);
-		if (light->isEnabled() == true) {
-			// create shadow map for light, if required
-			if (shadowMaps[i] == nullptr) {
-				auto shadowMap = new ShadowMap(this, Engine::getShadowMapWidth(), Engine::getShadowMapHeight());
-				shadowMap->initialize();
-				shadowMaps[i] = shadowMap;
-			}
-			// render
-			Engine::getShadowMappingShaderPre()->useProgram(engine);
-			shadowMaps[i]->render(light);
-			Engine::getShadowMappingShaderPre()->unUseProgram();
-		} else {
-			if (shadowMaps[i] != nullptr) {
-				// dispose shadow map
-				shadowMaps[i]->dispose();
-				delete shadowMaps[i];
-				shadowMaps[i] = nullptr;
-			}
-		}
+	for (auto shadowMap: updatedShadowMaps) {
+		// render
+		Engine::getShadowMappingShaderPre()->useProgram(engine);
+		shadowMap->render();
+		Engine::getShadowMappingShaderPre()->unUseProgram();
 	}
 	// restore disable color rendering
 	renderer->setColorMask(true, true, true, true);
@@ -101,7 +211,26 @@ void ShadowMapping::createShadowMaps()
 }
 
 ShadowMap* ShadowMapping::getShadowMap(int idx) {
-	return shadowMaps[idx];
+	return shadowMaps[idx].empty() == true?nullptr:shadowMaps[idx][0];
+}
+
+int32_t ShadowMapping::getShadowMapCascadeCount(int idx) {
+	return shadowMaps[idx].size();
+}
+
+ShadowMap* ShadowMapping::getShadowMap(int idx, int cascadeIdx) {
+	return shadowMaps[idx][cascadeIdx];
+}
+
+void ShadowMapping::getStatistics(int idx, ShadowMappingStatistics& statistics) {
+	statistics = ShadowMappingStatistics();
+	for (auto shadowMap: shadowMaps[idx]) {
+		statistics.cascades++;
+		statistics.casterEntities+= shadowMap->getCasterEntities().size();
+		statistics.casters+= shadowMap->getCasters().size();
+		statistics.casterTime+= shadowMap->getCasterTime();
+		statistics.renderTime+= shadowMap->getRenderTime();
+	}
 }
 
 void ShadowMapping::renderShadowMaps(const vector<Object3D*>& visibleObjects)
@@ -124,43 +253,80 @@ void ShadowMapping::renderShadowMaps(const vector<Object3D*>& visibleObjects)
 	// user shader program
 	shader->useProgram(engine);
 	// render each shadow map
+	auto camera = engine->getCamera();
 	for (auto i = 0; i < shadowMaps.size(); i++) {
 		// skip on unused shadow mapping
-		if (shadowMaps[i] == nullptr) continue;
+		if (shadowMaps[i].empty() == true) continue;
 
-		//
-		auto shadowMap = shadowMaps[i];
 		// set light to render
 		shader->setRenderLightId(i);
 
-		// setup depth textures to contexts
-		for (auto j = 0; j < contextCount; j++) {
-			// use default context
-			auto context = renderer->getContext(j);
-			// set up light shader uniforms
-			shadowMap->updateDepthBiasMVPMatrix(context);
-			// bind shadow map texture on shadow map texture unit
-			auto textureUnit = renderer->getTextureUnit(context);
-			renderer->setTextureUnit(context, ShadowMap::TEXTUREUNIT);
-			shadowMap->bindDepthBufferTexture(context);
-			// switch back to texture last unit
-			renderer->setTextureUnit(context, textureUnit);
-		}
+		// render each cascade
+		auto cascades = shadowMaps[i].size();
+		for (auto j = 0; j < cascades; j++) {
+			//
+			auto shadowMap = shadowMaps[i][j];
+
+			// view depth range of this cascade, fragments outside of it are discarded by shader
+			//	first cascade also takes nearer fragments, last cascade also takes farther fragments
+			auto cascadeViewDepthNear = j == 0?-Float::MAX_VALUE:shadowMap->getCascadeNear();
+			auto cascadeViewDepthFar = j == cascades - 1?Float::MAX_VALUE:shadowMap->getCascadeFar();
+
+			// determine receivers of this cascade, which are all receivers whose bounding box view depth range overlaps the cascade
+			//	so receivers spanning several cascades are rendered into each of them
+			auto visibleObjectsReceivingShadowsToRender = &visibleObjectsReceivingShadows;
+			if (cascades > 1) {
+				auto& forwardVector = camera->getForwardVector();
+				visibleObjectsReceivingShadowsCascade.clear();
+				for (auto object: visibleObjectsReceivingShadows) {
+					auto boundingBox = object->getBoundingBoxTransformed();
+					auto viewDepth = Vector3::computeDotProduct(
+						boundingBox->getCenter().clone().sub(camera->getLookFrom()),
+						forwardVector
+					);
+					auto& dimensions = boundingBox->getDimensions();
+					auto viewDepthExtent =
+						(Math::abs(forwardVector.getX()) * dimensions.getX() +
+						Math::abs(forwardVector.getY()) * dimensions.getY() +
+						Math::abs(forwardVector.getZ()) * dimensions.getZ()) * 0.5f;
+					if (viewDepth + viewDepthExtent < cascadeViewDepthNear) continue;
+					if (viewDepth - viewDepthExtent >= cascadeViewDepthFar) continue;
+					visibleObjectsReceivingShadowsCascade.push_back(object);
+				}
+				if (visibleObjectsReceivingShadowsCascade.empty() == true) continue;
+				visibleObjectsReceivingShadowsToRender = &visibleObjectsReceivingShadowsCascade;
+			}
 
-		// render objects, enable blending
-		//	will be disabled after rendering transparent faces
-		renderer->enableBlending();
-		// 	only opaque face entities as shadows will not be produced on transparent faces
-		object3DRenderer->render(
-			visibleObjectsReceivingShadows,
-			false,
-			Object3DRenderer::RENDERTYPE_NORMALS |
-			Object3DRenderer::RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY |
-			Object3DRenderer::RENDERTYPE_TEXTURES_DIFFUSEMASKEDTRANSPARENCY |
-			Object3DRenderer::RENDERTYPE_SHADOWMAPPING
-		);
-		//	disable blending
-		renderer->disableBlending();
+			// setup depth textures to contexts
+			for (auto k = 0; k < contextCount; k++) {
+				// use default context
+				auto context = renderer->getContext(k);
+				// set up light shader uniforms
+				shadowMap->updateDepthBiasMVPMatrix(context);
+				shader->setProgramCascadeViewDepthRange(context, cascadeViewDepthNear, cascadeViewDepthFar);
+				// bind shadow map texture on shadow map texture unit
+				auto textureUnit = renderer->getTextureUnit(context);
+				renderer->setTextureUnit(context, ShadowMap::TEXTUREUNIT);
+				shadowMap->bindDepthBufferTexture(context);
+				// switch back to texture last unit
+				renderer->setTextureUnit(context, textureUnit);
+			}
+
+			// render objects, enable blending
+			//	will be disabled after rendering transparent faces
+			renderer->enableBlending();
+			// 	only opaque face entities as shadows will not be produced on transparent faces
+			object3DRenderer->render(
+				*visibleObjectsReceivingShadowsToRender,
+				false,
+				Object3DRenderer::RENDERTYPE_NORMALS |
+				Object3DRenderer::RENDERTYPE_TEXTUREARRAYS_DIFFUSEMASKEDTRANSPARENCY |
+				Object3DRenderer::RENDERTYPE_TEXTURES_DIFFUSEMASKEDTRANSPARENCY |
+				Object3DRenderer::RENDERTYPE_SHADOWMAPPING
+			);
+			//	disable blending
+			renderer->disableBlending();
+		}
 	}
 
 	// unuse shader program
@@ -183,6 +349,7 @@ void ShadowMapping::renderShadowMaps(const vector<Object3D*>& visibleObjects)
 
 	//
 	visibleObjectsReceivingShadows.clear();
+	visibleObjectsReceivingShadowsCascade.clear();
 
 	//
 	runState = ShadowMapping_RunState::NONE;
@@ -192,11 +359,7 @@ void ShadowMapping::dispose()
 {
 	// dispose shadow mappings
 	for (auto i = 0; i < shadowMaps.size(); i++) {
-		if (shadowMaps[i] != nullptr) {
-			shadowMaps[i]->dispose();
-			delete shadowMaps[i];
-			shadowMaps[i] = nullptr;
-		}
+		disposeShadowMaps(i);
 	}
 }
 
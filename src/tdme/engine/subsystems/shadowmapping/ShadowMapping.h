@@ -17,6 +17,7 @@ using tdme::engine::Engine;
 using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::engine::subsystems::renderer::Renderer;
 using tdme::engine::subsystems::shadowmapping::ShadowMap;
+using tdme::engine::subsystems::shadowmapping::ShadowMappingStatistics;
 using tdme::math::Matrix4x4;
 using tdme::math::Vector3;
 using tdme::math::Vector4;
@@ -41,10 +42,29 @@ private:
 
 	Engine* engine { nullptr };
 
-	vector<ShadowMap*> shadowMaps;
+	vector<vector<ShadowMap*>> shadowMaps;
+	vector<ShadowMap*> updatedShadowMaps;
+	vector<Object3D*> casters;
 	ShadowMapping_RunState runState { NONE };
 
 	vector<Object3D*> visibleObjectsReceivingShadows;
+	vector<Object3D*> visibleObjectsReceivingShadowsCascade;
+
+	/**
+	 * Compute cascade split distance in camera view depth, blends logarithmic and uniform split scheme by shadow map cascade split lambda
+	 * @param zNear near distance
+	 * @param zFar far distance
+	 * @param idx split index
+	 * @param cascades cascades
+	 * @return split distance
+	 */
+	float computeCascadeSplit(float zNear, float zFar, int32_t idx, int32_t cascades);
+
+	/**
+	 * Dispose shadow maps of given light
+	 * @param lightIdx light index
+	 */
+	void disposeShadowMaps(int32_t lightIdx);
 
 public:
 	/** 
@@ -59,17 +79,61 @@ public:
 	 */
 	void reshape(int32_t width, int32_t height);
 
+	/**
+	 * Update shadow maps, which creates shadow maps for enabled lights, sets up light cameras and determines shadow caster entities
+	 */
+	void updateShadowMaps();
+
+	/**
+	 * Determine shadow casters of shadow maps updated by updateShadowMaps(), to be called from each engine thread
+	 * @param threadCount thread count
+	 * @param threadIdx thread index
+	 */
+	void determineShadowCastersFunction(int threadCount, int threadIdx);
+
+	/**
+	 * Collect shadow casters of all updated shadow maps into a unique list
+	 */
+	void collectShadowCasters();
+
+	/**
+	 * Compute transformations of shadow casters that have not been computed in this frame and do pre render steps, to be called from each engine thread
+	 * @param threadCount thread count
+	 * @param threadIdx thread index
+	 */
+	void preRenderShadowCastersFunction(int threadCount, int threadIdx);
+
 	/** 
-	 * Create shadow maps
+	 * Create shadow maps, which renders shadow casters into shadow maps updated by updateShadowMaps()
 	 */
 	void createShadowMaps();
 
+	/**
+	 * Get shadow mapping statistics of given light of last frame
+	 * @param idx light index
+	 * @param statistics statistics
+	 */
+	void getStatistics(int idx, ShadowMappingStatistics& statistics);
+
 	/** 
-	 * @return shadow map
+	 * @return shadow map or first cascade shadow map
 	 * @param idx index
 	 */
 	ShadowMap* getShadowMap(int idx);
 
+	/**
+	 * @return shadow map cascade count of given light
+	 * @param idx index
+	 */
+	int32_t getShadowMapCascadeCount(int idx);
+
+	/**
+	 * @return shadow map of given light and cascade
+	 * @param idx index
+	 * @param cascadeIdx cascade index
+	 */
+	ShadowMap* getShadowMap(int idx, int cascadeIdx);
+
 	/**
 	 * Render shadow maps
 	 * @param visibleObjects visible objects
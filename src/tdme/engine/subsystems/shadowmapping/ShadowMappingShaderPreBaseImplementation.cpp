@@ -5,6 +5,7 @@
 #include <tdme/engine/subsystems/lighting/LightingShader.h>
 #include <tdme/engine/subsystems/lighting/LightingShaderConstants.h>
 #include <tdme/engine/subsystems/renderer/Renderer.h>
+#include <tdme/engine/subsystems/rendering/Object3DRenderer.h>
 #include <tdme/math/Matrix4x4.h>
 #include <tdme/os/filesystem/FileSystem.h>
 #include <tdme/os/filesystem/FileSystemInterface.h>
@@ -16,6 +17,7 @@ using tdme::engine::subsystems::shadowmapping::ShadowMappingShaderPreBaseImpleme
 using tdme::engine::subsystems::lighting::LightingShader;
 using tdme::engine::subsystems::lighting::LightingShaderConstants;
 using tdme::engine::subsystems::renderer::Renderer;
+using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::math::Matrix4x4;
 using tdme::os::filesystem::FileSystem;
 using tdme::os::filesystem::FileSystemInterface;
@@ -27,6 +29,11 @@ ShadowMappingShaderPreBaseImplementation::ShadowMappingShaderPreBaseImplementati
 	initialized = false;
 }
 
+const string ShadowMappingShaderPreBaseImplementation::getInstanceDataDefinitions()
+{
+	return renderer->isTextureBufferObjectsAvailable() == true?"\n#define HAVE_INSTANCE_INDICES":"";
+}
+
 ShadowMappingShaderPreBaseImplementation::~ShadowMappingShaderPreBaseImplementation() {
 }
 
@@ -73,6 +80,14 @@ void ShadowMappingShaderPreBaseImplementation::initialize()
 	//
 	uniformTime = renderer->getProgramUniformLocation(programId, "time");
 
+	// instance data fetched by instance indices
+	if (renderer->isTextureBufferObjectsAvailable() == true) {
+		uniformInstanceDataTextureUnit = renderer->getProgramUniformLocation(programId, "instanceDataTextureUnit");
+		if (uniformInstanceDataTextureUnit == -1) return;
+		uniformInstanceIndicesTextureUnit = renderer->getProgramUniformLocation(programId, "instanceIndicesTextureUnit");
+		if (uniformInstanceIndicesTextureUnit == -1) return;
+	}
+
 	//
 	initialized = true;
 }
@@ -81,6 +96,8 @@ void ShadowMappingShaderPreBaseImplementation::useProgram(Engine* engine, void*
 {
 	renderer->useProgram(context, programId);
 	renderer->setLighting(context, renderer->LIGHTING_SPECULAR);
+	if (uniformInstanceDataTextureUnit != -1) renderer->setProgramUniformInteger(context, uniformInstanceDataTextureUnit, Object3DRenderer::TEXTUREUNIT_INSTANCEDATA);
+	if (uniformInstanceIndicesTextureUnit != -1) renderer->setProgramUniformInteger(context, uniformInstanceIndicesTextureUnit, Object3DRenderer::TEXTUREUNIT_INSTANCEINDICES);
 	renderer->setProgramUniformInteger(context, uniformDiffuseTextureUnit, LightingShaderConstants::SPECULAR_TEXTUREUNIT_DIFFUSE);
 	if (uniformTime != -1) renderer->setProgramUniformFloat(context, uniformTime, static_cast<float>(engine->getTiming()->getTotalTime()) / 1000.0f);
 }
@@ -1,6 +1,8 @@
 
 #pragma once
 
+#include <string>
+
 #include <tdme/tdme.h>
 #include <tdme/engine/fwd-tdme.h>
 #include <tdme/engine/subsystems/renderer/fwd-tdme.h>
@@ -8,6 +10,8 @@
 #include <tdme/engine/subsystems/shadowmapping/ShadowMappingShaderPreImplementation.h>
 #include <tdme/math/fwd-tdme.h>
 
+using std::string;
+
 using tdme::engine::Engine;
 using tdme::engine::subsystems::renderer::Renderer;
 using tdme::engine::subsystems::shadowmapping::ShadowMappingShaderPreImplementation;
@@ -36,8 +40,15 @@ protected:
 	int32_t uniformDiffuseTextureMaskedTransparency { -1 };
 	int32_t uniformDiffuseTextureMaskedTransparencyThreshold { -1 };
 	int32_t uniformTime { -1 };
+	int32_t uniformInstanceDataTextureUnit { -1 };
+	int32_t uniformInstanceIndicesTextureUnit { -1 };
 	bool initialized { false };
 
+	/**
+	 * @return vertex shader definitions to fetch instance data by instance indices if supported by renderer
+	 */
+	const string getInstanceDataDefinitions();
+
 public:
 
 	// overriden methods
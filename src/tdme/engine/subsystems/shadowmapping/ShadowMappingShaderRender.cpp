@@ -55,6 +55,8 @@ void ShadowMappingShaderRender::useProgram(Engine* engine)
 {
 	running = true;
 	this->engine = engine;
+	cascadeViewDepthNear = -Float::MAX_VALUE;
+	cascadeViewDepthFar = Float::MAX_VALUE;
 }
 
 void ShadowMappingShaderRender::unUseProgram()
@@ -112,6 +114,15 @@ void ShadowMappingShaderRender::setProgramDepthBiasMVPMatrix(void* context, cons
 	shadowMappingShaderRenderContext.implementation->setProgramDepthBiasMVPMatrix(context, this->depthBiasMVPMatrix);
 }
 
+void ShadowMappingShaderRender::setProgramCascadeViewDepthRange(void* context, float viewDepthNear, float viewDepthFar)
+{
+	this->cascadeViewDepthNear = viewDepthNear;
+	this->cascadeViewDepthFar = viewDepthFar;
+	auto& shadowMappingShaderRenderContext = contexts[renderer->getContextIndex(context)];
+	if (shadowMappingShaderRenderContext.implementation == nullptr) return;
+	shadowMappingShaderRenderContext.implementation->setProgramCascadeViewDepthRange(context, cascadeViewDepthNear, cascadeViewDepthFar);
+}
+
 void ShadowMappingShaderRender::setRenderLightId(int32_t lightId) {
 	this->lightId = lightId;
 }
@@ -132,5 +143,6 @@ void ShadowMappingShaderRender::setShader(void* context, const string& id) {
 	}
 
 	shadowMappingShaderRenderContext.implementation->setProgramDepthBiasMVPMatrix(context, depthBiasMVPMatrix);
+	shadowMappingShaderRenderContext.implementation->setProgramCascadeViewDepthRange(context, cascadeViewDepthNear, cascadeViewDepthFar);
 	shadowMappingShaderRenderContext.implementation->setRenderLightId(lightId);
 }
@@ -9,6 +9,7 @@
 #include <tdme/engine/subsystems/renderer/fwd-tdme.h>
 #include <tdme/engine/subsystems/shadowmapping/fwd-tdme.h>
 #include <tdme/math/Matrix4x4.h>
+#include <tdme/utils/Float.h>
 
 using std::map;
 using std::string;
@@ -18,6 +19,7 @@ using tdme::engine::Engine;
 using tdme::engine::subsystems::renderer::Renderer;
 using tdme::engine::subsystems::shadowmapping::ShadowMappingShaderRenderImplementation;
 using tdme::math::Matrix4x4;
+using tdme::utils::Float;
 
 /** 
  * Shadow mapping shader to render shadow maps
@@ -33,6 +35,8 @@ private:
 	map<string, ShadowMappingShaderRenderImplementation*> shader;
 	bool running { false };
 	Matrix4x4 depthBiasMVPMatrix;
+	float cascadeViewDepthNear { -Float::MAX_VALUE };
+	float cascadeViewDepthFar { Float::MAX_VALUE };
 	Engine* engine { nullptr };
 	Renderer* renderer { nullptr };
 	vector<ShadowMappingShaderRenderContext> contexts;
@@ -100,6 +104,14 @@ public:
 	 */
 	void setProgramDepthBiasMVPMatrix(void* context, const Matrix4x4& depthBiasMVPMatrix);
 
+	/**
+	 * Set up program cascade view depth range, fragments with a view depth outside of [near, far) are discarded
+	 * @param context context
+	 * @param viewDepthNear view depth near
+	 * @param viewDepthFar view depth far
+	 */
+	void setProgramCascadeViewDepthRange(void* context, float viewDepthNear, float viewDepthFar);
+
 	/**
 	 * Set light id
 	 * @param lightId light id to render
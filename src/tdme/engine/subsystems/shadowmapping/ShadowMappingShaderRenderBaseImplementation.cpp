@@ -8,6 +8,7 @@
 #include <tdme/engine/subsystems/lighting/LightingShader.h>
 #include <tdme/engine/subsystems/lighting/LightingShaderConstants.h>
 #include <tdme/engine/subsystems/renderer/Renderer.h>
+#include <tdme/engine/subsystems/rendering/Object3DRenderer.h>
 #include <tdme/engine/subsystems/shadowmapping/ShadowMap.h>
 #include <tdme/engine/subsystems/shadowmapping/ShadowMapping.h>
 #include <tdme/math/Matrix4x4.h>
@@ -23,6 +24,7 @@ using tdme::engine::subsystems::shadowmapping::ShadowMappingShaderRenderBaseImpl
 using tdme::engine::subsystems::lighting::LightingShader;
 using tdme::engine::subsystems::lighting::LightingShaderConstants;
 using tdme::engine::subsystems::renderer::Renderer;
+using tdme::engine::subsystems::rendering::Object3DRenderer;
 using tdme::engine::subsystems::shadowmapping::ShadowMap;
 using tdme::engine::subsystems::shadowmapping::ShadowMapping;
 using tdme::math::Math;
@@ -37,6 +39,11 @@ ShadowMappingShaderRenderBaseImplementation::ShadowMappingShaderRenderBaseImplem
 	initialized = false;
 }
 
+const string ShadowMappingShaderRenderBaseImplementation::getInstanceDataDefinitions()
+{
+	return renderer->isTextureBufferObjectsAvailable() == true?"\n#define HAVE_INSTANCE_INDICES":"";
+}
+
 ShadowMappingShaderRenderBaseImplementation::~ShadowMappingShaderRenderBaseImplementation()
 {
 }
@@ -77,6 +84,8 @@ void ShadowMappingShaderRenderBaseImplementation::initialize()
 		renderUniformCameraMatrix = renderer->getProgramUniformLocation(renderProgramId, "cameraMatrix");
 		if (renderUniformCameraMatrix == -1) return;
 	} else {
+		renderUniformMVMatrix = renderer->getProgramUniformLocation(renderProgramId, "mvMatrix");
+		if (renderUniformMVMatrix == -1) return;
 		renderUniformMVPMatrix = renderer->getProgramUniformLocation(renderProgramId, "mvpMatrix");
 		if (renderUniformMVPMatrix == -1) return;
 		renderUniformNormalMatrix = renderer->getProgramUniformLocation(renderProgramId, "normalMatrix");
@@ -95,11 +104,9 @@ void ShadowMappingShaderRenderBaseImplementation::initialize()
 	if (uniformDiffuseTextureMaskedTransparencyThreshold == -1) return;
 	renderUniformLightDirection = renderer->getProgramUniformLocation(renderProgramId, "lightDirection");
 	if (renderUniformLightDirection == -1) return;
+	renderUniformCascadeViewDepthRange = renderer->getProgramUniformLocation(renderProgramId, "cascadeViewDepthRange");
+	if (renderUniformCascadeViewDepthRange == -1) return;
 	if (shaderVersion != "gl2") {
-		if (renderer->isInstancedRenderingAvailable() == false) {
-			renderUniformMVMatrix = renderer->getProgramUniformLocation(renderProgramId, "mvMatrix");
-			if (renderUniformMVMatrix == -1) return;
-		}
 		renderUniformLightPosition = renderer->getProgramUniformLocation(renderProgramId, "lightPosition");
 		if (renderUniformLightPosition == -1) return;
 		renderUniformLightSpotExponent = renderer->getProgramUniformLocation(renderProgramId, "lightSpotExponent");
@@ -117,6 +124,14 @@ void ShadowMappingShaderRenderBaseImplementation::initialize()
 	//
 	renderUniformTime = renderer->getProgramUniformLocation(renderProgramId, "time");
 
+	// instance data fetched by instance indices
+	if (renderer->isTextureBufferObjectsAvailable() == true) {
+		renderUniformInstanceDataTextureUnit = renderer->getProgramUniformLocation(renderProgramId, "instanceDataTextureUnit");
+		if (renderUniformInstanceDataTextureUnit == -1) return;
+		renderUniformInstanceIndicesTextureUnit = renderer->getProgramUniformLocation(renderProgramId, "instanceIndicesTextureUnit");
+		if (renderUniformInstanceIndicesTextureUnit == -1) return;
+	}
+
 	//
 	initialized = true;
 }
@@ -125,6 +140,8 @@ void ShadowMappingShaderRenderBaseImplementation::useProgram(Engine* engine, voi
 {
 	renderer->useProgram(context, renderProgramId);
 	renderer->setLighting(context, renderer->LIGHTING_SPECULAR);
+	if (renderUniformInstanceDataTextureUnit != -1) renderer->setProgramUniformInteger(context, renderUniformInstanceDataTextureUnit, Object3DRenderer::TEXTUREUNIT_INSTANCEDATA);
+	if (renderUniformInstanceIndicesTextureUnit != -1) renderer->setProgramUniformInteger(context, renderUniformInstanceIndicesTextureUnit, Object3DRenderer::TEXTUREUNIT_INSTANCEINDICES);
 	renderer->setProgramUniformInteger(context, renderUniformTextureUnit, ShadowMap::TEXTUREUNIT);
 	if (renderUniformTime != -1) renderer->setProgramUniformFloat(context, renderUniformTime, static_cast<float>(engine->getTiming()->getTotalTime()) / 1000.0f);
 	if (renderUniformShadowMapLookUps != -1) renderer->setProgramUniformInteger(context, renderUniformShadowMapLookUps, Engine::getShadowMapRenderLookUps());
@@ -152,7 +169,7 @@ void ShadowMappingShaderRenderBaseImplementation::updateMatrices(void* context)
 		// model translation
 		renderer->getModelViewMatrix().getTranslation(modelTranslation);
 		// upload
-		if (renderUniformMVMatrix != -1) renderer->setProgramUniformFloatMatrix4x4(context, renderUniformMVMatrix, mvMatrix.getArray());
+		renderer->setProgramUniformFloatMatrix4x4(context, renderUniformMVMatrix, mvMatrix.getArray());
 		renderer->setProgramUniformFloatMatrix4x4(context, renderUniformMVPMatrix, mvpMatrix.getArray());
 		renderer->setProgramUniformFloatMatrix4x4(context, renderUniformNormalMatrix, normalMatrix.getArray());
 		if (renderUniformModelTranslation != -1) renderer->setProgramUniformFloatVec3(context, renderUniformModelTranslation, modelTranslation.getArray());
@@ -207,6 +224,11 @@ void ShadowMappingShaderRenderBaseImplementation::setProgramDepthBiasMVPMatrix(v
 	renderer->setProgramUniformFloatMatrix4x4(context, renderUniformDepthBiasMVPMatrix, depthBiasMVPMatrix.getArray());
 }
 
+void ShadowMappingShaderRenderBaseImplementation::setProgramCascadeViewDepthRange(void* context, float viewDepthNear, float viewDepthFar)
+{
+	renderer->setProgramUniformFloatVec2(context, renderUniformCascadeViewDepthRange, {{ viewDepthNear, viewDepthFar }});
+}
+
 void ShadowMappingShaderRenderBaseImplementation::setRenderLightId(int32_t lightId) {
 	this->lightId = lightId;
 }
@@ -52,9 +52,17 @@ protected:
 	int32_t renderUniformLightLinearAttenuation { -1 };
 	int32_t renderUniformLightQuadraticAttenuation { -1 };
 	int32_t renderUniformTime { -1 };
+	int32_t renderUniformCascadeViewDepthRange { -1 };
+	int32_t renderUniformInstanceDataTextureUnit { -1 };
+	int32_t renderUniformInstanceIndicesTextureUnit { -1 };
 	bool initialized;
 	int lightId { -1 };
 
+	/**
+	 * @return vertex shader definitions to fetch instance data by instance indices if supported by renderer
+	 */
+	const string getInstanceDataDefinitions();
+
 public:
 
 	// overriden methods
@@ -68,6 +76,7 @@ public:
 	virtual void updateLight(Renderer* renderer, void* context, int32_t lightId) override;
 	virtual void bindTexture(Renderer* renderer, void* context, int32_t textureId) override;
 	virtual void setProgramDepthBiasMVPMatrix(void* context, const Matrix4x4& depthBiasMVPMatrix) override;
+	virtual void setProgramCascadeViewDepthRange(void* context, float viewDepthNear, float viewDepthFar) override;
 	virtual void setRenderLightId(int32_t lightId) override;
 
 	/**
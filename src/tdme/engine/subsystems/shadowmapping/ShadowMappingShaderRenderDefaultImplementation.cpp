@@ -33,7 +33,8 @@ void ShadowMappingShaderRenderDefaultImplementation::initialize()
 	renderVertexShaderId = renderer->loadShader(
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/shadowmapping",
-		"render_vertexshader.c"
+		"render_vertexshader.c",
+		getInstanceDataDefinitions()
 	);
 	if (renderVertexShaderId == 0) return;
 
@@ -34,7 +34,8 @@ void ShadowMappingShaderRenderFoliageImplementation::initialize()
 		renderer->SHADER_VERTEX_SHADER,
 		"shader/" + shaderVersion + "/shadowmapping",
 		"render_vertexshader.c",
-		"#define HAVE_FOLIAGE",
+		"#define HAVE_FOLIAGE" +
+		getInstanceDataDefinitions(),
 		FileSystem::getInstance()->getContentAsString(
 			"shader/" + shaderVersion + "/functions",
 			"create_rotation_matrix.inc.c"
@@ -88,6 +88,14 @@ struct tdme::engine::subsystems::shadowmapping::ShadowMappingShaderRenderImpleme
 	 */
 	virtual void setProgramDepthBiasMVPMatrix(void* context, const Matrix4x4& depthBiasMVPMatrix) = 0;
 
+	/**
+	 * Set up program cascade view depth range, fragments with a view depth outside of [near, far) are discarded
+	 * @param context contet
+	 * @param viewDepthNear view depth near
+	 * @param viewDepthFar view depth far
+	 */
+	virtual void setProgramCascadeViewDepthRange(void* context, float viewDepthNear, float viewDepthFar) = 0;
+
 	/**
 	 * Set light id
 	 * @param lightId light id to render
@@ -0,0 +1,18 @@
+#pragma once
+
+#include <tdme/tdme.h>
+#include <tdme/engine/subsystems/shadowmapping/fwd-tdme.h>
+
+/**
+ * Shadow mapping statistics entity of a light, times are given in nanoseconds
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+struct tdme::engine::subsystems::shadowmapping::ShadowMappingStatistics
+{
+	int64_t cascades {  };
+	int64_t casterEntities {  };
+	int64_t casters {  };
+	int64_t casterTime {  };
+	int64_t renderTime {  };
+};
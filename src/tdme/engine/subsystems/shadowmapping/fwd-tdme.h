@@ -20,6 +20,7 @@ namespace shadowmapping {
 	class ShadowMappingShaderRenderDefaultImplementation;
 	class ShadowMappingShaderRenderFoliageImplementation;
 	class ShadowMappingShaderRenderTreeImplementation;
+	struct ShadowMappingStatistics;
 	class ShadowMapping_RunState;
 }  // namespace shadowmapping
 }  // namespace subsystems
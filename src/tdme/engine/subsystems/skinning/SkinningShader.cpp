@@ -143,14 +143,19 @@ void SkinningShader::computeSkinning(void* context, Object3DGroupMesh* object3DG
 			}
 		}
 
-		// vertices
+		// vertices, which are model data shared by all instances
 		{
-			object3DGroupMesh->setupVerticesBuffer(renderer, context, (*modelSkinningCache.vboIds)[0]);
+			auto fbVertices = ObjectBuffer::getByteBuffer(context, vertices.size() * 3 * sizeof(float))->asFloatBuffer();
+			for (auto& vertex: vertices) fbVertices.put(vertex.getArray());
+			renderer->uploadSkinningBufferObject(context, (*modelSkinningCache.vboIds)[0], fbVertices.getPosition() * sizeof(float), &fbVertices);
 		}
 
-		// normals
+		// normals, which are model data shared by all instances
 		{
-			object3DGroupMesh->setupNormalsBuffer(renderer, context, (*modelSkinningCache.vboIds)[1]);
+			auto& normals = group->getNormals();
+			auto fbNormals = ObjectBuffer::getByteBuffer(context, normals.size() * 3 * sizeof(float))->asFloatBuffer();
+			for (auto& normal: normals) fbNormals.put(normal.getArray());
+			renderer->uploadSkinningBufferObject(context, (*modelSkinningCache.vboIds)[1], fbNormals.getPosition() * sizeof(float), &fbNormals);
 		}
 
 		{
@@ -14,6 +14,7 @@
 
 #include <tdme/network/udpserver/NIOUDPServer.h>
 #include <tdme/network/udpserver/NIOUDPServerIOThread.h>
+#include <tdme/os/threading/AtomicOperations.h>
 #include <tdme/os/threading/Thread.h>
 #include <tdme/os/threading/Barrier.h>
 #include <tdme/os/threading/ReadWriteLock.h>
@@ -29,6 +30,8 @@ using std::to_string;
 
 using tdme::network::udpserver::NIOUDPServer;
 using tdme::network::udpserver::NIOUDPServerIOThread;
+using tdme::network::udpserver::NIOUDPServerStatistics;
+using tdme::os::threading::AtomicOperations;
 using tdme::os::threading::Thread;
 using tdme::os::threading::Barrier;
 using tdme::os::threading::ReadWriteLock;
@@ -46,7 +49,9 @@ NIOUDPServer::NIOUDPServer(const std::string& name, const std::string& host, con
 	ioThreads(NULL),
 	workerThreadPool(NULL),
 	clientCount(0),
-	messageCount(0) {
+	messageCount(0),
+	requestsDeclined(0L),
+	statisticsDumpInterval(0L) {
 	//
 }
 
@@ -90,6 +95,7 @@ void NIOUDPServer::run() {
 	// do main event loop, waiting until stop requested
 	uint64_t lastCleanUpClientsTime = Time::getCurrentMillis();
 	uint64_t lastCleanUpClientsSafeMessagesTime = Time::getCurrentMillis();
+	uint64_t lastStatisticsDumpTime = Time::getCurrentMillis();
 	while(isStopRequested() == false) {
 		// start time
 		uint64_t now = Time::getCurrentMillis();
@@ -118,6 +124,12 @@ void NIOUDPServer::run() {
 			lastCleanUpClientsSafeMessagesTime = now;
 		}
 
+		// dump statistics
+		if (statisticsDumpInterval > 0L && now >= lastStatisticsDumpTime + statisticsDumpInterval) {
+			Console::println(getStatistics().toString());
+			lastStatisticsDumpTime = now;
+		}
+
 		// duration
 		uint64_t duration = Time::getCurrentMillis() - now;
 
@@ -504,3 +516,31 @@ const uint32_t NIOUDPServer::allocateClientId() {
 	#endif
 	return clientId;
 }
+
+const NIOUDPServerStatistics NIOUDPServer::getStatistics() {
+	NIOUDPServerStatistics statistics;
+	statistics.time = Time::getCurrentMillis();
+	statistics.requestsDeclined = AtomicOperations::load(requestsDeclined);
+
+	// clients
+	clientIdMapReadWriteLock.readLock();
+	statistics.clients = clientIdMap.size();
+	clientIdMapReadWriteLock.unlock();
+
+	// worker thread pool backlog, io threads, those are only available if server is running
+	if (workerThreadPool != NULL) statistics.workerThreadPoolQueueSize = workerThreadPool->getElementCount();
+	if (ioThreads != NULL) {
+		statistics.ioThreads.resize(ioThreadCount);
+		for (auto i = 0; i < ioThreadCount; i++) {
+			ioThreads[i]->getStatistics(statistics.ioThreads[i]);
+			statistics.total.add(statistics.ioThreads[i]);
+		}
+	}
+
+	//
+	return statistics;
+}
+
+void NIOUDPServer::setStatisticsDumpInterval(const uint64_t statisticsDumpInterval) {
+	this->statisticsDumpInterval = statisticsDumpInterval;
+}
@@ -17,6 +17,7 @@
 #include <tdme/network/udpserver/NIOUDPServerIOThread.h>
 #include <tdme/network/udpserver/NIOUDPServerClient.h>
 #include <tdme/network/udpserver/NIOUDPServerGroup.h>
+#include <tdme/network/udpserver/NIOUDPServerStatistics.h>
 #include <tdme/network/udpserver/NIOServer.h>
 #include <tdme/network/udpserver/NIOServerWorkerThreadPool.h>
 
@@ -29,6 +30,7 @@ using tdme::network::udpserver::NIONetworkServerException;
 using tdme::network::udpserver::NIOUDPServerIOThread;
 using tdme::network::udpserver::NIOUDPServerClient;
 using tdme::network::udpserver::NIOUDPServerGroup;
+using tdme::network::udpserver::NIOUDPServerStatistics;
 using tdme::network::udpserver::NIOServer;
 using tdme::network::udpserver::NIOServerWorkerThreadPool;
 
@@ -61,6 +63,18 @@ public:
 	 */
 	virtual void run();
 
+	/**
+	 * @brief Returns a snapshot of server statistics, counters are maintained lock free, only queue sizes are determined using locks
+	 * @return server statistics
+	 */
+	const NIOUDPServerStatistics getStatistics();
+
+	/**
+	 * @brief Set up periodic statistics dump to console
+	 * @param statisticsDumpInterval statistics dump interval in milliseconds or 0 to disable
+	 */
+	void setStatisticsDumpInterval(const uint64_t statisticsDumpInterval);
+
 protected:
 	enum MessageType {MESSAGETYPE_CONNECT = 0, MESSAGETYPE_MESSAGE = 1, MESSAGETYPE_ACKNOWLEDGEMENT = 2};
 
@@ -195,5 +209,8 @@ private:
 
 	uint32_t clientCount;
 	uint32_t messageCount;
+
+	volatile uint64_t requestsDeclined;
+	volatile uint64_t statisticsDumpInterval;
 };
 
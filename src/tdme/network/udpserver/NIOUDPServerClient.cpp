@@ -5,6 +5,7 @@
 #include <sstream>
 #include <typeinfo>
 
+#include <tdme/os/threading/AtomicOperations.h>
 #include <tdme/utils/Console.h>
 #include <tdme/utils/IntEncDec.h>
 #include <tdme/utils/RTTI.h>
@@ -17,11 +18,13 @@ using std::pair;
 using std::string;
 using std::stringstream;
 
+using tdme::os::threading::AtomicOperations;
 using tdme::utils::Console;
 using tdme::utils::IntEncDec;
 using tdme::utils::RTTI;
 using tdme::utils::Time;
 using tdme::network::udpserver::NIOUDPServerClient;
+using tdme::network::udpserver::NIOUDPServerStatistics;
 
 NIOUDPServerClient::NIOUDPServerClient(const uint32_t clientId, const string& ip, const unsigned int port) :
 	server(NULL),
@@ -30,6 +33,8 @@ NIOUDPServerClient::NIOUDPServerClient(const uint32_t clientId, const string& ip
 	ip(ip),
 	port(port),
 	shutdownRequested(false),
+	rtt(0L),
+	rttEstimation(0L),
 	messageMapSafeMutex("nioudpserverclient_messagemapsafe") {
 	// key
 	ostringstream tmp;
@@ -196,6 +201,8 @@ void NIOUDPServerClient::onFrameReceived(stringstream* frame, const uint32_t mes
 	);
 	// delegate it to thread pool, but make it declinable
 	if (server->workerThreadPool->addElement(request, true) == false) {
+		// statistics
+		AtomicOperations::add(server->requestsDeclined);
 		// element was declined
 		Console::println("NIOUDPServerClient::onFrameReceived(): client request declined from '" + (ip) + "'. Shutting down client");
 		// 	release client reference
@@ -287,3 +294,48 @@ uint64_t NIOUDPServerClient::getRetryTime(const uint8_t retries) {
 	return NIOUDPServerIOThread::MESSAGEACK_RESENDTIMES[retries - 1];
 }
 
+
+void NIOUDPServerClient::addRTTSample(const uint64_t rtt) {
+	this->rtt = rtt;
+	AtomicOperations::add(statistics.rttSamples);
+	// RTT estimation is packed into a single 64 bit integer, so we can update it using compare and swap
+	uint64_t rttEstimationCurrent;
+	uint64_t rttEstimationNew;
+	do {
+		rttEstimationCurrent = AtomicOperations::load(rttEstimation);
+		uint64_t rttSmoothed8 = rttEstimationCurrent >> 32;
+		uint64_t rttVariance4 = rttEstimationCurrent & 0xFFFFFFFFL;
+		if (rttEstimationCurrent == 0L) {
+			// first sample: srtt = rtt, rttvar = rtt / 2
+			rttSmoothed8 = rtt * 8;
+			rttVariance4 = rtt * 2;
+		} else {
+			// rttvar = 3/4 * rttvar + 1/4 * |srtt - rtt|, srtt = 7/8 * srtt + 1/8 * rtt
+			uint64_t rttSmoothed = rttSmoothed8 / 8;
+			uint64_t rttDelta = rttSmoothed > rtt?rttSmoothed - rtt:rtt - rttSmoothed;
+			rttVariance4 = rttVariance4 - rttVariance4 / 4 + rttDelta;
+			rttSmoothed8 = rttSmoothed8 - rttSmoothed8 / 8 + rtt;
+		}
+		if (rttSmoothed8 > 0xFFFFFFFFL) rttSmoothed8 = 0xFFFFFFFFL;
+		if (rttVariance4 > 0xFFFFFFFFL) rttVariance4 = 0xFFFFFFFFL;
+		rttEstimationNew = (rttSmoothed8 << 32) | rttVariance4;
+	} while (AtomicOperations::compareAndSwap(rttEstimation, rttEstimationCurrent, rttEstimationNew) == false);
+}
+
+const NIOUDPServerStatistics::Client NIOUDPServerClient::getStatistics() {
+	NIOUDPServerStatistics::Client statistics;
+	statistics.clientId = clientId;
+	statistics.ip = ip;
+	statistics.port = port;
+	statistics.messagesReceived = AtomicOperations::load(this->statistics.messagesReceived);
+	statistics.bytesReceived = AtomicOperations::load(this->statistics.bytesReceived);
+	statistics.messagesSent = AtomicOperations::load(this->statistics.messagesSent);
+	statistics.bytesSent = AtomicOperations::load(this->statistics.bytesSent);
+	statistics.retransmits = AtomicOperations::load(this->statistics.retransmits);
+	statistics.rttSamples = AtomicOperations::load(this->statistics.rttSamples);
+	statistics.rtt = AtomicOperations::load(rtt);
+	auto rttEstimationCurrent = AtomicOperations::load(rttEstimation);
+	statistics.rttSmoothed = (rttEstimationCurrent >> 32) / 8;
+	statistics.rttVariance = (rttEstimationCurrent & 0xFFFFFFFFL) / 4;
+	return statistics;
+}
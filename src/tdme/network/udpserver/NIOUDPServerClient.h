@@ -16,12 +16,14 @@
 #include <tdme/network/udpserver/NIONetworkServerException.h>
 #include <tdme/network/udpserver/NIOUDPServer.h>
 #include <tdme/network/udpserver/NIOUDPServerIOThread.h>
+#include <tdme/network/udpserver/NIOUDPServerStatistics.h>
 
 using std::map;
 
 using tdme::utils::Exception;
 using tdme::network::udpserver::NIOUDPServer;
 using tdme::network::udpserver::NIOUDPServerIOThread;
+using tdme::network::udpserver::NIOUDPServerStatistics;
 
 /**
  * Base class for NIO tcp server clients
@@ -112,6 +114,12 @@ public:
 	 */
 	void shutdown();
 
+	/**
+	 * @brief Returns a snapshot of client statistics, including last/smoothed RTT and RTT variance estimated from acknowledgement timing
+	 * @return client statistics
+	 */
+	const NIOUDPServerStatistics::Client getStatistics();
+
 protected:
 	/**
 	 * @brief public destructor, should only be called implicitly by ReferenceCounter::releaseReference()
@@ -175,8 +183,19 @@ private:
 	 */
 	void cleanUpSafeMessages();
 
+	/**
+	 * @brief Records a RTT sample and updates smoothed RTT and RTT variance like TCP does (RFC 6298) without locking
+	 * @param rtt rtt in milliseconds
+	 */
+	void addRTTSample(const uint64_t rtt);
+
 	//
 	volatile bool shutdownRequested;
+	mutable NIOUDPServerStatistics::Client statistics;
+	// last rtt in milliseconds
+	volatile uint64_t rtt;
+	// smoothed rtt in 1/8 ms in upper 32 bits, rtt variance in 1/4 ms in lower 32 bits
+	volatile uint64_t rttEstimation;
 	Mutex messageMapSafeMutex;
 	MessageMapSafe messageMapSafe;
 };
@@ -7,6 +7,7 @@
 
 #include <tdme/os/network/KernelEventMechanism.h>
 #include <tdme/os/network/NIOInterest.h>
+#include <tdme/os/threading/AtomicOperations.h>
 #include <tdme/os/threading/Thread.h>
 #include <tdme/os/threading/Mutex.h>
 #include <tdme/utils/Console.h>
@@ -27,6 +28,7 @@ using tdme::os::network::NIOInterest;
 using tdme::os::network::NIO_INTEREST_NONE;
 using tdme::os::network::NIO_INTEREST_READ;
 using tdme::os::network::NIO_INTEREST_WRITE;
+using tdme::os::threading::AtomicOperations;
 using tdme::os::threading::Mutex;
 using tdme::os::threading::Thread;
 using tdme::utils::Console;
@@ -35,6 +37,7 @@ using tdme::utils::RTTI;
 using tdme::utils::Time;
 using tdme::network::udpserver::NIOUDPServerIOThread;
 using tdme::network::udpserver::NIOServerRequest;
+using tdme::network::udpserver::NIOUDPServerStatistics;
 
 const uint64_t NIOUDPServerIOThread::MESSAGEACK_RESENDTIMES[NIOUDPServerIOThread::MESSAGEACK_RESENDTIMES_TRIES] = {125L, 250L, 500L, 750L, 1000L, 2000L, 5000L};
 
@@ -102,6 +105,8 @@ void NIOUDPServerIOThread::run() {
 						NIOUDPServerClient* client = NULL;
 						NIOUDPServerClient* clientNew = NULL;
 						stringstream* frame = NULL;
+						AtomicOperations::add(statistics.datagramsReceived);
+						AtomicOperations::add(statistics.bytesReceived, bytesReceived);
 						try {
 							// transfer buffer to string stream
 							frame = new stringstream();
@@ -178,6 +183,9 @@ void NIOUDPServerIOThread::run() {
 											client->releaseReference();
 											throw NIONetworkServerException("message invalid");
 										}
+										// statistics
+										AtomicOperations::add(client->statistics.messagesReceived);
+										AtomicOperations::add(client->statistics.bytesReceived, bytesReceived);
 										// delegate
 										client->onFrameReceived(frame, messageId, retries);
 										break;
@@ -197,6 +205,9 @@ void NIOUDPServerIOThread::run() {
 							// delete frame
 							if (frame != NULL) delete frame;
 
+							// statistics
+							AtomicOperations::add(statistics.datagramsInvalid);
+
 							// log
 							Console::println(
 								"NIOUDPServerIOThread[" +
@@ -236,9 +247,12 @@ void NIOUDPServerIOThread::run() {
 						Message* message = &messageQueueBatch.front();
 						if (socket.write(message->ip, message->port, (void*)message->message, message->bytes) == -1) {
 							// sending would block, stop trying to sendin
+							AtomicOperations::add(statistics.sendWouldBlock);
 							break;
 						} else {
 							// success, remove message from message queue batch and continue
+							AtomicOperations::add(statistics.datagramsSent);
+							AtomicOperations::add(statistics.bytesSent, message->bytes);
 							messageQueueBatch.pop();
 						}
 					}
@@ -319,6 +333,10 @@ void NIOUDPServerIOThread::sendMessage(const NIOUDPServerClient* client, const u
 
 	if (deleteFrame == true) delete frame;
 
+	// client statistics, lets count messages when they get queued
+	AtomicOperations::add(client->statistics.messagesSent);
+	AtomicOperations::add(client->statistics.bytesSent, message.bytes);
+
 	// requires ack and retransmission ?
 	if (safe == true) {
 		// 	create message ack
@@ -337,6 +355,7 @@ void NIOUDPServerIOThread::sendMessage(const NIOUDPServerClient* client, const u
 		//	check if message queue is full
 		if (messageMapAck.size() > maxCCU * 20) {
 			messageMapAckMutex.unlock();
+			AtomicOperations::add(statistics.messageMapAckOverflows);
 			throw NIONetworkServerException("message queue ack overflow");
 		}
 		// 	push to message queue ack
@@ -350,9 +369,11 @@ void NIOUDPServerIOThread::sendMessage(const NIOUDPServerClient* client, const u
 	//	check if message queue is full
 	if (messageQueue.size() > maxCCU * 20) {
 		messageQueueMutex.unlock();
+		AtomicOperations::add(statistics.messageQueueOverflows);
 		throw NIONetworkServerException("message queue overflow");
 	}
 	messageQueue.push(message);
+	AtomicOperations::max(statistics.messageQueuePeak, messageQueue.size());
 
 	// set nio interest
 	if (messageQueue.size() == 1) {
@@ -370,6 +391,8 @@ void NIOUDPServerIOThread::sendMessage(const NIOUDPServerClient* client, const u
 
 void NIOUDPServerIOThread::processAckReceived(NIOUDPServerClient* client, const uint32_t messageId) {
 	bool messageAckValid = true;
+	uint8_t messageAckRetries = 0;
+	uint64_t messageAckTime = 0L;
 	MessageMapAck::iterator iterator;
 
 	// delete message from message queue ack
@@ -382,12 +405,30 @@ void NIOUDPServerIOThread::processAckReceived(NIOUDPServerClient* client, const
 		messageAckValid = messageAck->ip == client->ip && messageAck->port == client->port;
 		// remove if valid
 		if (messageAckValid == true) {
+			messageAckRetries = messageAck->retries;
+			messageAckTime = messageAck->time;
 			// remove message from message queue ack
 			messageMapAck.erase(iterator);
 		}
 	}
 	messageMapAckMutex.unlock();
 
+	// statistics
+	AtomicOperations::add(statistics.acksReceived);
+	if (messageAckValid == false) {
+		AtomicOperations::add(statistics.acksInvalid);
+	} else
+	if (messageAckTime != 0L) {
+		AtomicOperations::add(client->statistics.retransmits, messageAckRetries);
+		// only take RTT samples from messages that have not been retransmitted, as we can not tell which transmission was acknowledged
+		if (messageAckRetries == 0) {
+			uint64_t now = Time::getCurrentMillis();
+			uint64_t rtt = now > messageAckTime?now - messageAckTime:0L;
+			addRTTSample(rtt);
+			client->addRTTSample(rtt);
+		}
+	}
+
 	//
 	client->releaseReference();
 
@@ -410,6 +451,7 @@ void NIOUDPServerIOThread::processAckMessages() {
 		if (messageAck->retries == MESSAGEACK_RESENDTIMES_TRIES) {
 			// delete from message map ack
 			messageMapAck.erase(it++);
+			AtomicOperations::add(statistics.ackTimeouts);
 			// skip
 			continue;
 		} else
@@ -429,6 +471,7 @@ void NIOUDPServerIOThread::processAckMessages() {
 
 			// and push to be resent
 			messageQueueResend.push(message);
+			AtomicOperations::add(statistics.retransmits);
 		}
 		++it;
 	}
@@ -441,6 +484,7 @@ void NIOUDPServerIOThread::processAckMessages() {
 			Message* message = &messageQueueResend.front();
 			messageQueue.push(*message);
 			messageQueueResend.pop();
+			AtomicOperations::max(statistics.messageQueuePeak, messageQueue.size());
 
 			// set nio interest
 			if (messageQueue.size() == 1) {
@@ -455,3 +499,33 @@ void NIOUDPServerIOThread::processAckMessages() {
 		messageQueueMutex.unlock();
 	}
 }
+
+void NIOUDPServerIOThread::getStatistics(NIOUDPServerStatistics::IOThread& statistics) {
+	statistics.datagramsReceived = AtomicOperations::load(this->statistics.datagramsReceived);
+	statistics.bytesReceived = AtomicOperations::load(this->statistics.bytesReceived);
+	statistics.datagramsSent = AtomicOperations::load(this->statistics.datagramsSent);
+	statistics.bytesSent = AtomicOperations::load(this->statistics.bytesSent);
+	statistics.datagramsInvalid = AtomicOperations::load(this->statistics.datagramsInvalid);
+	statistics.acksReceived = AtomicOperations::load(this->statistics.acksReceived);
+	statistics.acksInvalid = AtomicOperations::load(this->statistics.acksInvalid);
+	statistics.retransmits = AtomicOperations::load(this->statistics.retransmits);
+	statistics.ackTimeouts = AtomicOperations::load(this->statistics.ackTimeouts);
+	statistics.sendWouldBlock = AtomicOperations::load(this->statistics.sendWouldBlock);
+	statistics.messageQueueOverflows = AtomicOperations::load(this->statistics.messageQueueOverflows);
+	statistics.messageMapAckOverflows = AtomicOperations::load(this->statistics.messageMapAckOverflows);
+	statistics.messageQueuePeak = AtomicOperations::load(this->statistics.messageQueuePeak);
+	statistics.rttSamples = AtomicOperations::load(this->statistics.rttSamples);
+	statistics.rttSum = AtomicOperations::load(this->statistics.rttSum);
+	statistics.rttMax = AtomicOperations::load(this->statistics.rttMax);
+	for (auto i = 0; i < NIOUDPServerStatistics::RTT_HISTOGRAM_BUCKETS; i++) {
+		statistics.rttHistogram[i] = AtomicOperations::load(this->statistics.rttHistogram[i]);
+	}
+
+	// queue sizes, snapshots are taken rarely so we can afford locking here
+	messageQueueMutex.lock();
+	statistics.messageQueueSize = messageQueue.size();
+	messageQueueMutex.unlock();
+	messageMapAckMutex.lock();
+	statistics.messageMapAckSize = messageMapAck.size();
+	messageMapAckMutex.unlock();
+}
@@ -9,6 +9,7 @@
 #include <tdme/network/udpserver/fwd-tdme.h>
 
 #include <tdme/tdme.h>
+#include <tdme/os/threading/AtomicOperations.h>
 #include <tdme/os/threading/Thread.h>
 #include <tdme/os/threading/Mutex.h>
 #include <tdme/os/network/KernelEventMechanism.h>
@@ -16,16 +17,19 @@
 
 #include <tdme/network/udpserver/NIOUDPServer.h>
 #include <tdme/network/udpserver/NIOUDPServerClient.h>
+#include <tdme/network/udpserver/NIOUDPServerStatistics.h>
 
 using std::queue;
 using std::map;
 
+using tdme::os::threading::AtomicOperations;
 using tdme::os::threading::Thread;
 using tdme::os::threading::Mutex;
 using tdme::os::network::KernelEventMechanism;
 using tdme::os::network::NIOUDPSocket;
 using tdme::network::udpserver::NIOUDPServer;
 using tdme::network::udpserver::NIOUDPServerClient;
+using tdme::network::udpserver::NIOUDPServerStatistics;
 
 /**
  * NIO network server udp IO thread
@@ -92,6 +96,23 @@ private:
 	 */
 	void processAckMessages();
 
+	/**
+	 * @brief Records a RTT sample
+	 * @param rtt rtt in milliseconds
+	 */
+	inline void addRTTSample(const uint64_t rtt) {
+		AtomicOperations::add(statistics.rttSamples);
+		AtomicOperations::add(statistics.rttSum, rtt);
+		AtomicOperations::max(statistics.rttMax, rtt);
+		AtomicOperations::add(statistics.rttHistogram[NIOUDPServerStatistics::getRTTHistogramBucket(rtt)]);
+	}
+
+	/**
+	 * @brief Get a snapshot of this IO thread statistics
+	 * @param statistics statistics
+	 */
+	void getStatistics(NIOUDPServerStatistics::IOThread& statistics);
+
 	//
 	unsigned int id;
 	NIOUDPServer* server;
@@ -105,5 +126,7 @@ private:
 	MessageMapAck messageMapAck;
 
 	NIOUDPSocket socket;
+
+	NIOUDPServerStatistics::IOThread statistics;
 };
 
@@ -0,0 +1,70 @@
+#include <string>
+
+#include <tdme/network/udpserver/NIOUDPServerStatistics.h>
+
+using std::string;
+using std::to_string;
+
+using tdme::network::udpserver::NIOUDPServerStatistics;
+
+void NIOUDPServerStatistics::IOThread::add(const IOThread& statistics) {
+	datagramsReceived+= statistics.datagramsReceived;
+	bytesReceived+= statistics.bytesReceived;
+	datagramsSent+= statistics.datagramsSent;
+	bytesSent+= statistics.bytesSent;
+	datagramsInvalid+= statistics.datagramsInvalid;
+	acksReceived+= statistics.acksReceived;
+	acksInvalid+= statistics.acksInvalid;
+	retransmits+= statistics.retransmits;
+	ackTimeouts+= statistics.ackTimeouts;
+	sendWouldBlock+= statistics.sendWouldBlock;
+	messageQueueOverflows+= statistics.messageQueueOverflows;
+	messageMapAckOverflows+= statistics.messageMapAckOverflows;
+	messageQueueSize+= statistics.messageQueueSize;
+	messageQueuePeak+= statistics.messageQueuePeak;
+	messageMapAckSize+= statistics.messageMapAckSize;
+	rttSamples+= statistics.rttSamples;
+	rttSum+= statistics.rttSum;
+	if (statistics.rttMax > rttMax) rttMax = statistics.rttMax;
+	for (auto i = 0; i < RTT_HISTOGRAM_BUCKETS; i++) rttHistogram[i]+= statistics.rttHistogram[i];
+}
+
+const string NIOUDPServerStatistics::Client::toString() const {
+	return
+		"client " + to_string(clientId) + " (" + ip + ":" + to_string(port) + "): " +
+		"received " + to_string(messagesReceived) + " msgs/" + to_string(bytesReceived) + " bytes, " +
+		"sent " + to_string(messagesSent) + " msgs/" + to_string(bytesSent) + " bytes, " +
+		"retransmits " + to_string(retransmits) + ", " +
+		"rtt " + to_string(rtt) + "ms, srtt " + to_string(rttSmoothed) + "ms, rttvar " + to_string(rttVariance) + "ms (" + to_string(rttSamples) + " samples)";
+}
+
+const string NIOUDPServerStatistics::toString(const IOThread& statistics) {
+	string result =
+		"received " + to_string(statistics.datagramsReceived) + " datagrams/" + to_string(statistics.bytesReceived) + " bytes (" + to_string(statistics.datagramsInvalid) + " invalid), " +
+		"sent " + to_string(statistics.datagramsSent) + " datagrams/" + to_string(statistics.bytesSent) + " bytes (" + to_string(statistics.sendWouldBlock) + " would block), " +
+		"acks " + to_string(statistics.acksReceived) + " (" + to_string(statistics.acksInvalid) + " invalid), " +
+		"retransmits " + to_string(statistics.retransmits) + ", " +
+		"ack timeouts " + to_string(statistics.ackTimeouts) + ", " +
+		"overflows " + to_string(statistics.messageQueueOverflows) + " queue/" + to_string(statistics.messageMapAckOverflows) + " ack, " +
+		"message queue " + to_string(statistics.messageQueueSize) + " (peak " + to_string(statistics.messageQueuePeak) + "), " +
+		"ack map " + to_string(statistics.messageMapAckSize) + ", " +
+		"rtt avg " + to_string(statistics.rttSamples == 0?0:statistics.rttSum / statistics.rttSamples) + "ms, max " + to_string(statistics.rttMax) + "ms, histogram [";
+	for (auto i = 0; i < RTT_HISTOGRAM_BUCKETS; i++) {
+		if (i > 0) result+= " ";
+		result+= (i == 0?string("0"):(i == RTT_HISTOGRAM_BUCKETS - 1?">=" + to_string(1 << (i - 1)):to_string(1 << (i - 1)))) + ":" + to_string(statistics.rttHistogram[i]);
+	}
+	result+= "]";
+	return result;
+}
+
+const string NIOUDPServerStatistics::toString() const {
+	string result =
+		"NIOUDPServerStatistics: clients " + to_string(clients) + ", " +
+		"worker queue " + to_string(workerThreadPoolQueueSize) + ", " +
+		"requests declined " + to_string(requestsDeclined) + "\n" +
+		"\ttotal: " + toString(total);
+	for (auto i = 0; i < ioThreads.size(); i++) {
+		result+= "\n\tio thread " + to_string(i) + ": " + toString(ioThreads[i]);
+	}
+	return result;
+}
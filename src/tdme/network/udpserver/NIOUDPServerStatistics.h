@@ -0,0 +1,108 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <vector>
+
+#include <tdme/network/udpserver/fwd-tdme.h>
+
+#include <tdme/tdme.h>
+
+using std::string;
+using std::vector;
+
+/**
+ * NIO udp server statistics snapshot, also used as lock free counter storage by server, IO threads and clients
+ * @author Andreas Drewke
+ */
+struct tdme::network::udpserver::NIOUDPServerStatistics {
+	static constexpr int RTT_HISTOGRAM_BUCKETS = 12;
+
+	/**
+	 * IO thread statistics
+	 */
+	struct IOThread {
+		uint64_t datagramsReceived { 0 };
+		uint64_t bytesReceived { 0 };
+		uint64_t datagramsSent { 0 };
+		uint64_t bytesSent { 0 };
+		uint64_t datagramsInvalid { 0 };
+		uint64_t acksReceived { 0 };
+		uint64_t acksInvalid { 0 };
+		uint64_t retransmits { 0 };
+		uint64_t ackTimeouts { 0 };
+		uint64_t sendWouldBlock { 0 };
+		uint64_t messageQueueOverflows { 0 };
+		uint64_t messageMapAckOverflows { 0 };
+		uint64_t messageQueueSize { 0 };
+		uint64_t messageQueuePeak { 0 };
+		uint64_t messageMapAckSize { 0 };
+		uint64_t rttSamples { 0 };
+		uint64_t rttSum { 0 };
+		uint64_t rttMax { 0 };
+		uint64_t rttHistogram[RTT_HISTOGRAM_BUCKETS] { 0 };
+
+		/**
+		 * Adds given IO thread statistics to this IO thread statistics, sizes and peaks are summed up too
+		 * @param statistics statistics
+		 */
+		void add(const IOThread& statistics);
+	};
+
+	/**
+	 * Client statistics
+	 */
+	struct Client {
+		uint32_t clientId { 0 };
+		string ip;
+		unsigned int port { 0 };
+		uint64_t messagesReceived { 0 };
+		uint64_t bytesReceived { 0 };
+		uint64_t messagesSent { 0 };
+		uint64_t bytesSent { 0 };
+		uint64_t retransmits { 0 };
+		uint64_t rttSamples { 0 };
+		uint64_t rtt { 0 };
+		uint64_t rttSmoothed { 0 };
+		uint64_t rttVariance { 0 };
+
+		/**
+		 * @return string representation
+		 */
+		const string toString() const;
+	};
+
+	int64_t time { 0 };
+	uint64_t clients { 0 };
+	uint64_t workerThreadPoolQueueSize { 0 };
+	uint64_t requestsDeclined { 0 };
+	IOThread total;
+	vector<IOThread> ioThreads;
+
+	/**
+	 * Returns RTT histogram bucket for given RTT, buckets are 0ms, 1ms, 2-3ms, 4-7ms, ..., >= 1024ms
+	 * @param rtt rtt in milliseconds
+	 * @return bucket index
+	 */
+	inline static int getRTTHistogramBucket(uint64_t rtt) {
+		auto bucket = 0;
+		while (rtt > 0 && bucket < RTT_HISTOGRAM_BUCKETS - 1) {
+			rtt>>= 1;
+			bucket++;
+		}
+		return bucket;
+	}
+
+	/**
+	 * @return string representation, used for periodic statistics dump
+	 */
+	const string toString() const;
+
+private:
+	/**
+	 * @return IO thread statistics string representation
+	 * @param statistics statistics
+	 */
+	static const string toString(const IOThread& statistics);
+};
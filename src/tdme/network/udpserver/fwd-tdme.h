@@ -10,6 +10,7 @@ namespace udpserver {
 	class NIOUDPServerClient;
 	class NIOUDPServerGroup;
 	class NIOUDPServerIOThread;
+	struct NIOUDPServerStatistics;
 } // namespace udpserver
 } // namespace network
 } // namespace tdme
@@ -2,76 +2,264 @@
 
 #include <string.h>
 
+#if defined(_WIN32)
+	#include <windows.h>
+#else
+	#include <fcntl.h>
+	#include <sys/mman.h>
+	#include <sys/stat.h>
+	#include <unistd.h>
+#endif
+
 #include <algorithm>
 #include <cassert>
-#include <fstream>
 #include <string>
 #include <vector>
 
 #include <ext/sha256/sha256.h>
 #include <ext/zlib/zlib.h>
 
-#include <tdme/math/Math.h>
 #include <tdme/os/filesystem/FileNameFilter.h>
-#include <tdme/os/threading/Mutex.h>
 #include <tdme/utils/fwd-tdme.h>
 #include <tdme/utils/StringUtils.h>
 #include <tdme/utils/StringTokenizer.h>
 #include <tdme/utils/Console.h>
 #include <tdme/utils/Exception.h>
 
-using std::ifstream;
-using std::ios;
+using std::min;
 using std::sort;
 using std::string;
 using std::to_string;
 using std::vector;
 
-using tdme::math::Math;
 using tdme::os::filesystem::ArchiveFileSystem;
-using tdme::os::threading::Mutex;
 using tdme::utils::StringUtils;
 using tdme::utils::StringTokenizer;
 using tdme::utils::Console;
 using tdme::utils::Exception;
 
-ArchiveFileSystem::ArchiveFileSystem(const string& fileName): fileName(fileName), ifsMutex("afs-ifs-mutex")
+ArchiveFileSystem::ArchiveFileSystem(const string& fileName): fileName(fileName)
 {
-	// open
-	ifs.open(fileName.c_str(), ifstream::binary);
-	if (ifs.is_open() == false) {
-		throw FileSystemException("Unable to open file for reading(" + to_string(errno) + "): " + fileName);
+	// map archive
+	mapArchive();
+
+	// read toc offset and determine format version
+	try {
+		uint64_t fileInformationOffset;
+		uint32_t magic = 0;
+		if (dataBytes >= sizeof(fileInformationOffset) + sizeof(magic)) {
+			memcpy(&magic, data + dataBytes - sizeof(magic), sizeof(magic));
+		}
+		if (magic == FORMAT_V2_MAGIC) {
+			version = 2;
+			memcpy(&fileInformationOffset, data + dataBytes - sizeof(magic) - sizeof(fileInformationOffset), sizeof(fileInformationOffset));
+			setupTOCV2(fileInformationOffset, dataBytes - sizeof(magic) - sizeof(fileInformationOffset));
+		} else {
+			if (dataBytes < sizeof(fileInformationOffset)) {
+				throw FileSystemException("Invalid archive file: " + fileName);
+			}
+			version = 1;
+			memcpy(&fileInformationOffset, data + dataBytes - sizeof(fileInformationOffset), sizeof(fileInformationOffset));
+			readTOCV1(fileInformationOffset);
+		}
+	} catch (FileSystemException& exception) {
+		unmapArchive();
+		throw;
 	}
+}
 
-	// read toc offset
-	uint64_t fileInformationOffset;
-	ifs.seekg(-static_cast<int64_t>(sizeof(fileInformationOffset)), ios::end);
-	ifs.read((char*)&fileInformationOffset, sizeof(fileInformationOffset));
-	ifs.seekg(fileInformationOffset, ios::beg);
-
-	// read toc
+void ArchiveFileSystem::readTOCV1(uint64_t tocOffset) {
+	auto tocPosition = tocOffset;
+	auto tocRead = [&](void* value, uint64_t bytes) {
+		if (tocPosition > dataBytes || bytes > dataBytes - tocPosition) {
+			throw FileSystemException("Invalid archive file: toc exceeds archive: " + fileName);
+		}
+		memcpy(value, data + tocPosition, bytes);
+		tocPosition+= bytes;
+	};
 	while (true == true) {
 		uint32_t nameSize;
-		ifs.read((char*)&nameSize, sizeof(nameSize));
+		tocRead(&nameSize, sizeof(nameSize));
 		if (nameSize == 0) break;
 
+		string name;
 		FileInformation fileInformation;
-		auto buffer = new char[nameSize];
-		ifs.read(buffer, nameSize);
-		fileInformation.name.append(buffer, nameSize);
-		delete [] buffer;
-		ifs.read((char*)&fileInformation.bytes, sizeof(fileInformation.bytes));
-		ifs.read((char*)&fileInformation.compressed, sizeof(fileInformation.compressed));
-		ifs.read((char*)&fileInformation.bytesCompressed, sizeof(fileInformation.bytesCompressed));
-		ifs.read((char*)&fileInformation.offset, sizeof(fileInformation.offset));
-		ifs.read((char*)&fileInformation.executable, sizeof(fileInformation.executable));
-		fileInformations[fileInformation.name] = fileInformation;
+		name.resize(nameSize);
+		tocRead(&name[0], nameSize);
+		tocRead(&fileInformation.bytes, sizeof(fileInformation.bytes));
+		tocRead(&fileInformation.codec, sizeof(fileInformation.codec));
+		tocRead(&fileInformation.bytesCompressed, sizeof(fileInformation.bytesCompressed));
+		tocRead(&fileInformation.offset, sizeof(fileInformation.offset));
+		tocRead(&fileInformation.executable, sizeof(fileInformation.executable));
+		fileInformation.chunkCount = 0;
+		fileInformation.chunkSize = 0;
+		fileInformation.chunkOffsets = nullptr;
+		fileInformations[name] = fileInformation;
+	}
+}
+
+void ArchiveFileSystem::setupTOCV2(uint64_t tocOffset, uint64_t tocEnd) {
+	// toc is used directly from mapped memory, so check bounds and alignment once
+	if (tocOffset > tocEnd || tocOffset % 8 != 0 || tocEnd - tocOffset < sizeof(TOCHeader)) {
+		throw FileSystemException("Invalid archive file: invalid toc: " + fileName);
+	}
+	tocHeader = reinterpret_cast<const TOCHeader*>(data + tocOffset);
+	uint64_t tocBytes =
+		sizeof(TOCHeader) +
+		static_cast<uint64_t>(tocHeader->entryCount) * sizeof(TOCEntry) +
+		tocHeader->chunkOffsetCount * sizeof(uint64_t) +
+		static_cast<uint64_t>(tocHeader->hashTableSize) * sizeof(uint32_t) +
+		tocHeader->namePoolBytes;
+	if (tocBytes > tocEnd - tocOffset ||
+		tocHeader->hashTableSize == 0 ||
+		(tocHeader->hashTableSize & (tocHeader->hashTableSize - 1)) != 0 ||
+		tocHeader->hashTableSize <= tocHeader->entryCount) {
+		throw FileSystemException("Invalid archive file: invalid toc: " + fileName);
+	}
+	auto tocData = data + tocOffset + sizeof(TOCHeader);
+	tocEntries = reinterpret_cast<const TOCEntry*>(tocData);
+	tocData+= static_cast<uint64_t>(tocHeader->entryCount) * sizeof(TOCEntry);
+	tocChunkOffsets = reinterpret_cast<const uint64_t*>(tocData);
+	tocData+= tocHeader->chunkOffsetCount * sizeof(uint64_t);
+	tocHashTable = reinterpret_cast<const uint32_t*>(tocData);
+	tocData+= static_cast<uint64_t>(tocHeader->hashTableSize) * sizeof(uint32_t);
+	tocNamePool = reinterpret_cast<const char*>(tocData);
+
+	// validate entries
+	for (uint32_t i = 0; i < tocHeader->entryCount; i++) {
+		auto& tocEntry = tocEntries[i];
+		if (static_cast<uint64_t>(tocEntry.nameOffset) + tocEntry.nameSize > tocHeader->namePoolBytes ||
+			(tocEntry.chunkCount > 0 &&
+				(tocHeader->chunkSize == 0 ||
+				tocEntry.chunkOffsetIndex + tocEntry.chunkCount + 1 > tocHeader->chunkOffsetCount ||
+				tocEntry.chunkCount != tocEntry.bytes / tocHeader->chunkSize + (tocEntry.bytes % tocHeader->chunkSize != 0?1:0)))) {
+			throw FileSystemException("Invalid archive file: invalid toc entry: " + fileName);
+		}
 	}
 }
 
 ArchiveFileSystem::~ArchiveFileSystem()
 {
-	ifs.close();
+	unmapArchive();
+}
+
+void ArchiveFileSystem::mapArchive() {
+	#if defined(_WIN32)
+		auto _fileHandle = CreateFileA(fileName.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_RANDOM_ACCESS, NULL);
+		if (_fileHandle == INVALID_HANDLE_VALUE) {
+			throw FileSystemException("Unable to open file for reading(" + to_string(GetLastError()) + "): " + fileName);
+		}
+		LARGE_INTEGER fileSize;
+		if (GetFileSizeEx(_fileHandle, &fileSize) == 0 || fileSize.QuadPart == 0) {
+			CloseHandle(_fileHandle);
+			throw FileSystemException("Unable to determine file size(" + to_string(GetLastError()) + "): " + fileName);
+		}
+		auto _fileMappingHandle = CreateFileMappingA(_fileHandle, NULL, PAGE_READONLY, 0, 0, NULL);
+		if (_fileMappingHandle == NULL) {
+			CloseHandle(_fileHandle);
+			throw FileSystemException("Unable to map file(" + to_string(GetLastError()) + "): " + fileName);
+		}
+		auto _data = MapViewOfFile(_fileMappingHandle, FILE_MAP_READ, 0, 0, 0);
+		if (_data == NULL) {
+			CloseHandle(_fileMappingHandle);
+			CloseHandle(_fileHandle);
+			throw FileSystemException("Unable to map file(" + to_string(GetLastError()) + "): " + fileName);
+		}
+		fileHandle = _fileHandle;
+		fileMappingHandle = _fileMappingHandle;
+		data = static_cast<const uint8_t*>(_data);
+		dataBytes = fileSize.QuadPart;
+	#else
+		fileDescriptor = open(fileName.c_str(), O_RDONLY);
+		if (fileDescriptor == -1) {
+			throw FileSystemException("Unable to open file for reading(" + to_string(errno) + "): " + fileName);
+		}
+		struct stat fileStat;
+		if (fstat(fileDescriptor, &fileStat) == -1 || fileStat.st_size == 0) {
+			::close(fileDescriptor);
+			fileDescriptor = -1;
+			throw FileSystemException("Unable to determine file size(" + to_string(errno) + "): " + fileName);
+		}
+		auto _data = mmap(NULL, fileStat.st_size, PROT_READ, MAP_SHARED, fileDescriptor, 0);
+		if (_data == MAP_FAILED) {
+			::close(fileDescriptor);
+			fileDescriptor = -1;
+			throw FileSystemException("Unable to map file(" + to_string(errno) + "): " + fileName);
+		}
+		data = static_cast<const uint8_t*>(_data);
+		dataBytes = fileStat.st_size;
+	#endif
+}
+
+void ArchiveFileSystem::unmapArchive() {
+	if (data == nullptr) return;
+	#if defined(_WIN32)
+		UnmapViewOfFile(data);
+		CloseHandle(static_cast<HANDLE>(fileMappingHandle));
+		CloseHandle(static_cast<HANDLE>(fileHandle));
+		fileMappingHandle = nullptr;
+		fileHandle = nullptr;
+	#else
+		munmap((void*)data, dataBytes);
+		::close(fileDescriptor);
+		fileDescriptor = -1;
+	#endif
+	data = nullptr;
+	dataBytes = 0LL;
+}
+
+bool ArchiveFileSystem::findFileInformation(const string& relativeFileName, FileInformation& fileInformation) {
+	if (version == 1) {
+		auto fileInformationIt = fileInformations.find(relativeFileName);
+		if (fileInformationIt == fileInformations.end()) return false;
+		fileInformation = fileInformationIt->second;
+		return true;
+	}
+
+	// look up hash table using linear probing
+	auto nameHash = computeNameHash(relativeFileName.data(), relativeFileName.size());
+	auto hashTableMask = tocHeader->hashTableSize - 1;
+	auto slot = static_cast<uint32_t>(nameHash) & hashTableMask;
+	// probe at most hash table size slots, as a corrupt hash table might have no empty slot
+	for (uint32_t probes = 0; probes < tocHeader->hashTableSize && tocHashTable[slot] != FORMAT_V2_HASHTABLE_EMPTY; probes++, slot = (slot + 1) & hashTableMask) {
+		auto entryIdx = tocHashTable[slot];
+		if (entryIdx >= tocHeader->entryCount) return false;
+		auto& tocEntry = tocEntries[entryIdx];
+		if (tocEntry.nameHash != nameHash ||
+			tocEntry.nameSize != relativeFileName.size() ||
+			memcmp(tocNamePool + tocEntry.nameOffset, relativeFileName.data(), tocEntry.nameSize) != 0) continue;
+		fileInformation.bytes = tocEntry.bytes;
+		fileInformation.codec = tocEntry.codec;
+		fileInformation.bytesCompressed = tocEntry.bytesCompressed;
+		fileInformation.offset = tocEntry.offset;
+		fileInformation.executable = tocEntry.executable == 1;
+		fileInformation.chunkCount = tocEntry.chunkCount;
+		fileInformation.chunkSize = tocHeader->chunkSize;
+		fileInformation.chunkOffsets = tocEntry.chunkCount > 0?tocChunkOffsets + tocEntry.chunkOffsetIndex:nullptr;
+		return true;
+	}
+	return false;
+}
+
+ArchiveFileSystem::FileInformation ArchiveFileSystem::getFileInformation(const string& pathName, const string& fileName) {
+	// compose relative file name and remove ./
+	auto relativeFileName = pathName + "/" + fileName;
+	if (StringUtils::startsWith(relativeFileName, "./")  == true) relativeFileName = StringUtils::substring(relativeFileName, 2);
+
+	// determine file
+	FileInformation fileInformation;
+	if (findFileInformation(relativeFileName, fileInformation) == false) {
+		throw FileSystemException("Unable to open file for reading: " + relativeFileName + ": " + pathName + "/" + fileName);
+	}
+	return fileInformation;
+}
+
+const uint8_t* ArchiveFileSystem::getFileData(const FileInformation& fileInformation) {
+	auto bytes = fileInformation.codec != CODEC_NONE?fileInformation.bytesCompressed:fileInformation.bytes;
+	if (fileInformation.offset > dataBytes || bytes > dataBytes - fileInformation.offset) {
+		throw FileSystemException("Invalid archive file: file exceeds archive: " + fileName);
+	}
+	return data + fileInformation.offset;
 }
 
 const string& ArchiveFileSystem::getArchiveFileName() {
@@ -87,20 +275,23 @@ void ArchiveFileSystem::list(const string& pathName, vector<string>& files, File
 	// TODO: this currently lists all files beginning from given path, also files in sub folders
 	auto _pathName = pathName;
 	if (_pathName.empty() == false && StringUtils::endsWith(pathName, "/") == false) _pathName+= "/";
-	for (auto& fileInformationIt: fileInformations) {
-		auto fileName = fileInformationIt.second.name;
-		if (StringUtils::startsWith(fileName, _pathName) == true) {
-			try {
-				if (filter != nullptr && filter->accept(
-					getPathName(fileName),
-					getFileName(fileName)
-				) == false) continue;
-			} catch (Exception& exception) {
-				Console::println("StandardFileSystem::list(): Filter::accept(): " + pathName + "/" + fileName + ": " + exception.what());
-				continue;
-			}
-			files.push_back(StringUtils::substring(fileName, pathName.size()));
+	auto listFile = [&](const string& fileName) {
+		if (StringUtils::startsWith(fileName, _pathName) == false) return;
+		try {
+			if (filter != nullptr && filter->accept(
+				getPathName(fileName),
+				getFileName(fileName)
+			) == false) return;
+		} catch (Exception& exception) {
+			Console::println("StandardFileSystem::list(): Filter::accept(): " + pathName + "/" + fileName + ": " + exception.what());
+			return;
 		}
+		files.push_back(StringUtils::substring(fileName, pathName.size()));
+	};
+	if (version == 1) {
+		for (auto& fileInformationIt: fileInformations) listFile(fileInformationIt.first);
+	} else {
+		for (uint32_t i = 0; i < tocHeader->entryCount; i++) listFile(string(tocNamePool + tocEntries[i].nameOffset, tocEntries[i].nameSize));
 	}
 	sort(files.begin(), files.end());
 }
@@ -119,22 +310,12 @@ bool ArchiveFileSystem::fileExists(const string& fileName) {
 	if (StringUtils::startsWith(relativeFileName, "./")  == true) relativeFileName = StringUtils::substring(relativeFileName, 2);
 
 	//
-	return fileInformations.find(relativeFileName) != fileInformations.end();
+	FileInformation fileInformation;
+	return findFileInformation(relativeFileName, fileInformation);
 }
 
 bool ArchiveFileSystem::isExecutable(const string& pathName, const string& fileName) {
-	// compose relative file name and remove ./
-	auto relativeFileName = pathName + "/" + fileName;
-	if (StringUtils::startsWith(relativeFileName, "./")  == true) relativeFileName = StringUtils::substring(relativeFileName, 2);
-
-	// determine file
-	auto fileInformationIt = fileInformations.find(relativeFileName);
-	if (fileInformationIt == fileInformations.end()) {
-		throw FileSystemException("Unable to open file for reading: " + relativeFileName + ": " + pathName + "/" + fileName);
-	}
-	auto& fileInformation = fileInformationIt->second;
-	//
-	return fileInformation.executable;
+	return getFileInformation(pathName, fileName).executable;
 }
 
 void ArchiveFileSystem::setExecutable(const string& pathName, const string& fileName) {
@@ -142,30 +323,17 @@ void ArchiveFileSystem::setExecutable(const string& pathName, const string& file
 }
 
 uint64_t ArchiveFileSystem::getFileSize(const string& pathName, const string& fileName) {
-	// compose relative file name and remove ./
-	auto relativeFileName = pathName + "/" + fileName;
-	if (StringUtils::startsWith(relativeFileName, "./")  == true) relativeFileName = StringUtils::substring(relativeFileName, 2);
-
-	// determine file
-	auto fileInformationIt = fileInformations.find(relativeFileName);
-	if (fileInformationIt == fileInformations.end()) {
-		throw FileSystemException("Unable to open file for reading: " + relativeFileName + ": " + pathName + "/" + fileName);
-	}
-	auto& fileInformation = fileInformationIt->second;
-	//
-	return fileInformation.bytes;
+	return getFileInformation(pathName, fileName).bytes;
 }
 
-void ArchiveFileSystem::decompress(vector<uint8_t>& inContent, vector<uint8_t>& outContent) {
+void ArchiveFileSystem::decompress(const uint8_t* inContent, uint64_t inBytes, uint8_t* outContent, uint64_t outBytes) {
 	// see: https://www.zlib.net/zpipe.c
-
-	#define CHUNK	16384
+	//	we inflate straight from memory mapped archive into out content, so we do not need any intermediate buffers
+	//	z_stream uses 32 bit sizes, so we feed it in chunks of 1GB at most
+	const uint64_t CHUNK = 1024LL * 1024LL * 1024LL;
 
 	int ret;
-	size_t have;
 	z_stream strm;
-	unsigned char in[CHUNK];
-	unsigned char out[CHUNK];
 
 	// allocate inflate state
 	strm.zalloc = Z_NULL;
@@ -178,42 +346,35 @@ void ArchiveFileSystem::decompress(vector<uint8_t>& inContent, vector<uint8_t>&
 		throw FileSystemException("ArchiveFileSystem::decompress(): Error while decompressing: inflate init");
 	}
 
-	// decompress until deflate stream ends or end of file */
-	size_t outPosition = 0;
-	size_t inPosition = 0;
-	size_t inBytes = inContent.size();
+	// decompress until deflate stream ends or end of input
+	uint64_t inPosition = 0;
+	uint64_t outPosition = 0;
 	do {
-		// see: https://www.zlib.net/zpipe.c
-		auto inStartPosition = inPosition;
-		for (size_t i = 0; i < CHUNK; i++) {
+		if (strm.avail_in == 0) {
 			if (inPosition == inBytes) break;
-			in[i] = inContent[inPosition];
-			inPosition++;
+			strm.avail_in = min(inBytes - inPosition, CHUNK);
+			strm.next_in = (Bytef*)(inContent + inPosition);
+			inPosition+= strm.avail_in;
 		}
-		strm.avail_in = inPosition - inStartPosition;
-		if (strm.avail_in == 0) break;
-		strm.next_in = in;
-
-		// run inflate() on input until output buffer not full
-		do {
-			strm.avail_out = CHUNK;
-			strm.next_out = out;
-			ret = inflate(&strm, Z_NO_FLUSH);
-			assert(ret != Z_STREAM_ERROR); // state not clobbered
-			switch (ret) {
-				case Z_NEED_DICT:
-					throw FileSystemException("ArchiveFileSystem::decompress(): Error while decompressing: Z_NEED_DICT");
-				case Z_DATA_ERROR:
-				case Z_MEM_ERROR:
-					(void)inflateEnd(&strm);
-					throw FileSystemException("ArchiveFileSystem::decompress(): Error while decompressing: Z_DATA_ERROR | Z_MEM_ERROR");
-			}
-			have = CHUNK - strm.avail_out;
-			for (size_t i = 0; i < have; i++) {
-				outContent[outPosition++] = out[i];
-			}
-		} while (strm.avail_out == 0);
-
+		if (outPosition == outBytes) {
+			(void)inflateEnd(&strm);
+			throw FileSystemException("ArchiveFileSystem::decompress(): Error while decompressing: decompressed data exceeds file size");
+		}
+		auto outChunk = min(outBytes - outPosition, CHUNK);
+		strm.avail_out = outChunk;
+		strm.next_out = (Bytef*)(outContent + outPosition);
+		ret = inflate(&strm, Z_NO_FLUSH);
+		assert(ret != Z_STREAM_ERROR); // state not clobbered
+		switch (ret) {
+			case Z_NEED_DICT:
+				(void)inflateEnd(&strm);
+				throw FileSystemException("ArchiveFileSystem::decompress(): Error while decompressing: Z_NEED_DICT");
+			case Z_DATA_ERROR:
+			case Z_MEM_ERROR:
+				(void)inflateEnd(&strm);
+				throw FileSystemException("ArchiveFileSystem::decompress(): Error while decompressing: Z_DATA_ERROR | Z_MEM_ERROR");
+		}
+		outPosition+= outChunk - strm.avail_out;
 		// done when inflate() says it's done
 	} while (ret != Z_STREAM_END);
 
@@ -226,44 +387,47 @@ void ArchiveFileSystem::decompress(vector<uint8_t>& inContent, vector<uint8_t>&
 	}
 }
 
-const string ArchiveFileSystem::getContentAsString(const string& pathName, const string& fileName) {
-	// compose relative file name and remove ./
-	auto relativeFileName = pathName + "/" + fileName;
-	if (StringUtils::startsWith(relativeFileName, "./")  == true) relativeFileName = StringUtils::substring(relativeFileName, 2);
-
-	// determine file
-	auto fileInformationIt = fileInformations.find(relativeFileName);
-	if (fileInformationIt == fileInformations.end()) {
-		throw FileSystemException("Unable to open file for reading: " + relativeFileName + ": " + pathName + "/" + fileName);
+uint64_t ArchiveFileSystem::decodeChunk(const FileInformation& fileInformation, const uint8_t* fileData, uint32_t chunkIdx, uint8_t* outContent) {
+	auto chunkOffset = static_cast<uint64_t>(chunkIdx) * fileInformation.chunkSize;
+	if (chunkIdx >= fileInformation.chunkCount || chunkOffset >= fileInformation.bytes) {
+		throw FileSystemException("Invalid archive file: invalid chunk: " + fileName);
 	}
-	auto& fileInformation = fileInformationIt->second;
-
-	//
-	ifsMutex.lock();
-
-	// seek
-	ifs.seekg(fileInformation.offset, ios::beg);
+	auto chunkBytes = min(static_cast<uint64_t>(fileInformation.chunkSize), fileInformation.bytes - chunkOffset);
+	auto chunkCompressedOffset = fileInformation.chunkOffsets[chunkIdx];
+	auto chunkCompressedEnd = fileInformation.chunkOffsets[chunkIdx + 1];
+	if (chunkCompressedOffset > chunkCompressedEnd || chunkCompressedEnd > fileInformation.bytesCompressed) {
+		throw FileSystemException("Invalid archive file: invalid chunk: " + fileName);
+	}
+	decompress(fileData + chunkCompressedOffset, chunkCompressedEnd - chunkCompressedOffset, outContent, chunkBytes);
+	return chunkBytes;
+}
 
-	// result
-	string result;
-	if (fileInformation.compressed == 1) {
-		vector<uint8_t> compressedBuffer;
-		compressedBuffer.resize(fileInformation.bytesCompressed);
-		ifs.read((char*)compressedBuffer.data(), fileInformation.bytesCompressed);
-		ifsMutex.unlock();
-		vector<uint8_t> decompressedBuffer;
-		decompressedBuffer.resize(fileInformation.bytes);
-		decompress(compressedBuffer, decompressedBuffer);
-		result.append((char*)decompressedBuffer.data(), fileInformation.bytes);
-	} else {
-		vector<uint8_t> buffer;
-		buffer.resize(fileInformation.bytes);
-		ifs.read((char*)buffer.data(), fileInformation.bytes);
-		ifsMutex.unlock();
-		result.append((char*)buffer.data(), fileInformation.bytes);
+void ArchiveFileSystem::decode(const FileInformation& fileInformation, uint8_t* outContent) {
+	auto fileData = getFileData(fileInformation);
+	switch (fileInformation.codec) {
+		case CODEC_NONE:
+			memcpy(outContent, fileData, fileInformation.bytes);
+			break;
+		case CODEC_DEFLATE:
+			if (fileInformation.bytes == 0) break;
+			if (fileInformation.chunkCount == 0) {
+				decompress(fileData, fileInformation.bytesCompressed, outContent, fileInformation.bytes);
+			} else {
+				for (uint32_t i = 0; i < fileInformation.chunkCount; i++) {
+					decodeChunk(fileInformation, fileData, i, outContent + static_cast<uint64_t>(i) * fileInformation.chunkSize);
+				}
+			}
+			break;
+		default:
+			throw FileSystemException("ArchiveFileSystem::decode(): Unsupported codec: " + to_string(fileInformation.codec));
 	}
+}
 
-	// done
+const string ArchiveFileSystem::getContentAsString(const string& pathName, const string& fileName) {
+	auto fileInformation = getFileInformation(pathName, fileName);
+	string result;
+	result.resize(fileInformation.bytes);
+	if (fileInformation.bytes > 0) decode(fileInformation, (uint8_t*)&result[0]);
 	return result;
 }
 
@@ -273,35 +437,46 @@ void ArchiveFileSystem::setContentFromString(const string& pathName, const strin
 
 void ArchiveFileSystem::getContent(const string& pathName, const string& fileName, vector<uint8_t>& content)
 {
-	// compose relative file name and remove ./
-	auto relativeFileName = pathName + "/" + fileName;
-	if (StringUtils::startsWith(relativeFileName, "./")  == true) relativeFileName = StringUtils::substring(relativeFileName, 2);
+	auto fileInformation = getFileInformation(pathName, fileName);
+	content.resize(fileInformation.bytes);
+	if (fileInformation.bytes > 0) decode(fileInformation, content.data());
+}
 
-	// determine file
-	auto fileInformationIt = fileInformations.find(relativeFileName);
-	if (fileInformationIt == fileInformations.end()) {
-		throw FileSystemException("Unable to open file for reading: " + relativeFileName + ": " + pathName + "/" + fileName);
-	}
-	auto& fileInformation = fileInformationIt->second;
+const uint8_t* ArchiveFileSystem::getContentView(const string& pathName, const string& fileName, uint64_t& bytes) {
+	auto fileInformation = getFileInformation(pathName, fileName);
+	bytes = fileInformation.bytes;
+	if (fileInformation.codec != CODEC_NONE) return nullptr;
+	return getFileData(fileInformation);
+}
 
-	//
-	ifsMutex.lock();
-
-	// seek
-	ifs.seekg(fileInformation.offset, ios::beg);
-
-	// result
-	if (fileInformation.compressed == 1) {
-		vector<uint8_t> compressedContent;
-		compressedContent.resize(fileInformation.bytesCompressed);
-		ifs.read((char*)compressedContent.data(), fileInformation.bytesCompressed);
-		ifsMutex.unlock();
-		content.resize(fileInformation.bytes);
-		decompress(compressedContent, content);
+void ArchiveFileSystem::getContentRange(const string& pathName, const string& fileName, uint64_t offset, uint64_t bytes, vector<uint8_t>& content) {
+	auto fileInformation = getFileInformation(pathName, fileName);
+	if (offset > fileInformation.bytes) offset = fileInformation.bytes;
+	bytes = min(bytes, fileInformation.bytes - offset);
+	content.resize(bytes);
+	if (bytes == 0) return;
+	auto fileData = getFileData(fileInformation);
+	if (fileInformation.codec == CODEC_NONE) {
+		memcpy(content.data(), fileData + offset, bytes);
+	} else
+	if (fileInformation.codec == CODEC_DEFLATE && fileInformation.chunkCount > 0) {
+		// only decode chunks that overlap requested range
+		vector<uint8_t> chunk(fileInformation.chunkSize);
+		auto firstChunkIdx = static_cast<uint32_t>(offset / fileInformation.chunkSize);
+		auto lastChunkIdx = static_cast<uint32_t>((offset + bytes - 1) / fileInformation.chunkSize);
+		uint64_t contentPosition = 0;
+		for (auto i = firstChunkIdx; i <= lastChunkIdx; i++) {
+			auto chunkOffset = static_cast<uint64_t>(i) * fileInformation.chunkSize;
+			auto chunkBytes = decodeChunk(fileInformation, fileData, i, chunk.data());
+			uint64_t copyOffset = offset > chunkOffset?offset - chunkOffset:0LL;
+			auto copyBytes = min(chunkBytes - copyOffset, bytes - contentPosition);
+			memcpy(content.data() + contentPosition, chunk.data() + copyOffset, copyBytes);
+			contentPosition+= copyBytes;
+		}
 	} else {
-		content.resize(fileInformation.bytes);
-		ifs.read((char*)content.data(), fileInformation.bytes);
-		ifsMutex.unlock();
+		vector<uint8_t> decodedContent(fileInformation.bytes);
+		decode(fileInformation, decodedContent.data());
+		memcpy(content.data(), decodedContent.data() + offset, bytes);
 	}
 }
 
@@ -414,21 +589,15 @@ void ArchiveFileSystem::removeFile(const string& pathName, const string& fileNam
 }
 
 const string ArchiveFileSystem::computeSHA256Hash() {
-	ifs.seekg(0, ios::end);
-	auto bytesTotal = ifs.tellg();
-	ifs.seekg(0, ios::beg);
-
-	uint8_t input[16384];
 	unsigned char digest[SHA256::DIGEST_SIZE];
 	memset(digest, 0, SHA256::DIGEST_SIZE);
 
 	SHA256 ctx = SHA256();
 	ctx.init();
-	auto bytesRead = 0LL;
-	while (bytesRead < bytesTotal) {
-		auto bytesToRead = Math::min(static_cast<int64_t>(bytesTotal - bytesRead), sizeof(input));
-		ifs.read((char*)input, bytesToRead);
-		ctx.update((const uint8_t*)input, bytesToRead);
+	uint64_t bytesRead = 0LL;
+	while (bytesRead < dataBytes) {
+		auto bytesToRead = min(dataBytes - bytesRead, static_cast<uint64_t>(16384));
+		ctx.update(data + bytesRead, bytesToRead);
 		bytesRead+= bytesToRead;
 	}
 	ctx.final(digest);
@@ -1,6 +1,5 @@
 #pragma once
 
-#include <fstream>
 #include <map>
 #include <string>
 #include <vector>
@@ -8,45 +7,185 @@
 #include <tdme/tdme.h>
 #include <tdme/os/filesystem/fwd-tdme.h>
 #include <tdme/os/filesystem/FileSystemInterface.h>
-#include <tdme/os/threading/Mutex.h>
 #include <tdme/utils/fwd-tdme.h>
 
-using std::ifstream;
 using std::map;
 using std::string;
 using std::vector;
 
 using tdme::os::filesystem::FileNameFilter;
 using tdme::os::filesystem::FileSystemInterface;
-using tdme::os::threading::Mutex;
 
 /**
  * Archive file system implementation
+ * The archive is memory mapped read only, so concurrent readers do not need any locking
+ *
+ * Format version 1 stores a zlib compressed file content per entry and a table of contents of variable size entries.
+ * Format version 2 stores per entry codecs, optionally split into independently compressed chunks for partial reads,
+ * and a table of contents of fixed size entries with a name hash table, which is used directly from mapped memory.
+ * Version 2 archives are identified by a trailing magic after the table of contents offset.
  * @author Andreas Drewke
  */
 class tdme::os::filesystem::ArchiveFileSystem final: public FileSystemInterface
 {
+public:
+	/**
+	 * Per entry codecs
+	 */
+	enum Codec { CODEC_NONE = 0, CODEC_DEFLATE = 1 };
+
+	static constexpr uint32_t FORMAT_V2_MAGIC = 0x32414454; // "TDA2"
+	static constexpr uint32_t FORMAT_V2_HASHTABLE_EMPTY = 0xFFFFFFFF;
+
+	/**
+	 * Format version 2 table of contents header, followed by entries, chunk offsets, hash table and name pool
+	 */
+	struct TOCHeader {
+		uint32_t entryCount;
+		uint32_t hashTableSize;
+		uint32_t chunkSize;
+		uint32_t reserved;
+		uint64_t chunkOffsetCount;
+		uint64_t namePoolBytes;
+	};
+
+	/**
+	 * Format version 2 table of contents entry
+	 * If an entry is chunked its chunk offsets, relative to entry offset, are stored at chunkOffsetIndex, including the end offset
+	 */
+	struct TOCEntry {
+		uint64_t nameHash;
+		uint64_t bytes;
+		uint64_t bytesCompressed;
+		uint64_t offset;
+		uint64_t chunkOffsetIndex;
+		uint32_t nameOffset;
+		uint32_t nameSize;
+		uint32_t chunkCount;
+		uint8_t codec;
+		uint8_t executable;
+		uint8_t padding[2];
+	};
+
+	/**
+	 * Computes file name hash used in format version 2 table of contents (FNV-1a)
+	 * @param name name
+	 * @param size name size
+	 * @return hash
+	 */
+	inline static uint64_t computeNameHash(const char* name, size_t size) {
+		uint64_t hash = 14695981039346656037ULL;
+		for (size_t i = 0; i < size; i++) {
+			hash^= static_cast<uint8_t>(name[i]);
+			hash*= 1099511628211ULL;
+		}
+		return hash;
+	}
+
 private:
 	struct FileInformation {
-		string name;
 		uint64_t bytes;
-		uint8_t compressed;
+		uint8_t codec;
 		uint64_t bytesCompressed;
 		uint64_t offset;
 		bool executable;
+		uint32_t chunkCount;
+		uint32_t chunkSize;
+		const uint64_t* chunkOffsets;
 	};
 	string fileName;
-	Mutex ifsMutex;
-	ifstream ifs;
+	void* fileHandle { nullptr };
+	void* fileMappingHandle { nullptr };
+	int fileDescriptor { -1 };
+	const uint8_t* data { nullptr };
+	uint64_t dataBytes { 0LL };
+	int version { 1 };
 	map<string, FileInformation> fileInformations;
+	const TOCHeader* tocHeader { nullptr };
+	const TOCEntry* tocEntries { nullptr };
+	const uint64_t* tocChunkOffsets { nullptr };
+	const uint32_t* tocHashTable { nullptr };
+	const char* tocNamePool { nullptr };
+
+	/**
+	 * Map archive file into memory
+	 * @throws tdme::os::filesystem::FileSystemException
+	 */
+	void mapArchive();
+
+	/**
+	 * Unmap archive file from memory
+	 */
+	void unmapArchive();
+
+	/**
+	 * Read format version 1 table of contents
+	 * @param tocOffset table of contents offset
+	 * @throws tdme::os::filesystem::FileSystemException
+	 */
+	void readTOCV1(uint64_t tocOffset);
+
+	/**
+	 * Set up format version 2 table of contents, which is used directly from mapped memory
+	 * @param tocOffset table of contents offset
+	 * @param tocEnd table of contents end
+	 * @throws tdme::os::filesystem::FileSystemException
+	 */
+	void setupTOCV2(uint64_t tocOffset, uint64_t tocEnd);
+
+	/**
+	 * Find file information of given relative file name
+	 * @param relativeFileName relative file name
+	 * @param fileInformation file information
+	 * @return success
+	 */
+	bool findFileInformation(const string& relativeFileName, FileInformation& fileInformation);
+
+	/**
+	 * Returns file information of given file
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @throws tdme::os::filesystem::FileSystemException
+	 * @return file information
+	 */
+	FileInformation getFileInformation(const string& pathName, const string& fileName);
+
+	/**
+	 * Decode chunk of given file into given buffer
+	 * @param fileInformation file information
+	 * @param fileData file data
+	 * @param chunkIdx chunk index
+	 * @param outContent out content, needs to hold at least chunk size bytes
+	 * @throws tdme::os::filesystem::FileSystemException
+	 * @return decoded bytes
+	 */
+	uint64_t decodeChunk(const FileInformation& fileInformation, const uint8_t* fileData, uint32_t chunkIdx, uint8_t* outContent);
+
+	/**
+	 * Decode file content into given buffer
+	 * @param fileInformation file information
+	 * @param outContent out content, needs to hold file bytes
+	 * @throws tdme::os::filesystem::FileSystemException
+	 */
+	void decode(const FileInformation& fileInformation, uint8_t* outContent);
+
+	/**
+	 * Returns file data within memory mapped archive and validates it against archive bounds
+	 * @param fileInformation file information
+	 * @throws tdme::os::filesystem::FileSystemException
+	 * @return file data
+	 */
+	const uint8_t* getFileData(const FileInformation& fileInformation);
 
 	/**
 	 * Decompress from archive
 	 * @param inContent compressed content
+	 * @param inBytes compressed content bytes
 	 * @param outContent uncompressed out content
+	 * @param outBytes uncompressed out content bytes
 	 * @throws tdme::os::filesystem::FileSystemException
 	 */
-	void decompress(vector<uint8_t>& inContent, vector<uint8_t>& outContent);
+	void decompress(const uint8_t* inContent, uint64_t inBytes, uint8_t* outContent, uint64_t outBytes);
 
 public:
 	/**
@@ -54,6 +193,35 @@ public:
 	 */
 	const string& getArchiveFileName();
 
+	/**
+	 * Returns a zero copy view of uncompressed file content within the memory mapped archive
+	 * The view stays valid as long as this archive file system exists
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param bytes bytes of file content
+	 * @throws tdme::os::filesystem::FileSystemException
+	 * @return file content or nullptr if file is stored compressed, use getContent() in this case
+	 */
+	const uint8_t* getContentView(const string& pathName, const string& fileName, uint64_t& bytes);
+
+	/**
+	 * Read a range of file content, chunked files only decode chunks overlapping the range
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param offset offset within file content
+	 * @param bytes bytes to read, will be clamped to file size
+	 * @param content content
+	 * @throws tdme::os::filesystem::FileSystemException
+	 */
+	void getContentRange(const string& pathName, const string& fileName, uint64_t offset, uint64_t bytes, vector<uint8_t>& content) override;
+
+	/**
+	 * @return archive format version
+	 */
+	inline int getVersion() {
+		return version;
+	}
+
 	// overriden methods
 	const string getFileName(const string& path, const string& fileName) override;
 	void list(const string& pathName, vector<string>& files, FileNameFilter* filter = nullptr, bool addDrives = false) override;
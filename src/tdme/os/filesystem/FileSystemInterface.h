@@ -71,6 +71,17 @@ struct tdme::os::filesystem::FileSystemInterface
 	 */
 	virtual void getContent(const string& pathName, const string& fileName, vector<uint8_t>& content) = 0;
 
+	/**
+	 * Get a range of file content
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param offset offset within file content
+	 * @param bytes bytes to read, will be clamped to file size
+	 * @param content content vector
+	 * @throws tdme::os::filesystem::FileSystemException
+	 */
+	virtual void getContentRange(const string& pathName, const string& fileName, uint64_t offset, uint64_t bytes, vector<uint8_t>& content) = 0;
+
 	/** 
 	 * Set file content
 	 * @param pathName path name
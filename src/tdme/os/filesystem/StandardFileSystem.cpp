@@ -180,6 +180,22 @@ void StandardFileSystem::getContent(const string& pathName, const string& fileNa
 	ifs.close();
 }
 
+void StandardFileSystem::getContentRange(const string& pathName, const string& fileName, uint64_t offset, uint64_t bytes, vector<uint8_t>& content)
+{
+	ifstream ifs(getFileName(pathName, fileName).c_str(), ifstream::binary);
+	if (ifs.is_open() == false) {
+		throw FileSystemException("Unable to open file for reading(" + to_string(errno) + "): " + pathName + "/" + fileName);
+	}
+	ifs.seekg( 0, ios::end );
+	uint64_t size = ifs.tellg();
+	if (offset > size) offset = size;
+	if (bytes > size - offset) bytes = size - offset;
+	content.resize(bytes);
+	ifs.seekg(offset, ios::beg);
+	ifs.read((char*)content.data(), bytes);
+	ifs.close();
+}
+
 void StandardFileSystem::setContent(const string& pathName, const string& fileName, const vector<uint8_t>& content) {
 	ofstream ofs(getFileName(pathName, fileName).c_str(), ofstream::binary);
 	if (ofs.is_open() == false) {
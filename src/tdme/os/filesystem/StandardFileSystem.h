@@ -33,6 +33,7 @@ public:
 	const string getContentAsString(const string& pathName, const string& fileName) override;
 	void setContentFromString(const string& pathName, const string& fileName, const string& content) override;
 	void getContent(const string& pathName, const string& fileName, vector<uint8_t>& content) override;
+	void getContentRange(const string& pathName, const string& fileName, uint64_t offset, uint64_t bytes, vector<uint8_t>& content) override;
 	void setContent(const string& pathName, const string& fileName, const vector<uint8_t>& content) override;
 	void getContentAsStringArray(const string& pathName, const string& fileName, vector<string>& content) override;
 	void setContentFromStringArray(const string& pathName, const string& fileName, const vector<string>& content) override;
@@ -0,0 +1,71 @@
+#pragma once
+
+#include <stdint.h>
+
+#if defined(_WIN32) && defined(_MSC_VER)
+	#include <windows.h>
+#endif
+
+#include <tdme/os/threading/fwd-tdme.h>
+
+/**
+ * Lock free atomic operations on 64 bit integers, used e.g. for statistics counters
+ * @author Andreas Drewke
+ */
+class tdme::os::threading::AtomicOperations {
+public:
+	/**
+	 * Atomically adds given value
+	 * @param value value
+	 * @param add value to add
+	 * @return new value
+	 */
+	inline static uint64_t add(volatile uint64_t& value, const uint64_t add = 1) {
+		#if defined(_WIN32) && defined(_MSC_VER)
+			return (uint64_t)InterlockedExchangeAdd64((volatile LONG64*)&value, (LONG64)add) + add;
+		#else
+			return __sync_add_and_fetch(&value, add);
+		#endif
+	}
+
+	/**
+	 * Atomically loads given value
+	 * @param value value
+	 * @return value
+	 */
+	inline static uint64_t load(volatile uint64_t& value) {
+		#if defined(_WIN32) && defined(_MSC_VER)
+			return (uint64_t)InterlockedCompareExchange64((volatile LONG64*)&value, 0, 0);
+		#else
+			return __sync_add_and_fetch(&value, 0);
+		#endif
+	}
+
+	/**
+	 * Atomically sets value to desired if it currently equals expected
+	 * @param value value
+	 * @param expected expected value
+	 * @param desired desired value
+	 * @return if value has been set
+	 */
+	inline static bool compareAndSwap(volatile uint64_t& value, const uint64_t expected, const uint64_t desired) {
+		#if defined(_WIN32) && defined(_MSC_VER)
+			return (uint64_t)InterlockedCompareExchange64((volatile LONG64*)&value, (LONG64)desired, (LONG64)expected) == expected;
+		#else
+			return __sync_bool_compare_and_swap(&value, expected, desired);
+		#endif
+	}
+
+	/**
+	 * Atomically raises value to given candidate if candidate is greater
+	 * @param value value
+	 * @param candidate candidate
+	 */
+	inline static void max(volatile uint64_t& value, const uint64_t candidate) {
+		uint64_t current = load(value);
+		while (candidate > current && compareAndSwap(value, current, candidate) == false) {
+			current = load(value);
+		}
+	}
+
+};
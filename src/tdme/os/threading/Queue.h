@@ -91,6 +91,17 @@ public:
 		return true;
 	}
 
+	/**
+	 * @brief Returns number of elements currently in queue
+	 * @return element count
+	 */
+	unsigned int getElementCount() {
+		m.lock();
+		unsigned int elementCount = data.size();
+		m.unlock();
+		return elementCount;
+	}
+
 protected:
 	typedef queue<T*> QueueType;
 	QueueType data;
@@ -4,6 +4,7 @@
 namespace tdme {
 namespace os {
 namespace threading {
+		class AtomicOperations;
 		class Barrier;
 		class Condition;
 		class Mutex;
@@ -0,0 +1,7 @@
+#include <tdme/tests/LightClustersTest.h>
+
+int main(int argc, char** argv)
+{
+	::tdme::tests::LightClustersTest::main();
+	return 0;
+}
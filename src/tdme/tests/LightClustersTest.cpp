@@ -0,0 +1,255 @@
+#include <tdme/tests/LightClustersTest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tdme/engine/Light.h>
+#include <tdme/engine/model/Color4.h>
+#include <tdme/engine/subsystems/lighting/LightClusters.h>
+#include <tdme/engine/subsystems/lighting/LightClustersStatistics.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/math/Vector4.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/Time.h>
+
+using std::find;
+using std::mt19937;
+using std::string;
+using std::to_string;
+using std::uniform_real_distribution;
+using std::vector;
+
+using tdme::engine::Light;
+using tdme::engine::model::Color4;
+using tdme::engine::subsystems::lighting::LightClusters;
+using tdme::engine::subsystems::lighting::LightClustersStatistics;
+using tdme::math::Matrix4x4;
+using tdme::math::Vector3;
+using tdme::math::Vector4;
+using tdme::tests::LightClustersTest;
+using tdme::utils::Console;
+using tdme::utils::Time;
+
+namespace {
+	constexpr float Z_NEAR { 0.1f };
+	constexpr float Z_FAR { 150.0f };
+
+	Matrix4x4 createProjectionMatrix() {
+		// perspective projection with 90 degrees field of view and aspect ratio of 2
+		auto aspect = 2.0f;
+		return Matrix4x4(
+			1.0f / aspect, 0.0f, 0.0f, 0.0f,
+			0.0f, 1.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, (Z_FAR + Z_NEAR) / (Z_NEAR - Z_FAR), -1.0f,
+			0.0f, 0.0f, 2.0f * Z_FAR * Z_NEAR / (Z_NEAR - Z_FAR), 0.0f
+		);
+	}
+
+	Light createLight(const Vector3& position, float quadraticAttenuation) {
+		Light light;
+		light.setEnabled(true);
+		light.setPosition(Vector4(position.getX(), position.getY(), position.getZ(), 1.0f));
+		light.setDiffuse(Color4(1.0f, 1.0f, 1.0f, 1.0f));
+		light.setSpecular(Color4(0.5f, 0.5f, 0.5f, 1.0f));
+		light.setQuadraticAttenuation(quadraticAttenuation);
+		return light;
+	}
+
+	bool isLightInCluster(LightClusters& lightClusters, int32_t clusterIdx, int32_t lightIdx) {
+		auto& clusterData = lightClusters.getClusterData();
+		auto& lightIndexData = lightClusters.getLightIndexData();
+		auto begin = lightIndexData.begin() + clusterData[clusterIdx * 2 + 0];
+		auto end = begin + clusterData[clusterIdx * 2 + 1];
+		return find(begin, end, lightIdx) != end;
+	}
+
+	void bin(LightClusters& lightClusters, const Matrix4x4& projectionMatrix, const vector<Light>& lights) {
+		lightClusters.update(projectionMatrix, Matrix4x4().identity(), Z_NEAR, Z_FAR, lights);
+		lightClusters.binLightsFunction(1, 0);
+		lightClusters.collectLights();
+	}
+}
+
+LightClustersTest::LightClustersTest()
+{
+}
+
+void LightClustersTest::main()
+{
+	auto lct = new LightClustersTest();
+	Console::println(string("Light clusters tests:"));
+	lct->testBinning();
+	lct->testConservativeBinning();
+	lct->testMultithreadedBinning();
+	lct->testPerformance();
+	delete lct;
+}
+
+void LightClustersTest::printResult(const string& test, bool result) {
+	Console::println(test + ": " + (result == true?success:fail));
+}
+
+void LightClustersTest::testBinning()
+{
+	Console::println(string("\nBinning\n-------"));
+
+	auto projectionMatrix = createProjectionMatrix();
+	LightClusters lightClusters(nullptr);
+	LightClustersStatistics statistics;
+
+	// light in front of camera with a range of about 4
+	vector<Light> lights;
+	lights.push_back(createLight(Vector3(0.0f, 0.0f, -10.0f), 16.0f));
+	bin(lightClusters, projectionMatrix, lights);
+	printResult("light data", lightClusters.getLightCount() == 1 && lightClusters.getLightData().size() == LightClusters::LIGHT_TEXELS * 4);
+	printResult("light in cluster at light position", isLightInCluster(lightClusters, lightClusters.getClusterIdx(0.0f, 0.0f, 10.0f), 0) == true);
+	printResult("light in cluster within light range", isLightInCluster(lightClusters, lightClusters.getClusterIdx(0.0f, 0.0f, 13.0f), 0) == true);
+	printResult("light not in cluster behind light range", isLightInCluster(lightClusters, lightClusters.getClusterIdx(0.0f, 0.0f, 50.0f), 0) == false);
+	printResult("light not in cluster beside light range", isLightInCluster(lightClusters, lightClusters.getClusterIdx(0.95f, 0.95f, 10.0f), 0) == false);
+
+	// lights behind camera, disabled lights and directional lights are skipped
+	lights.push_back(createLight(Vector3(0.0f, 0.0f, 10.0f), 16.0f));
+	lights.push_back(createLight(Vector3(0.0f, 0.0f, -10.0f), 16.0f));
+	lights[2].setEnabled(false);
+	lights.push_back(createLight(Vector3(0.0f, 0.0f, -10.0f), 16.0f));
+	lights[3].setPosition(Vector4(0.0f, 1.0f, 0.0f, 0.0f));
+	bin(lightClusters, projectionMatrix, lights);
+	lightClusters.getStatistics(statistics);
+	printResult("skip invisible, disabled and directional lights", lightClusters.getLightCount() == 1 && statistics.lights == 1);
+
+	// lights without attenuation affect all clusters
+	lights.clear();
+	lights.push_back(createLight(Vector3(0.0f, 0.0f, -10.0f), 0.0f));
+	bin(lightClusters, projectionMatrix, lights);
+	lightClusters.getStatistics(statistics);
+	printResult("light without range in all clusters", statistics.clusterLights == LightClusters::CLUSTERS_X * LightClusters::CLUSTERS_Y * LightClusters::CLUSTERS_Z);
+
+	// cluster light overflow
+	lights.clear();
+	for (auto i = 0; i < LightClusters::CLUSTER_LIGHTS_MAX + 10; i++) lights.push_back(createLight(Vector3(0.0f, 0.0f, -10.0f), 16.0f));
+	bin(lightClusters, projectionMatrix, lights);
+	lightClusters.getStatistics(statistics);
+	auto clusterIdx = lightClusters.getClusterIdx(0.0f, 0.0f, 10.0f);
+	printResult(
+		"cluster light overflow",
+		lightClusters.getClusterData()[clusterIdx * 2 + 1] == LightClusters::CLUSTER_LIGHTS_MAX &&
+		statistics.droppedClusterLights > 0
+	);
+}
+
+void LightClustersTest::testConservativeBinning()
+{
+	Console::println(string("\nConservative binning\n--------------------"));
+
+	auto projectionMatrix = createProjectionMatrix();
+	LightClusters lightClusters(nullptr);
+	mt19937 random(42);
+	uniform_real_distribution<float> positionXY(-60.0f, 60.0f);
+	uniform_real_distribution<float> positionZ(-Z_FAR, 0.0f);
+	uniform_real_distribution<float> ndc(-0.99f, 0.99f);
+	uniform_real_distribution<float> viewDepth(Z_NEAR, Z_FAR);
+	uniform_real_distribution<float> quadraticAttenuation(0.25f, 64.0f);
+
+	// random lights
+	vector<Light> lights;
+	for (auto i = 0; i < 256; i++) lights.push_back(createLight(Vector3(positionXY(random), positionXY(random), positionZ(random)), quadraticAttenuation(random)));
+	bin(lightClusters, projectionMatrix, lights);
+
+	// each light that affects a random point in view frustum needs to be in cluster of that point
+	auto& lightData = lightClusters.getLightData();
+	auto missedLights = 0;
+	auto testedLights = 0;
+	Vector4 clipSpacePoint;
+	for (auto i = 0; i < 10000; i++) {
+		auto x = ndc(random);
+		auto y = ndc(random);
+		auto depth = viewDepth(random);
+		// view space point of normalized device coordinates x and y at view depth
+		projectionMatrix.multiply(Vector4(0.0f, 0.0f, -depth, 1.0f), clipSpacePoint);
+		Vector4 viewSpacePoint;
+		lightClusters.getProjectionMatrixInverted().multiply(Vector4(x, y, clipSpacePoint[2] / clipSpacePoint[3], 1.0f), viewSpacePoint);
+		Vector3 point(viewSpacePoint[0] / viewSpacePoint[3], viewSpacePoint[1] / viewSpacePoint[3], viewSpacePoint[2] / viewSpacePoint[3]);
+		auto clusterIdx = lightClusters.getClusterIdx(x, y, depth);
+		for (auto lightIdx = 0; lightIdx < lightClusters.getLightCount(); lightIdx++) {
+			auto lightPosition = Vector3(
+				lightData[lightIdx * LightClusters::LIGHT_TEXELS * 4 + 0],
+				lightData[lightIdx * LightClusters::LIGHT_TEXELS * 4 + 1],
+				lightData[lightIdx * LightClusters::LIGHT_TEXELS * 4 + 2]
+			);
+			auto lightRange = lightData[lightIdx * LightClusters::LIGHT_TEXELS * 4 + 3];
+			if (point.clone().sub(lightPosition).computeLength() > lightRange * 0.99f) continue;
+			testedLights++;
+			if (isLightInCluster(lightClusters, clusterIdx, lightIdx) == false) missedLights++;
+		}
+	}
+	printResult("lights affecting points are in clusters of points (" + to_string(testedLights) + " tested, " + to_string(missedLights) + " missed)", testedLights > 0 && missedLights == 0);
+}
+
+void LightClustersTest::testMultithreadedBinning()
+{
+	Console::println(string("\nMultithreaded binning\n---------------------"));
+
+	auto projectionMatrix = createProjectionMatrix();
+	LightClusters lightClusters(nullptr);
+	mt19937 random(4711);
+	uniform_real_distribution<float> positionXY(-60.0f, 60.0f);
+	uniform_real_distribution<float> positionZ(-Z_FAR, 0.0f);
+	uniform_real_distribution<float> quadraticAttenuation(0.25f, 64.0f);
+
+	vector<Light> lights;
+	for (auto i = 0; i < 512; i++) lights.push_back(createLight(Vector3(positionXY(random), positionXY(random), positionZ(random)), quadraticAttenuation(random)));
+
+	// single threaded
+	bin(lightClusters, projectionMatrix, lights);
+	auto clusterData = lightClusters.getClusterData();
+	auto lightIndexData = lightClusters.getLightIndexData();
+
+	// split into 4 work packages like engine threads do
+	lightClusters.update(projectionMatrix, Matrix4x4().identity(), Z_NEAR, Z_FAR, lights);
+	for (auto threadIdx = 0; threadIdx < 4; threadIdx++) lightClusters.binLightsFunction(4, threadIdx);
+	lightClusters.collectLights();
+	printResult("multithreaded binning equals single threaded binning", clusterData == lightClusters.getClusterData() && lightIndexData == lightClusters.getLightIndexData());
+
+	// bin lights threads, repeated to check signalling between frames
+	LightClusters threadedLightClusters(nullptr, 4);
+	auto threadedBinningEqual = true;
+	for (auto i = 0; i < 10; i++) {
+		threadedLightClusters.update(projectionMatrix, Matrix4x4().identity(), Z_NEAR, Z_FAR, lights);
+		threadedLightClusters.binLights();
+		threadedLightClusters.collectLights();
+		threadedBinningEqual&= clusterData == threadedLightClusters.getClusterData() && lightIndexData == threadedLightClusters.getLightIndexData();
+	}
+	printResult("bin lights threads binning equals single threaded binning", threadedBinningEqual);
+}
+
+void LightClustersTest::testPerformance()
+{
+	Console::println(string("\nPerformance\n-----------"));
+
+	auto projectionMatrix = createProjectionMatrix();
+	LightClusters lightClusters(nullptr);
+	LightClustersStatistics statistics;
+	mt19937 random(42);
+	uniform_real_distribution<float> positionXY(-60.0f, 60.0f);
+	uniform_real_distribution<float> positionZ(-Z_FAR, 0.0f);
+	uniform_real_distribution<float> quadraticAttenuation(0.25f, 64.0f);
+
+	vector<Light> lights;
+	for (auto i = 0; i < LightClusters::LIGHTS_MAX; i++) lights.push_back(createLight(Vector3(positionXY(random), positionXY(random), positionZ(random)), quadraticAttenuation(random)));
+
+	auto runs = 100;
+	auto timeStart = Time::getCurrentMillis();
+	for (auto i = 0; i < runs; i++) bin(lightClusters, projectionMatrix, lights);
+	auto timeTaken = Time::getCurrentMillis() - timeStart;
+	lightClusters.getStatistics(statistics);
+	Console::println(
+		"binning " + to_string(statistics.lights) + " visible lights: " +
+		to_string(static_cast<float>(timeTaken) / static_cast<float>(runs)) + "ms per frame, " +
+		to_string(statistics.clusterLights) + " cluster lights, " +
+		to_string(statistics.droppedClusterLights) + " dropped cluster lights"
+	);
+	printResult("binning lights", statistics.lights > 0);
+}
@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+
+#include <tdme/tdme.h>
+#include <tdme/tests/fwd-tdme.h>
+
+using std::string;
+
+/**
+ * Light clusters test
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::tests::LightClustersTest final
+{
+public:
+	static void main();
+
+	LightClustersTest();
+
+	void testBinning();
+	void testConservativeBinning();
+	void testMultithreadedBinning();
+	void testPerformance();
+
+private:
+	string success = "Success";
+	string fail = "Fail";
+
+	/**
+	 * Print test result
+	 * @param test test
+	 * @param result result
+	 */
+	void printResult(const string& test, bool result);
+};
@@ -0,0 +1,7 @@
+#include <tdme/tests/OcclusionCullingTest.h>
+
+int main(int argc, char** argv)
+{
+	::tdme::tests::OcclusionCullingTest::main();
+	return 0;
+}
@@ -0,0 +1,207 @@
+#include <tdme/tests/OcclusionCullingTest.h>
+
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tdme/engine/Object3DModel.h>
+#include <tdme/engine/model/Group.h>
+#include <tdme/engine/model/Model.h>
+#include <tdme/engine/primitives/BoundingBox.h>
+#include <tdme/engine/primitives/PrimitiveModel.h>
+#include <tdme/engine/primitives/Triangle.h>
+#include <tdme/engine/subsystems/occlusionculling/OcclusionCulling.h>
+#include <tdme/engine/subsystems/occlusionculling/OcclusionCullingStatistics.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/Time.h>
+
+using std::mt19937;
+using std::string;
+using std::to_string;
+using std::uniform_real_distribution;
+using std::vector;
+
+using tdme::tests::OcclusionCullingTest;
+using tdme::engine::Object3DModel;
+using tdme::engine::model::Group;
+using tdme::engine::model::Model;
+using tdme::engine::primitives::BoundingBox;
+using tdme::engine::primitives::PrimitiveModel;
+using tdme::engine::primitives::Triangle;
+using tdme::engine::subsystems::occlusionculling::OcclusionCulling;
+using tdme::engine::subsystems::occlusionculling::OcclusionCullingStatistics;
+using tdme::math::Matrix4x4;
+using tdme::math::Vector3;
+using tdme::utils::Console;
+using tdme::utils::Time;
+
+OcclusionCullingTest::OcclusionCullingTest()
+{
+	// camera at origin looking along negative z axis, 90 degree vertical field of view, aspect 2, z near 0.1, z far 1000
+	auto zNear = 0.1f;
+	auto zFar = 1000.0f;
+	mvpMatrix.set(
+		0.5f, 0.0f, 0.0f, 0.0f,
+		0.0f, 1.0f, 0.0f, 0.0f,
+		0.0f, 0.0f, (zFar + zNear) / (zNear - zFar), -1.0f,
+		0.0f, 0.0f, 2.0f * zFar * zNear / (zNear - zFar), 0.0f
+	);
+}
+
+void OcclusionCullingTest::main()
+{
+	auto tst = new OcclusionCullingTest();
+	Console::println(string("Occlusion culling tests:"));
+	tst->testBoundingBoxOccluder();
+	tst->testTriangleOccluder();
+	tst->testObjectOccluder();
+	tst->testNearPlaneClipping();
+	tst->testPerformance();
+	delete tst;
+}
+
+void OcclusionCullingTest::printResult(const string& test, bool result) {
+	Console::println(test + ": " + (result == true?success:fail));
+}
+
+void OcclusionCullingTest::testBoundingBoxOccluder()
+{
+	Console::println(string("\nBounding box occluder\n---------------------"));
+
+	Matrix4x4 identityMatrix;
+	identityMatrix.identity();
+	OcclusionCulling occlusionCulling;
+	occlusionCulling.reset(mvpMatrix, 0.1f);
+	BoundingBox wall(Vector3(-2.0f, -2.0f, -11.0f), Vector3(2.0f, 2.0f, -10.0f));
+	occlusionCulling.addOccluder(identityMatrix, &wall);
+	occlusionCulling.updateHiZ();
+
+	BoundingBox behind(Vector3(-0.5f, -0.5f, -51.0f), Vector3(0.5f, 0.5f, -50.0f));
+	BoundingBox inFront(Vector3(-0.5f, -0.5f, -6.0f), Vector3(0.5f, 0.5f, -5.0f));
+	BoundingBox beside(Vector3(29.5f, -0.5f, -51.0f), Vector3(30.5f, 0.5f, -50.0f));
+	BoundingBox partlyBehind(Vector3(-1.0f, -0.5f, -51.0f), Vector3(15.0f, 0.5f, -50.0f));
+	BoundingBox nearPlane(Vector3(-0.5f, -0.5f, -1.0f), Vector3(0.5f, 0.5f, 1.0f));
+	OcclusionCullingStatistics statistics;
+	occlusionCulling.getStatistics(statistics);
+	printResult("box behind occluder is occluded", occlusionCulling.isVisible(&behind) == false);
+	printResult("box in front of occluder is visible", occlusionCulling.isVisible(&inFront) == true);
+	printResult("box beside occluder is visible", occlusionCulling.isVisible(&beside) == true);
+	printResult("box partly behind occluder is visible", occlusionCulling.isVisible(&partlyBehind) == true);
+	printResult("box intersecting near plane is visible", occlusionCulling.isVisible(&nearPlane) == true);
+	printResult("statistics count occluder triangles", statistics.occluders == 1 && statistics.occluderTriangles == 12);
+}
+
+void OcclusionCullingTest::testTriangleOccluder()
+{
+	Console::println(string("\nTriangle occluder\n-----------------"));
+
+	// translate quad from z = 0 to z = -10 by occluder transformations
+	Matrix4x4 transformationsMatrix;
+	transformationsMatrix.identity().translate(Vector3(0.0f, 0.0f, -10.0f));
+	vector<Triangle> triangles = {
+		Triangle(Vector3(-2.0f, -2.0f, 0.0f), Vector3(2.0f, -2.0f, 0.0f), Vector3(2.0f, 2.0f, 0.0f)),
+		Triangle(Vector3(-2.0f, -2.0f, 0.0f), Vector3(-2.0f, 2.0f, 0.0f), Vector3(2.0f, 2.0f, 0.0f))
+	};
+	OcclusionCulling occlusionCulling;
+	occlusionCulling.reset(mvpMatrix, 0.1f);
+	occlusionCulling.addOccluder(transformationsMatrix, triangles);
+	occlusionCulling.updateHiZ();
+
+	BoundingBox behind(Vector3(-0.5f, -0.5f, -51.0f), Vector3(0.5f, 0.5f, -50.0f));
+	BoundingBox inFront(Vector3(-0.5f, -0.5f, -6.0f), Vector3(0.5f, 0.5f, -5.0f));
+	printResult("box behind occluder is occluded", occlusionCulling.isVisible(&behind) == false);
+	printResult("box in front of occluder is visible", occlusionCulling.isVisible(&inFront) == true);
+
+	// no occluders
+	occlusionCulling.reset(mvpMatrix, 0.1f);
+	occlusionCulling.updateHiZ();
+	printResult("box without occluders is visible", occlusionCulling.isVisible(&behind) == true);
+}
+
+void OcclusionCullingTest::testObjectOccluder()
+{
+	Console::println(string("\nObject occluder\n---------------"));
+
+	// wall model whose group is translated from z = 0 to z = -20
+	BoundingBox wall(Vector3(-2.0f, -2.0f, -0.5f), Vector3(2.0f, 2.0f, 0.5f));
+	auto model = PrimitiveModel::createBoundingBoxModel(&wall, "wall");
+	Matrix4x4 groupTransformationsMatrix;
+	groupTransformationsMatrix.identity().translate(Vector3(0.0f, 0.0f, -20.0f));
+	model->getGroupById("group")->setTransformationsMatrix(groupTransformationsMatrix);
+	auto object = new Object3DModel(model);
+	OcclusionCulling occlusionCulling;
+	occlusionCulling.reset(mvpMatrix, 0.1f);
+	occlusionCulling.addOccluder(object);
+	occlusionCulling.updateHiZ();
+
+	BoundingBox behind(Vector3(-0.5f, -0.5f, -51.0f), Vector3(0.5f, 0.5f, -50.0f));
+	BoundingBox inFront(Vector3(-0.5f, -0.5f, -16.0f), Vector3(0.5f, 0.5f, -15.0f));
+	printResult("box behind object occluder with group transformations is occluded", occlusionCulling.isVisible(&behind) == false);
+	printResult("box in front of object occluder with group transformations is visible", occlusionCulling.isVisible(&inFront) == true);
+	delete object;
+	delete model;
+}
+
+void OcclusionCullingTest::testNearPlaneClipping()
+{
+	Console::println(string("\nNear plane clipping\n-------------------"));
+
+	// tunnel around camera, which is clipped by near plane
+	Matrix4x4 identityMatrix;
+	identityMatrix.identity();
+	OcclusionCulling occlusionCulling;
+	occlusionCulling.reset(mvpMatrix, 0.1f);
+	BoundingBox tunnel(Vector3(-2.0f, -2.0f, -20.0f), Vector3(2.0f, 2.0f, 5.0f));
+	occlusionCulling.addOccluder(identityMatrix, &tunnel);
+	occlusionCulling.updateHiZ();
+
+	BoundingBox behind(Vector3(-0.5f, -0.5f, -51.0f), Vector3(0.5f, 0.5f, -50.0f));
+	BoundingBox inside(Vector3(-0.5f, -0.5f, -11.0f), Vector3(0.5f, 0.5f, -10.0f));
+	printResult("box behind clipped occluder is occluded", occlusionCulling.isVisible(&behind) == false);
+	printResult("box inside clipped occluder is visible", occlusionCulling.isVisible(&inside) == true);
+}
+
+void OcclusionCullingTest::testPerformance()
+{
+	Console::println(string("\nPerformance\n-----------"));
+
+	mt19937 random(42);
+	uniform_real_distribution<float> xDistribution(-200.0f, 200.0f);
+	uniform_real_distribution<float> zDistribution(-500.0f, -20.0f);
+	Matrix4x4 identityMatrix;
+	identityMatrix.identity();
+
+	// city like scene with 100 buildings and 100000 objects
+	vector<BoundingBox> buildings;
+	for (auto i = 0; i < 100; i++) {
+		auto x = xDistribution(random);
+		auto z = zDistribution(random);
+		buildings.push_back(BoundingBox(Vector3(x - 10.0f, -1.0f, z - 10.0f), Vector3(x + 10.0f, 30.0f, z + 10.0f)));
+	}
+	vector<BoundingBox> objects;
+	for (auto i = 0; i < 100000; i++) {
+		auto x = xDistribution(random);
+		auto z = zDistribution(random);
+		objects.push_back(BoundingBox(Vector3(x - 1.0f, -1.0f, z - 1.0f), Vector3(x + 1.0f, 1.0f, z + 1.0f)));
+	}
+
+	OcclusionCulling occlusionCulling;
+	auto rasterizeTimeStart = Time::getCurrentMillis();
+	for (auto i = 0; i < 10; i++) {
+		occlusionCulling.reset(mvpMatrix, 0.1f);
+		for (auto& building: buildings) occlusionCulling.addOccluder(identityMatrix, &building);
+		occlusionCulling.updateHiZ();
+	}
+	auto rasterizeTime = Time::getCurrentMillis() - rasterizeTimeStart;
+	auto testTimeStart = Time::getCurrentMillis();
+	auto culled = 0;
+	for (auto& object: objects) {
+		if (occlusionCulling.isVisible(&object) == false) culled++;
+	}
+	auto testTime = Time::getCurrentMillis() - testTimeStart;
+	Console::println("rasterizing " + to_string(buildings.size()) + " occluders 10 times: " + to_string(rasterizeTime) + "ms");
+	Console::println("testing " + to_string(objects.size()) + " bounding boxes: " + to_string(testTime) + "ms, culled: " + to_string(culled));
+	printResult("objects hidden by buildings are culled", culled > 0);
+}
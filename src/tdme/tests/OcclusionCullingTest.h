@@ -0,0 +1,43 @@
+#pragma once
+
+#include <string>
+
+#include <tdme/tdme.h>
+#include <tdme/math/fwd-tdme.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/tests/fwd-tdme.h>
+
+using std::string;
+
+using tdme::math::Matrix4x4;
+
+/**
+ * Occlusion culling test
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::tests::OcclusionCullingTest final
+{
+public:
+	static void main();
+
+	OcclusionCullingTest();
+
+	void testBoundingBoxOccluder();
+	void testTriangleOccluder();
+	void testObjectOccluder();
+	void testNearPlaneClipping();
+	void testPerformance();
+
+private:
+	string success = "Success";
+	string fail = "Fail";
+	Matrix4x4 mvpMatrix;
+
+	/**
+	 * Print test result
+	 * @param test test
+	 * @param result result
+	 */
+	void printResult(const string& test, bool result);
+};
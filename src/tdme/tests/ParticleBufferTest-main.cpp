@@ -0,0 +1,7 @@
+#include <tdme/tests/ParticleBufferTest.h>
+
+int main(int argc, char** argv)
+{
+	::tdme::tests::ParticleBufferTest::main();
+	return 0;
+}
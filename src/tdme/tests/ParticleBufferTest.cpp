@@ -0,0 +1,344 @@
+#include <tdme/tests/ParticleBufferTest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tdme/engine/Transformations.h>
+#include <tdme/engine/model/Color4.h>
+#include <tdme/engine/primitives/BoundingBox.h>
+#include <tdme/engine/subsystems/particlesystem/Particle.h>
+#include <tdme/engine/subsystems/particlesystem/ParticleBuffer.h>
+#include <tdme/engine/subsystems/particlesystem/PointParticleEmitter.h>
+#include <tdme/engine/subsystems/particlesystem/PointsParticleSystemInternal.h>
+#include <tdme/engine/subsystems/rendering/TransparentRenderPoint.h>
+#include <tdme/engine/subsystems/rendering/TransparentRenderPointsPool.h>
+#include <tdme/math/Math.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/os/threading/Thread.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/Time.h>
+
+using std::mt19937;
+using std::sort;
+using std::string;
+using std::to_string;
+using std::uniform_int_distribution;
+using std::uniform_real_distribution;
+using std::vector;
+
+using tdme::engine::Transformations;
+using tdme::engine::model::Color4;
+using tdme::engine::primitives::BoundingBox;
+using tdme::engine::subsystems::particlesystem::Particle;
+using tdme::engine::subsystems::particlesystem::ParticleBuffer;
+using tdme::engine::subsystems::particlesystem::PointParticleEmitter;
+using tdme::engine::subsystems::particlesystem::PointsParticleSystemInternal;
+using tdme::engine::subsystems::rendering::TransparentRenderPoint;
+using tdme::engine::subsystems::rendering::TransparentRenderPointsPool;
+using tdme::math::Math;
+using tdme::math::Matrix4x4;
+using tdme::math::Vector3;
+using tdme::os::threading::Thread;
+using tdme::tests::ParticleBufferTest;
+using tdme::utils::Console;
+using tdme::utils::Time;
+
+namespace {
+	constexpr int64_t TIME_DELTA { 16LL };
+	constexpr float FPS { 10.0f };
+
+	Particle createParticle(mt19937& random, int64_t lifeTimeMax) {
+		uniform_real_distribution<float> unit(-1.0f, 1.0f);
+		Particle particle;
+		particle.active = true;
+		particle.spriteIndex = 0.0f;
+		particle.position.set(unit(random), unit(random), unit(random));
+		particle.velocity.set(unit(random), unit(random) * 5.0f, unit(random));
+		particle.mass = unit(random) > 0.0f?0.1f:0.0f;
+		particle.lifeTimeMax = lifeTimeMax;
+		particle.lifeTimeCurrent = 0LL;
+		particle.color.set(1.0f, 1.0f, 1.0f, 1.0f);
+		particle.colorAdd.set(-0.0001f, -0.0002f, -0.0003f, -0.0004f);
+		return particle;
+	}
+
+	/**
+	 * Updates particle like points particle systems did with array of structures storage
+	 */
+	void updateParticle(Particle& particle, int64_t timeDelta) {
+		Vector3 velocityForTime;
+		particle.lifeTimeCurrent+= timeDelta;
+		particle.spriteIndex+= (static_cast<float>(timeDelta) / 1000.0f) * FPS;
+		if (particle.mass > Math::EPSILON)
+			particle.velocity.sub(Vector3(0.0f, 0.5f * Math::g * static_cast< float >(timeDelta) / 1000.0f, 0.0f));
+		particle.position.add(velocityForTime.set(particle.velocity).scale(static_cast< float >(timeDelta) / 1000.0f));
+		auto& color = particle.color.getArray();
+		auto& colorAdd = particle.colorAdd.getArray();
+		color[0] += colorAdd[0] * static_cast< float >(timeDelta);
+		color[1] += colorAdd[1] * static_cast< float >(timeDelta);
+		color[2] += colorAdd[2] * static_cast< float >(timeDelta);
+		color[3] += colorAdd[3] * static_cast< float >(timeDelta);
+	}
+
+	void updateParticleBuffer(ParticleBuffer* particleBuffer) {
+		particleBuffer->removeExpired(TIME_DELTA);
+		particleBuffer->integrate(TIME_DELTA, FPS);
+	}
+
+	/**
+	 * Updates particle buffers split by thread index like engine threads do with particle systems
+	 */
+	class UpdateThread: public Thread {
+	private:
+		int threadCount;
+		int threadIdx;
+		vector<ParticleBuffer*>* particleBuffers;
+		int runs;
+
+	public:
+		UpdateThread(int threadCount, int threadIdx, vector<ParticleBuffer*>* particleBuffers, int runs):
+			Thread("particlebuffertest-updatethread"),
+			threadCount(threadCount),
+			threadIdx(threadIdx),
+			particleBuffers(particleBuffers),
+			runs(runs) {
+		}
+
+		void run() override {
+			for (auto i = 0; i < runs; i++) {
+				for (auto j = threadIdx; j < particleBuffers->size(); j+= threadCount) updateParticleBuffer((*particleBuffers)[j]);
+			}
+		}
+	};
+	/**
+	 * Points particle system filled with particles up to its capacity, without engine
+	 */
+	class TestPointsParticleSystem: public PointsParticleSystemInternal {
+	public:
+		TestPointsParticleSystem(const string& id, mt19937& random, int32_t capacity):
+			PointsParticleSystemInternal(id, new PointParticleEmitter(0, 1000000LL, 0LL, 0.0f, 0.0f, Vector3(), Vector3(), Vector3(), Color4(1.0f, 1.0f, 1.0f, 1.0f), Color4(1.0f, 1.0f, 1.0f, 1.0f)), capacity, 10.0f, false, nullptr, 1, 1, FPS) {
+			for (auto i = 0; i < capacity; i++) particles.add(createParticle(random, 1000000LL));
+			active = true;
+			Transformations transformations;
+			transformations.setTranslation(Vector3(1.0f, 2.0f, 3.0f));
+			transformations.update();
+			setLocalTransformations(transformations);
+			setTranslation(Vector3(-10.0f, 0.0f, 5.0f));
+			setScale(Vector3(2.0f, 2.0f, 2.0f));
+			addRotation(Vector3(0.0f, 1.0f, 0.0f), 45.0f);
+			update();
+		}
+
+		inline const ParticleBuffer& getParticleBuffer() {
+			return particles;
+		}
+
+		inline BoundingBox* getBoundingBox() {
+			return &boundingBox;
+		}
+	};
+}
+
+ParticleBufferTest::ParticleBufferTest()
+{
+}
+
+void ParticleBufferTest::main()
+{
+	auto pbt = new ParticleBufferTest();
+	Console::println(string("Particle buffer tests:"));
+	pbt->testAdd();
+	pbt->testCompaction();
+	pbt->testIntegration();
+	pbt->testPerformance();
+	delete pbt;
+}
+
+void ParticleBufferTest::printResult(const string& test, bool result) {
+	Console::println(test + ": " + (result == true?success:fail));
+}
+
+void ParticleBufferTest::testAdd()
+{
+	Console::println(string("\nAdd\n---"));
+
+	mt19937 random(42);
+	ParticleBuffer particleBuffer(16);
+	auto added = 0;
+	for (auto i = 0; i < 20; i++) {
+		if (particleBuffer.add(createParticle(random, 1000LL)) == true) added++;
+	}
+	printResult("add until capacity", added == 16 && particleBuffer.getCount() == 16);
+	particleBuffer.clear();
+	printResult("clear", particleBuffer.getCount() == 0 && particleBuffer.add(createParticle(random, 1000LL)) == true);
+}
+
+void ParticleBufferTest::testCompaction()
+{
+	Console::println(string("\nCompaction\n----------"));
+
+	mt19937 random(42);
+	uniform_int_distribution<int64_t> lifeTime(1LL, 2000LL);
+	ParticleBuffer particleBuffer(1000);
+
+	// use sprite index to identify particles
+	vector<int> expectedIds;
+	for (auto i = 0; i < 1000; i++) {
+		auto particle = createParticle(random, lifeTime(random));
+		particle.spriteIndex = static_cast<float>(i);
+		if (particle.lifeTimeMax > 1000LL) expectedIds.push_back(i);
+		particleBuffer.add(particle);
+	}
+	auto removed = particleBuffer.removeExpired(1000LL);
+	vector<int> ids;
+	auto lifeTimesValid = true;
+	for (auto i = 0; i < particleBuffer.getCount(); i++) {
+		ids.push_back(static_cast<int>(particleBuffer.getSpriteIndex(i)));
+		if (particleBuffer.getLifeTimeCurrent(i) != 1000LL) lifeTimesValid = false;
+	}
+	sort(ids.begin(), ids.end());
+	printResult("removed particles with expired life time (" + to_string(removed) + " removed)", removed == 1000 - expectedIds.size() && particleBuffer.getCount() == expectedIds.size());
+	printResult("alive particles are compacted and kept", ids == expectedIds && lifeTimesValid == true);
+	particleBuffer.removeExpired(1000LL);
+	printResult("remove all particles", particleBuffer.getCount() == 0);
+}
+
+void ParticleBufferTest::testIntegration()
+{
+	Console::println(string("\nIntegration\n-----------"));
+
+	mt19937 random(4711);
+	ParticleBuffer particleBuffer(1000);
+	vector<Particle> particles;
+	for (auto i = 0; i < 1000; i++) {
+		particles.push_back(createParticle(random, 1000000LL));
+		particleBuffer.add(particles[i]);
+	}
+
+	// compare with array of structures update
+	for (auto frame = 0; frame < 100; frame++) {
+		for (auto& particle: particles) updateParticle(particle, TIME_DELTA);
+		updateParticleBuffer(&particleBuffer);
+	}
+	auto maxError = 0.0f;
+	Vector3 position;
+	Vector3 velocity;
+	Color4 color;
+	for (auto i = 0; i < particles.size(); i++) {
+		particleBuffer.getPosition(i, position);
+		particleBuffer.getVelocity(i, velocity);
+		particleBuffer.getColor(i, color);
+		maxError = Math::max(maxError, position.clone().sub(particles[i].position).computeLength());
+		maxError = Math::max(maxError, velocity.clone().sub(particles[i].velocity).computeLength());
+		for (auto j = 0; j < 4; j++) maxError = Math::max(maxError, Math::abs(color.getArray()[j] - particles[i].color.getArray()[j]));
+		maxError = Math::max(maxError, Math::abs(particleBuffer.getSpriteIndex(i) - particles[i].spriteIndex));
+	}
+	printResult("structure of arrays integration equals array of structures integration (max error: " + to_string(maxError) + ")", maxError < 0.001f);
+}
+
+void ParticleBufferTest::testPerformance()
+{
+	Console::println(string("\nPerformance\n-----------"));
+
+	mt19937 random(42);
+	auto particleBufferCount = 64;
+	auto particleBufferCapacity = 16384;
+	auto runs = 100;
+	vector<ParticleBuffer*> particleBuffers;
+	for (auto i = 0; i < particleBufferCount; i++) {
+		auto particleBuffer = new ParticleBuffer(particleBufferCapacity);
+		for (auto j = 0; j < particleBufferCapacity; j++) particleBuffer->add(createParticle(random, 1000000LL));
+		particleBuffers.push_back(particleBuffer);
+	}
+	auto particles = static_cast<float>(particleBufferCount * particleBufferCapacity) * static_cast<float>(runs);
+
+	// array of structures for comparison
+	vector<Particle> aosParticles(particleBufferCount * particleBufferCapacity);
+	for (auto& particle: aosParticles) particle = createParticle(random, 1000000LL);
+	auto timeStart = Time::getCurrentMillis();
+	for (auto i = 0; i < runs; i++) {
+		for (auto& particle: aosParticles) {
+			if (particle.lifeTimeCurrent + TIME_DELTA >= particle.lifeTimeMax) particle.active = false;
+			if (particle.active == false) continue;
+			updateParticle(particle, TIME_DELTA);
+		}
+	}
+	auto timeTakenAoS = Math::max(Time::getCurrentMillis() - timeStart, 1LL);
+	Console::println("array of structures, single threaded: " + to_string(static_cast<int64_t>(particles / static_cast<float>(timeTakenAoS))) + " particles/ms");
+	aosParticles.clear();
+
+	// single threaded
+	timeStart = Time::getCurrentMillis();
+	for (auto i = 0; i < runs; i++) {
+		for (auto particleBuffer: particleBuffers) updateParticleBuffer(particleBuffer);
+	}
+	auto timeTaken = Math::max(Time::getCurrentMillis() - timeStart, 1LL);
+	Console::println("structure of arrays, single threaded: " + to_string(static_cast<int64_t>(particles / static_cast<float>(timeTaken))) + " particles/ms");
+
+	// multithreaded, independent particle buffers are updated by different threads
+	auto threadCount = Math::clamp(Thread::getHardwareThreadCount() == 0?2:Thread::getHardwareThreadCount() / 2, 2, 4);
+	vector<UpdateThread*> threads;
+	for (auto i = 0; i < threadCount; i++) threads.push_back(new UpdateThread(threadCount, i, &particleBuffers, runs));
+	timeStart = Time::getCurrentMillis();
+	for (auto thread: threads) thread->start();
+	for (auto thread: threads) thread->join();
+	auto timeTakenMultithreaded = Math::max(Time::getCurrentMillis() - timeStart, 1LL);
+	for (auto thread: threads) delete thread;
+	Console::println("structure of arrays, " + to_string(threadCount) + " threads: " + to_string(static_cast<int64_t>(particles / static_cast<float>(timeTakenMultithreaded))) + " particles/ms");
+
+	auto alive = 0;
+	for (auto particleBuffer: particleBuffers) {
+		alive+= particleBuffer->getCount();
+		delete particleBuffer;
+	}
+	printResult("updating particles", alive == particleBufferCount * particleBufferCapacity);
+
+	// full points particle system update path, integration, transformations, bounding box and render points
+	auto particleSystemCount = 16;
+	vector<TestPointsParticleSystem*> particleSystems;
+	for (auto i = 0; i < particleSystemCount; i++) particleSystems.push_back(new TestPointsParticleSystem("pps" + to_string(i), random, particleBufferCapacity));
+	auto particleSystemParticles = static_cast<float>(particleSystemCount * particleBufferCapacity) * static_cast<float>(runs);
+	timeStart = Time::getCurrentMillis();
+	for (auto i = 0; i < runs; i++) {
+		for (auto particleSystem: particleSystems) particleSystem->updateParticles(TIME_DELTA);
+	}
+	auto timeTakenParticleSystems = Math::max(Time::getCurrentMillis() - timeStart, 1LL);
+	Console::println("points particle systems update, single threaded: " + to_string(static_cast<int64_t>(particleSystemParticles / static_cast<float>(timeTakenParticleSystems))) + " particles/ms");
+
+	// compare render points and bounding box with particle wise transformations
+	auto maxError = 0.0f;
+	auto pointCount = 0;
+	for (auto particleSystem: particleSystems) {
+		auto& particleBuffer = particleSystem->getParticleBuffer();
+		auto& transparentRenderPoints = particleSystem->getRenderPointsPool()->getTransparentRenderPoints();
+		auto& localTransformationsMatrix = particleSystem->getLocalTransformations().getTransformationsMatrix();
+		Vector3 center;
+		localTransformationsMatrix.getTranslation(center);
+		center.add(particleSystem->getEmitter()->getCenter());
+		Vector3 position;
+		Vector3 min;
+		Vector3 max;
+		for (auto i = 0; i < particleBuffer.getCount(); i++) {
+			particleBuffer.getPosition(i, position);
+			localTransformationsMatrix.multiply(position, position);
+			position.add(center);
+			if (i == 0) {
+				min.set(position);
+				max.set(position);
+			} else {
+				min.set(Math::min(min.getX(), position.getX()), Math::min(min.getY(), position.getY()), Math::min(min.getZ(), position.getZ()));
+				max.set(Math::max(max.getX(), position.getX()), Math::max(max.getY(), position.getY()), Math::max(max.getZ(), position.getZ()));
+			}
+			particleSystem->getTransformationsMatrix().multiply(position, position);
+			maxError = Math::max(maxError, position.clone().sub(transparentRenderPoints[i]->point).computeLength());
+			pointCount++;
+		}
+		maxError = Math::max(maxError, min.clone().sub(particleSystem->getBoundingBox()->getMin()).computeLength());
+		maxError = Math::max(maxError, max.clone().sub(particleSystem->getBoundingBox()->getMax()).computeLength());
+		delete particleSystem;
+	}
+	printResult("points particle systems render points equal particle wise transformations (max error: " + to_string(maxError) + ")", pointCount == particleSystemCount * particleBufferCapacity && maxError < 0.001f);
+}
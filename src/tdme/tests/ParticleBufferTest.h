@@ -0,0 +1,37 @@
+#pragma once
+
+#include <string>
+
+#include <tdme/tdme.h>
+#include <tdme/tests/fwd-tdme.h>
+
+using std::string;
+
+/**
+ * Particle buffer test
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::tests::ParticleBufferTest final
+{
+public:
+	static void main();
+
+	ParticleBufferTest();
+
+	void testAdd();
+	void testCompaction();
+	void testIntegration();
+	void testPerformance();
+
+private:
+	string success = "Success";
+	string fail = "Fail";
+
+	/**
+	 * Print test result
+	 * @param test test
+	 * @param result result
+	 */
+	void printResult(const string& test, bool result);
+};
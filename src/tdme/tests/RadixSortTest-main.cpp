@@ -0,0 +1,7 @@
+#include <tdme/tests/RadixSortTest.h>
+
+int main(int argc, char** argv)
+{
+	::tdme::tests::RadixSortTest::main();
+	return 0;
+}
@@ -0,0 +1,135 @@
+#include <tdme/tests/RadixSortTest.h>
+
+#include <stdio.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tdme/utils/Console.h>
+#include <tdme/utils/RadixSort.h>
+#include <tdme/utils/Time.h>
+
+using std::mt19937_64;
+using std::sort;
+using std::stable_sort;
+using std::string;
+using std::to_string;
+using std::uniform_real_distribution;
+using std::vector;
+
+using tdme::tests::RadixSortTest;
+using tdme::utils::Console;
+using tdme::utils::RadixSort;
+using tdme::utils::Time;
+
+namespace {
+	struct Entry64 {
+		uint64_t key;
+		uint32_t idx;
+	};
+	struct Entry32 {
+		uint32_t key;
+		float value;
+	};
+}
+
+RadixSortTest::RadixSortTest()
+{
+}
+
+void RadixSortTest::main()
+{
+	auto rst = new RadixSortTest();
+	Console::println(string("Radix sort tests:"));
+	rst->testSort();
+	rst->testFloatKeys();
+	rst->testPerformance();
+	delete rst;
+}
+
+void RadixSortTest::printResult(const string& test, bool result) {
+	Console::println(test + ": " + (result == true?success:fail));
+}
+
+void RadixSortTest::testSort()
+{
+	Console::println(string("\nSort\n----"));
+
+	mt19937_64 random(42);
+	vector<Entry64> buffer;
+
+	// empty and single entry
+	vector<Entry64> entries;
+	RadixSort::sort(entries, buffer);
+	printResult("sort empty", entries.size() == 0);
+	entries.push_back({ 123ULL, 0 });
+	RadixSort::sort(entries, buffer);
+	printResult("sort single entry", entries.size() == 1 && entries[0].key == 123ULL);
+
+	// random keys, keys only differ in some bytes, equal keys
+	for (auto keyMask: vector<uint64_t> { 0xFFFFFFFFFFFFFFFFULL, 0xFF000000000000FFULL, 0x0000000000000007ULL, 0x0ULL }) {
+		entries.clear();
+		for (auto i = 0; i < 10000; i++) entries.push_back({ random() & keyMask, static_cast<uint32_t>(i) });
+		auto expectedEntries = entries;
+		stable_sort(expectedEntries.begin(), expectedEntries.end(), [](const Entry64& a, const Entry64& b) { return a.key < b.key; });
+		RadixSort::sort(entries, buffer);
+		auto sorted = entries.size() == expectedEntries.size();
+		for (auto i = 0; sorted == true && i < entries.size(); i++) {
+			if (entries[i].key != expectedEntries[i].key || entries[i].idx != expectedEntries[i].idx) sorted = false;
+		}
+		char keyMaskString[32];
+		snprintf(keyMaskString, sizeof(keyMaskString), "%016llx", static_cast<unsigned long long>(keyMask));
+		printResult("sort stable, key mask " + string(keyMaskString), sorted);
+	}
+}
+
+void RadixSortTest::testFloatKeys()
+{
+	Console::println(string("\nFloat keys\n----------"));
+
+	mt19937_64 random(42);
+	uniform_real_distribution<float> distribution(-10000.0f, 10000.0f);
+	vector<Entry32> entries;
+	vector<Entry32> buffer;
+	for (auto value: vector<float> { 0.0f, -0.0f, 1.0f, -1.0f, 1e-30f, -1e-30f, 1e30f, -1e30f }) {
+		entries.push_back({ RadixSort::getFloatKey(value), value });
+	}
+	for (auto i = 0; i < 10000; i++) {
+		auto value = distribution(random);
+		entries.push_back({ RadixSort::getFloatKey(value), value });
+	}
+	RadixSort::sort(entries, buffer);
+	auto sorted = true;
+	for (auto i = 1; i < entries.size(); i++) {
+		if (entries[i - 1].value > entries[i].value) sorted = false;
+	}
+	printResult("float keys preserve float order", sorted);
+	printResult("-0.0 before 0.0", RadixSort::getFloatKey(-0.0f) < RadixSort::getFloatKey(0.0f));
+}
+
+void RadixSortTest::testPerformance()
+{
+	Console::println(string("\nPerformance\n-----------"));
+
+	mt19937_64 random(42);
+	vector<Entry64> buffer;
+	for (auto entryCount: vector<int32_t> { 1000, 10000, 100000, 1000000 }) {
+		vector<Entry64> entries;
+		for (auto i = 0; i < entryCount; i++) entries.push_back({ random(), static_cast<uint32_t>(i) });
+		auto radixSortStart = Time::getCurrentMillis();
+		for (auto i = 0; i < 10; i++) {
+			auto sortEntries = entries;
+			RadixSort::sort(sortEntries, buffer);
+		}
+		auto radixSortTime = Time::getCurrentMillis() - radixSortStart;
+		auto stdSortStart = Time::getCurrentMillis();
+		for (auto i = 0; i < 10; i++) {
+			auto sortEntries = entries;
+			sort(sortEntries.begin(), sortEntries.end(), [](const Entry64& a, const Entry64& b) { return a.key < b.key; });
+		}
+		auto stdSortTime = Time::getCurrentMillis() - stdSortStart;
+		Console::println(to_string(entryCount) + " entries, 10 times: radix sort: " + to_string(radixSortTime) + "ms, std::sort: " + to_string(stdSortTime) + "ms");
+	}
+}
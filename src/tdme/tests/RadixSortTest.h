@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+
+#include <tdme/tdme.h>
+#include <tdme/tests/fwd-tdme.h>
+
+using std::string;
+
+/**
+ * Radix sort test
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::tests::RadixSortTest final
+{
+public:
+	static void main();
+
+	RadixSortTest();
+
+	void testSort();
+	void testFloatKeys();
+	void testPerformance();
+
+private:
+	string success = "Success";
+	string fail = "Fail";
+
+	/**
+	 * Print test result
+	 * @param test test
+	 * @param result result
+	 */
+	void printResult(const string& test, bool result);
+};
@@ -0,0 +1,7 @@
+#include <tdme/tests/SoftwareRendererTest.h>
+
+int main(int argc, char** argv)
+{
+	::tdme::tests::SoftwareRendererTest::main();
+	return 0;
+}
@@ -0,0 +1,264 @@
+#include <tdme/tests/SoftwareRendererTest.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <tdme/engine/Engine.h>
+#include <tdme/engine/fileio/textures/Texture.h>
+#include <tdme/engine/subsystems/renderer/SoftwareRenderer.h>
+#include <tdme/math/Math.h>
+#include <tdme/utils/ByteBuffer.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/FloatBuffer.h>
+#include <tdme/utils/IntBuffer.h>
+
+using std::array;
+using std::string;
+using std::to_string;
+using std::vector;
+
+using tdme::tests::SoftwareRendererTest;
+using tdme::engine::Engine;
+using tdme::engine::fileio::textures::Texture;
+using tdme::engine::subsystems::renderer::SoftwareRenderer;
+using tdme::math::Math;
+using tdme::utils::ByteBuffer;
+using tdme::utils::Console;
+using tdme::utils::FloatBuffer;
+using tdme::utils::IntBuffer;
+
+SoftwareRendererTest::SoftwareRendererTest()
+{
+}
+
+void SoftwareRendererTest::main()
+{
+	// use multiple contexts and rasterizer threads
+	Engine::setThreadCount(4);
+	auto srt = new SoftwareRendererTest();
+	Console::println(string("Software renderer tests:"));
+	srt->testTriangles();
+	srt->testSequencePoints();
+	srt->testTexturing();
+	srt->testFrameBuffer();
+	delete srt;
+}
+
+void SoftwareRendererTest::printResult(const string& test, bool result) {
+	Console::println(test + ": " + (result == true?success:fail));
+}
+
+SoftwareRenderer* SoftwareRendererTest::createRenderer(int32_t width, int32_t height) {
+	auto renderer = new TestRenderer();
+	renderer->initialize();
+	renderer->setViewPort(0, 0, width, height);
+	renderer->updateViewPort();
+	renderer->setClearColor(0.0f, 0.0f, 0.0f, 1.0f);
+	renderer->clear(renderer->CLEAR_COLOR_BUFFER_BIT | renderer->CLEAR_DEPTH_BUFFER_BIT);
+	return renderer;
+}
+
+void SoftwareRendererTest::drawTriangles(SoftwareRenderer* renderer, void* context, const vector<float>& vertices, const vector<float>& textureCoordinates, const array<float, 4>& color) {
+	// program without matrices, so vertices are given in normalized device coordinates
+	auto programId = renderer->createProgram(renderer->PROGRAM_OBJECTS);
+	renderer->linkProgram(programId);
+	auto uniformEffectColorMul = renderer->getProgramUniformLocation(programId, "effectColorMul");
+	auto uniformDiffuseTextureUnit = renderer->getProgramUniformLocation(programId, "diffuseTextureUnit");
+	auto uniformDiffuseTextureAvailable = renderer->getProgramUniformLocation(programId, "diffuseTextureAvailable");
+	renderer->useProgram(context, programId);
+	renderer->setProgramUniformFloatVec4(context, uniformEffectColorMul, color);
+	renderer->setProgramUniformInteger(context, uniformDiffuseTextureUnit, 0);
+	renderer->setProgramUniformInteger(context, uniformDiffuseTextureAvailable, textureCoordinates.empty() == true?0:1);
+	auto vboIds = renderer->createBufferObjects(2, true, false);
+	auto verticesBuffer = ByteBuffer::allocate(vertices.size() * sizeof(float))->asFloatBuffer();
+	for (auto value: vertices) verticesBuffer.put(value);
+	renderer->uploadBufferObject(context, vboIds[0], vertices.size() * sizeof(float), &verticesBuffer);
+	renderer->bindVerticesBufferObject(context, vboIds[0]);
+	if (textureCoordinates.empty() == false) {
+		auto textureCoordinatesBuffer = ByteBuffer::allocate(textureCoordinates.size() * sizeof(float))->asFloatBuffer();
+		for (auto value: textureCoordinates) textureCoordinatesBuffer.put(value);
+		renderer->uploadBufferObject(context, vboIds[1], textureCoordinates.size() * sizeof(float), &textureCoordinatesBuffer);
+		renderer->bindTextureCoordinatesBufferObject(context, vboIds[1]);
+	}
+	renderer->drawTrianglesFromBufferObjects(context, vertices.size() / 9, 0);
+	renderer->unbindBufferObjects(context);
+}
+
+array<uint8_t, 4> SoftwareRendererTest::readPixel(SoftwareRenderer* renderer, int32_t x, int32_t y) {
+	auto pixels = renderer->readPixels(x, y, 1, 1);
+	array<uint8_t, 4> pixel = {{ pixels->get(0), pixels->get(1), pixels->get(2), pixels->get(3) }};
+	delete pixels;
+	return pixel;
+}
+
+void SoftwareRendererTest::testTriangles()
+{
+	Console::println(string("\nTriangles\n---------"));
+
+	auto renderer = createRenderer(256, 256);
+	auto context = renderer->getDefaultContext();
+
+	// lower left triangle in front
+	drawTriangles(renderer, context, {-1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, -1.0f, 1.0f, 0.0f}, {}, {{ 1.0f, 1.0f, 1.0f, 1.0f }});
+	// full screen quad behind from another context
+	drawTriangles(
+		renderer,
+		renderer->getContext(Engine::getThreadCount() - 1),
+		{-1.0f, -1.0f, 0.5f, 1.0f, -1.0f, 0.5f, 1.0f, 1.0f, 0.5f, 1.0f, 1.0f, 0.5f, -1.0f, 1.0f, 0.5f, -1.0f, -1.0f, 0.5f},
+		{},
+		{{ 1.0f, 0.0f, 0.0f, 1.0f }}
+	);
+	// clock wise triangle that gets culled
+	drawTriangles(renderer, context, {-1.0f, -1.0f, -0.5f, -1.0f, 1.0f, -0.5f, 1.0f, -1.0f, -0.5f}, {}, {{ 0.0f, 0.0f, 1.0f, 1.0f }});
+
+	auto lowerLeft = readPixel(renderer, 10, 10);
+	auto upperRight = readPixel(renderer, 245, 245);
+	printResult("rasterization", lowerLeft == array<uint8_t, 4> {{ 255, 255, 255, 255 }});
+	printResult("depth test", upperRight == array<uint8_t, 4> {{ 255, 0, 0, 255 }});
+	printResult("depth buffer", Math::abs(renderer->readPixelDepth(10, 10) - 0.5f) < 0.001f && Math::abs(renderer->readPixelDepth(245, 245) - 0.75f) < 0.001f);
+
+	// rendering must be deterministic
+	auto pixels1 = renderer->readPixels(0, 0, 256, 256);
+	renderer->clear(renderer->CLEAR_COLOR_BUFFER_BIT | renderer->CLEAR_DEPTH_BUFFER_BIT);
+	drawTriangles(renderer, context, {-1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, -1.0f, 1.0f, 0.0f}, {}, {{ 1.0f, 1.0f, 1.0f, 1.0f }});
+	drawTriangles(
+		renderer,
+		renderer->getContext(Engine::getThreadCount() - 1),
+		{-1.0f, -1.0f, 0.5f, 1.0f, -1.0f, 0.5f, 1.0f, 1.0f, 0.5f, 1.0f, 1.0f, 0.5f, -1.0f, 1.0f, 0.5f, -1.0f, -1.0f, 0.5f},
+		{},
+		{{ 1.0f, 0.0f, 0.0f, 1.0f }}
+	);
+	auto pixels2 = renderer->readPixels(0, 0, 256, 256);
+	auto deterministic = true;
+	for (auto i = 0; i < 256 * 256 * 4; i++) if (pixels1->get(i) != pixels2->get(i)) deterministic = false;
+	printResult("deterministic", deterministic);
+	delete pixels1;
+	delete pixels2;
+
+	//
+	delete renderer;
+}
+
+void SoftwareRendererTest::testSequencePoints()
+{
+	Console::println(string("\nSequence points\n---------------"));
+
+	auto renderer = createRenderer(256, 256);
+
+	// opaque full screen quad behind from another context like engine threads render opaque objects
+	drawTriangles(
+		renderer,
+		renderer->getContext(Engine::getThreadCount() - 1),
+		{-1.0f, -1.0f, 0.5f, 1.0f, -1.0f, 0.5f, 1.0f, 1.0f, 0.5f, 1.0f, 1.0f, 0.5f, -1.0f, 1.0f, 0.5f, -1.0f, -1.0f, 0.5f},
+		{},
+		{{ 1.0f, 0.0f, 0.0f, 1.0f }}
+	);
+	// transparent full screen quad in front from default context after all engine threads finished
+	renderer->onSequencePoint();
+	renderer->enableBlending();
+	drawTriangles(
+		renderer,
+		renderer->getDefaultContext(),
+		{-1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, -1.0f, 1.0f, 0.0f, -1.0f, -1.0f, 0.0f},
+		{},
+		{{ 1.0f, 1.0f, 1.0f, 0.5f }}
+	);
+	renderer->disableBlending();
+
+	auto pixel = readPixel(renderer, 128, 128);
+	printResult("draw calls after sequence point are blended over draw calls of other contexts", pixel[0] == 255 && pixel[1] > 0 && pixel[1] < 255);
+
+	//
+	delete renderer;
+}
+
+void SoftwareRendererTest::testTexturing()
+{
+	Console::println(string("\nTexturing\n---------"));
+
+	auto renderer = createRenderer(64, 64);
+	auto context = renderer->getDefaultContext();
+
+	// 2x2 texture with red, green, blue and white texels
+	auto textureData = ByteBuffer::allocate(2 * 2 * 4);
+	for (auto texel: vector<uint32_t> {0xff0000ff, 0x00ff00ff, 0x0000ffff, 0xffffffff}) {
+		textureData->put((texel >> 24) & 0xff);
+		textureData->put((texel >> 16) & 0xff);
+		textureData->put((texel >> 8) & 0xff);
+		textureData->put(texel & 0xff);
+	}
+	auto texture = new Texture("texture", 32, 2, 2, 2, 2, textureData);
+	texture->acquireReference();
+	auto textureId = renderer->createTexture();
+	renderer->setTextureUnit(context, 0);
+	renderer->bindTexture(context, textureId);
+	renderer->uploadTexture(context, texture);
+	drawTriangles(
+		renderer,
+		context,
+		{-1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, -1.0f, 1.0f, 0.0f, -1.0f, -1.0f, 0.0f},
+		{0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f},
+		{{ 1.0f, 1.0f, 1.0f, 1.0f }}
+	);
+	printResult(
+		"texture sampling",
+		readPixel(renderer, 10, 10) == array<uint8_t, 4> {{ 255, 0, 0, 255 }} &&
+		readPixel(renderer, 50, 10) == array<uint8_t, 4> {{ 0, 255, 0, 255 }} &&
+		readPixel(renderer, 10, 50) == array<uint8_t, 4> {{ 0, 0, 255, 255 }} &&
+		readPixel(renderer, 50, 50) == array<uint8_t, 4> {{ 255, 255, 255, 255 }}
+	);
+
+	//
+	texture->releaseReference();
+	delete renderer;
+}
+
+void SoftwareRendererTest::testFrameBuffer()
+{
+	Console::println(string("\nFrame buffer\n------------"));
+
+	auto renderer = createRenderer(64, 64);
+	auto context = renderer->getDefaultContext();
+
+	// render into frame buffer
+	auto depthBufferTextureId = renderer->createDepthBufferTexture(32, 32);
+	auto colorBufferTextureId = renderer->createColorBufferTexture(32, 32);
+	auto frameBufferId = renderer->createFramebufferObject(depthBufferTextureId, colorBufferTextureId);
+	renderer->bindFrameBuffer(frameBufferId);
+	renderer->setViewPort(0, 0, 32, 32);
+	renderer->updateViewPort();
+	renderer->setClearColor(0.0f, 0.0f, 1.0f, 1.0f);
+	renderer->clear(renderer->CLEAR_COLOR_BUFFER_BIT | renderer->CLEAR_DEPTH_BUFFER_BIT);
+	drawTriangles(renderer, context, {-1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, -1.0f, 1.0f, 0.0f}, {}, {{ 0.0f, 1.0f, 0.0f, 1.0f }});
+	printResult(
+		"frame buffer rendering",
+		readPixel(renderer, 2, 2) == array<uint8_t, 4> {{ 0, 255, 0, 255 }} &&
+		readPixel(renderer, 30, 30) == array<uint8_t, 4> {{ 0, 0, 255, 255 }}
+	);
+
+	// render color buffer texture into default frame buffer
+	renderer->bindFrameBuffer(renderer->FRAMEBUFFER_DEFAULT);
+	renderer->setViewPort(0, 0, 64, 64);
+	renderer->updateViewPort();
+	renderer->setTextureUnit(context, 0);
+	renderer->bindTexture(context, colorBufferTextureId);
+	drawTriangles(
+		renderer,
+		context,
+		{-1.0f, -1.0f, 0.0f, 1.0f, -1.0f, 0.0f, 1.0f, 1.0f, 0.0f, 1.0f, 1.0f, 0.0f, -1.0f, 1.0f, 0.0f, -1.0f, -1.0f, 0.0f},
+		{0.0f, 0.0f, 1.0f, 0.0f, 1.0f, 1.0f, 1.0f, 1.0f, 0.0f, 1.0f, 0.0f, 0.0f},
+		{{ 1.0f, 1.0f, 1.0f, 1.0f }}
+	);
+	printResult(
+		"frame buffer texture",
+		readPixel(renderer, 4, 4) == array<uint8_t, 4> {{ 0, 255, 0, 255 }} &&
+		readPixel(renderer, 60, 60) == array<uint8_t, 4> {{ 0, 0, 255, 255 }}
+	);
+
+	//
+	renderer->disposeFrameBufferObject(frameBufferId);
+	renderer->disposeTexture(depthBufferTextureId);
+	renderer->disposeTexture(colorBufferTextureId);
+	delete renderer;
+}
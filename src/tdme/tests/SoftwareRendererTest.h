@@ -0,0 +1,89 @@
+#pragma once
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <tdme/tdme.h>
+#include <tdme/engine/subsystems/renderer/fwd-tdme.h>
+#include <tdme/engine/subsystems/renderer/SoftwareRenderer.h>
+#include <tdme/tests/fwd-tdme.h>
+
+using std::array;
+using std::string;
+using std::vector;
+
+using tdme::engine::subsystems::renderer::SoftwareRenderer;
+
+/**
+ * Software renderer test
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::tests::SoftwareRendererTest final
+{
+public:
+	static void main();
+
+	SoftwareRendererTest();
+
+	void testTriangles();
+	void testSequencePoints();
+	void testTexturing();
+	void testFrameBuffer();
+
+private:
+	/**
+	 * Software renderer without engine connection
+	 */
+	class TestRenderer: public SoftwareRenderer {
+	public:
+		// overriden methods
+		void onUpdateProjectionMatrix(void* context) override {}
+		void onUpdateCameraMatrix(void* context) override {}
+		void onUpdateModelViewMatrix(void* context) override {}
+		void onBindTexture(void* context, int32_t textureId) override {}
+		void onUpdateTextureMatrix(void* context) override {}
+		void onUpdateEffect(void* context) override {}
+		void onUpdateLight(void* context, int32_t lightId) override {}
+		void onUpdateMaterial(void* context) override {}
+		void onUpdateShader(void* context) override {}
+	};
+
+	string success = "Success";
+	string fail = "Fail";
+
+	/**
+	 * Print test result
+	 * @param test test
+	 * @param result result
+	 */
+	void printResult(const string& test, bool result);
+
+	/**
+	 * Create renderer with a view port of given size and a cleared frame buffer
+	 * @param width width
+	 * @param height height
+	 * @return renderer
+	 */
+	SoftwareRenderer* createRenderer(int32_t width, int32_t height);
+
+	/**
+	 * Draw triangles given in normalized device coordinates
+	 * @param renderer renderer
+	 * @param context context
+	 * @param vertices vertices with 3 floats per vertex
+	 * @param textureCoordinates texture coordinates with 2 floats per vertex or empty
+	 * @param color color
+	 */
+	void drawTriangles(SoftwareRenderer* renderer, void* context, const vector<float>& vertices, const vector<float>& textureCoordinates, const array<float, 4>& color);
+
+	/**
+	 * Read pixel color
+	 * @param renderer renderer
+	 * @param x x
+	 * @param y y
+	 * @return color
+	 */
+	array<uint8_t, 4> readPixel(SoftwareRenderer* renderer, int32_t x, int32_t y);
+};
@@ -0,0 +1,7 @@
+#include <tdme/tests/TextureAtlasBakerTest.h>
+
+int main(int argc, char** argv)
+{
+	::tdme::tests::TextureAtlasBakerTest::main();
+	return 0;
+}
@@ -0,0 +1,177 @@
+#include <tdme/tests/TextureAtlasBakerTest.h>
+
+#include <array>
+#include <string>
+#include <vector>
+
+#include <tdme/engine/fileio/textures/Texture.h>
+#include <tdme/engine/model/Face.h>
+#include <tdme/engine/model/FacesEntity.h>
+#include <tdme/engine/model/Group.h>
+#include <tdme/engine/model/Material.h>
+#include <tdme/engine/model/Model.h>
+#include <tdme/engine/model/RotationOrder.h>
+#include <tdme/engine/model/SpecularMaterialProperties.h>
+#include <tdme/engine/model/TextureAtlasBaker.h>
+#include <tdme/engine/model/TextureAtlasStatistics.h>
+#include <tdme/engine/model/TextureCoordinate.h>
+#include <tdme/engine/model/UpVector.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/utils/ByteBuffer.h>
+#include <tdme/utils/Console.h>
+
+using std::array;
+using std::string;
+using std::to_string;
+using std::vector;
+
+using tdme::tests::TextureAtlasBakerTest;
+using tdme::engine::fileio::textures::Texture;
+using tdme::engine::model::Face;
+using tdme::engine::model::FacesEntity;
+using tdme::engine::model::Group;
+using tdme::engine::model::Material;
+using tdme::engine::model::Model;
+using tdme::engine::model::RotationOrder;
+using tdme::engine::model::SpecularMaterialProperties;
+using tdme::engine::model::TextureAtlasBaker;
+using tdme::engine::model::TextureAtlasStatistics;
+using tdme::engine::model::TextureCoordinate;
+using tdme::engine::model::UpVector;
+using tdme::math::Vector3;
+using tdme::utils::ByteBuffer;
+using tdme::utils::Console;
+
+TextureAtlasBakerTest::TextureAtlasBakerTest()
+{
+}
+
+void TextureAtlasBakerTest::main()
+{
+	auto tabt = new TextureAtlasBakerTest();
+	Console::println(string("Texture atlas baker tests:"));
+	tabt->testBake();
+	delete tabt;
+}
+
+void TextureAtlasBakerTest::printResult(const string& test, bool result) {
+	Console::println(test + ": " + (result == true?success:fail));
+}
+
+Texture* TextureAtlasBakerTest::createTexture(const string& id, int32_t size, uint8_t red, uint8_t green, uint8_t blue) {
+	auto textureData = ByteBuffer::allocate(size * size * 4);
+	for (auto i = 0; i < size * size; i++) {
+		textureData->put(red);
+		textureData->put(green);
+		textureData->put(blue);
+		textureData->put(255);
+	}
+	return new Texture(id, 32, size, size, size, size, textureData);
+}
+
+void TextureAtlasBakerTest::addQuad(Group* group, Material* material, float textureCoordinateMax) {
+	auto vertices = group->getVertices();
+	auto normals = group->getNormals();
+	auto textureCoordinates = group->getTextureCoordinates();
+	auto facesEntities = group->getFacesEntities();
+	auto vertexIdx = static_cast<int32_t>(vertices.size());
+	auto normalIdx = static_cast<int32_t>(normals.size());
+	vertices.push_back(Vector3(0.0f, 0.0f, 0.0f));
+	vertices.push_back(Vector3(1.0f, 0.0f, 0.0f));
+	vertices.push_back(Vector3(1.0f, 1.0f, 0.0f));
+	vertices.push_back(Vector3(0.0f, 1.0f, 0.0f));
+	normals.push_back(Vector3(0.0f, 0.0f, 1.0f));
+	textureCoordinates.push_back(TextureCoordinate(array<float, 2> {0.0f, 0.0f}));
+	textureCoordinates.push_back(TextureCoordinate(array<float, 2> {textureCoordinateMax, 0.0f}));
+	textureCoordinates.push_back(TextureCoordinate(array<float, 2> {textureCoordinateMax, textureCoordinateMax}));
+	textureCoordinates.push_back(TextureCoordinate(array<float, 2> {0.0f, textureCoordinateMax}));
+	FacesEntity facesEntity(group, material->getId());
+	facesEntity.setMaterial(material);
+	facesEntity.setFaces(
+		{
+			Face(group, vertexIdx + 0, vertexIdx + 1, vertexIdx + 2, normalIdx, normalIdx, normalIdx, vertexIdx + 0, vertexIdx + 1, vertexIdx + 2),
+			Face(group, vertexIdx + 2, vertexIdx + 3, vertexIdx + 0, normalIdx, normalIdx, normalIdx, vertexIdx + 2, vertexIdx + 3, vertexIdx + 0)
+		}
+	);
+	facesEntities.push_back(facesEntity);
+	group->setVertices(vertices);
+	group->setNormals(normals);
+	group->setTextureCoordinates(textureCoordinates);
+	group->setFacesEntities(facesEntities);
+}
+
+void TextureAtlasBakerTest::testBake()
+{
+	Console::println(string("\nBake\n----"));
+
+	// two models with 3 materials, where one material repeats its texture
+	vector<Model*> models;
+	vector<Material*> materials;
+	for (auto i = 0; i < 2; i++) {
+		auto model = new Model("model" + to_string(i), "model" + to_string(i), UpVector::Y_UP, RotationOrder::ZYX, nullptr);
+		auto group = new Group(model, nullptr, "group", "group");
+		model->getSubGroups()[group->getId()] = group;
+		model->getGroups()[group->getId()] = group;
+		for (auto j = 0; j < (i == 0?2:1); j++) {
+			auto materialIdx = materials.size();
+			auto material = new Material("material" + to_string(materialIdx));
+			material->getSpecularMaterialProperties()->setDiffuseTexture(createTexture("texture" + to_string(materialIdx), materialIdx == 1?64:32, materialIdx * 100, 50, 255 - materialIdx * 100));
+			model->getMaterials()[material->getId()] = material;
+			addQuad(group, material, materialIdx == 2?2.0f:1.0f);
+			materials.push_back(material);
+		}
+		models.push_back(model);
+	}
+	// third model material shares properties of first materials but repeats texture
+	auto material3 = new Material("material3");
+	material3->getSpecularMaterialProperties()->setDiffuseTexture(materials[0]->getSpecularMaterialProperties()->getDiffuseTexture());
+	models[1]->getMaterials()[material3->getId()] = material3;
+	addQuad(models[1]->getGroupById("group"), material3, 1.0f);
+	materials.push_back(material3);
+
+	//
+	TextureAtlasStatistics statistics;
+	TextureAtlasBaker textureAtlasBaker("test", 128, 4);
+	for (auto model: models) textureAtlasBaker.addModel(model);
+	textureAtlasBaker.bake(&statistics);
+	printResult(
+		"statistics: materials: " + to_string(statistics.materialCount) +
+		", atlas materials: " + to_string(statistics.atlasMaterialCount) +
+		", atlas textures: " + to_string(statistics.atlasTextureCount) +
+		", atlases: " + to_string(statistics.atlasCount) +
+		", packing efficiency: " + to_string(statistics.packingEfficiency),
+		statistics.materialCount == 4 && statistics.atlasMaterialCount == 3 && statistics.atlasTextureCount == 1 && statistics.atlasCount == 1 &&
+		statistics.packingEfficiency > 0.3f && statistics.packingEfficiency <= 1.0f
+	);
+	auto atlasMaterial = textureAtlasBaker.getAtlasMaterial(materials[0]);
+	printResult(
+		"atlas material shared",
+		atlasMaterial != nullptr &&
+		textureAtlasBaker.getAtlasMaterial(materials[1]) == atlasMaterial &&
+		textureAtlasBaker.getAtlasMaterial(materials[3]) == atlasMaterial
+	);
+	printResult("repeating material excluded", textureAtlasBaker.getAtlasMaterial(materials[2]) == nullptr);
+	if (atlasMaterial == nullptr) return;
+
+	// sample atlas at remapped texture coordinates
+	auto atlasTexture = atlasMaterial->getSpecularMaterialProperties()->getDiffuseTexture();
+	printResult("atlas texture does not repeat", atlasTexture != nullptr && atlasTexture->isRepeat() == false);
+	auto atlasSize = atlasTexture->getTextureWidth();
+	auto atlasData = atlasTexture->getTextureData();
+	auto remapSuccess = true;
+	for (auto materialIdx: {0, 1, 3}) {
+		auto expectedRed = (materialIdx == 3?0:materialIdx) * 100;
+		for (auto uv: {array<float, 2> {0.0f, 0.0f}, array<float, 2> {0.5f, 0.25f}, array<float, 2> {0.999f, 0.999f}}) {
+			auto atlasUV = textureAtlasBaker.remapTextureCoordinate(materials[materialIdx], TextureCoordinate(uv)).getArray();
+			auto x = static_cast<int32_t>(atlasUV[0] * atlasSize);
+			auto y = static_cast<int32_t>(atlasUV[1] * atlasSize);
+			if (x < 0 || x >= atlasSize || y < 0 || y >= atlasSize || atlasData->get((y * atlasSize + x) * 4) != expectedRed) remapSuccess = false;
+			// padding must replicate texture edges
+			if (uv[0] == 0.0f && (x < 1 || atlasData->get((y * atlasSize + x - 1) * 4) != expectedRed)) remapSuccess = false;
+		}
+	}
+	printResult("remapped texture coordinates", remapSuccess == true);
+
+	//
+	for (auto model: models) delete model;
+}
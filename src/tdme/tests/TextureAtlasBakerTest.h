@@ -0,0 +1,60 @@
+#pragma once
+
+#include <string>
+
+#include <tdme/tdme.h>
+#include <tdme/engine/fileio/textures/fwd-tdme.h>
+#include <tdme/engine/model/fwd-tdme.h>
+#include <tdme/tests/fwd-tdme.h>
+
+using std::string;
+
+using tdme::engine::fileio::textures::Texture;
+using tdme::engine::model::Group;
+using tdme::engine::model::Material;
+using tdme::engine::model::Model;
+
+/**
+ * Texture atlas baker test
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::tests::TextureAtlasBakerTest final
+{
+public:
+	static void main();
+
+	TextureAtlasBakerTest();
+
+	void testBake();
+
+private:
+	string success = "Success";
+	string fail = "Fail";
+
+	/**
+	 * Print test result
+	 * @param test test
+	 * @param result result
+	 */
+	void printResult(const string& test, bool result);
+
+	/**
+	 * Create texture filled with given color
+	 * @param id id
+	 * @param size texture width and height
+	 * @param red red
+	 * @param green green
+	 * @param blue blue
+	 * @return texture
+	 */
+	Texture* createTexture(const string& id, int32_t size, uint8_t red, uint8_t green, uint8_t blue);
+
+	/**
+	 * Add a quad with given material and texture coordinates ranging from 0 to given max texture coordinate
+	 * @param group group
+	 * @param material material
+	 * @param textureCoordinateMax max texture coordinate
+	 */
+	void addQuad(Group* group, Material* material, float textureCoordinateMax);
+};
@@ -0,0 +1,7 @@
+#include <tdme/tests/TransparencySortingTest.h>
+
+int main(int argc, char** argv)
+{
+	::tdme::tests::TransparencySortingTest::main();
+	return 0;
+}
@@ -0,0 +1,232 @@
+#include <tdme/tests/TransparencySortingTest.h>
+
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+#include <tdme/engine/model/Color4.h>
+#include <tdme/engine/subsystems/rendering/RenderTransparentRenderPointsPool.h>
+#include <tdme/engine/subsystems/rendering/TransparentRenderFace.h>
+#include <tdme/engine/subsystems/rendering/TransparentRenderFacesPool.h>
+#include <tdme/engine/subsystems/rendering/TransparentRenderPoint.h>
+#include <tdme/engine/subsystems/rendering/TransparentRenderPointsPool.h>
+#include <tdme/math/Matrix4x4.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/RadixSort.h>
+#include <tdme/utils/Time.h>
+
+using std::equal;
+using std::mt19937;
+using std::sort;
+using std::string;
+using std::to_string;
+using std::uniform_real_distribution;
+using std::vector;
+
+using tdme::tests::TransparencySortingTest;
+using tdme::engine::model::Color4;
+using tdme::engine::subsystems::rendering::RenderTransparentRenderPointsPool;
+using tdme::engine::subsystems::rendering::TransparentRenderFace;
+using tdme::engine::subsystems::rendering::TransparentRenderFacesPool;
+using tdme::engine::subsystems::rendering::TransparentRenderPoint;
+using tdme::engine::subsystems::rendering::TransparentRenderPointsPool;
+using tdme::math::Matrix4x4;
+using tdme::math::Vector3;
+using tdme::utils::Console;
+using tdme::utils::RadixSort;
+using tdme::utils::Time;
+
+TransparencySortingTest::TransparencySortingTest()
+{
+}
+
+void TransparencySortingTest::main()
+{
+	auto tst = new TransparencySortingTest();
+	Console::println(string("Transparency sorting tests:"));
+	tst->testFaceSorting();
+	tst->testClusterSorting();
+	tst->testPointSorting();
+	tst->testPerformance();
+	delete tst;
+}
+
+void TransparencySortingTest::printResult(const string& test, bool result) {
+	Console::println(test + ": " + (result == true?success:fail));
+}
+
+void TransparencySortingTest::testFaceSorting()
+{
+	Console::println(string("\nFace sorting\n------------"));
+
+	mt19937 random(42);
+	uniform_real_distribution<float> distribution(-100.0f, 1000.0f);
+	vector<TransparentRenderFace> faces(10000);
+	vector<TransparentRenderFace*> transparentRenderFaces;
+	for (auto i = 0; i < faces.size(); i++) {
+		faces[i].faceIdx = i;
+		faces[i].distanceFromCamera = i % 10 == 0?50.0f:distribution(random);
+		transparentRenderFaces.push_back(&faces[i]);
+	}
+	vector<int32_t> transparentRenderFacesClusters;
+	vector<TransparentRenderFacesPool::SortEntry> sortEntries;
+	vector<TransparentRenderFacesPool::SortEntry> sortEntriesBuffer;
+	vector<TransparentRenderFace*> sortedTransparentRenderFaces;
+	TransparentRenderFacesPool::sort(transparentRenderFaces, transparentRenderFacesClusters, sortEntries, sortEntriesBuffer, sortedTransparentRenderFaces);
+	auto sorted = sortedTransparentRenderFaces.size() == transparentRenderFaces.size();
+	auto stable = true;
+	for (auto i = 1; sorted == true && i < sortedTransparentRenderFaces.size(); i++) {
+		auto face1 = sortedTransparentRenderFaces[i - 1];
+		auto face2 = sortedTransparentRenderFaces[i];
+		if (face1->distanceFromCamera < face2->distanceFromCamera) sorted = false;
+		if (face1->distanceFromCamera == face2->distanceFromCamera && face1->faceIdx > face2->faceIdx) stable = false;
+	}
+	printResult("faces sorted from far to near", sorted);
+	printResult("faces with same distance keep order", stable);
+}
+
+void TransparencySortingTest::testClusterSorting()
+{
+	Console::println(string("\nCluster sorting\n---------------"));
+
+	// 3 clusters with 3, 1 and 2 faces
+	vector<float> clusterDistances = { 10.0f, 30.0f, 20.0f };
+	vector<int32_t> transparentRenderFacesClusters = { 0, 3, 4 };
+	vector<TransparentRenderFace> faces(6);
+	vector<TransparentRenderFace*> transparentRenderFaces;
+	for (auto i = 0; i < faces.size(); i++) {
+		faces[i].faceIdx = i;
+		faces[i].distanceFromCamera = clusterDistances[i < 3?0:(i < 4?1:2)];
+		transparentRenderFaces.push_back(&faces[i]);
+	}
+	vector<TransparentRenderFacesPool::SortEntry> sortEntries;
+	vector<TransparentRenderFacesPool::SortEntry> sortEntriesBuffer;
+	vector<TransparentRenderFace*> sortedTransparentRenderFaces;
+	TransparentRenderFacesPool::sort(transparentRenderFaces, transparentRenderFacesClusters, sortEntries, sortEntriesBuffer, sortedTransparentRenderFaces);
+	vector<int32_t> expectedFaceIndices = { 3, 4, 5, 0, 1, 2 };
+	auto sorted = sortedTransparentRenderFaces.size() == expectedFaceIndices.size();
+	for (auto i = 0; sorted == true && i < sortedTransparentRenderFaces.size(); i++) {
+		if (sortedTransparentRenderFaces[i]->faceIdx != expectedFaceIndices[i]) sorted = false;
+	}
+	printResult("clusters sorted from far to near, faces keep order within cluster", sorted);
+}
+
+void TransparencySortingTest::testPointSorting()
+{
+	Console::println(string("\nPoint sorting\n-------------"));
+
+	// 2 particle systems, which are merged and sorted on their own like combined particle systems
+	mt19937 random(42);
+	uniform_real_distribution<float> distribution(-1000.0f, 100.0f);
+	TransparentRenderPointsPool pointsPool1(1000);
+	TransparentRenderPointsPool pointsPool2(1000);
+	for (auto i = 0; i < 1000; i++) {
+		pointsPool1.addPoint(Vector3(0.0f, 0.0f, i % 10 == 0?-50.0f:distribution(random)), i, Color4(1.0f, 1.0f, 1.0f, 1.0f), 0, &pointsPool1);
+		pointsPool2.addPoint(Vector3(0.0f, 0.0f, distribution(random)), i, Color4(1.0f, 1.0f, 1.0f, 1.0f), 0, &pointsPool2);
+	}
+	// render points pool grows beyond its initial capacity
+	RenderTransparentRenderPointsPool renderPointsPool(1000);
+	Matrix4x4 cameraMatrix;
+	cameraMatrix.identity();
+	renderPointsPool.merge(&pointsPool1, cameraMatrix);
+	renderPointsPool.sort(0, renderPointsPool.getTransparentRenderPointsCount());
+	auto pointsEnd1 = renderPointsPool.getTransparentRenderPointsCount();
+	renderPointsPool.merge(&pointsPool2, cameraMatrix);
+	renderPointsPool.sort(pointsEnd1, renderPointsPool.getTransparentRenderPointsCount());
+	auto& points = renderPointsPool.getTransparentRenderPoints();
+	auto sorted = renderPointsPool.getTransparentRenderPointsCount() == 2000;
+	auto stable = true;
+	for (auto i = 0; sorted == true && i < renderPointsPool.getTransparentRenderPointsCount(); i++) {
+		// points stay in range of their particle system
+		if (points[i]->particleSystem != (i < pointsEnd1?static_cast<void*>(&pointsPool1):static_cast<void*>(&pointsPool2))) sorted = false;
+		if (i == 0 || i == pointsEnd1) continue;
+		// depth is quantized by dropping the lowest 8 bits of float keys
+		auto key1 = RadixSort::getFloatKey(points[i - 1]->point.getZ()) & 0xffffff00;
+		auto key2 = RadixSort::getFloatKey(points[i]->point.getZ()) & 0xffffff00;
+		if (key1 > key2) sorted = false;
+		if (key1 == key2 && points[i - 1]->spriteIndex > points[i]->spriteIndex) stable = false;
+	}
+	printResult("points of combined particle systems sorted from far to near", sorted);
+	printResult("points with same depth keep order", stable);
+
+	// sorting sorted points again does not change them
+	auto sortedPoints = vector<TransparentRenderPoint*>(points.begin(), points.begin() + renderPointsPool.getTransparentRenderPointsCount());
+	renderPointsPool.sort(0, pointsEnd1);
+	renderPointsPool.sort(pointsEnd1, renderPointsPool.getTransparentRenderPointsCount());
+	printResult("sorted points stay sorted", equal(sortedPoints.begin(), sortedPoints.end(), points.begin()));
+
+	// performance
+	TransparentRenderPointsPool pointsPool(65535);
+	vector<Vector3> pointPositions;
+	for (auto i = 0; i < 65535; i++) pointPositions.push_back(Vector3(0.0f, 0.0f, distribution(random)));
+	auto stdSortTime = 0LL;
+	auto radixSortTime = 0LL;
+	for (auto i = 0; i < 10; i++) {
+		pointsPool.reset();
+		for (auto& pointPosition: pointPositions) pointsPool.addPoint(pointPosition, 0, Color4(1.0f, 1.0f, 1.0f, 1.0f), 0, &pointsPool);
+		auto stdSortTransparentRenderPoints = vector<TransparentRenderPoint*>(pointsPool.getTransparentRenderPoints().begin(), pointsPool.getTransparentRenderPoints().end());
+		auto start = Time::getCurrentMillis();
+		sort(stdSortTransparentRenderPoints.begin(), stdSortTransparentRenderPoints.end(), TransparentRenderPoint::compare);
+		stdSortTime+= Time::getCurrentMillis() - start;
+		renderPointsPool.reset();
+		renderPointsPool.merge(&pointsPool, cameraMatrix);
+		start = Time::getCurrentMillis();
+		renderPointsPool.sort();
+		radixSortTime+= Time::getCurrentMillis() - start;
+	}
+	Console::println("65535 points, 10 times: std::sort: " + to_string(stdSortTime) + "ms, radix sort: " + to_string(radixSortTime) + "ms");
+}
+
+void TransparencySortingTest::testPerformance()
+{
+	Console::println(string("\nPerformance\n-----------"));
+
+	mt19937 random(42);
+	uniform_real_distribution<float> distribution(0.0f, 1000.0f);
+	vector<TransparentRenderFacesPool::SortEntry> sortEntries;
+	vector<TransparentRenderFacesPool::SortEntry> sortEntriesBuffer;
+	vector<TransparentRenderFace*> sortedTransparentRenderFaces;
+	for (auto faceCount: vector<int32_t> { 1000, 10000, 100000, 1000000 }) {
+		// faces, clusters of 256 faces each
+		vector<TransparentRenderFace> faces(faceCount);
+		vector<TransparentRenderFace*> transparentRenderFaces;
+		vector<int32_t> transparentRenderFacesClusters;
+		vector<int32_t> noTransparentRenderFacesClusters;
+		for (auto i = 0; i < faceCount; i++) {
+			faces[i].faceIdx = i;
+			faces[i].distanceFromCamera = distribution(random);
+			transparentRenderFaces.push_back(&faces[i]);
+			if (i % 256 == 0) transparentRenderFacesClusters.push_back(i);
+		}
+		// std::sort of face pointers
+		auto stdSortTime = 0LL;
+		for (auto i = 0; i < 10; i++) {
+			auto stdSortTransparentRenderFaces = transparentRenderFaces;
+			auto start = Time::getCurrentMillis();
+			sort(stdSortTransparentRenderFaces.begin(), stdSortTransparentRenderFaces.end(), TransparentRenderFace::compare);
+			stdSortTime+= Time::getCurrentMillis() - start;
+		}
+		// radix sort per face
+		auto faceSortTime = 0LL;
+		for (auto i = 0; i < 10; i++) {
+			auto start = Time::getCurrentMillis();
+			TransparentRenderFacesPool::sort(transparentRenderFaces, noTransparentRenderFacesClusters, sortEntries, sortEntriesBuffer, sortedTransparentRenderFaces);
+			faceSortTime+= Time::getCurrentMillis() - start;
+		}
+		// radix sort per cluster
+		auto clusterSortTime = 0LL;
+		for (auto i = 0; i < 10; i++) {
+			auto start = Time::getCurrentMillis();
+			TransparentRenderFacesPool::sort(transparentRenderFaces, transparentRenderFacesClusters, sortEntries, sortEntriesBuffer, sortedTransparentRenderFaces);
+			clusterSortTime+= Time::getCurrentMillis() - start;
+		}
+		Console::println(
+			to_string(faceCount) + " faces, 10 times: " +
+			"std::sort: " + to_string(stdSortTime) + "ms, " +
+			"radix sort per face: " + to_string(faceSortTime) + "ms, " +
+			"radix sort per cluster of 256 faces: " + to_string(clusterSortTime) + "ms"
+		);
+	}
+}
@@ -72,6 +72,7 @@ int main(int argc, char *argv[]) {
 
 	// start echo server
 	server = new EchoUDPServer("127.0.0.1", 10000, 100);
+	server->setStatisticsDumpInterval(10000L);
 	bc = new ServerBroadcaster(server);
 	bc->start();
 	server->start();
@@ -0,0 +1,7 @@
+#include <tdme/tests/VertexPackingTest.h>
+
+int main(int argc, char** argv)
+{
+	::tdme::tests::VertexPackingTest::main();
+	return 0;
+}
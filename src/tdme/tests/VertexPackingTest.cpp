@@ -0,0 +1,148 @@
+#include <tdme/tests/VertexPackingTest.h>
+
+#include <array>
+#include <string>
+
+#include <tdme/engine/model/TextureCoordinate.h>
+#include <tdme/engine/subsystems/rendering/VertexPacking.h>
+#include <tdme/math/Math.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/utils/Console.h>
+
+using std::array;
+using std::string;
+using std::to_string;
+
+using tdme::tests::VertexPackingTest;
+using tdme::engine::model::TextureCoordinate;
+using tdme::engine::subsystems::rendering::VertexPacking;
+using tdme::math::Math;
+using tdme::math::Vector3;
+using tdme::utils::Console;
+
+VertexPackingTest::VertexPackingTest()
+{
+}
+
+void VertexPackingTest::main()
+{
+	auto vpt = new VertexPackingTest();
+	Console::println(string("Vertex packing tests:"));
+	vpt->testHalfFloat();
+	vpt->testSignedNormalized1010102();
+	vpt->testPackedVertex();
+	delete vpt;
+}
+
+void VertexPackingTest::printResult(const string& test, bool result) {
+	Console::println(test + ": " + (result == true?success:fail));
+}
+
+void VertexPackingTest::testHalfFloat()
+{
+	Console::println(string("\nHalf float\n----------"));
+
+	// exactly representable values
+	printResult("encode 0.0", VertexPacking::encodeHalfFloat(0.0f) == 0x0000);
+	printResult("encode -0.0", VertexPacking::encodeHalfFloat(-0.0f) == 0x8000);
+	printResult("encode 1.0", VertexPacking::encodeHalfFloat(1.0f) == 0x3C00);
+	printResult("encode -2.0", VertexPacking::encodeHalfFloat(-2.0f) == 0xC000);
+	printResult("encode 0.5", VertexPacking::encodeHalfFloat(0.5f) == 0x3800);
+	printResult("encode 65504.0", VertexPacking::encodeHalfFloat(65504.0f) == 0x7BFF);
+	printResult("encode smallest normal", VertexPacking::encodeHalfFloat(Math::pow(2.0, -14.0)) == 0x0400);
+	printResult("encode smallest subnormal", VertexPacking::encodeHalfFloat(Math::pow(2.0, -24.0)) == 0x0001);
+
+	// rounding
+	printResult("round 1/3", VertexPacking::encodeHalfFloat(1.0f / 3.0f) == 0x3555);
+	printResult("round halfway to even down", VertexPacking::encodeHalfFloat(1.0f + Math::pow(2.0, -11.0)) == 0x3C00);
+	printResult("round halfway to even up", VertexPacking::encodeHalfFloat(1.0f + 3.0f * Math::pow(2.0, -11.0)) == 0x3C02);
+	printResult("round to infinity", VertexPacking::encodeHalfFloat(65520.0f) == 0x7C00);
+	printResult("round to zero", VertexPacking::encodeHalfFloat(Math::pow(2.0, -26.0)) == 0x0000);
+
+	// special values
+	printResult("encode infinity", VertexPacking::encodeHalfFloat(Math::pow(2.0, 200.0)) == 0x7C00);
+	auto nan = VertexPacking::decodeHalfFloat(0x7E00);
+	printResult("decode NaN", nan != nan);
+	printResult("encode NaN", (VertexPacking::encodeHalfFloat(nan) & 0x7FFF) > 0x7C00);
+
+	// every half float except NaNs must survive decoding and encoding
+	auto roundTripFailures = 0;
+	for (auto i = 0; i < 65536; i++) {
+		auto half = static_cast<uint16_t>(i);
+		if ((half & 0x7C00) == 0x7C00 && (half & 0x03FF) != 0) continue;
+		if (VertexPacking::encodeHalfFloat(VertexPacking::decodeHalfFloat(half)) != half) roundTripFailures++;
+	}
+	printResult("round trip of all half floats, failures: " + to_string(roundTripFailures), roundTripFailures == 0);
+
+	// relative error for texture coordinate range
+	auto maxRelativeError = 0.0f;
+	for (auto i = -40000; i <= 40000; i++) {
+		auto value = static_cast<float>(i) / 10000.0f + 0.00001234f;
+		auto error = Math::abs(VertexPacking::decodeHalfFloat(VertexPacking::encodeHalfFloat(value)) - value);
+		maxRelativeError = Math::max(maxRelativeError, Math::abs(value) < 0.0001f?0.0f:error / Math::abs(value));
+	}
+	printResult("max relative error " + to_string(maxRelativeError) + " in [-4.0, 4.0]", maxRelativeError <= Math::pow(2.0, -11.0));
+}
+
+void VertexPackingTest::testSignedNormalized1010102()
+{
+	Console::println(string("\nSigned normalized 10:10:10:2\n----------------------------"));
+
+	// exactly representable values
+	Vector3 decoded;
+	auto w = VertexPacking::decodeSignedNormalized1010102(VertexPacking::encodeSignedNormalized1010102(Vector3(1.0f, 0.0f, -1.0f), 1), decoded);
+	printResult("encode (1.0, 0.0, -1.0), 1", decoded.equals(Vector3(1.0f, 0.0f, -1.0f), Math::EPSILON) == true && w == 1);
+	w = VertexPacking::decodeSignedNormalized1010102(VertexPacking::encodeSignedNormalized1010102(Vector3(0.0f, -1.0f, 0.0f), -1), decoded);
+	printResult("encode (0.0, -1.0, 0.0), -1", decoded.equals(Vector3(0.0f, -1.0f, 0.0f), Math::EPSILON) == true && w == -1);
+	w = VertexPacking::decodeSignedNormalized1010102(VertexPacking::encodeSignedNormalized1010102(Vector3(2.0f, -2.0f, 0.5f)), decoded);
+	printResult("clamp (2.0, -2.0, 0.5), 0", decoded.equals(Vector3(1.0f, -1.0f, 0.5f), 1.0f / 511.0f) == true && w == 0);
+
+	// angle error of random unit vectors
+	auto maxAngleError = 0.0f;
+	for (auto i = 0; i < 100000; i++) {
+		auto vector = Vector3(Math::random() * 2.0f - 1.0f, Math::random() * 2.0f - 1.0f, Math::random() * 2.0f - 1.0f);
+		if (vector.computeLengthSquared() < Math::EPSILON) continue;
+		vector.normalize();
+		VertexPacking::decodeSignedNormalized1010102(VertexPacking::encodeSignedNormalized1010102(vector), decoded);
+		maxAngleError = Math::max(maxAngleError, 180.0f / Math::PI * Math::acos(Math::clamp(Vector3::computeDotProduct(vector, decoded.normalize()), -1.0f, 1.0f)));
+	}
+	printResult("max angle error " + to_string(maxAngleError) + " degrees", maxAngleError < 0.2f);
+}
+
+void VertexPackingTest::testPackedVertex()
+{
+	Console::println(string("\nPacked vertex\n-------------"));
+
+	printResult("packed vertex size " + to_string(sizeof(VertexPacking::PackedVertex)), sizeof(VertexPacking::PackedVertex) == 24);
+
+	// pack and unpack right and left handed tangent spaces
+	Vector3 normal(0.0f, 1.0f, 0.0f);
+	Vector3 tangent(1.0f, 0.0f, 0.0f);
+	Vector3 rightHandedBitangent;
+	Vector3 leftHandedBitangent;
+	Vector3::computeCrossProduct(normal, tangent, rightHandedBitangent);
+	leftHandedBitangent.set(rightHandedBitangent).scale(-1.0f);
+	TextureCoordinate textureCoordinate(0.25f, 1.5f);
+	VertexPacking::PackedVertex packedVertex;
+	Vector3 unpackedVertex;
+	Vector3 unpackedNormal;
+	Vector3 unpackedTangent;
+	Vector3 unpackedBitangent;
+	TextureCoordinate unpackedTextureCoordinate;
+	VertexPacking::pack(Vector3(1.5f, -2.25f, 1000.125f), normal, &tangent, &rightHandedBitangent, &textureCoordinate, packedVertex);
+	VertexPacking::unpack(packedVertex, unpackedVertex, unpackedNormal, unpackedTangent, unpackedBitangent, unpackedTextureCoordinate);
+	printResult("vertex", unpackedVertex.equals(Vector3(1.5f, -2.25f, 1000.125f), Math::EPSILON) == true);
+	printResult("normal", unpackedNormal.equals(normal, 1.0f / 511.0f) == true);
+	printResult("tangent", unpackedTangent.equals(tangent, 1.0f / 511.0f) == true);
+	printResult("right handed bitangent", unpackedBitangent.equals(rightHandedBitangent, 2.0f / 511.0f) == true);
+	printResult("texture coordinate", unpackedTextureCoordinate.equals(textureCoordinate, 0.001f) == true);
+	VertexPacking::pack(Vector3(1.5f, -2.25f, 1000.125f), normal, &tangent, &leftHandedBitangent, &textureCoordinate, packedVertex);
+	VertexPacking::unpack(packedVertex, unpackedVertex, unpackedNormal, unpackedTangent, unpackedBitangent, unpackedTextureCoordinate);
+	printResult("left handed bitangent", unpackedBitangent.equals(leftHandedBitangent, 2.0f / 511.0f) == true);
+
+	// without tangents and texture coordinates
+	VertexPacking::pack(Vector3(0.0f, 0.0f, 0.0f), normal, nullptr, nullptr, nullptr, packedVertex);
+	VertexPacking::unpack(packedVertex, unpackedVertex, unpackedNormal, unpackedTangent, unpackedBitangent, unpackedTextureCoordinate);
+	printResult("no tangent", unpackedTangent.equals(Vector3(0.0f, 0.0f, 0.0f), Math::EPSILON) == true && unpackedBitangent.equals(Vector3(0.0f, 0.0f, 0.0f), Math::EPSILON) == true);
+	printResult("no texture coordinate", unpackedTextureCoordinate.equals(TextureCoordinate(array<float, 2> {{ 0.0f, 0.0f }}), Math::EPSILON) == true);
+}
@@ -0,0 +1,36 @@
+#pragma once
+
+#include <string>
+
+#include <tdme/tdme.h>
+#include <tdme/tests/fwd-tdme.h>
+
+using std::string;
+
+/**
+ * Vertex packing test
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::tests::VertexPackingTest final
+{
+public:
+	static void main();
+
+	VertexPackingTest();
+
+	void testHalfFloat();
+	void testSignedNormalized1010102();
+	void testPackedVertex();
+
+private:
+	string success = "Success";
+	string fail = "Fail";
+
+	/**
+	 * Print test result
+	 * @param test test
+	 * @param result result
+	 */
+	void printResult(const string& test, bool result);
+};
@@ -0,0 +1,7 @@
+#include <tdme/tests/XMLPullParserTest.h>
+
+int main(int argc, char** argv)
+{
+	::tdme::tests::XMLPullParserTest::main();
+	return 0;
+}
@@ -0,0 +1,204 @@
+#include <tdme/tests/XMLPullParserTest.h>
+
+#include <string>
+#include <vector>
+
+#include <tdme/os/filesystem/FileSystem.h>
+#include <tdme/os/filesystem/FileSystemInterface.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/Exception.h>
+#include <tdme/utils/XMLPullParser.h>
+
+using std::string;
+using std::to_string;
+using std::vector;
+
+using tdme::tests::XMLPullParserTest;
+using tdme::os::filesystem::FileSystem;
+using tdme::os::filesystem::FileSystemInterface;
+using tdme::utils::Console;
+using tdme::utils::Exception;
+using tdme::utils::XMLPullParser;
+
+XMLPullParserTest::XMLPullParserTest()
+{
+}
+
+void XMLPullParserTest::main()
+{
+	auto xppt = new XMLPullParserTest();
+	Console::println(string("XML pull parser tests:"));
+	xppt->testEvents();
+	xppt->testNumbers();
+	xppt->testRange();
+	FileSystem::getInstance()->removeFile(xppt->pathName, xppt->fileName);
+	delete xppt;
+}
+
+void XMLPullParserTest::printResult(const string& test, bool result) {
+	Console::println(test + ": " + (result == true?success:fail));
+}
+
+void XMLPullParserTest::testEvents()
+{
+	Console::println(string("\nEvents\n------"));
+
+	FileSystem::getInstance()->setContentFromString(
+		pathName,
+		fileName,
+		"<?xml version=\"1.0\" encoding=\"utf-8\"?>\n"
+		"<!DOCTYPE root [ <!ELEMENT root ANY> ]>\n"
+		"<!-- comment with <element> -->\n"
+		"<root version=\"1.4.1\" name='a &amp; b &lt;c&gt;'>\n"
+		"\t<empty id=\"e\"/>\n"
+		"\t<text>  hello \n\t world &#65;&#x42;  </text>\n"
+		"\t<cdata><![CDATA[<raw> & text]]></cdata>\n"
+		"\t<?instruction?>\n"
+		"</root>\n"
+	);
+	string expectedEvents = "start:root[version=1.4.1,name=a & b <c>](1) start:empty[id=e](2) end:empty(1) start:text(2) text:hello world AB end:text(1) start:cdata(2) text:<raw> & text end:cdata(1) end:root(0) end";
+	for (auto chunkSize: {1, 3, 1024 * 1024}) {
+		string events;
+		try {
+			XMLPullParser xmlParser(pathName, fileName, 0LL, UINT64_MAX, chunkSize);
+			while (true == true) {
+				auto event = xmlParser.next();
+				if (events.empty() == false) events+= " ";
+				if (event == XMLPullParser::EVENTTYPE_START_ELEMENT) {
+					events+= "start:" + xmlParser.getName();
+					if (xmlParser.getAttributes().empty() == false) {
+						events+= "[";
+						for (auto& attribute: xmlParser.getAttributes()) {
+							if (events[events.size() - 1] != '[') events+= ",";
+							events+= attribute.first + "=" + attribute.second;
+						}
+						events+= "]";
+					}
+					events+= "(" + to_string(xmlParser.getDepth()) + ")";
+				} else
+				if (event == XMLPullParser::EVENTTYPE_END_ELEMENT) {
+					events+= "end:" + xmlParser.getName() + "(" + to_string(xmlParser.getDepth()) + ")";
+				} else
+				if (event == XMLPullParser::EVENTTYPE_TEXT) {
+					string text;
+					xmlParser.readText(text);
+					events+= "text:" + text;
+				} else {
+					events+= "end";
+					break;
+				}
+			}
+		} catch (Exception& exception) {
+			events = string("error: ") + exception.what();
+		}
+		printResult("events with chunk size " + to_string(chunkSize) + ": " + events, events == expectedEvents);
+	}
+
+	// malformed documents must throw
+	for (auto xml: {"<root><a></root>", "<root>", "<root a=\"1></root>"}) {
+		FileSystem::getInstance()->setContentFromString(pathName, fileName, xml);
+		auto error = false;
+		try {
+			XMLPullParser xmlParser(pathName, fileName);
+			while (xmlParser.next() != XMLPullParser::EVENTTYPE_END_DOCUMENT);
+		} catch (Exception& exception) {
+			error = true;
+		}
+		printResult("malformed document " + string(xml), error == true);
+	}
+}
+
+void XMLPullParserTest::testNumbers()
+{
+	Console::println(string("\nNumbers\n-------"));
+
+	vector<float> expectedFloats;
+	vector<int32_t> expectedInts;
+	string floatsString;
+	string intsString;
+	for (auto i = 0; i < 1000; i++) {
+		expectedFloats.push_back(static_cast<float>(i - 500) * 0.125f);
+		expectedInts.push_back((i - 500) * 7);
+		floatsString+= to_string(expectedFloats[i]) + (i % 10 == 9?"\n":" ");
+		intsString+= to_string(expectedInts[i]) + (i % 10 == 9?"\n":"\t");
+	}
+	FileSystem::getInstance()->setContentFromString(
+		pathName,
+		fileName,
+		"<root><float_array count=\"1000\">\n" + floatsString + "</float_array><p>" + intsString + "</p><float_array>1.5e3 -2E-1 .5</float_array></root>"
+	);
+	for (auto chunkSize: {5, 1024 * 1024}) {
+		vector<float> floats;
+		vector<int32_t> ints;
+		vector<float> exponentFloats;
+		XMLPullParser xmlParser(pathName, fileName, 0LL, UINT64_MAX, chunkSize);
+		XMLPullParser::EventType event;
+		while ((event = xmlParser.next()) != XMLPullParser::EVENTTYPE_END_DOCUMENT) {
+			if (event != XMLPullParser::EVENTTYPE_START_ELEMENT) continue;
+			if (xmlParser.getName() == "float_array") {
+				if (xmlParser.next() == XMLPullParser::EVENTTYPE_TEXT) xmlParser.readFloats(floats.empty() == true?floats:exponentFloats);
+			} else
+			if (xmlParser.getName() == "p") {
+				if (xmlParser.next() == XMLPullParser::EVENTTYPE_TEXT) xmlParser.readInts(ints);
+			}
+		}
+		printResult("floats with chunk size " + to_string(chunkSize), floats == expectedFloats);
+		printResult("integers with chunk size " + to_string(chunkSize), ints == expectedInts);
+		printResult("floats with exponents with chunk size " + to_string(chunkSize), exponentFloats == vector<float>({1500.0f, -0.2f, 0.5f}));
+	}
+	vector<float> floats;
+	XMLPullParser::parseFloats(floatsString, floats);
+	printResult("parse floats", floats == expectedFloats);
+	vector<int32_t> ints;
+	XMLPullParser::parseInts(intsString, ints);
+	printResult("parse integers", ints == expectedInts);
+	auto error = false;
+	try {
+		XMLPullParser::parseFloats("1.0 x 2.0", floats);
+	} catch (Exception& exception) {
+		error = true;
+	}
+	printResult("parse invalid float", error == true);
+}
+
+void XMLPullParserTest::testRange()
+{
+	Console::println(string("\nRange\n-----"));
+
+	string floatsString;
+	vector<float> expectedFloats;
+	for (auto i = 0; i < 100; i++) {
+		expectedFloats.push_back(static_cast<float>(i) * 0.25f);
+		floatsString+= to_string(expectedFloats[i]) + " ";
+	}
+	FileSystem::getInstance()->setContentFromString(
+		pathName,
+		fileName,
+		"<root><float_array>" + floatsString + "</float_array><float_array>1.0</float_array></root>"
+	);
+
+	// remember offset of first array, which is too long to be read as text
+	uint64_t textOffset = 0LL;
+	uint64_t textBytes = 0LL;
+	auto textComplete = true;
+	XMLPullParser xmlParser(pathName, fileName);
+	XMLPullParser::EventType event;
+	while ((event = xmlParser.next()) != XMLPullParser::EVENTTYPE_END_DOCUMENT) {
+		if (event == XMLPullParser::EVENTTYPE_START_ELEMENT && xmlParser.getName() == "float_array" && xmlParser.next() == XMLPullParser::EVENTTYPE_TEXT) {
+			string text;
+			if (xmlParser.readText(text, 64) == false) {
+				textComplete = false;
+				textOffset = xmlParser.getTextOffset();
+				textBytes = xmlParser.getTextBytes();
+			}
+		}
+	}
+	printResult("text exceeds max length", textComplete == false);
+	printResult("text offset " + to_string(textOffset) + " and bytes " + to_string(textBytes), textOffset == string("<root><float_array>").size() && textBytes == floatsString.size());
+
+	// parse numbers of range only
+	vector<float> floats;
+	XMLPullParser rangeParser(pathName, fileName, textOffset, textBytes, 16);
+	rangeParser.readFloats(floats);
+	printResult("floats of range", floats == expectedFloats);
+}
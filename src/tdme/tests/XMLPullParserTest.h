@@ -0,0 +1,38 @@
+#pragma once
+
+#include <string>
+
+#include <tdme/tdme.h>
+#include <tdme/tests/fwd-tdme.h>
+
+using std::string;
+
+/**
+ * XML pull parser test
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::tests::XMLPullParserTest final
+{
+public:
+	static void main();
+
+	XMLPullParserTest();
+
+	void testEvents();
+	void testNumbers();
+	void testRange();
+
+private:
+	string success = "Success";
+	string fail = "Fail";
+	string pathName = ".";
+	string fileName = "xmlpullparsertest.xml";
+
+	/**
+	 * Print test result
+	 * @param test test
+	 * @param result result
+	 */
+	void printResult(const string& test, bool result);
+};
@@ -9,17 +9,26 @@ namespace tests {
 	class EngineTest;
 	class EntityHierarchyTest;
 	class FoliageTest;
+	class LightClustersTest;
 	class LODTest;
 	class MathOperatorTest;
+	class OcclusionCullingTest;
+	class ParticleBufferTest;
 	class PathFindingTest;
 	class PivotTest;
+	class RadixSortTest;
 	class PhysicsTest1;
 	class PhysicsTest2;
 	class PhysicsTest3;
 	class PhysicsTest4;
 	class RayTracingTest;
 	class SkinningTest;
+	class SoftwareRendererTest;
+	class TextureAtlasBakerTest;
+	class TransparencySortingTest;
 	class TreeTest;
+	class VertexPackingTest;
 	class WaterTest;
+	class XMLPullParserTest;
 }  // namespace tests
 }  // namespace tdme
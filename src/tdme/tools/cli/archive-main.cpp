@@ -1,11 +1,17 @@
+#include <string.h>
+
+#include <algorithm>
 #include <cassert>
+#include <cstdlib>
 #include <fstream>
+#include <map>
 #include <string>
 #include <vector>
 
 #include <ext/zlib/zlib.h>
 
 #include <tdme/application/Application.h>
+#include <tdme/os/filesystem/ArchiveFileSystem.h>
 #include <tdme/os/filesystem/FileNameFilter.h>
 #include <tdme/os/filesystem/FileSystem.h>
 #include <tdme/os/filesystem/FileSystemInterface.h>
@@ -14,12 +20,15 @@
 #include <tdme/utils/StringTokenizer.h>
 #include <tdme/utils/StringUtils.h>
 
+using std::map;
+using std::min;
 using std::ofstream;
 using std::string;
 using std::to_string;
 using std::vector;
 
 using tdme::application::Application;
+using tdme::os::filesystem::ArchiveFileSystem;
 using tdme::os::filesystem::FileNameFilter;
 using tdme::os::filesystem::FileSystem;
 using tdme::os::filesystem::FileSystemInterface;
@@ -39,12 +48,18 @@ namespace archive {
 		uint64_t bytesCompressed;
 		uint64_t offset;
 		bool executable;
+		vector<uint64_t> chunkOffsets;
+	};
+	struct CodecSetup {
+		ArchiveFileSystem::Codec codec;
+		int level;
 	};
 };
 };
 };
 };
 
+using tdme::tools::cli::archive::CodecSetup;
 using tdme::tools::cli::archive::FileInformation;
 
 void scanDir(const string& folder, vector<string>& totalFiles) {
@@ -98,7 +113,33 @@ void scanDir(const string& folder, vector<string>& totalFiles) {
 	}
 }
 
-void processFile(const string& fileName, vector<FileInformation>& fileInformations) {
+bool parseCodecSetup(const string& codecName, CodecSetup& codecSetup) {
+	if (codecName == "store") {
+		codecSetup = { ArchiveFileSystem::CODEC_NONE, 0 };
+	} else
+	if (codecName == "fast") {
+		codecSetup = { ArchiveFileSystem::CODEC_DEFLATE, Z_BEST_SPEED };
+	} else
+	if (codecName == "default") {
+		codecSetup = { ArchiveFileSystem::CODEC_DEFLATE, Z_DEFAULT_COMPRESSION };
+	} else
+	if (codecName == "best") {
+		codecSetup = { ArchiveFileSystem::CODEC_DEFLATE, Z_BEST_COMPRESSION };
+	} else {
+		return false;
+	}
+	return true;
+}
+
+bool compressContent(const uint8_t* content, uint64_t bytes, int level, vector<uint8_t>& compressedContent) {
+	auto bytesCompressed = compressBound(bytes);
+	compressedContent.resize(bytesCompressed);
+	if (compress2(compressedContent.data(), &bytesCompressed, content, bytes, level) != Z_OK) return false;
+	compressedContent.resize(bytesCompressed);
+	return true;
+}
+
+void processFile(const string& fileName, vector<FileInformation>& fileInformations, int archiveVersion, const CodecSetup& codecSetup, uint32_t chunkSize) {
 	Console::print("Processing file: " + fileName);
 
 	// read content
@@ -114,82 +155,150 @@ void processFile(const string& fileName, vector<FileInformation>& fileInformatio
 	ofs.seekp(0, ofstream::end);
 	uint64_t fileOffset = ofs.tellp();
 
-	//
-	uint64_t bytesCompressed = 0;
-	uint8_t compressed = 1;
-
-	// always use compression for now
-	if (compressed == 1) {
-		// see: https://www.zlib.net/zpipe.c
-
-		#define CHUNK 	16384
-
-		int ret;
-		int flush;
-		size_t have;
-		z_stream strm;
-		unsigned char in[CHUNK];
-		unsigned char out[CHUNK];
-
-		/* allocate deflate state */
-		strm.zalloc = Z_NULL;
-		strm.zfree = Z_NULL;
-		strm.opaque = Z_NULL;
-		ret = deflateInit(&strm, Z_DEFAULT_COMPRESSION);
-		if (ret != Z_OK) {
-			Console::println("processFile(): Error compressing file: Aborting");
+	// encode
+	FileInformation fileInformation;
+	fileInformation.name = fileName;
+	fileInformation.bytes = content.size();
+	fileInformation.compressed = ArchiveFileSystem::CODEC_NONE;
+	fileInformation.bytesCompressed = 0;
+	fileInformation.offset = fileOffset;
+	fileInformation.executable = false;
+	if (archiveVersion == 1) {
+		// version 1 archives always use zlib compression
+		vector<uint8_t> compressedContent;
+		if (compressContent(content.data(), content.size(), Z_DEFAULT_COMPRESSION, compressedContent) == false) {
+			Console::println(": Error compressing file: Aborting");
 			return;
 		}
-
-		// compress until end of file
-		size_t inPosition = 0;
-		size_t inBytes = content.size();
+		ofs.write((char*)compressedContent.data(), compressedContent.size());
+		fileInformation.compressed = ArchiveFileSystem::CODEC_DEFLATE;
+		fileInformation.bytesCompressed = compressedContent.size();
+	} else
+	if (codecSetup.codec == ArchiveFileSystem::CODEC_DEFLATE) {
+		// compress, chunked if file exceeds chunk size
+		vector<uint8_t> compressedContent;
+		vector<uint8_t> compressedChunk;
+		vector<uint64_t> chunkOffsets;
+		auto chunked = chunkSize > 0 && content.size() > chunkSize;
+		auto _chunkSize = chunked == true?static_cast<uint64_t>(chunkSize):static_cast<uint64_t>(content.size());
+		uint64_t contentPosition = 0;
 		do {
-			auto inStartPosition = inPosition;
-			for (size_t i = 0; i < CHUNK; i++) {
-				if (inPosition == inBytes) break;
-				in[i] = content[inPosition];
-				inPosition++;
+			auto chunkBytes = min(_chunkSize, content.size() - contentPosition);
+			if (compressContent(content.data() + contentPosition, chunkBytes, codecSetup.level, compressedChunk) == false) {
+				Console::println(": Error compressing file: Aborting");
+				return;
 			}
-			strm.avail_in = inPosition - inStartPosition;
-			flush = inPosition == inBytes?Z_FINISH:Z_NO_FLUSH;
-			strm.next_in = in;
-
-			// run deflate() on input until output buffer not full, finish compression if all of source has been read in
-			do {
-				strm.avail_out = CHUNK;
-				strm.next_out = out;
-				ret = deflate(&strm, flush); // no bad return value
-				assert(ret != Z_STREAM_ERROR); // state not clobbered
-				have = CHUNK - strm.avail_out;
-				ofs.write((char*)out, have);
-				bytesCompressed+= have;
-			} while (strm.avail_out == 0);
-			assert(strm.avail_in == 0); // all input will be used
-
-			// done when last data in file processed
-		} while (flush != Z_FINISH);
-		assert(ret == Z_STREAM_END); // stream will be complete
-
-		// clean up and return
-		(void) deflateEnd(&strm);
-	} else {
+			chunkOffsets.push_back(compressedContent.size());
+			compressedContent.insert(compressedContent.end(), compressedChunk.begin(), compressedChunk.end());
+			contentPosition+= chunkBytes;
+		} while (contentPosition < content.size());
+		chunkOffsets.push_back(compressedContent.size());
+		// only use compression if it pays off
+		if (compressedContent.size() < content.size()) {
+			ofs.write((char*)compressedContent.data(), compressedContent.size());
+			fileInformation.compressed = ArchiveFileSystem::CODEC_DEFLATE;
+			fileInformation.bytesCompressed = compressedContent.size();
+			if (chunked == true) fileInformation.chunkOffsets = chunkOffsets;
+		}
+	}
+	if (fileInformation.compressed == ArchiveFileSystem::CODEC_NONE) {
 		ofs.write((char*)content.data(), content.size());
 	}
 	ofs.close();
 
 	// store file information
-	FileInformation fileInformation;
-	fileInformation.name = fileName;
-	fileInformation.bytes = content.size();
-	fileInformation.compressed = compressed;
-	fileInformation.bytesCompressed = bytesCompressed;
-	fileInformation.offset = fileOffset;
-	fileInformation.executable = false;
 	fileInformations.push_back(fileInformation);
 
 	// done
-	Console::println(", processed " + to_string(content.size()) + " bytes" + (compressed == 1?", " + to_string(bytesCompressed) + " bytes compressed":""));
+	Console::println(
+		", processed " + to_string(content.size()) + " bytes" +
+		(fileInformation.compressed == ArchiveFileSystem::CODEC_DEFLATE?", " + to_string(fileInformation.bytesCompressed) + " bytes compressed":", stored") +
+		(fileInformation.chunkOffsets.empty() == false?", " + to_string(fileInformation.chunkOffsets.size() - 1) + " chunks":"")
+	);
+}
+
+void writeTOCV1(const vector<FileInformation>& fileInformations) {
+	ofstream ofs("archive.ta", ofstream::binary | ofstream::app);
+	ofs.seekp(0, ofstream::end);
+	uint32_t fileInformationOffsetEnd = 0LL;
+	uint64_t fileInformationOffset = ofs.tellp();
+	for (auto& fileInformation: fileInformations) {
+		uint32_t nameSize = fileInformation.name.size();
+		ofs.write((char*)&nameSize, sizeof(nameSize));
+		for (auto i = 0; i < nameSize; i++) ofs.write(&fileInformation.name[i], 1);
+		ofs.write((char*)&fileInformation.bytes, sizeof(fileInformation.bytes));
+		ofs.write((char*)&fileInformation.compressed, sizeof(fileInformation.compressed));
+		ofs.write((char*)&fileInformation.bytesCompressed, sizeof(fileInformation.bytesCompressed));
+		ofs.write((char*)&fileInformation.offset, sizeof(fileInformation.offset));
+		ofs.write((char*)&fileInformation.executable, sizeof(fileInformation.executable));
+	}
+	ofs.write((char*)&fileInformationOffsetEnd, sizeof(fileInformationOffsetEnd));
+	ofs.write((char*)&fileInformationOffset, sizeof(fileInformationOffset));
+	ofs.close();
+}
+
+void writeTOCV2(const vector<FileInformation>& fileInformations, uint32_t chunkSize) {
+	ofstream ofs("archive.ta", ofstream::binary | ofstream::app);
+	ofs.seekp(0, ofstream::end);
+
+	// toc needs to be 8 byte aligned as it is used directly from mapped memory
+	uint64_t fileInformationOffset = ofs.tellp();
+	while (fileInformationOffset % 8 != 0) {
+		ofs.put(0);
+		fileInformationOffset++;
+	}
+
+	// create toc entries, chunk offsets and name pool
+	vector<ArchiveFileSystem::TOCEntry> tocEntries;
+	vector<uint64_t> chunkOffsets;
+	string namePool;
+	for (auto& fileInformation: fileInformations) {
+		ArchiveFileSystem::TOCEntry tocEntry;
+		memset(&tocEntry, 0, sizeof(tocEntry));
+		tocEntry.nameHash = ArchiveFileSystem::computeNameHash(fileInformation.name.data(), fileInformation.name.size());
+		tocEntry.bytes = fileInformation.bytes;
+		tocEntry.bytesCompressed = fileInformation.bytesCompressed;
+		tocEntry.offset = fileInformation.offset;
+		tocEntry.nameOffset = namePool.size();
+		tocEntry.nameSize = fileInformation.name.size();
+		tocEntry.codec = fileInformation.compressed;
+		tocEntry.executable = fileInformation.executable == true?1:0;
+		if (fileInformation.chunkOffsets.empty() == false) {
+			tocEntry.chunkOffsetIndex = chunkOffsets.size();
+			tocEntry.chunkCount = fileInformation.chunkOffsets.size() - 1;
+			chunkOffsets.insert(chunkOffsets.end(), fileInformation.chunkOffsets.begin(), fileInformation.chunkOffsets.end());
+		}
+		namePool+= fileInformation.name;
+		tocEntries.push_back(tocEntry);
+	}
+
+	// create hash table, using a load factor of at most 0.5
+	uint32_t hashTableSize = 1;
+	while (hashTableSize < tocEntries.size() * 2 + 1) hashTableSize*= 2;
+	vector<uint32_t> hashTable(hashTableSize, ArchiveFileSystem::FORMAT_V2_HASHTABLE_EMPTY);
+	for (uint32_t i = 0; i < tocEntries.size(); i++) {
+		auto slot = static_cast<uint32_t>(tocEntries[i].nameHash) & (hashTableSize - 1);
+		while (hashTable[slot] != ArchiveFileSystem::FORMAT_V2_HASHTABLE_EMPTY) slot = (slot + 1) & (hashTableSize - 1);
+		hashTable[slot] = i;
+	}
+
+	// write
+	ArchiveFileSystem::TOCHeader tocHeader;
+	memset(&tocHeader, 0, sizeof(tocHeader));
+	tocHeader.entryCount = tocEntries.size();
+	tocHeader.hashTableSize = hashTableSize;
+	tocHeader.chunkSize = chunkSize;
+	tocHeader.chunkOffsetCount = chunkOffsets.size();
+	tocHeader.namePoolBytes = namePool.size();
+	ofs.write((char*)&tocHeader, sizeof(tocHeader));
+	ofs.write((char*)tocEntries.data(), tocEntries.size() * sizeof(ArchiveFileSystem::TOCEntry));
+	ofs.write((char*)chunkOffsets.data(), chunkOffsets.size() * sizeof(uint64_t));
+	ofs.write((char*)hashTable.data(), hashTable.size() * sizeof(uint32_t));
+	ofs.write(namePool.data(), namePool.size());
+	uint32_t magic = ArchiveFileSystem::FORMAT_V2_MAGIC;
+	ofs.write((char*)&fileInformationOffset, sizeof(fileInformationOffset));
+	ofs.write((char*)&magic, sizeof(magic));
+	ofs.close();
 }
 
 int main(int argc, char** argv)
@@ -198,8 +307,38 @@ int main(int argc, char** argv)
 	Console::println(string("Programmed 2018 by Andreas Drewke, drewke.net."));
 	Console::println();
 
-	if (argc != 1) {
-		Console::println("Usage: archive");
+	// parse arguments
+	auto archiveVersion = 2;
+	uint32_t chunkSize = 64 * 1024;
+	CodecSetup defaultCodecSetup = { ArchiveFileSystem::CODEC_DEFLATE, Z_DEFAULT_COMPRESSION };
+	map<string, CodecSetup> extensionCodecSetups;
+	auto argumentsValid = true;
+	for (auto i = 1; i < argc; i++) {
+		auto argument = string(argv[i]);
+		if (argument == "--v1") {
+			archiveVersion = 1;
+		} else
+		if (StringUtils::startsWith(argument, "--chunk-size=") == true) {
+			chunkSize = atoi(StringUtils::substring(argument, string("--chunk-size=").size()).c_str()) * 1024;
+		} else
+		if (StringUtils::startsWith(argument, "--codec=") == true) {
+			if (parseCodecSetup(StringUtils::substring(argument, string("--codec=").size()), defaultCodecSetup) == false) argumentsValid = false;
+		} else
+		if (StringUtils::startsWith(argument, "--codec-") == true && argument.find('=') != string::npos) {
+			auto extension = StringUtils::toLowerCase(StringUtils::substring(argument, string("--codec-").size(), argument.find('=')));
+			CodecSetup codecSetup;
+			if (parseCodecSetup(StringUtils::substring(argument, argument.find('=') + 1), codecSetup) == false) argumentsValid = false;
+			extensionCodecSetups[extension] = codecSetup;
+		} else {
+			argumentsValid = false;
+		}
+	}
+	if (argumentsValid == false) {
+		Console::println("Usage: archive [--v1] [--codec=store|fast|default|best] [--codec-<extension>=store|fast|default|best] [--chunk-size=<kb>]");
+		Console::println("  --v1: write version 1 archive, which always uses default zlib compression");
+		Console::println("  --codec: default codec, defaults to default");
+		Console::println("  --codec-<extension>: codec for files with given extension, e.g. --codec-tm=fast --codec-ogg=store");
+		Console::println("  --chunk-size: size of independently compressed chunks in KB for partial reads, 0 disables chunking, defaults to 64");
 		Application::exit(1);
 	}
 
@@ -221,27 +360,19 @@ int main(int argc, char** argv)
 	// add files to archive
 	vector<FileInformation> fileInformations;
 	for (auto fileName: files) {
-		processFile(fileName, fileInformations);
+		auto codecSetup = defaultCodecSetup;
+		auto extensionIdx = fileName.rfind('.');
+		if (extensionIdx != string::npos) {
+			auto extensionCodecSetupIt = extensionCodecSetups.find(StringUtils::toLowerCase(StringUtils::substring(fileName, extensionIdx + 1)));
+			if (extensionCodecSetupIt != extensionCodecSetups.end()) codecSetup = extensionCodecSetupIt->second;
+		}
+		processFile(fileName, fileInformations, archiveVersion, codecSetup, chunkSize);
 	}
 
 	// add file informations
-	{
-		ofstream ofs("archive.ta", ofstream::binary | ofstream::app);
-		ofs.seekp(0, ofstream::end);
-		uint32_t fileInformationOffsetEnd = 0LL;
-		uint64_t fileInformationOffset = ofs.tellp();
-		for (auto& fileInformation: fileInformations) {
-			uint32_t nameSize = fileInformation.name.size();
-			ofs.write((char*)&nameSize, sizeof(nameSize));
-			for (auto i = 0; i < nameSize; i++) ofs.write(&fileInformation.name[i], 1);
-			ofs.write((char*)&fileInformation.bytes, sizeof(fileInformation.bytes));
-			ofs.write((char*)&fileInformation.compressed, sizeof(fileInformation.compressed));
-			ofs.write((char*)&fileInformation.bytesCompressed, sizeof(fileInformation.bytesCompressed));
-			ofs.write((char*)&fileInformation.offset, sizeof(fileInformation.offset));
-			ofs.write((char*)&fileInformation.executable, sizeof(fileInformation.executable));
-		}
-		ofs.write((char*)&fileInformationOffsetEnd, sizeof(fileInformationOffsetEnd));
-		ofs.write((char*)&fileInformationOffset, sizeof(fileInformationOffset));
-		ofs.close();
+	if (archiveVersion == 1) {
+		writeTOCV1(fileInformations);
+	} else {
+		writeTOCV2(fileInformations, chunkSize);
 	}
 }
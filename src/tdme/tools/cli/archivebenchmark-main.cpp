@@ -0,0 +1,143 @@
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <tdme/application/Application.h>
+#include <tdme/engine/fileio/models/TMReader.h>
+#include <tdme/engine/model/Model.h>
+#include <tdme/os/filesystem/ArchiveFileSystem.h>
+#include <tdme/os/filesystem/FileSystem.h>
+#include <tdme/os/filesystem/FileSystemInterface.h>
+#include <tdme/os/threading/AtomicOperations.h>
+#include <tdme/os/threading/Thread.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/Exception.h>
+#include <tdme/utils/StringUtils.h>
+#include <tdme/utils/Time.h>
+
+using std::string;
+using std::to_string;
+using std::vector;
+
+using tdme::application::Application;
+using tdme::engine::fileio::models::TMReader;
+using tdme::engine::model::Model;
+using tdme::os::filesystem::ArchiveFileSystem;
+using tdme::os::filesystem::FileSystem;
+using tdme::os::filesystem::FileSystemInterface;
+using tdme::os::threading::AtomicOperations;
+using tdme::os::threading::Thread;
+using tdme::utils::Console;
+using tdme::utils::Exception;
+using tdme::utils::StringUtils;
+using tdme::utils::Time;
+
+namespace tdme {
+namespace tools {
+namespace cli {
+namespace archivebenchmark {
+
+/**
+ * Loads every n-th model of given model list
+ */
+class LoadThread: public Thread {
+public:
+	LoadThread(int idx, int threadCount, const vector<string>* models, volatile uint64_t* modelsLoaded, volatile uint64_t* bytesLoaded):
+		Thread("archivebenchmark-loadthread"),
+		idx(idx),
+		threadCount(threadCount),
+		models(models),
+		modelsLoaded(modelsLoaded),
+		bytesLoaded(bytesLoaded) {
+	}
+
+	void run() {
+		for (auto i = idx; i < models->size(); i+= threadCount) {
+			auto& modelFileName = (*models)[i];
+			try {
+				auto pathName = FileSystem::getInstance()->getPathName(modelFileName);
+				auto fileName = FileSystem::getInstance()->getFileName(modelFileName);
+				auto model = TMReader::read(pathName, fileName);
+				AtomicOperations::add(*modelsLoaded);
+				AtomicOperations::add(*bytesLoaded, FileSystem::getInstance()->getFileSize(pathName, fileName));
+				delete model;
+			} catch (Exception& exception) {
+				Console::println("LoadThread::run(): " + modelFileName + ": " + exception.what());
+			}
+		}
+	}
+
+private:
+	int idx;
+	int threadCount;
+	const vector<string>* models;
+	volatile uint64_t* modelsLoaded;
+	volatile uint64_t* bytesLoaded;
+};
+
+};
+};
+};
+};
+
+using tdme::tools::cli::archivebenchmark::LoadThread;
+
+int main(int argc, char** argv)
+{
+	Console::println(string("archivebenchmark 1.9.9"));
+	Console::println(string("Programmed 2020 by Andreas Drewke, drewke.net."));
+	Console::println();
+
+	if (argc < 2 || argc > 3) {
+		Console::println("Usage: archivebenchmark archive.ta [threads]");
+		Application::exit(1);
+	}
+
+	auto archiveFileName = string(argv[1]);
+	auto threadCount = argc == 3?atoi(argv[2]):8;
+	if (threadCount < 1) threadCount = 1;
+
+	// set up archive file system
+	try {
+		FileSystem::setupFileSystem(new ArchiveFileSystem(archiveFileName));
+	} catch (Exception& exception) {
+		Console::println("An error occurred: " + string(exception.what()));
+		Application::exit(1);
+	}
+
+	// collect models
+	vector<string> files;
+	vector<string> models;
+	FileSystem::getInstance()->list("", files);
+	for (auto& file: files) {
+		if (StringUtils::endsWith(StringUtils::toLowerCase(file), ".tm") == true) models.push_back(file);
+	}
+	Console::println("Loading " + to_string(models.size()) + " models from " + archiveFileName + " using " + to_string(threadCount) + " threads");
+
+	// load models
+	volatile uint64_t modelsLoaded = 0LL;
+	volatile uint64_t bytesLoaded = 0LL;
+	auto startTime = Time::getCurrentMillis();
+	vector<LoadThread*> threads;
+	for (auto i = 0; i < threadCount; i++) {
+		auto thread = new LoadThread(i, threadCount, &models, &modelsLoaded, &bytesLoaded);
+		thread->start();
+		threads.push_back(thread);
+	}
+	for (auto thread: threads) {
+		thread->join();
+		delete thread;
+	}
+	auto duration = Time::getCurrentMillis() - startTime;
+
+	// report
+	Console::println(
+		"Loaded " + to_string(modelsLoaded) + " models, " +
+		to_string(bytesLoaded / 1024LL) + " KB in " + to_string(duration) + "ms: " +
+		to_string(duration == 0?0.0:static_cast<double>(bytesLoaded) / (1024.0 * 1024.0) / (static_cast<double>(duration) / 1000.0)) + " MB/s, " +
+		to_string(duration == 0?0.0:static_cast<double>(modelsLoaded) / (static_cast<double>(duration) / 1000.0)) + " models/s"
+	);
+
+	//
+	FileSystem::unsetFileSystem();
+}
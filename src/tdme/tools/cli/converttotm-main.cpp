@@ -1,17 +1,32 @@
 #include <string>
 #include <cstdlib>
+#include <vector>
 
 #include <tdme/application/Application.h>
+#include <tdme/engine/ModelUtilities.h>
+#include <tdme/engine/fileio/models/ModelImportStatistics.h>
 #include <tdme/engine/fileio/models/ModelReader.h>
 #include <tdme/engine/fileio/models/TMWriter.h>
+#include <tdme/engine/model/Model.h>
+#include <tdme/engine/model/ModelHelper.h>
+#include <tdme/engine/subsystems/rendering/ModelStatistics.h>
 #include <tdme/os/filesystem/FileSystem.h>
 #include <tdme/os/filesystem/FileSystemInterface.h>
 #include <tdme/utils/Console.h>
 #include <tdme/utils/Exception.h>
 
+using std::string;
+using std::to_string;
+using std::vector;
+
 using tdme::application::Application;
+using tdme::engine::ModelUtilities;
+using tdme::engine::fileio::models::ModelImportStatistics;
 using tdme::engine::fileio::models::ModelReader;
 using tdme::engine::fileio::models::TMWriter;
+using tdme::engine::model::Model;
+using tdme::engine::model::ModelHelper;
+using tdme::engine::subsystems::rendering::ModelStatistics;
 using tdme::os::filesystem::FileSystem;
 using tdme::os::filesystem::FileSystemInterface;
 using tdme::utils::Console;
@@ -22,18 +37,54 @@ int main(int argc, char** argv)
 	Console::println(string("converttotm 1.9.9"));
 	Console::println(string("Programmed 2018 by Andreas Drewke, drewke.net."));
 	Console::println();
-	if (argc != 3) {
-		Console::println("Usage: converttotm inputfile outputfile");
+
+	// parse arguments
+	auto optimize = false;
+	auto timings = false;
+	vector<string> fileNames;
+	for (auto i = 1; i < argc; i++) {
+		auto argument = string(argv[i]);
+		if (argument == "--optimize") {
+			optimize = true;
+		} else
+		if (argument == "--timings") {
+			timings = true;
+		} else {
+			fileNames.push_back(argument);
+		}
+	}
+	if (fileNames.size() != 2) {
+		Console::println("Usage: converttotm [--optimize] [--timings] inputfile outputfile");
 		Application::exit(1);
 	}
-	string inputFileName = string(argv[1]);
-	string outputFileName = string(argv[2]);
+	string inputFileName = fileNames[0];
+	string outputFileName = fileNames[1];
 	try {
 		Console::println("Loading model: " + inputFileName);
+		ModelImportStatistics modelImportStatistics;
 		auto model = ModelReader::read(
 			FileSystem::getInstance()->getPathName(inputFileName),
-			FileSystem::getInstance()->getFileName(inputFileName)
+			FileSystem::getInstance()->getFileName(inputFileName),
+			&modelImportStatistics
 		);
+		if (timings == true) {
+			Console::println("Import timings: threads: " + to_string(modelImportStatistics.threadCount));
+			Console::println("\tparse: " + to_string(modelImportStatistics.parseTime) + "ms");
+			Console::println("\tscene graph: " + to_string(modelImportStatistics.sceneGraphTime) + "ms");
+			Console::println("\ttextures: " + to_string(modelImportStatistics.texturesTime) + "ms");
+			Console::println("\tgroups: " + to_string(modelImportStatistics.groupsTime) + "ms");
+			Console::println("\tanimations: " + to_string(modelImportStatistics.animationsTime) + "ms");
+			Console::println("\tpost process: " + to_string(modelImportStatistics.postProcessTime) + "ms");
+			Console::println("\ttotal: " + to_string(modelImportStatistics.totalTime) + "ms");
+		}
+		if (optimize == true) {
+			ModelStatistics modelStatistics;
+			ModelUtilities::computeModelStatistics(model, &modelStatistics);
+			Console::println("Optimizing model: ACMR: " + to_string(modelStatistics.acmr) + ", ATVR: " + to_string(modelStatistics.atvr));
+			ModelHelper::optimizeForRendering(model);
+			ModelUtilities::computeModelStatistics(model, &modelStatistics);
+			Console::println("Optimized model: ACMR: " + to_string(modelStatistics.acmr) + ", ATVR: " + to_string(modelStatistics.atvr));
+		}
 		Console::println("Exporting model: " + outputFileName);
 		TMWriter::write(
 			model,
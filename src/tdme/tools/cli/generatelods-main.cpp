@@ -0,0 +1,95 @@
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <tdme/application/Application.h>
+#include <tdme/engine/fileio/models/ModelReader.h>
+#include <tdme/engine/fileio/models/TMWriter.h>
+#include <tdme/engine/model/Model.h>
+#include <tdme/engine/model/ModelHelper.h>
+#include <tdme/engine/model/ModelSimplificationStatistics.h>
+#include <tdme/os/filesystem/FileSystem.h>
+#include <tdme/os/filesystem/FileSystemInterface.h>
+#include <tdme/tools/shared/tools/Tools.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/Exception.h>
+#include <tdme/utils/Float.h>
+#include <tdme/utils/StringUtils.h>
+#include <tdme/utils/Time.h>
+
+using std::string;
+using std::to_string;
+using std::vector;
+
+using tdme::application::Application;
+using tdme::engine::fileio::models::ModelReader;
+using tdme::engine::fileio::models::TMWriter;
+using tdme::engine::model::Model;
+using tdme::engine::model::ModelHelper;
+using tdme::engine::model::ModelSimplificationStatistics;
+using tdme::os::filesystem::FileSystem;
+using tdme::os::filesystem::FileSystemInterface;
+using tdme::tools::shared::tools::Tools;
+using tdme::utils::Console;
+using tdme::utils::Exception;
+using tdme::utils::Float;
+using tdme::utils::StringUtils;
+using tdme::utils::Time;
+
+int main(int argc, char** argv)
+{
+	Console::println(string("generatelods 1.9.9"));
+	Console::println(string("Programmed 2020 by Andreas Drewke, drewke.net."));
+	Console::println();
+
+	// parse arguments
+	vector<float> lodRatios = { 0.5f, 0.25f };
+	auto maxError = Float::MAX_VALUE;
+	string inputFileName;
+	for (auto i = 1; i < argc; i++) {
+		auto argument = string(argv[i]);
+		if (StringUtils::startsWith(argument, "--lod2=") == true) {
+			lodRatios[0] = Float::parseFloat(StringUtils::substring(argument, string("--lod2=").size()));
+		} else
+		if (StringUtils::startsWith(argument, "--lod3=") == true) {
+			lodRatios[1] = Float::parseFloat(StringUtils::substring(argument, string("--lod3=").size()));
+		} else
+		if (StringUtils::startsWith(argument, "--max-error=") == true) {
+			maxError = Float::parseFloat(StringUtils::substring(argument, string("--max-error=").size()));
+		} else {
+			inputFileName = argument;
+		}
+	}
+	if (inputFileName.empty() == true) {
+		Console::println("Usage: generatelods [--lod2=0.5] [--lod3=0.25] [--max-error=distance] inputfile");
+		Console::println("Generates inputfile.lod2.tm and inputfile.lod3.tm next to input file with given target face ratios");
+		Application::exit(1);
+	}
+
+	//
+	try {
+		auto pathName = FileSystem::getInstance()->getPathName(inputFileName);
+		auto fileName = FileSystem::getInstance()->getFileName(inputFileName);
+		for (auto i = 0; i < lodRatios.size(); i++) {
+			auto lodLevel = i + 2;
+			Console::println("Loading model: " + inputFileName);
+			auto model = ModelReader::read(pathName, fileName);
+			Console::println("Simplifying model to LOD level " + to_string(lodLevel) + " with target face ratio of " + to_string(lodRatios[i]));
+			ModelSimplificationStatistics statistics;
+			auto startTime = Time::getCurrentMillis();
+			ModelHelper::simplify(model, lodRatios[i], maxError, &statistics);
+			Console::println(
+				"Simplified model in " + to_string(Time::getCurrentMillis() - startTime) + "ms: " +
+				to_string(statistics.faceCount) + " --> " + to_string(statistics.simplifiedFaceCount) + " faces, " +
+				"max error distance: " + to_string(statistics.maxError)
+			);
+			auto lodFileName = Tools::removeFileEnding(fileName) + ".lod" + to_string(lodLevel) + ".tm";
+			Console::println("Exporting model: " + pathName + "/" + lodFileName);
+			TMWriter::write(model, pathName, lodFileName);
+			delete model;
+		}
+	} catch (Exception& exception) {
+		Console::println("An error occurred: " + string(exception.what()));
+		Application::exit(1);
+	}
+}
@@ -0,0 +1,101 @@
+#include <cstdlib>
+#include <string>
+#include <vector>
+
+#include <tdme/application/Application.h>
+#include <tdme/engine/fileio/models/TMReader.h>
+#include <tdme/engine/model/Model.h>
+#include <tdme/os/filesystem/FileSystem.h>
+#include <tdme/os/filesystem/FileSystemInterface.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/Exception.h>
+#include <tdme/utils/StringUtils.h>
+#include <tdme/utils/Time.h>
+
+using std::string;
+using std::to_string;
+using std::vector;
+
+using tdme::application::Application;
+using tdme::engine::fileio::models::TMReader;
+using tdme::engine::model::Model;
+using tdme::os::filesystem::FileSystem;
+using tdme::os::filesystem::FileSystemInterface;
+using tdme::utils::Console;
+using tdme::utils::Exception;
+using tdme::utils::StringUtils;
+using tdme::utils::Time;
+
+int main(int argc, char** argv)
+{
+	Console::println(string("tmbenchmark 1.9.9"));
+	Console::println(string("Programmed 2020 by Andreas Drewke, drewke.net."));
+	Console::println();
+
+	// parse arguments
+	auto iterations = 10;
+	vector<string> modelFileNames;
+	for (auto i = 1; i < argc; i++) {
+		auto argument = string(argv[i]);
+		if (StringUtils::startsWith(argument, "--iterations=") == true) {
+			iterations = atoi(StringUtils::substring(argument, string("--iterations=").size()).c_str());
+		} else {
+			modelFileNames.push_back(argument);
+		}
+	}
+	if (modelFileNames.empty() == true || iterations < 1) {
+		Console::println("Usage: tmbenchmark [--iterations=10] model1.tm [model2.tm ...]");
+		Application::exit(1);
+	}
+
+	// load file contents, so we only measure decoding
+	vector<vector<uint8_t>> contents;
+	contents.resize(modelFileNames.size());
+	uint64_t bytesTotal = 0LL;
+	try {
+		for (auto i = 0; i < modelFileNames.size(); i++) {
+			FileSystem::getInstance()->getContent(
+				FileSystem::getInstance()->getPathName(modelFileNames[i]),
+				FileSystem::getInstance()->getFileName(modelFileNames[i]),
+				contents[i]
+			);
+			bytesTotal+= contents[i].size();
+		}
+	} catch (Exception& exception) {
+		Console::println("An error occurred: " + string(exception.what()));
+		Application::exit(1);
+	}
+
+	// decode
+	try {
+		// warm up, which also loads and caches textures
+		for (auto i = 0; i < modelFileNames.size(); i++) {
+			delete TMReader::read(contents[i], FileSystem::getInstance()->getPathName(modelFileNames[i]), FileSystem::getInstance()->getFileName(modelFileNames[i]));
+		}
+		uint64_t durationTotal = 0LL;
+		for (auto i = 0; i < modelFileNames.size(); i++) {
+			auto pathName = FileSystem::getInstance()->getPathName(modelFileNames[i]);
+			auto fileName = FileSystem::getInstance()->getFileName(modelFileNames[i]);
+			auto startTime = Time::getCurrentMillis();
+			for (auto j = 0; j < iterations; j++) delete TMReader::read(contents[i], pathName, fileName);
+			auto duration = Time::getCurrentMillis() - startTime;
+			durationTotal+= duration;
+			Console::println(
+				modelFileNames[i] + ": " +
+				to_string(contents[i].size() / 1024LL) + " KB: " +
+				to_string(static_cast<double>(duration) / static_cast<double>(iterations)) + "ms/model, " +
+				to_string(duration == 0?0.0:static_cast<double>(contents[i].size()) * iterations / (1024.0 * 1024.0) / (static_cast<double>(duration) / 1000.0)) + " MB/s"
+			);
+		}
+
+		// report
+		Console::println(
+			"Decoded " + to_string(modelFileNames.size()) + " models " + to_string(iterations) + " times, " +
+			to_string(bytesTotal * iterations / 1024LL) + " KB in " + to_string(durationTotal) + "ms: " +
+			to_string(durationTotal == 0?0.0:static_cast<double>(bytesTotal) * iterations / (1024.0 * 1024.0) / (static_cast<double>(durationTotal) / 1000.0)) + " MB/s"
+		);
+	} catch (Exception& exception) {
+		Console::println("An error occurred: " + string(exception.what()));
+		Application::exit(1);
+	}
+}
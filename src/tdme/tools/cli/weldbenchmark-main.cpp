@@ -0,0 +1,169 @@
+#include <array>
+#include <map>
+#include <string>
+#include <vector>
+
+#include <tdme/application/Application.h>
+#include <tdme/engine/fileio/models/ModelReader.h>
+#include <tdme/engine/model/Face.h>
+#include <tdme/engine/model/FacesEntity.h>
+#include <tdme/engine/model/Group.h>
+#include <tdme/engine/model/JointWeight.h>
+#include <tdme/engine/model/Model.h>
+#include <tdme/engine/model/ModelHelper.h>
+#include <tdme/engine/model/Skinning.h>
+#include <tdme/engine/model/TextureCoordinate.h>
+#include <tdme/math/Vector3.h>
+#include <tdme/os/filesystem/FileSystem.h>
+#include <tdme/os/filesystem/FileSystemInterface.h>
+#include <tdme/utils/Console.h>
+#include <tdme/utils/Exception.h>
+#include <tdme/utils/Time.h>
+
+using std::array;
+using std::map;
+using std::string;
+using std::to_string;
+using std::vector;
+
+using tdme::application::Application;
+using tdme::engine::fileio::models::ModelReader;
+using tdme::engine::model::Face;
+using tdme::engine::model::FacesEntity;
+using tdme::engine::model::Group;
+using tdme::engine::model::JointWeight;
+using tdme::engine::model::Model;
+using tdme::engine::model::ModelHelper;
+using tdme::engine::model::Skinning;
+using tdme::engine::model::TextureCoordinate;
+using tdme::math::Vector3;
+using tdme::os::filesystem::FileSystem;
+using tdme::os::filesystem::FileSystemInterface;
+using tdme::utils::Console;
+using tdme::utils::Exception;
+using tdme::utils::Time;
+
+namespace tdme {
+namespace tools {
+namespace cli {
+namespace weldbenchmark {
+
+/**
+ * Expand indexed groups into one vertex per face corner, which is what importers provide before welding
+ * @param groups groups
+ * @return vertex count
+ */
+int64_t unweld(const map<string, Group*>& groups) {
+	int64_t vertexCount = 0LL;
+	for (auto it: groups) {
+		auto group = it.second;
+		auto& groupVertices = group->getVertices();
+		auto& groupNormals = group->getNormals();
+		auto& groupTextureCoordinates = group->getTextureCoordinates();
+		auto& groupTangents = group->getTangents();
+		auto& groupBitangents = group->getBitangents();
+		vector<Vector3> vertices;
+		vector<Vector3> normals;
+		vector<TextureCoordinate> textureCoordinates;
+		vector<Vector3> tangents;
+		vector<Vector3> bitangents;
+		vector<vector<JointWeight>> verticesJointsWeights;
+		auto skinning = group->getSkinning();
+		auto facesEntities = group->getFacesEntities();
+		for (auto& facesEntity: facesEntities) {
+			auto faces = facesEntity.getFaces();
+			for (auto& face: faces) {
+				for (auto idx = 0; idx < 3; idx++) {
+					vertices.push_back(groupVertices[face.getVertexIndices()[idx]]);
+					normals.push_back(groupNormals[face.getNormalIndices()[idx]]);
+					if (groupTextureCoordinates.size() > 0) textureCoordinates.push_back(groupTextureCoordinates[face.getTextureCoordinateIndices()[idx]]);
+					if (groupTangents.size() > 0) tangents.push_back(groupTangents[face.getTangentIndices()[idx]]);
+					if (groupBitangents.size() > 0) bitangents.push_back(groupBitangents[face.getBitangentIndices()[idx]]);
+					if (skinning != nullptr) verticesJointsWeights.push_back(skinning->getVerticesJointsWeights()[face.getVertexIndices()[idx]]);
+				}
+				auto vertexIdx = static_cast<int32_t>(vertices.size()) - 3;
+				face = Face(group, vertexIdx, vertexIdx + 1, vertexIdx + 2, vertexIdx, vertexIdx + 1, vertexIdx + 2, vertexIdx, vertexIdx + 1, vertexIdx + 2);
+				face.setTangentIndices(vertexIdx, vertexIdx + 1, vertexIdx + 2);
+				face.setBitangentIndices(vertexIdx, vertexIdx + 1, vertexIdx + 2);
+			}
+			facesEntity.setFaces(faces);
+		}
+		group->setFacesEntities(facesEntities);
+		group->setVertices(vertices);
+		group->setNormals(normals);
+		if (groupTextureCoordinates.size() > 0) group->setTextureCoordinates(textureCoordinates);
+		group->setTangents(tangents);
+		group->setBitangents(bitangents);
+		if (skinning != nullptr) skinning->setVerticesJointsWeights(verticesJointsWeights);
+		vertexCount+= vertices.size();
+		vertexCount+= unweld(group->getSubGroups());
+	}
+	return vertexCount;
+}
+
+/**
+ * Count vertices
+ * @param groups groups
+ * @return vertex count
+ */
+int64_t countVertices(const map<string, Group*>& groups) {
+	int64_t vertexCount = 0LL;
+	for (auto it: groups) {
+		vertexCount+= it.second->getVertices().size();
+		vertexCount+= countVertices(it.second->getSubGroups());
+	}
+	return vertexCount;
+}
+
+};
+};
+};
+};
+
+int main(int argc, char** argv)
+{
+	Console::println(string("weldbenchmark 1.9.9"));
+	Console::println(string("Programmed 2020 by Andreas Drewke, drewke.net."));
+	Console::println();
+	if (argc < 2) {
+		Console::println("Usage: weldbenchmark model1 [model2 ...]");
+		Application::exit(1);
+	}
+
+	//
+	int64_t facesTotal = 0LL;
+	int64_t durationTotal = 0LL;
+	for (auto i = 1; i < argc; i++) {
+		auto modelFileName = string(argv[i]);
+		try {
+			auto model = ModelReader::read(
+				FileSystem::getInstance()->getPathName(modelFileName),
+				FileSystem::getInstance()->getFileName(modelFileName)
+			);
+			auto verticesBefore = tdme::tools::cli::weldbenchmark::unweld(model->getSubGroups());
+			auto faces = verticesBefore / 3;
+			auto startTime = Time::getCurrentMillis();
+			ModelHelper::prepareForIndexedRendering(model);
+			auto duration = Time::getCurrentMillis() - startTime;
+			auto verticesAfter = tdme::tools::cli::weldbenchmark::countVertices(model->getSubGroups());
+			Console::println(
+				modelFileName + ": " +
+				to_string(faces) + " faces, " +
+				to_string(verticesBefore) + " --> " + to_string(verticesAfter) + " vertices in " +
+				to_string(duration) + "ms: " +
+				to_string(duration == 0?0.0:static_cast<double>(faces) / (static_cast<double>(duration) / 1000.0)) + " faces/s"
+			);
+			facesTotal+= faces;
+			durationTotal+= duration;
+			delete model;
+		} catch (Exception& exception) {
+			Console::println("An error occurred: " + modelFileName + ": " + string(exception.what()));
+		}
+	}
+
+	// report
+	Console::println(
+		"Welded " + to_string(facesTotal) + " faces in " + to_string(durationTotal) + "ms: " +
+		to_string(durationTotal == 0?0.0:static_cast<double>(facesTotal) / (static_cast<double>(durationTotal) / 1000.0)) + " faces/s"
+	);
+}
@@ -6,6 +6,7 @@
 
 #include <vector>
 #include <map>
+#include <utility>
 #include <string>
 
 #include <tdme/tdme.h>
@@ -77,6 +78,8 @@
 #include <tdme/utils/Console.h>
 
 using std::map;
+using std::make_pair;
+using std::pair;
 using std::vector;
 using std::string;
 using std::to_string;
@@ -160,6 +163,7 @@ float Level::renderGroupsLOD3MinDistance = 50.0;
 int Level::renderGroupsLOD2ReduceBy = 4;
 int Level::renderGroupsLOD3ReduceBy = 16;
 bool Level::enableEarlyZRejection = false;
+bool Level::renderGroupsTextureAtlas = false;
 
 void Level::setLight(Engine* engine, LevelEditorLevel* level, const Vector3& translation)
 {
@@ -410,7 +414,7 @@ Entity* Level::createEntity(LevelEditorObject* levelEditorObject, const Vector3&
 void Level::addLevel(Engine* engine, LevelEditorLevel* level, bool addEmpties, bool addTrigger, bool pickable, bool enable, const Vector3& translation, ProgressCallback* progressCallback)
 {
 	if (progressCallback != nullptr) progressCallback->progress(0.0f);
-	map<string, map<string, vector<Transformations*>>> renderGroupEntitiesByModelAndPartition;
+	map<string, map<string, vector<pair<LevelEditorEntity*, Transformations*>>>> renderGroupEntitiesByModelAndPartition;
 	map<string, LevelEditorEntity*> renderGroupLevelEditorEntities;
 	auto progressStepCurrent = 0;
 	for (auto i = 0; i < level->getObjectCount(); i++) {
@@ -429,8 +433,13 @@ void Level::addLevel(Engine* engine, LevelEditorLevel* level, bool addEmpties, b
 			auto partitionX = (int)(minX / renderGroupsPartitionWidth);
 			auto partitionY = (int)(minY / renderGroupsPartitionHeight);
 			auto partitionZ = (int)(minZ / renderGroupsPartitionDepth);
-			renderGroupLevelEditorEntities[object->getEntity()->getModel()->getId()] = object->getEntity();
-			renderGroupEntitiesByModelAndPartition[object->getEntity()->getModel()->getId()][to_string(partitionX) + "," + to_string(partitionY) + "," + to_string(partitionZ)].push_back(&object->getTransformations());
+			// with texture atlas different models can share a render group if they share shaders
+			auto renderGroupKey =
+				renderGroupsTextureAtlas == true?
+					"atlas." + object->getEntity()->getShader() + "." + object->getEntity()->getDistanceShader() + "." + to_string(object->getEntity()->getDistanceShaderDistance()):
+					object->getEntity()->getModel()->getId();
+			if (renderGroupLevelEditorEntities.find(renderGroupKey) == renderGroupLevelEditorEntities.end()) renderGroupLevelEditorEntities[renderGroupKey] = object->getEntity();
+			renderGroupEntitiesByModelAndPartition[renderGroupKey][to_string(partitionX) + "," + to_string(partitionY) + "," + to_string(partitionZ)].push_back(make_pair(object->getEntity(), &object->getTransformations()));
 		} else {
 			Entity* entity = createEntity(object);
 			if (entity == nullptr) continue;
@@ -469,11 +478,12 @@ void Level::addLevel(Engine* engine, LevelEditorLevel* level, bool addEmpties, b
 			object3DRenderGroup->setDistanceShader(levelEditorEntity->getDistanceShader());
 			object3DRenderGroup->setDistanceShaderDistance(levelEditorEntity->getDistanceShaderDistance());
 			if (enableEarlyZRejection == true) object3DRenderGroup->setEnableEarlyZRejection(true);
+			object3DRenderGroup->setTextureAtlasEnabled(renderGroupsTextureAtlas);
 			auto objectIdx = -1;
-			for (auto transformation: itPartition.second) {
+			for (auto& entityTransformations: itPartition.second) {
 				objectIdx++;
 				if (objectIdx % renderGroupsReduceBy != 0) continue;
-				object3DRenderGroup->addObject(*transformation);
+				object3DRenderGroup->addObject(entityTransformations.first->getModel(), *entityTransformations.second);
 			}
 			object3DRenderGroup->updateRenderGroup();
 			engine->addEntity(object3DRenderGroup);
@@ -51,6 +51,7 @@ public:
 	static int renderGroupsLOD2ReduceBy;
 	static int renderGroupsLOD3ReduceBy;
 	static bool enableEarlyZRejection;
+	static bool renderGroupsTextureAtlas;
 
 public:
 
@@ -204,6 +205,21 @@ public:
 		Level::enableEarlyZRejection = enableEarlyZRejection;
 	}
 
+	/**
+	 * @return if render groups combine different models with same shaders using texture atlases
+	 */
+	inline static bool isRenderGroupsTextureAtlas() {
+		return renderGroupsTextureAtlas;
+	}
+
+	/**
+	 * Set if render groups combine different models with same shaders using texture atlases
+	 * @param renderGroupsTextureAtlas render groups texture atlas
+	 */
+	inline static void setRenderGroupsTextureAtlas(bool renderGroupsTextureAtlas) {
+		Level::renderGroupsTextureAtlas = renderGroupsTextureAtlas;
+	}
+
 	/** 
 	 * Set lights from level
 	 * @param engine engine
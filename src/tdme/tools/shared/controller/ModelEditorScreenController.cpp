@@ -9,6 +9,8 @@
 #include <tdme/engine/model/Material.h>
 #include <tdme/engine/model/Model.h>
 #include <tdme/engine/model/Group.h>
+#include <tdme/engine/model/ModelHelper.h>
+#include <tdme/engine/model/ModelSimplificationStatistics.h>
 #include <tdme/engine/model/SpecularMaterialProperties.h>
 #include <tdme/gui/GUIParser.h>
 #include <tdme/gui/events/Action.h>
@@ -55,6 +57,8 @@ using tdme::engine::model::AnimationSetup;
 using tdme::engine::model::Material;
 using tdme::engine::model::Model;
 using tdme::engine::model::Group;
+using tdme::engine::model::ModelHelper;
+using tdme::engine::model::ModelSimplificationStatistics;
 using tdme::engine::model::SpecularMaterialProperties;
 using tdme::gui::GUIParser;
 using tdme::gui::events::Action;
@@ -191,6 +195,8 @@ void ModelEditorScreenController::initialize()
 		lodModelFile = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("lod_model_file"));
 		lodModelFileLoad = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("lod_model_file_load"));
 		lodModelFileClear = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("lod_model_file_clear"));
+		lodSimplifyRatio = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("lod_simplify_ratio"));
+		lodModelGenerate = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("lod_model_generate"));
 		lodMinDistance = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("lod_min_distance"));
 		lodColorMul = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("lod_color_mul"));
 		lodColorAdd = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("lod_color_add"));
@@ -230,11 +236,16 @@ void ModelEditorScreenController::initialize()
 		animationsAnimationApply = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("button_animations_animation_apply"));
 		statsOpaqueFaces = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("stats_opaque_faces"));
 		buttonToolsComputeNormals = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("button_tools_computenormals"));
+		buttonToolsOptimize = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("button_tools_optimize"));
 		statsTransparentFaces = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("stats_transparent_faces"));
 		statsMaterialCount = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("stats_material_count"));
+		statsACMR = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("stats_acmr"));
+		statsATVR = dynamic_cast< GUIElementNode* >(screenNode->getNodeById("stats_atvr"));
 		statsOpaqueFaces->getController()->setDisabled(true);
 		statsTransparentFaces->getController()->setDisabled(true);
 		statsMaterialCount->getController()->setDisabled(true);
+		statsACMR->getController()->setDisabled(true);
+		statsATVR->getController()->setDisabled(true);
 	} catch (Exception& exception) {
 		Console::print(string("ModelEditorScreenController::initialize(): An error occurred: "));
 		Console::println(string(exception.what()));
@@ -384,6 +395,8 @@ void ModelEditorScreenController::setLODLevel(LevelEditorEntity* entity, int lev
 		lodModelFile->getController()->setDisabled(true);
 		lodModelFileLoad->getController()->setDisabled(true);
 		lodModelFileClear->getController()->setDisabled(true);
+		lodSimplifyRatio->getController()->setDisabled(true);
+		lodModelGenerate->getController()->setDisabled(true);
 		lodMinDistance->getController()->setValue(MutableString("0.0"));
 		lodMinDistance->getController()->setDisabled(true);
 		lodColorMul->getController()->setValue(MutableString("1.0, 1.0, 1.0, 1.0"));
@@ -401,6 +414,8 @@ void ModelEditorScreenController::setLODLevel(LevelEditorEntity* entity, int lev
 		lodModelFile->getController()->setDisabled(false);
 		lodModelFileLoad->getController()->setDisabled(false);
 		lodModelFileClear->getController()->setDisabled(false);
+		lodSimplifyRatio->getController()->setDisabled(false);
+		lodModelGenerate->getController()->setDisabled(false);
 		lodMinDistance->getController()->setValue(MutableString(entityLodLevel->getMinDistance()));
 		lodMinDistance->getController()->setDisabled(false);
 		lodColorMul->getController()->setValue(MutableString(Tools::formatColor4(entityLodLevel->getColorMul())));
@@ -422,6 +437,8 @@ void ModelEditorScreenController::unsetLODLevel() {
 	lodModelFile->getController()->setDisabled(true);
 	lodModelFileLoad->getController()->setDisabled(true);
 	lodModelFileClear->getController()->setDisabled(true);
+	lodSimplifyRatio->getController()->setDisabled(true);
+	lodModelGenerate->getController()->setDisabled(true);
 	lodMinDistance->getController()->setValue(MutableString("0.0"));
 	lodMinDistance->getController()->setDisabled(true);
 	lodColorMul->getController()->setValue(MutableString("1.0, 1.0, 1.0, 1.0"));
@@ -484,6 +501,39 @@ void ModelEditorScreenController::onLODLevelClearModel() {
 	lodModelFile->getController()->setValue(MutableString());
 }
 
+void ModelEditorScreenController::onLODLevelGenerateModel() {
+	auto entity = view->getEntity();
+	auto lodLevelInt = Tools::convertToIntSilent(lodLevel->getController()->getValue().getString());
+	auto entityLodLevel = getLODLevel(lodLevelInt);
+	if (entityLodLevel == nullptr) return;
+	try {
+		auto ratio = Tools::convertToFloat(lodSimplifyRatio->getController()->getValue().getString());
+		if (ratio <= 0.0f || ratio > 1.0f) throw ExceptionBase("Simplify ratio must be greater than 0.0 and less or equal 1.0");
+		auto model = ModelReader::read(
+			Tools::getPath(entity->getFileName()),
+			Tools::getFileName(entity->getFileName())
+		);
+		ModelSimplificationStatistics simplificationStatistics;
+		ModelHelper::simplify(model, ratio, Float::MAX_VALUE, &simplificationStatistics);
+		view->resetEntity();
+		entityLodLevel->setType(LODObject3D::LODLEVELTYPE_MODEL);
+		entityLodLevel->setFileName(
+			Tools::getPath(entity->getFileName()) + "/" +
+			Tools::removeFileEnding(Tools::getFileName(entity->getFileName())) +
+			".lod" + to_string(lodLevelInt) + ".tm"
+		);
+		entityLodLevel->setModel(model);
+		setLODLevel(entity, lodLevelInt);
+		showErrorPopUp(
+			"Simplification",
+			"Faces: " + to_string(simplificationStatistics.faceCount) + " --> " + to_string(simplificationStatistics.simplifiedFaceCount) + ", " +
+			"max. error distance: " + Tools::formatFloat(simplificationStatistics.maxError)
+		);
+	} catch (Exception& exception) {
+		showErrorPopUp("Warning", (string(exception.what())));
+	}
+}
+
 void ModelEditorScreenController::onLODLevelApplySettings() {
 	view->resetEntity();
 	auto lodLevelInt = Tools::convertToIntSilent(lodLevel->getController()->getValue().getString());
@@ -1129,11 +1179,13 @@ void ModelEditorScreenController::unsetAnimations() {
 	animationsAnimationApply->getController()->setDisabled(true);
 }
 
-void ModelEditorScreenController::setStatistics(int32_t statsOpaqueFaces, int32_t statsTransparentFaces, int32_t statsMaterialCount)
+void ModelEditorScreenController::setStatistics(int32_t statsOpaqueFaces, int32_t statsTransparentFaces, int32_t statsMaterialCount, float statsACMR, float statsATVR)
 {
 	this->statsOpaqueFaces->getController()->setValue(MutableString(statsOpaqueFaces));
 	this->statsTransparentFaces->getController()->setValue(MutableString(statsTransparentFaces));
 	this->statsMaterialCount->getController()->setValue(MutableString(statsMaterialCount));
+	this->statsACMR->getController()->setValue(MutableString(statsACMR, 3));
+	this->statsATVR->getController()->setValue(MutableString(statsATVR, 3));
 }
 
 void ModelEditorScreenController::unsetStatistics()
@@ -1141,20 +1193,28 @@ void ModelEditorScreenController::unsetStatistics()
 	this->statsOpaqueFaces->getController()->setValue(MutableString());
 	this->statsTransparentFaces->getController()->setValue(MutableString());
 	this->statsMaterialCount->getController()->setValue(MutableString());
+	this->statsACMR->getController()->setValue(MutableString());
+	this->statsATVR->getController()->setValue(MutableString());
 }
 
 void ModelEditorScreenController::setTools() {
 	buttonToolsComputeNormals->getController()->setDisabled(false);
+	buttonToolsOptimize->getController()->setDisabled(false);
 }
 
 void ModelEditorScreenController::unsetTools() {
 	buttonToolsComputeNormals->getController()->setDisabled(true);
+	buttonToolsOptimize->getController()->setDisabled(true);
 }
 
 void ModelEditorScreenController::onToolsComputeNormal() {
 	view->computeNormals();
 }
 
+void ModelEditorScreenController::onToolsOptimize() {
+	view->optimizeModel();
+}
+
 void ModelEditorScreenController::onQuit()
 {
 	TDMEModelEditor::getInstance()->quit();
@@ -1349,6 +1409,9 @@ void ModelEditorScreenController::onActionPerformed(GUIActionListener_Type* type
 			if (node->getId().compare("lod_model_file_clear") == 0) {
 				onLODLevelClearModel();
 			} else
+			if (node->getId().compare("lod_model_generate") == 0) {
+				onLODLevelGenerateModel();
+			} else
 			if (node->getId().compare("button_lod_apply") == 0) {
 				onLODLevelApplySettings();
 			} else
@@ -1393,6 +1456,9 @@ void ModelEditorScreenController::onActionPerformed(GUIActionListener_Type* type
 			} else
 			if (node->getId().compare("button_tools_computenormals") == 0) {
 				onToolsComputeNormal();
+			} else
+			if (node->getId().compare("button_tools_optimize") == 0) {
+				onToolsOptimize();
 			}
 		}
 	}
@@ -74,6 +74,8 @@ private:
 	GUIElementNode* lodModelFile { nullptr };
 	GUIElementNode* lodModelFileLoad { nullptr };
 	GUIElementNode* lodModelFileClear { nullptr };
+	GUIElementNode* lodSimplifyRatio { nullptr };
+	GUIElementNode* lodModelGenerate { nullptr };
 	GUIElementNode* lodMinDistance { nullptr };
 	GUIElementNode* lodColorMul { nullptr };
 	GUIElementNode* lodColorAdd { nullptr };
@@ -112,9 +114,12 @@ private:
 	GUIElementNode* animationsAnimationName { nullptr };
 	GUIElementNode* animationsAnimationApply { nullptr };
 	GUIElementNode* buttonToolsComputeNormals { nullptr };
+	GUIElementNode* buttonToolsOptimize { nullptr };
 	GUIElementNode* statsOpaqueFaces { nullptr };
 	GUIElementNode* statsTransparentFaces { nullptr };
 	GUIElementNode* statsMaterialCount { nullptr };
+	GUIElementNode* statsACMR { nullptr };
+	GUIElementNode* statsATVR { nullptr };
 
 	FileDialogPath* modelPath { nullptr };
 	FileDialogPath* audioPath { nullptr };
@@ -247,6 +252,11 @@ public:
 	 */
 	void onLODLevelClearModel();
 
+	/**
+	 * On LOD level generate model by simplifying LOD level 1 model
+	 */
+	void onLODLevelGenerateModel();
+
 	/**
 	 * On LOD level apply settings
 	 */
@@ -335,8 +345,10 @@ public:
 	 * @param statsOpaqueFaces stats opaque faces
 	 * @param statsTransparentFaces stats transparent faces
 	 * @param statsMaterialCount stats material count
+	 * @param statsACMR stats average cache miss ratio
+	 * @param statsATVR stats average transformed vertex ratio
 	 */
-	void setStatistics(int32_t statsOpaqueFaces, int32_t statsTransparentFaces, int32_t statsMaterialCount);
+	void setStatistics(int32_t statsOpaqueFaces, int32_t statsTransparentFaces, int32_t statsMaterialCount, float statsACMR, float statsATVR);
 
 	/**
 	 * Unset statistics
@@ -388,6 +400,11 @@ public:
 	 */
 	void onToolsComputeNormal();
 
+	/**
+	 * On tools optimize
+	 */
+	void onToolsOptimize();
+
 	/**
 	 * Save file
 	 * @param pathName path name
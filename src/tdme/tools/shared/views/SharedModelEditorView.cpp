@@ -155,7 +155,7 @@ void SharedModelEditorView::initModel()
 	if (currentModelObject != nullptr) {
 		ModelStatistics modelStatistics;
 		ModelUtilities::computeModelStatistics(currentModelObject->getModel(), &modelStatistics);
-		modelEditorScreenController->setStatistics(modelStatistics.opaqueFaceCount, modelStatistics.transparentFaceCount, modelStatistics.materialCount);
+		modelEditorScreenController->setStatistics(modelStatistics.opaqueFaceCount, modelStatistics.transparentFaceCount, modelStatistics.materialCount, modelStatistics.acmr, modelStatistics.atvr);
 	} else {
 		modelEditorScreenController->unsetStatistics();
 	}
@@ -222,6 +222,25 @@ void SharedModelEditorView::computeNormals() {
 	resetEntity();
 }
 
+void SharedModelEditorView::optimizeModel() {
+	if (entity == nullptr) return;
+	engine->removeEntity("model");
+	class OptimizeModelProgressCallback: public ProgressCallback {
+	private:
+		ProgressBarScreenController* progressBarScreenController;
+	public:
+		OptimizeModelProgressCallback(ProgressBarScreenController* progressBarScreenController): progressBarScreenController(progressBarScreenController) {
+		}
+		virtual void progress(float value) {
+			progressBarScreenController->progress(value);
+		}
+	};
+	popUps->getProgressBarScreenController()->show();
+	ModelHelper::optimizeForRendering(entity->getModel(), new OptimizeModelProgressCallback(popUps->getProgressBarScreenController()));
+	popUps->getProgressBarScreenController()->close();
+	resetEntity();
+}
+
 void SharedModelEditorView::handleInputEvents()
 {
 	entityPhysicsView->handleInputEvents(entity, objectScale);
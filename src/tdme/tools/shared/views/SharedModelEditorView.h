@@ -171,6 +171,11 @@ public:
 	 */
 	void computeNormals();
 
+	/**
+	 * Optimize model for rendering
+	 */
+	void optimizeModel();
+
 	// overriden methods
 	void handleInputEvents() override;
 
@@ -0,0 +1,78 @@
+#pragma once
+
+#include <tdme/tdme.h>
+#include <tdme/utils/fwd-tdme.h>
+
+#include <array>
+#include <string.h>
+#include <vector>
+
+using std::array;
+using std::vector;
+
+/**
+ * Radix sort utility class
+ * 	Sorts entries by their unsigned integer key member in ascending order with least significant digit radix sort using 8 bit digits
+ * 	Digits that are equal for all keys are skipped, sorting is stable
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::utils::RadixSort final
+{
+public:
+
+	/**
+	 * Sort entries by key
+	 * @param entries entries, which need to provide a unsigned integer key member
+	 * @param buffer buffer, which should be reused between calls to avoid allocations
+	 */
+	template<typename T>
+	inline static void sort(vector<T>& entries, vector<T>& buffer) {
+		constexpr int32_t digits = sizeof(entries[0].key);
+		auto entryCount = entries.size();
+		if (entryCount < 2) return;
+		buffer.resize(entryCount);
+		// count digits for all passes at once
+		array<array<uint32_t, 256>, digits> histograms;
+		for (auto& histogram: histograms) histogram.fill(0);
+		for (auto& entry: entries) {
+			auto key = entry.key;
+			for (auto digit = 0; digit < digits; digit++) {
+				histograms[digit][(key >> (digit * 8)) & 0xff]++;
+			}
+		}
+		// do passes that actually do reorder
+		auto source = &entries;
+		auto target = &buffer;
+		array<uint32_t, 256> offsets;
+		for (auto digit = 0; digit < digits; digit++) {
+			auto& histogram = histograms[digit];
+			if (histogram[(entries[0].key >> (digit * 8)) & 0xff] == entryCount) continue;
+			uint32_t offset = 0;
+			for (auto i = 0; i < 256; i++) {
+				offsets[i] = offset;
+				offset+= histogram[i];
+			}
+			for (auto& entry: *source) {
+				(*target)[offsets[(entry.key >> (digit * 8)) & 0xff]++] = entry;
+			}
+			auto swap = source;
+			source = target;
+			target = swap;
+		}
+		if (source != &entries) entries.swap(buffer);
+	}
+
+	/**
+	 * Create a key of given float, which preserves the float order when sorting keys as unsigned integers
+	 * @param value value
+	 * @return key
+	 */
+	inline static uint32_t getFloatKey(float value) {
+		uint32_t key;
+		memcpy(&key, &value, sizeof(key));
+		// flip all bits of negative floats, flip sign bit of positive floats
+		return (key & 0x80000000) == 0x80000000?~key:key | 0x80000000;
+	}
+
+};
@@ -9,6 +9,7 @@
 using std::chrono::duration_cast;
 using std::chrono::high_resolution_clock;
 using std::chrono::milliseconds;
+using std::chrono::nanoseconds;
 using std::string;
 
 /**
@@ -32,6 +33,14 @@ public:
 		return high_resolution_clock::now().time_since_epoch() / milliseconds(1);
 	}
 
+	/**
+	 * Retrieve current time in nanoseconds, use only for measuring time differences
+	 * @return int64_t
+	 */
+	inline static int64_t getCurrentNanos() {
+		return high_resolution_clock::now().time_since_epoch() / nanoseconds(1);
+	}
+
 	/**
 	 * Get date/time as string
 	 * @param format format, see strftime
@@ -0,0 +1,384 @@
+#include <tdme/utils/XMLPullParser.h>
+
+#include <stdlib.h>
+#include <string.h>
+
+#include <algorithm>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <tdme/os/filesystem/FileSystem.h>
+#include <tdme/os/filesystem/FileSystemInterface.h>
+#include <tdme/utils/ExceptionBase.h>
+
+using std::min;
+using std::pair;
+using std::string;
+using std::to_string;
+using std::vector;
+
+using tdme::utils::XMLPullParser;
+
+using tdme::os::filesystem::FileSystem;
+using tdme::os::filesystem::FileSystemInterface;
+using tdme::utils::ExceptionBase;
+
+XMLPullParser::XMLPullParser(const string& pathName, const string& fileName, uint64_t offset, uint64_t bytes, uint32_t chunkSize):
+	pathName(pathName),
+	fileName(fileName),
+	chunkSize(chunkSize),
+	chunkOffset(offset),
+	end(bytes > UINT64_MAX - offset?UINT64_MAX:offset + bytes)
+{
+	// parsing starts within text, which is skipped by next() or can be consumed directly
+	textPending = true;
+	textOffset = offset;
+}
+
+bool XMLPullParser::readChunk() {
+	chunkOffset+= chunk.size();
+	chunkPosition = 0;
+	chunk.clear();
+	if (chunkOffset >= end) return false;
+	FileSystem::getInstance()->getContentRange(pathName, fileName, chunkOffset, min(static_cast<uint64_t>(chunkSize), end - chunkOffset), chunk);
+	if (chunk.size() == 0) {
+		end = chunkOffset;
+		return false;
+	}
+	return true;
+}
+
+void XMLPullParser::throwError(const string& message) {
+	throw ExceptionBase("XMLPullParser: " + pathName + "/" + fileName + ": offset " + to_string(getOffset()) + ": " + message);
+}
+
+void XMLPullParser::skipWhiteSpace() {
+	int32_t c;
+	while ((c = peek()) != -1 && isWhiteSpace(c) == true) chunkPosition++;
+}
+
+void XMLPullParser::skipUntil(const char* sequence) {
+	auto sequenceLength = strlen(sequence);
+	auto matched = 0;
+	int32_t c;
+	while ((c = get()) != -1) {
+		if (c == sequence[matched]) {
+			if (++matched == sequenceLength) return;
+		} else {
+			matched = c == sequence[0]?1:0;
+		}
+	}
+	throwError("unexpected end of document, expected '" + string(sequence) + "'");
+}
+
+void XMLPullParser::readName(string& name) {
+	name.clear();
+	int32_t c;
+	while ((c = peek()) != -1 && isWhiteSpace(c) == false && c != '/' && c != '>' && c != '=' && c != '<') {
+		name+= static_cast<char>(c);
+		chunkPosition++;
+	}
+	if (name.empty() == true) throwError("expected name");
+}
+
+void XMLPullParser::readEntity(string& text) {
+	string entity;
+	int32_t c;
+	while ((c = peek()) != -1 && c != ';' && c != '<' && c != '&' && isWhiteSpace(c) == false && entity.size() < 10) {
+		entity+= static_cast<char>(c);
+		chunkPosition++;
+	}
+	if (c != ';') {
+		// not a entity, keep as is
+		text+= "&" + entity;
+		return;
+	}
+	chunkPosition++;
+	if (entity == "lt") text+= '<'; else
+	if (entity == "gt") text+= '>'; else
+	if (entity == "amp") text+= '&'; else
+	if (entity == "quot") text+= '"'; else
+	if (entity == "apos") text+= '\''; else
+	if (entity.size() > 1 && entity[0] == '#') {
+		// character reference, encode as UTF-8
+		auto codePoint = entity[1] == 'x' || entity[1] == 'X'?strtoul(entity.c_str() + 2, nullptr, 16):strtoul(entity.c_str() + 1, nullptr, 10);
+		if (codePoint < 0x80) {
+			text+= static_cast<char>(codePoint);
+		} else
+		if (codePoint < 0x800) {
+			text+= static_cast<char>(0xC0 | (codePoint >> 6));
+			text+= static_cast<char>(0x80 | (codePoint & 0x3F));
+		} else
+		if (codePoint < 0x10000) {
+			text+= static_cast<char>(0xE0 | (codePoint >> 12));
+			text+= static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			text+= static_cast<char>(0x80 | (codePoint & 0x3F));
+		} else {
+			text+= static_cast<char>(0xF0 | ((codePoint >> 18) & 0x07));
+			text+= static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+			text+= static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+			text+= static_cast<char>(0x80 | (codePoint & 0x3F));
+		}
+	} else {
+		text+= "&" + entity + ";";
+	}
+}
+
+void XMLPullParser::skipText() {
+	if (textPending == false) return;
+	textPending = false;
+	if (textCDATA == true) return;
+	while (peek() != -1) {
+		auto begin = chunk.data() + chunkPosition;
+		auto markup = static_cast<const uint8_t*>(memchr(begin, '<', chunk.size() - chunkPosition));
+		if (markup != nullptr) {
+			chunkPosition+= markup - begin;
+			break;
+		}
+		chunkPosition = chunk.size();
+	}
+	textBytes = getOffset() - textOffset;
+}
+
+XMLPullParser::EventType XMLPullParser::next() {
+	// synthesize end element event for empty elements
+	if (emptyElement == true) {
+		emptyElement = false;
+		name = elements.back();
+		elements.pop_back();
+		return EVENTTYPE_END_ELEMENT;
+	}
+	skipText();
+	textCDATA = false;
+	cdata.clear();
+	while (true == true) {
+		skipWhiteSpace();
+		auto c = peek();
+		if (c == -1) {
+			if (elements.empty() == false) throwError("unexpected end of document, expected end of element '" + elements.back() + "'");
+			return EVENTTYPE_END_DOCUMENT;
+		}
+		// text
+		if (c != '<') {
+			textPending = true;
+			textOffset = getOffset();
+			textBytes = 0LL;
+			// ignore text outside of root element
+			if (elements.empty() == true) {
+				skipText();
+				continue;
+			}
+			return EVENTTYPE_TEXT;
+		}
+		chunkPosition++;
+		c = peek();
+		// processing instruction
+		if (c == '?') {
+			skipUntil("?>");
+			continue;
+		}
+		// comment, CDATA or document type declaration
+		if (c == '!') {
+			chunkPosition++;
+			string markup;
+			while (markup.size() < 7 && (c = peek()) != -1 && c != '>') {
+				markup+= static_cast<char>(c);
+				chunkPosition++;
+				if (markup == "--" || markup == "[CDATA[") break;
+			}
+			if (markup == "--") {
+				skipUntil("-->");
+				continue;
+			} else
+			if (markup == "[CDATA[") {
+				textOffset = getOffset();
+				while ((c = get()) != -1) {
+					cdata+= static_cast<char>(c);
+					if (cdata.size() >= 3 && cdata.compare(cdata.size() - 3, 3, "]]>") == 0) break;
+				}
+				if (c == -1) throwError("unexpected end of document, expected ']]>'");
+				cdata.resize(cdata.size() - 3);
+				textBytes = getOffset() - textOffset;
+				if (elements.empty() == true) {
+					cdata.clear();
+					continue;
+				}
+				textPending = true;
+				textCDATA = true;
+				return EVENTTYPE_TEXT;
+			}
+			// document type declaration, which can have a internal subset with brackets
+			auto brackets = 0;
+			for (auto i = 0; i < markup.size(); i++) {
+				if (markup[i] == '[') brackets++; else
+				if (markup[i] == ']') brackets--;
+			}
+			while ((c = get()) != -1 && (c != '>' || brackets > 0)) {
+				if (c == '[') brackets++; else
+				if (c == ']') brackets--;
+			}
+			if (c == -1) throwError("unexpected end of document, expected '>'");
+			continue;
+		}
+		// end element
+		if (c == '/') {
+			chunkPosition++;
+			readName(name);
+			skipWhiteSpace();
+			if (get() != '>') throwError("expected '>' for end of element '" + name + "'");
+			if (elements.empty() == true || elements.back() != name) throwError("unexpected end of element '" + name + "'");
+			elements.pop_back();
+			return EVENTTYPE_END_ELEMENT;
+		}
+		// start element
+		readName(name);
+		attributes.clear();
+		while (true == true) {
+			skipWhiteSpace();
+			c = peek();
+			if (c == '/') {
+				chunkPosition++;
+				if (get() != '>') throwError("expected '>' for empty element '" + name + "'");
+				emptyElement = true;
+				break;
+			} else
+			if (c == '>') {
+				chunkPosition++;
+				break;
+			} else
+			if (c == -1) {
+				throwError("unexpected end of document within element '" + name + "'");
+			}
+			pair<string, string> attribute;
+			readName(attribute.first);
+			skipWhiteSpace();
+			if (get() != '=') throwError("expected '=' for attribute '" + attribute.first + "'");
+			skipWhiteSpace();
+			auto quote = get();
+			if (quote != '"' && quote != '\'') throwError("expected quote for attribute '" + attribute.first + "'");
+			while ((c = get()) != -1 && c != quote) {
+				if (c == '&') {
+					readEntity(attribute.second);
+				} else {
+					attribute.second+= static_cast<char>(c);
+				}
+			}
+			if (c == -1) throwError("unexpected end of document within attribute '" + attribute.first + "'");
+			attributes.push_back(attribute);
+		}
+		elements.push_back(name);
+		return EVENTTYPE_START_ELEMENT;
+	}
+}
+
+bool XMLPullParser::readText(string& text, uint64_t maxLength) {
+	text.clear();
+	if (textPending == false) return true;
+	if (textCDATA == true) {
+		textPending = false;
+		text = cdata;
+		return text.size() <= maxLength;
+	}
+	auto whiteSpace = false;
+	int32_t c;
+	while ((c = peek()) != -1 && c != '<') {
+		if (text.size() > maxLength) {
+			skipText();
+			return false;
+		}
+		chunkPosition++;
+		if (isWhiteSpace(c) == true) {
+			whiteSpace = true;
+		} else {
+			if (whiteSpace == true && text.empty() == false) text+= ' ';
+			whiteSpace = false;
+			if (c == '&') {
+				readEntity(text);
+			} else {
+				text+= static_cast<char>(c);
+			}
+		}
+	}
+	textPending = false;
+	textBytes = getOffset() - textOffset;
+	return text.size() <= maxLength;
+}
+
+bool XMLPullParser::readToken(char (&token)[TOKEN_LENGTH_MAX + 1]) {
+	skipWhiteSpace();
+	auto c = peek();
+	if (c == -1 || c == '<') {
+		textPending = false;
+		textBytes = getOffset() - textOffset;
+		return false;
+	}
+	auto length = 0;
+	while ((c = peek()) != -1 && c != '<' && isWhiteSpace(c) == false) {
+		if (length == TOKEN_LENGTH_MAX) throwError("token too long");
+		token[length++] = static_cast<char>(c);
+		chunkPosition++;
+	}
+	token[length] = 0;
+	return true;
+}
+
+float XMLPullParser::parseFloat(const char* token) {
+	char* tokenEnd;
+	auto value = strtof(token, &tokenEnd);
+	if (tokenEnd == token) throw ExceptionBase("XMLPullParser: invalid float: '" + string(token) + "'");
+	return value;
+}
+
+int32_t XMLPullParser::parseInt(const char* token) {
+	char* tokenEnd;
+	auto value = strtol(token, &tokenEnd, 10);
+	if (tokenEnd == token) throw ExceptionBase("XMLPullParser: invalid integer: '" + string(token) + "'");
+	return static_cast<int32_t>(value);
+}
+
+void XMLPullParser::readFloats(vector<float>& values) {
+	if (textPending == false) return;
+	if (textCDATA == true) {
+		textPending = false;
+		parseFloats(cdata, values);
+		return;
+	}
+	char token[TOKEN_LENGTH_MAX + 1];
+	while (readToken(token) == true) values.push_back(parseFloat(token));
+}
+
+void XMLPullParser::readInts(vector<int32_t>& values) {
+	if (textPending == false) return;
+	if (textCDATA == true) {
+		textPending = false;
+		parseInts(cdata, values);
+		return;
+	}
+	char token[TOKEN_LENGTH_MAX + 1];
+	while (readToken(token) == true) values.push_back(parseInt(token));
+}
+
+void XMLPullParser::parseFloats(const string& text, vector<float>& values) {
+	string token;
+	for (auto i = 0; i <= text.size(); i++) {
+		if (i == text.size() || isWhiteSpace(text[i]) == true) {
+			if (token.empty() == false) values.push_back(parseFloat(token.c_str()));
+			token.clear();
+		} else {
+			token+= text[i];
+		}
+	}
+}
+
+void XMLPullParser::parseInts(const string& text, vector<int32_t>& values) {
+	string token;
+	for (auto i = 0; i <= text.size(); i++) {
+		if (i == text.size() || isWhiteSpace(text[i]) == true) {
+			if (token.empty() == false) values.push_back(parseInt(token.c_str()));
+			token.clear();
+		} else {
+			token+= text[i];
+		}
+	}
+}
@@ -0,0 +1,242 @@
+#pragma once
+
+#include <stdint.h>
+
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <tdme/tdme.h>
+#include <tdme/utils/fwd-tdme.h>
+
+using std::pair;
+using std::string;
+using std::vector;
+
+/**
+ * XML pull parser, which streams a XML file chunk wise from file system instead of loading the whole document into memory
+ * 	Text content can be consumed as string or be parsed directly into numeric buffers
+ * 	Comments, processing instructions and document type declarations are skipped
+ * @author Andreas Drewke
+ * @version $Id$
+ */
+class tdme::utils::XMLPullParser final
+{
+public:
+	enum EventType { EVENTTYPE_START_ELEMENT, EVENTTYPE_END_ELEMENT, EVENTTYPE_TEXT, EVENTTYPE_END_DOCUMENT };
+
+	/**
+	 * Public constructor
+	 * @param pathName path name
+	 * @param fileName file name
+	 * @param offset offset within file to start parsing at
+	 * @param bytes bytes to parse, parsing ends at end of file if range exceeds file
+	 * @param chunkSize chunk size to read from file system at once
+	 */
+	XMLPullParser(const string& pathName, const string& fileName, uint64_t offset = 0LL, uint64_t bytes = UINT64_MAX, uint32_t chunkSize = 1024 * 1024);
+
+	/**
+	 * Parse next event, unconsumed text of current event will be skipped
+	 * @throws tdme::os::filesystem::FileSystemException
+	 * @throws tdme::utils::ExceptionBase
+	 * @return event type
+	 */
+	EventType next();
+
+	/**
+	 * @return element name of current start or end element event
+	 */
+	inline const string& getName() {
+		return name;
+	}
+
+	/**
+	 * @return attributes of current start element event
+	 */
+	inline const vector<pair<string, string>>& getAttributes() {
+		return attributes;
+	}
+
+	/**
+	 * @return element depth, which is 1 for root element start event and 0 for its end event
+	 */
+	inline int32_t getDepth() {
+		return elements.size();
+	}
+
+	/**
+	 * @return file offset of current text
+	 */
+	inline uint64_t getTextOffset() {
+		return textOffset;
+	}
+
+	/**
+	 * @return bytes of current text within file, available after text has been consumed
+	 */
+	inline uint64_t getTextBytes() {
+		return textBytes;
+	}
+
+	/**
+	 * Consume text at current position as string, white space is condensed and entities are decoded
+	 * @param text text
+	 * @param maxLength max length of text to store
+	 * @throws tdme::os::filesystem::FileSystemException
+	 * @return if complete text has been stored into text
+	 */
+	bool readText(string& text, uint64_t maxLength = UINT64_MAX);
+
+	/**
+	 * Consume text at current position as white space separated floats
+	 * @param values values to append floats to
+	 * @throws tdme::os::filesystem::FileSystemException
+	 * @throws tdme::utils::ExceptionBase
+	 */
+	void readFloats(vector<float>& values);
+
+	/**
+	 * Consume text at current position as white space separated integers
+	 * @param values values to append integers to
+	 * @throws tdme::os::filesystem::FileSystemException
+	 * @throws tdme::utils::ExceptionBase
+	 */
+	void readInts(vector<int32_t>& values);
+
+	/**
+	 * Parse white space separated floats from string
+	 * @param text text
+	 * @param values values to append floats to
+	 * @throws tdme::utils::ExceptionBase
+	 */
+	static void parseFloats(const string& text, vector<float>& values);
+
+	/**
+	 * Parse white space separated integers from string
+	 * @param text text
+	 * @param values values to append integers to
+	 * @throws tdme::utils::ExceptionBase
+	 */
+	static void parseInts(const string& text, vector<int32_t>& values);
+
+private:
+	static constexpr int32_t TOKEN_LENGTH_MAX { 64 };
+
+	string pathName;
+	string fileName;
+	uint32_t chunkSize;
+	vector<uint8_t> chunk;
+	uint64_t chunkOffset;
+	uint32_t chunkPosition { 0 };
+	uint64_t end;
+	string name;
+	vector<pair<string, string>> attributes;
+	vector<string> elements;
+	bool emptyElement { false };
+	bool textPending { false };
+	bool textCDATA { false };
+	string cdata;
+	uint64_t textOffset { 0LL };
+	uint64_t textBytes { 0LL };
+
+	/**
+	 * @return file offset of current position
+	 */
+	inline uint64_t getOffset() {
+		return chunkOffset + chunkPosition;
+	}
+
+	/**
+	 * Read next chunk
+	 * @return if there is more data
+	 */
+	bool readChunk();
+
+	/**
+	 * Peek character
+	 * @return character or -1 if end has been reached
+	 */
+	inline int32_t peek() {
+		if (chunkPosition == chunk.size() && readChunk() == false) return -1;
+		return chunk[chunkPosition];
+	}
+
+	/**
+	 * Get character
+	 * @return character or -1 if end has been reached
+	 */
+	inline int32_t get() {
+		if (chunkPosition == chunk.size() && readChunk() == false) return -1;
+		return chunk[chunkPosition++];
+	}
+
+	/**
+	 * Check if given character is white space
+	 * @param c character
+	 * @return if character is white space
+	 */
+	inline static bool isWhiteSpace(int32_t c) {
+		return c == ' ' || c == '\t' || c == '\n' || c == '\r' || c == '\f' || c == '\v';
+	}
+
+	/**
+	 * Skip white space
+	 */
+	void skipWhiteSpace();
+
+	/**
+	 * Skip until given sequence including it
+	 * @param sequence sequence
+	 * @throws tdme::utils::ExceptionBase
+	 */
+	void skipUntil(const char* sequence);
+
+	/**
+	 * Read name
+	 * @param name name
+	 */
+	void readName(string& name);
+
+	/**
+	 * Read entity after ampersand and append its decoded value to text
+	 * @param text text
+	 */
+	void readEntity(string& text);
+
+	/**
+	 * Skip text at current position if not yet consumed
+	 */
+	void skipText();
+
+	/**
+	 * Read next white space separated token of current text
+	 * @param token token buffer
+	 * @return if a token has been read
+	 * @throws tdme::utils::ExceptionBase
+	 */
+	bool readToken(char (&token)[TOKEN_LENGTH_MAX + 1]);
+
+	/**
+	 * Parse float token
+	 * @param token token
+	 * @throws tdme::utils::ExceptionBase
+	 * @return float
+	 */
+	static float parseFloat(const char* token);
+
+	/**
+	 * Parse integer token
+	 * @param token token
+	 * @throws tdme::utils::ExceptionBase
+	 * @return integer
+	 */
+	static int32_t parseInt(const char* token);
+
+	/**
+	 * Throw a parse error
+	 * @param message message
+	 * @throws tdme::utils::ExceptionBase
+	 */
+	void throwError(const string& message);
+
+};
@@ -21,6 +21,7 @@ namespace utils {
 	class PathFindingNode;
 	class PathFindingCustomTest;
 	class Properties;
+	class RadixSort;
 	class ReferenceCounter;
 	class RTTI;
 	class Time;
@@ -29,5 +30,6 @@ namespace utils {
 	class StringUtils;
 	class Console;
 	class ExceptionBase;
+	class XMLPullParser;
 }  // namespace utils
 }  // namespace tdme